@@ -0,0 +1,111 @@
+/*************************************************************************/
+/*************************************************************************/
+/*          Parallel Combined Multiple Recursive Generator               */
+/*                                                                       */
+/* Note: z = x + y * 2^32 (mod 2^64), x is a 64-bit LCG and y is a       */
+/*       multiple recursive generator modulo 2^31 - 1                    */
+/*************************************************************************/
+/*************************************************************************/
+
+
+#include "cmrg.h"
+#include "cmrg_globals.h"
+
+
+GEN_REGISTRY CMRG::CMRG_NGENS;
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+CMRG::CMRG()
+{
+    gentype = GLOBALS_CMRG.GENTYPE;
+    rng_type = SPRNG_CMRG;
+
+    CMRG_NGENS.add(1);
+}
+
+
+/*!
+ *  \brief Destructor
+ */
+CMRG::~CMRG()
+{
+    CMRG_NGENS.add(-1);
+}
+
+
+int CMRG::init_rng(int gn, int tg, int s, int m)
+{ return engine.init_rng(gn, tg, s, m); }
+
+
+int CMRG::pack_size() const
+{ return engine.pack_size(); }
+
+
+/*!
+ *  \brief Pack state into caller buffer, see CMRG_ENGINE::pack_rng().
+ */
+int CMRG::pack_rng(void * const buffer, const int size) const
+{ return engine.pack_rng(buffer, size); }
+
+
+/*!
+ *  \brief Restore state in place, see CMRG_ENGINE::unpack_rng().
+ */
+int CMRG::unpack_rng(const void * const buffer, const int size)
+{ return engine.unpack_rng(buffer, size); }
+
+
+int CMRG::get_rn_int()
+{ return engine.get_rn_int(); }
+
+
+float CMRG::get_rn_flt()
+{ return engine.get_rn_flt(); }
+
+
+double CMRG::get_rn_dbl()
+{ return engine.get_rn_dbl(); }
+
+
+int CMRG::get_seed_rng() const
+{ return engine.get_seed_rng(); }
+
+
+int CMRG::get_ngens() const
+{ return CMRG_NGENS.count(); }
+
+
+#if defined(DEBUG)
+int CMRG::get_prime() const
+{ return engine.get_prime(); }
+
+# if defined(LONG_SPRNG)
+unsigned long int CMRG::get_seed() const
+{ return engine.get_seed(); }
+
+unsigned long int CMRG::get_multiplier() const
+{ return engine.get_multiplier(); }
+
+# else
+int CMRG::get_seed() const
+{ return engine.get_seed(); }
+
+int CMRG::get_multiplier() const
+{ return engine.get_multiplier(); }
+# endif
+#endif
+
+
+/***********************************************************************************
+* SPRNG (c) 2016 by The University of Tennessee, Knoxville                         *
+*                                                                                  *
+* SPRNG is licensed under a                                                        *
+* Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License. *
+*                                                                                  *
+* You should have received a copy of the license along with this                   *
+* work. If not, see <http://creativecommons.org/licenses/by-nc-sa/4.0/>.           *
+************************************************************************************/
+
@@ -0,0 +1,51 @@
+#ifndef __CMRG_H
+#define __CMRG_H
+
+
+#include "sprng.h"
+#include "cmrg_engine.h"
+#include "registry.h"
+
+
+/*! \class CMRG
+ *  \brief Class for combined multiple recursive RNG.
+ *
+ *  Adapter of CMRG_ENGINE for the virtual SPRNG interface.
+ */
+class CMRG: public SPRNG
+{
+    // Number of generators, per-thread counts
+    static GEN_REGISTRY CMRG_NGENS;
+
+  public:
+    CMRG();
+    ~CMRG();
+    int init_rng(int, int, int, int);
+    int get_rn_int();
+    float get_rn_flt();
+    double get_rn_dbl();
+    int get_seed_rng() const;
+    int get_ngens() const;
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    int get_prime() const;
+# if defined(LONG_SPRNG)
+    unsigned long int get_seed() const;
+    unsigned long int get_multiplier() const;
+# else
+    int get_seed() const;
+    int get_multiplier() const;
+# endif
+#endif
+
+  private:
+    const char *gentype;
+    int rng_type;
+    CMRG_ENGINE engine;
+};
+
+
+#endif  // __CMRG_H
+
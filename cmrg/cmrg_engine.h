@@ -0,0 +1,230 @@
+#ifndef __CMRG_ENGINE_H
+#define __CMRG_ENGINE_H
+
+
+#include <stdio.h>
+#include <string.h>  // memcpy
+#include "cmrg_globals.h"
+#include "cmrg_mrg.h"
+#include "cmrg_pack.h"
+#include "lcg64_jump.h"
+#include "primes_64.h"
+
+
+/*! \class CMRG_ENGINE
+ *  \brief Header-only combined multiple recursive RNG.
+ *
+ *  Statically dispatched version of CMRG, z_n = x_n + y_n * 2^32 (mod 2^64),
+ *  where x_n = a * x_{n-1} + p (mod 2^64) is the LCG64 stream of the
+ *  generator number and y_n = 107374182 * y_{n-1} + 104480 * y_{n-5}
+ *  (mod 2^31 - 1) is a multiple recursive generator (see cmrg_mrg.h).
+ *  The CMRG class is a thin adapter for the virtual SPRNG interface.
+ *
+ *  Integers are the high 31-bits of z_n, floating-point numbers are the high
+ *  24 (float) or 53 (double) bits of z_n scaled exactly.
+ */
+class CMRG_ENGINE
+{
+  public:
+    CMRG_ENGINE();
+    int init_rng(int, int, int, int);
+    int get_rn_int();
+    float get_rn_flt();
+    double get_rn_dbl();
+    int get_seed_rng() const;
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    int get_prime() const;
+# if defined(LONG_SPRNG)
+    unsigned long int get_seed() const;
+    unsigned long int get_multiplier() const;
+# else
+    int get_seed() const;
+    int get_multiplier() const;
+# endif
+#endif
+
+  private:
+    int init_seed;
+    unsigned int prime;
+    int prime_position;
+    int prime_next;
+    int parameter;
+    unsigned long int seed;
+    unsigned long int multiplier;
+    unsigned int mrg[CMRG_ORDER];
+    unsigned long int next();
+};
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+inline CMRG_ENGINE::CMRG_ENGINE()
+{
+    init_seed = 0;
+    prime = 0;
+    prime_position = 0;
+    prime_next = 0;
+    parameter = 0;
+    seed = 0;
+    multiplier = 0;
+    memset(mrg, 0, sizeof(mrg));
+}
+
+
+/*!
+ *  \brief Initialize RNG
+ *
+ *  Gives back one generator (node gennum) with updated spawning info.
+ *  Should be called total_gen times, with different value
+ *  of gennum in [0,total_gen) each call.
+ *
+ *  MRG terms are drawn from the initial LCG state, then the LCG component
+ *  is run up as LCG64. This is not the initialization of SPRNG CMRG,
+ *  streams differ from SPRNG (see masprng.h).
+ */
+inline int CMRG_ENGINE::init_rng(int gn, int tg, int s, int m)
+{
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+    prime_next = tg;
+
+    if (gn >= GLOBALS_CMRG.CMRG_MAX_STREAMS)
+        printf("WARNING: generator number (%d) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", gn, GLOBALS_CMRG.CMRG_MAX_STREAMS);
+
+    if (gn < 0 || gn >= tg) {
+        printf("ERROR: generator number is out of range, %d\n", gn);
+        return -1;
+    }
+    prime_position = gn;
+    getprime_64(1, &prime, prime_position);
+
+    if (m < 0 || m >= GLOBALS_CMRG.NPARAMS) {
+        printf("ERROR: multiplier out of range, %d\n", m);
+        m = 0;
+    }
+    parameter = m;
+    init_seed = s & 0x7FFFFFFF;
+    multiplier = GLOBALS_CMRG.MULT[parameter];
+    seed = GLOBALS_CMRG.INIT_SEED ^ (((unsigned long int)init_seed << 33) | (unsigned long int)prime_position);
+    cmrg_mrg_fill(mrg, seed, multiplier, prime);
+
+    unsigned long int A, C;
+    lcg64_jump(&A, &C, multiplier, (unsigned long int)prime, GLOBALS_CMRG.CMRG_RUNUP * (long int)prime_position);
+    seed = lcg64_jump_apply(seed, A, C);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Step both components and return z_n.
+ */
+inline unsigned long int CMRG_ENGINE::next()
+{
+    seed = seed * multiplier + prime;
+
+    return seed + (cmrg_mrg_next(mrg) << 0x20);
+}
+
+
+/*!
+ *  The high 31-bits out of the 64-bits are returned.
+ */
+inline int CMRG_ENGINE::get_rn_int()
+{ return (int)(next() >> 0x21); }
+
+
+inline float CMRG_ENGINE::get_rn_flt()
+{ return (float)(int)(next() >> 0x28) * (float)GLOBALS_CMRG.TWO_M24; }
+
+
+inline double CMRG_ENGINE::get_rn_dbl()
+{ return (double)(next() >> 0xB) * GLOBALS_CMRG.TWO_M53; }
+
+
+/*!
+ *  \brief Size in bytes of packed state.
+ */
+inline int CMRG_ENGINE::pack_size() const
+{ return cmrg_pack_size(1); }
+
+
+/*!
+ *  \brief Pack state into caller buffer (see cmrg_pack.h).
+ *
+ *  Returns number of bytes written or -1 on error.
+ */
+inline int CMRG_ENGINE::pack_rng(void * const buffer, const int size) const
+{
+    const int nbytes = cmrg_pack_check(buffer, size, 1);
+    if (nbytes < 0)
+        return -1;
+
+    const CMRG_PACK_VIEW pack = cmrg_pack_view(buffer, 1);
+    cmrg_pack_header(pack.header, 1, 0, prime_position, prime_next);
+    pack.seed[0] = seed;
+    memcpy(pack.mrg, mrg, sizeof(mrg));
+    pack.init_seed[0] = init_seed;
+    pack.prime[0] = (int32_t)prime;
+    pack.parameter[0] = parameter;
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Restore state in place from packed state (see cmrg_pack.h).
+ *
+ *  Returns number of bytes read or -1 on error, state is not modified on error.
+ */
+inline int CMRG_ENGINE::unpack_rng(const void * const buffer, const int size)
+{
+    if (cmrg_unpack_check(buffer, size, 1) < 0)
+        return -1;
+
+    const CMRG_PACK_VIEW pack = cmrg_pack_view(buffer, 1);
+    prime_position = pack.header->prime_position;
+    prime_next = pack.header->prime_next;
+    init_seed = pack.init_seed[0];
+    prime = (unsigned int)pack.prime[0];
+    parameter = pack.parameter[0];
+    multiplier = GLOBALS_CMRG.MULT[parameter];
+    seed = pack.seed[0];
+    memcpy(mrg, pack.mrg, sizeof(mrg));
+
+    return cmrg_pack_size(1);
+}
+
+
+inline int CMRG_ENGINE::get_seed_rng() const
+{ return init_seed; }
+
+
+#if defined(DEBUG)
+inline int CMRG_ENGINE::get_prime() const
+{ return (int)prime; }
+
+# if defined(LONG_SPRNG)
+inline unsigned long int CMRG_ENGINE::get_seed() const
+{ return seed; }
+
+inline unsigned long int CMRG_ENGINE::get_multiplier() const
+{ return multiplier; }
+
+# else
+inline int CMRG_ENGINE::get_seed() const
+{ return (int)(seed >> 0x21); }
+
+inline int CMRG_ENGINE::get_multiplier() const
+{ return (int)(multiplier >> 0x21); }
+# endif
+#endif
+
+
+#endif  // __CMRG_ENGINE_H
@@ -0,0 +1,58 @@
+#ifndef __CMRG_GLOBALS_H
+#define __CMRG_GLOBALS_H
+
+
+// Provides access to alignment attributes required for SIMD mode.
+// Misalignment may cause segmentation faults.
+#include "simd.h"
+
+
+/*!
+ *  Order of the multiple recursive component, y_n depends on y_{n-1} and y_{n-5}.
+ */
+#define CMRG_ORDER 5
+
+
+/*!
+ *  Global parameters for CMRG
+ *  The 64-bit LCG component uses the multipliers of LCG64, an unsigned long
+ *  int of 64 bits is required (LP64) independently of LONG_SPRNG.
+ *  The MRG component is y_n = A1 * y_{n-1} + A5 * y_{n-5} (mod 2^31 - 1).
+ */
+struct CMRG_GLOBALS
+{
+    const char * GENTYPE;
+    int NPARAMS;
+    unsigned long int INIT_SEED;
+    unsigned long int MULT[3];
+    unsigned long int MRG_A1;
+    unsigned long int MRG_A5;
+    unsigned long int MRG_MOD;
+    double TWO_M24;
+    double TWO_M31;
+    double TWO_M53;
+    int CMRG_RUNUP;
+    int CMRG_MAX_STREAMS;
+} __SIMD_ALIGN__;
+
+
+/*!
+ *  Global instance of configuration structure.
+ */
+const CMRG_GLOBALS GLOBALS_CMRG __SIMD_ALIGN__ = {
+    "Combined Multiple Recursive Generator",
+    3,
+    0x2BC6FFFF8CFE166DUL,
+    {0x27BB2EE687B0B0FDUL, 0x2C6FE96EE78B6955UL, 0x369DEA0F31A53F85UL},
+    107374182UL,
+    104480UL,
+    0x7FFFFFFFUL,
+    5.96046447753906234e-8,
+    4.656612873077392578125e-10,
+    1.1102230246251565404e-16,
+    127,
+    146138719
+};
+
+
+#endif  // __CMRG_GLOBALS_H
@@ -0,0 +1,65 @@
+#ifndef __CMRG_MRG_H
+#define __CMRG_MRG_H
+
+
+#include "cmrg_globals.h"
+
+
+/*
+ *  Multiple recursive component of CMRG, scalar form.
+ *
+ *  State y[0] is the newest term and y[CMRG_ORDER - 1] the oldest, terms
+ *  are in [0, 2^31 - 1). Reduction modulo the Mersenne prime 2^31 - 1 only
+ *  uses masks, shifts, and adds, the same operations are used per lane by
+ *  the SIMD kernels (see vcmrg_kernels.h).
+ */
+
+
+/*!
+ *  \brief Reduce t < 2^62 modulo 2^31 - 1.
+ *
+ *  2^31 = 1 (mod 2^31 - 1), two folds of the high bits leave a value in
+ *  [0, 2^31 - 1] and 2^31 - 1 is mapped to 0 without branches.
+ */
+inline static unsigned long int cmrg_mod(unsigned long int t)
+{
+    t = (t & GLOBALS_CMRG.MRG_MOD) + (t >> 31);
+    t = (t & GLOBALS_CMRG.MRG_MOD) + (t >> 31);
+    return (t + ((t + 1) >> 31)) & GLOBALS_CMRG.MRG_MOD;
+}
+
+
+/*!
+ *  \brief Step MRG once and return the new term.
+ */
+inline static unsigned long int cmrg_mrg_next(unsigned int * const y)
+{
+    const unsigned long int t = cmrg_mod(GLOBALS_CMRG.MRG_A1 * y[0] + GLOBALS_CMRG.MRG_A5 * y[CMRG_ORDER - 1]);
+    for (int i = CMRG_ORDER - 1; i > 0; --i)
+        y[i] = y[i - 1];
+    y[0] = (unsigned int)t;
+    return t;
+}
+
+
+/*!
+ *  \brief Initial terms of MRG from the initial state of the LCG component.
+ *
+ *  Terms are the high 31-bits of successive steps of the LCG (seed is not
+ *  modified), reduced modulo 2^31 - 1. An all-zero state is replaced by
+ *  y[0] = 1 so the period is maximal.
+ */
+inline static void cmrg_mrg_fill(unsigned int * const y, unsigned long int seed, const unsigned long int mult, const unsigned long int prime)
+{
+    unsigned int any = 0;
+    for (int i = CMRG_ORDER - 1; i >= 0; --i) {
+        seed = seed * mult + prime;
+        y[i] = (unsigned int)cmrg_mod(seed >> 0x21);
+        any |= y[i];
+    }
+    if (!any)
+        y[0] = 1;
+}
+
+
+#endif  // __CMRG_MRG_H
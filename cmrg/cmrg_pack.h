@@ -0,0 +1,137 @@
+#ifndef __CMRG_PACK_H
+#define __CMRG_PACK_H
+
+
+#include <stdio.h>   // printf
+#include <stdint.h>  // fixed width integers
+#include "sprng.h"   // SPRNG_CMRG
+#include "pack.h"
+#include "cmrg_globals.h"
+
+
+/*
+ *  Checkpoint format of CMRG and VCMRG (packed state), version 1.
+ *
+ *  Fixed layout in host byte order, independent of SIMD mode and LONG_SPRNG:
+ *
+ *    CMRG_PACK_HEADER           24 bytes
+ *    uint64_t seed[n]           LCG component
+ *    uint32_t mrg[n][5]         MRG component, newest term first
+ *    int32_t init_seed[n]
+ *    int32_t prime[n]
+ *    int32_t parameter[n]       multiplier index
+ *
+ *  for n streams, padded with zeros to a multiple of 8 bytes. Buffers have
+ *  to be 8-byte aligned, packed generators can be placed back to back.
+ *  Multipliers are restored from parameters. A CMRG and a VCMRG with a
+ *  single active stream use the same packed state.
+ */
+const uint32_t CMRG_PACK_MAGIC = 0x524D4353U;  /*!< "SCMR" */
+const uint16_t CMRG_PACK_VERSION = 1;
+
+
+struct CMRG_PACK_HEADER
+{
+    PACK_HEADER base;
+    int32_t per_lane;  /*!< streams use generator numbers prime_position + i */
+    int32_t prime_position;
+    int32_t prime_next;
+};
+
+
+/*!
+ *  Arrays of packed state of n streams.
+ */
+struct CMRG_PACK_VIEW
+{
+    CMRG_PACK_HEADER *header;
+    uint64_t *seed;
+    uint32_t *mrg;
+    int32_t *init_seed;
+    int32_t *prime;
+    int32_t *parameter;
+};
+
+
+/*!
+ *  \brief Size in bytes of packed state of n streams.
+ */
+inline static int cmrg_pack_size(const int n)
+{
+    return pack_align((int)sizeof(CMRG_PACK_HEADER) + n * (int)(sizeof(uint64_t) + CMRG_ORDER * sizeof(uint32_t) + 3 * sizeof(int32_t)));
+}
+
+
+/*!
+ *  \brief Arrays of packed state of n streams in buffer.
+ */
+inline static CMRG_PACK_VIEW cmrg_pack_view(const void * const buffer, const int n)
+{
+    CMRG_PACK_VIEW view;
+    view.header = (CMRG_PACK_HEADER *)buffer;
+    view.seed = (uint64_t *)(view.header + 1);
+    view.mrg = (uint32_t *)(view.seed + n);
+    view.init_seed = (int32_t *)(view.mrg + n * CMRG_ORDER);
+    view.prime = view.init_seed + n;
+    view.parameter = view.prime + n;
+    return view;
+}
+
+
+/*!
+ *  \brief Check buffer for packing n streams, clears padding.
+ *
+ *  Returns packed size or -1 on error.
+ */
+inline static int cmrg_pack_check(void * const buffer, const int size, const int n)
+{
+    return pack_check(buffer, size, cmrg_pack_size(n));
+}
+
+
+/*!
+ *  \brief Check packed state with at most max_streams streams.
+ *
+ *  Parameters and MRG terms of all streams are validated, terms have to be
+ *  in [0, 2^31 - 1) and not all zero.
+ *  Returns number of streams or -1 on error.
+ */
+inline static int cmrg_unpack_check(const void * const buffer, const int size, const int max_streams)
+{
+    const int n = pack_check_header(buffer, size, CMRG_PACK_MAGIC, CMRG_PACK_VERSION, SPRNG_CMRG, max_streams, (int)sizeof(CMRG_PACK_HEADER));
+    if (n < 0 || pack_check_size(size, cmrg_pack_size(n)) < 0)
+        return -1;
+
+    const CMRG_PACK_VIEW pack = cmrg_pack_view(buffer, n);
+    for (int strm = 0; strm < n; ++strm) {
+        const uint32_t * const y = pack.mrg + strm * CMRG_ORDER;
+        uint32_t any = 0;
+        int valid = 1;
+        for (int i = 0; i < CMRG_ORDER; ++i) {
+            any |= y[i];
+            if (y[i] >= GLOBALS_CMRG.MRG_MOD)
+                valid = 0;
+        }
+        if (!any || !valid || pack.parameter[strm] < 0 || pack.parameter[strm] >= GLOBALS_CMRG.NPARAMS) {
+            printf("ERROR: Unpacked parameters not acceptable.\n");
+            return -1;
+        }
+    }
+
+    return n;
+}
+
+
+/*!
+ *  \brief Fill header of packed state.
+ */
+inline static void cmrg_pack_header(CMRG_PACK_HEADER * const header, const int n, const int per_lane, const int prime_position, const int prime_next)
+{
+    pack_header(&header->base, CMRG_PACK_MAGIC, CMRG_PACK_VERSION, SPRNG_CMRG, n);
+    header->per_lane = per_lane;
+    header->prime_position = prime_position;
+    header->prime_next = prime_next;
+}
+
+
+#endif  // __CMRG_PACK_H
@@ -0,0 +1,69 @@
+#ifndef __VCMRG_H
+#define __VCMRG_H
+
+
+#include "simd.h"
+#if defined SIMD_MODE
+
+
+#include "vsprng.h"
+#include "vcmrg_engine.h"
+#include "registry.h"
+
+
+/*! \class VCMRG
+ *  \brief Class for SIMD combined multiple recursive RNG.
+ *
+ *  Adapter of VCMRG_ENGINE for the virtual VSPRNG interface.
+ */
+class VCMRG: public VSPRNG
+{
+    // Number of generators, per-thread counts
+    static GEN_REGISTRY CMRG_NGENS;
+
+  public:
+    VCMRG();
+    ~VCMRG();
+    int init_rng(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int init_rng_lanes(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int reseed_rng(const int * const);
+    int spawn_rng(const int, VSPRNG *** const);
+    SIMD_INT get_rn_int() const;
+    SIMD_FLT get_rn_flt() const;
+    SIMD_DBL get_rn_dbl() const;
+    void get_rn_dbl2(SIMD_DBL * const) const;
+    int get_rn_int_array(int * const, const int) const;
+    int get_rn_flt_array(float * const, const int) const;
+    int get_rn_dbl_array(double * const, const int) const;
+    int get_rn_dbl2_array(double * const, const int) const;
+    int get_rn_int_streams(int * const, const int, const int) const;
+    int get_rn_flt_streams(float * const, const int, const int) const;
+    int get_rn_dbl_streams(double * const, const int, const int) const;
+    int get_stream_stride(const int) const;
+    SIMD_INT get_seed_rng() const;
+    int get_ngens() const;
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    SIMD_INT get_prime() const;
+    SIMD_INT get_seed() const;
+    SIMD_INT get_multiplier() const;
+# if defined(LONG_SPRNG)
+    SIMD_INT get_seed2() const;
+    SIMD_INT get_multiplier2() const;
+# endif
+#endif
+
+  private:
+    const char *gentype;
+    int32_t rng_type;
+    VCMRG_ENGINE *engine;
+};
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VCMRG_H
+
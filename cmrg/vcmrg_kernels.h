@@ -0,0 +1,145 @@
+#ifndef __VCMRG_KERNELS_H
+#define __VCMRG_KERNELS_H
+
+
+#include "simd.h"
+#if defined(SIMD_MODE)
+
+
+#include "cmrg_globals.h"
+
+
+/*
+ *  SIMD kernels for CMRG
+ *
+ *  Same register layout as VLCG64, 64-bit elements in 2 registers, register 0
+ *  holds streams [0, SIMD_STREAMS_64) and register 1 streams
+ *  [SIMD_STREAMS_64, SIMD_STREAMS_32). Register j of the MRG component is
+ *  y[j][0] (newest term) to y[j][CMRG_ORDER - 1] (oldest term).
+ *
+ *  The MRG terms are below 2^31, so the products with A1 and A5 are 32x32
+ *  to 64-bit multiplies (simd_mul_u32) and the reduction modulo 2^31 - 1
+ *  is shifts, masks, and adds per lane, as cmrg_mod().
+ */
+#define VCMRG_REGS 2
+
+
+/*!
+ *  \brief Step both components of a register of streams and return z_n.
+ *
+ *  s, m, p are the LCG seed, multiplier, and prime of the register, y its
+ *  MRG terms.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT vcmrg_step(SIMD_INT * const s, const SIMD_INT m, const SIMD_INT p, SIMD_INT * const y)
+{
+    const SIMD_INT va1 = simd_set(GLOBALS_CMRG.MRG_A1);
+    const SIMD_INT va5 = simd_set(GLOBALS_CMRG.MRG_A5);
+    const SIMD_INT vmod = simd_set(GLOBALS_CMRG.MRG_MOD);
+    const SIMD_INT vone = simd_set(0x1UL);
+
+    // LCG, wraparound modulo 2^64
+    *s = simd_add_i64(simd_mul_u64(*s, m), p);
+
+    // MRG, t < 2^59 is folded twice and 2^31 - 1 is mapped to 0
+    SIMD_INT vt = simd_add_i64(simd_mul_u32(y[0], va1), simd_mul_u32(y[CMRG_ORDER - 1], va5));
+    vt = simd_add_i64(simd_and(vt, vmod), simd_srl_64(vt, 0x1F));
+    vt = simd_add_i64(simd_and(vt, vmod), simd_srl_64(vt, 0x1F));
+    vt = simd_and(simd_add_i64(vt, simd_srl_64(simd_add_i64(vt, vone), 0x1F)), vmod);
+
+    for (int i = CMRG_ORDER - 1; i > 0; --i)
+        y[i] = y[i - 1];
+    y[0] = vt;
+
+    return simd_add_i64(*s, simd_sll_64(vt, 0x20));
+}
+
+
+/*!
+ *  \brief Step streams once and return integer random numbers.
+ *
+ *  The high 31-bits out of the 64-bits are returned.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT vcmrg_next_int(SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p, SIMD_INT (* const y)[CMRG_ORDER])
+{
+    const SIMD_INT vz0 = vcmrg_step(&s[0], m[0], p[0], y[0]);
+    const SIMD_INT vz1 = vcmrg_step(&s[1], m[1], p[1], y[1]);
+
+    return simd_packmerge_i32(simd_srl_64(vz0, 0x21), simd_srl_64(vz1, 0x21));
+}
+
+
+/*!
+ *  \brief Step streams once and return single-precision random numbers.
+ *
+ *  The high 24-bits out of the 64-bits are scaled by 2^-24.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_FLT vcmrg_next_flt(SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p, SIMD_INT (* const y)[CMRG_ORDER])
+{
+    const SIMD_FLT vfac = simd_set((float)GLOBALS_CMRG.TWO_M24);
+
+    const SIMD_INT vz0 = vcmrg_step(&s[0], m[0], p[0], y[0]);
+    const SIMD_INT vz1 = vcmrg_step(&s[1], m[1], p[1], y[1]);
+
+    const SIMD_FLT vrn = simd_cvt_i32_f32(simd_packmerge_i32(simd_srl_64(vz0, 0x28), simd_srl_64(vz1, 0x28)));
+    return simd_mul(vrn, vfac);
+}
+
+
+/*!
+ *  \brief Step streams [0, SIMD_STREAMS_64) once and return double-precision random numbers.
+ *
+ *  The high 53-bits out of the 64-bits are scaled by 2^-53, as the sum
+ *  of the high 31-bits and the next 22-bits (see vlcg64_next_dbl()).
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL vcmrg_next_dbl(SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p, SIMD_INT (* const y)[CMRG_ORDER])
+{
+    const SIMD_DBL vfac[2] __SIMD_ALIGN__ = { simd_set(GLOBALS_CMRG.TWO_M31),
+                                              simd_set(GLOBALS_CMRG.TWO_M53) };
+    const SIMD_INT vmsk_lsb22 = simd_set(0x3FFFFFUL);
+
+    const SIMD_INT vz = vcmrg_step(&s[0], m[0], p[0], y[0]);
+
+    // High parts in low half, low parts in high half
+    const SIMD_INT vrn = simd_packmerge_i32(simd_srl_64(vz, 0x21), simd_and(simd_srl_64(vz, 0xB), vmsk_lsb22));
+    const SIMD_DBL vhi = simd_mul(simd_cvt_i32_f64(vrn), vfac[0]);
+    return simd_fmadd(simd_cvt_i32_f64_hi(vrn), vfac[1], vhi);
+}
+
+
+/*!
+ *  \brief Step all streams once and return double-precision random numbers.
+ *
+ *  rn[0] holds streams [0, SIMD_STREAMS_64), identical to vcmrg_next_dbl(),
+ *  rn[1] holds streams [SIMD_STREAMS_64, SIMD_STREAMS_32).
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void vcmrg_next_dbl2(SIMD_DBL * const rn, SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p, SIMD_INT (* const y)[CMRG_ORDER])
+{
+    const SIMD_DBL vfac[2] __SIMD_ALIGN__ = { simd_set(GLOBALS_CMRG.TWO_M31),
+                                              simd_set(GLOBALS_CMRG.TWO_M53) };
+    const SIMD_INT vmsk_lsb22 = simd_set(0x3FFFFFUL);
+    SIMD_INT vtmp[2] __SIMD_ALIGN__;
+
+    const SIMD_INT vz0 = vcmrg_step(&s[0], m[0], p[0], y[0]);
+    const SIMD_INT vz1 = vcmrg_step(&s[1], m[1], p[1], y[1]);
+
+    // High and low parts of all streams
+    vtmp[0] = simd_packmerge_i32(simd_srl_64(vz0, 0x21), simd_srl_64(vz1, 0x21));
+    vtmp[1] = simd_packmerge_i32(simd_and(simd_srl_64(vz0, 0xB), vmsk_lsb22),
+                                 simd_and(simd_srl_64(vz1, 0xB), vmsk_lsb22));
+
+    rn[0] = simd_mul(simd_cvt_i32_f64(vtmp[0]), vfac[0]);
+    rn[1] = simd_mul(simd_cvt_i32_f64_hi(vtmp[0]), vfac[0]);
+    rn[0] = simd_fmadd(simd_cvt_i32_f64(vtmp[1]), vfac[1], rn[0]);
+    rn[1] = simd_fmadd(simd_cvt_i32_f64_hi(vtmp[1]), vfac[1], rn[1]);
+}
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VCMRG_KERNELS_H
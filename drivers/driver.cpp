@@ -1,12 +1,17 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <float.h>
+#include <pthread.h>
+#include <new>
 #include "masprng.h"
 #include "timers.h"
 #include "utils.h"
 #include "vutils.h"
 #include "check.h"
+#include "primes_64.h"
+#include "store.h"
 
 
 #if defined(DEBUG)
@@ -20,35 +25,173 @@
 #define RNG_TYPE_NUM SPRNG_LCG
 #define TEST 1
 
+// Number of register sets for multiple register sets engine (2, 4, 8)
+#define ILP_SETS 4
+
 
 #if TEST == 0
 #define RNG_TYPE_STR "Integer"
 #define RNG_TYPE int
 #define get_rn() get_rn_int()
+#define get_rn_array(a,n) get_rn_int_array(a,n)
+#define get_rn_all_array(a,n) get_rn_int_array(a,n)
+#define get_rn_streams(a,n,s) get_rn_int_streams(a,n,s)
 #define VRNG_TYPE SIMD_INT
 #define RNG_FMT "%d"
 #define RNG_ELEMS SIMD_STREAMS_32
+#define get_nstreams() get_nstreams_32()
 #define RNG_NEQ(a,b) (a != b)
 #elif TEST == 1
 #define RNG_TYPE_STR "Float"
 #define RNG_TYPE float
 #define get_rn() get_rn_flt()
+#define get_rn_array(a,n) get_rn_flt_array(a,n)
+#define get_rn_all_array(a,n) get_rn_flt_array(a,n)
+#define get_rn_streams(a,n,s) get_rn_flt_streams(a,n,s)
 #define VRNG_TYPE SIMD_FLT
 #define RNG_FMT "%f"
 #define RNG_ELEMS SIMD_STREAMS_32
+#define get_nstreams() get_nstreams_32()
 #define RNG_NEQ(a,b) (fabs(a-b) > FLT_EPSILON)
 #else
 #define RNG_TYPE_STR "Double"
 #define RNG_TYPE double
 #define get_rn() get_rn_dbl()
+#define get_rn_array(a,n) get_rn_dbl_array(a,n)
+#define get_rn_all_array(a,n) get_rn_dbl2_array(a,n)
+#define get_rn_streams(a,n,s) get_rn_dbl_streams(a,n,s)
 #define VRNG_TYPE SIMD_DBL
 #define RNG_FMT "%f"
 #define RNG_ELEMS SIMD_STREAMS_64
+#define get_nstreams() get_nstreams_64()
 #define RNG_NEQ(a,b) (fabs(a-b) > DBL_EPSILON)
 #endif
 
 
 int main_gen(int);
+int main_lcg64(int);
+int main_lfg(int);
+int main_cmrg(int);
+int main_mlfg(int);
+int main_pmlcg(int);
+
+
+// Generators created by each thread in generator creation benchmark
+#define NGENS_THREAD 10000
+
+// Generators initialized by concurrent initialization stress test
+#define NGENS_STRESS 4096
+
+struct STRESS_ARGS
+{
+    int tid;
+    int nthreads;
+    int *rn;
+};
+
+
+/*
+ *  Initialize an interleaved subset of generators, generator numbers are spread
+ *  over [0, LCG_MAX_STREAMS) so that threads search primes concurrently.
+ */
+void * init_gens(void *ptr)
+{
+    STRESS_ARGS * const args = (STRESS_ARGS *)ptr;
+    const int step = GLOBALS.LCG_MAX_STREAMS / NGENS_STRESS;
+
+    for (int i = args->tid; i < NGENS_STRESS; i += args->nthreads) {
+        LCG_ENGINE eng;
+        eng.init_rng(i * step, GLOBALS.LCG_MAX_STREAMS, 985456376, i % 7);
+        args->rn[i] = eng.get_rn_int();
+    }
+
+    return NULL;
+}
+
+
+// Streams initialized by batch initialization benchmark, and sampled per-object initializations
+#define INIT_STREAMS (1 << 20)
+#define INIT_SAMPLES 1024
+
+// Generators spawned by spawning benchmark
+#define NSPAWN 1000
+
+// Reseeds per sample in reseed benchmark
+#define NRESEED 100000
+
+// Offsets sampled by 64 bit prime search benchmark
+#define PRIME64_SAMPLES 16
+
+// Streams packed by checkpoint benchmark
+#define CKPT_STREAMS (1 << 20)
+
+// Words converted by store/load benchmark
+#define STORE_WORDS (1 << 22)
+
+// Numbers per type generated by 64 bit LCG throughput benchmark, as time_lcg64
+#define LCG64_TRIAL_SIZE 1000000
+
+// Numbers per type generated by lagged Fibonacci throughput benchmark
+#define LFG_TRIAL_SIZE (1 << 14)
+#define LFG_TRIAL_REPS 256
+#define CMRG_TRIAL_SIZE 1000000
+#define MLFG_TRIAL_SIZE (1 << 14)
+#define MLFG_TRIAL_REPS 256
+#define PMLCG_TRIAL_SIZE 1000000
+
+
+/*
+ *  Store/load numbers with a loop per byte, reference for store/load routines.
+ */
+int store_long_bytes(const unsigned long int * const l, const int n, const int nbytes, unsigned char * const c)
+{
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < nbytes; ++j)
+            c[nbytes * i + j] = (l[i] >> (8 * (nbytes - j - 1))) & 0xFF;
+    return nbytes * n;
+}
+
+
+int load_long_bytes(const unsigned char * const c, const int n, const int nbytes, unsigned long int * const l)
+{
+    for (int i = 0; i < n; ++i) {
+        l[i] = 0;
+        for (int j = 0; j < nbytes; ++j)
+            l[i] = (l[i] << 8) + (c[nbytes * i + j] & 0xFF);
+    }
+    return nbytes * n;
+}
+
+struct NGENS_ARGS
+{
+    pthread_barrier_t *barrier;
+    int tid;
+    int ngens;
+};
+
+
+/*
+ *  Create generators, count all generators while these are alive, then destroy them.
+ */
+void * create_gens(void *ptr)
+{
+    NGENS_ARGS * const args = (NGENS_ARGS *)ptr;
+    SPRNG **gens = new SPRNG*[NGENS_THREAD];
+
+    for (int i = 0; i < NGENS_THREAD; ++i)
+        gens[i] = selectType(RNG_TYPE_NUM);
+
+    pthread_barrier_wait(args->barrier);
+    if (args->tid == 0)
+        args->ngens = gens[0]->get_ngens();
+    pthread_barrier_wait(args->barrier);
+
+    for (int i = 0; i < NGENS_THREAD; ++i)
+        delete gens[i];
+    delete [] gens;
+
+    return NULL;
+}
 
 
 int main(int argc, char *argv[])
@@ -64,10 +207,25 @@ int main(int argc, char *argv[])
     if (argc > 1)
         rng_lim = atoi(argv[1]);
 
+    // Generator type checked against SPRNG data (e.g. ./rng 0 2 < lcg64.data)
+    int rng_type = RNG_TYPE_NUM;
+    if (argc > 2)
+        rng_type = atoi(argv[2]);
+
     if (rng_lim > 0) {
         retval = main_gen(rng_lim);
+        if (!retval)
+            retval = main_lcg64(rng_lim);
+        if (!retval)
+            retval = main_lfg(rng_lim);
+        if (!retval)
+            retval = main_cmrg(rng_lim);
+        if (!retval)
+            retval = main_mlfg(rng_lim);
+        if (!retval)
+            retval = main_pmlcg(rng_lim);
     } else {
-        retval = check_gen(RNG_TYPE_NUM);
+        retval = check_gen(rng_type);
     }
 
 	if (retval)
@@ -112,7 +270,7 @@ int main_gen(int rng_lim)
 #endif
 
     // Integer/float/double
-    RNG_TYPE rngs[RNG_ELEMS];
+    RNG_TYPE rngs[RNG_ELEMS] = { 0 };
 
     // RNG object
     SPRNG *rng[RNG_ELEMS];
@@ -153,6 +311,42 @@ int main_gen(int rng_lim)
 #endif
     printf("\n");
 
+    // Scalar devirtualized engine
+    double t1e;
+    RNG_TYPE rngs1e[RNG_ELEMS] = { 0 };
+    LCG_ENGINE eng[RNG_ELEMS];
+    for (i = 0; i < RNG_ELEMS; ++i)
+        eng[i].init_rng(0, 1, iseeds[i], m[i]);
+
+    // Run kernel
+    startTime(timers);
+    for (i = 0; i < rng_lim; ++i)
+        for (j = 0; j < RNG_ELEMS; ++j)
+            rngs1e[j] = eng[j].get_rn();
+    t1e = stopTime(timers);
+
+    // Print results
+    printf("Scalar engine real time = %.16f sec\n", t1e);
+    if (t1e > 0)
+        printf("speedup = scalar/engine = %g\n", t1 / t1e);
+    else
+        printf("invalid speedup = %g/%g\n", t1, t1e);
+
+    // Validate run, engine has to match virtual interface
+    int valid = 1;
+    for (i = 0; i < RNG_ELEMS; ++i) {
+        if (RNG_NEQ(rngs[i], rngs1e[i])) {
+            valid = 0;
+            break;
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: " RNG_TYPE_STR " engine generator passed the reproducibility test.\n");
+    else
+        printf("FAILED: " RNG_TYPE_STR " engine generator does not reproduce correct stream.\n");
+    printf("\n");
+
 
     // SIMD
 #if defined(SIMD_MODE)
@@ -172,6 +366,7 @@ int main_gen(int rng_lim)
     // Integer/float/double
     RNG_TYPE rngs2[nstrms];
     VRNG_TYPE vrngs;
+    simd_set_zero(&vrngs);
 
     // RNG object
     VSPRNG *vrng = selectTypeSIMD(RNG_TYPE_NUM);
@@ -217,7 +412,7 @@ int main_gen(int rng_lim)
         printf("invalid speedup = %g/%g\n", t1, t2);
 
     // Validate run
-    int valid = 1;
+    valid = 1;
     for (i = 0; i < RNG_ELEMS; ++i) {
 # if defined(DEBUG)
         if (RNG_NEQ(rngs[i], rngs2[i]) || RNG_NEQ(seeds[i], seeds2[i])) {
@@ -235,14 +430,1792 @@ int main_gen(int rng_lim)
         printf("FAILED: " RNG_TYPE_STR " generator does not reproduce correct stream.\n");
     printf("\n");
 
+    // Vector devirtualized engine (aligned on stack)
+    double t2e;
+    RNG_TYPE rngs2e[nstrms];
+    VRNG_TYPE vrngs2e;
+    simd_set_zero(&vrngs2e);
+    VLCG_ENGINE veng;
+    veng.init_rng(0, 1, iseeds, m, nstrms);
+
+    // Run kernel
+    startTime(timers);
+    for (i = 0; i < rng_lim; ++i)
+        vrngs2e = veng.get_rn();
+    t2e = stopTime(timers);
+
+    // Print results
+    simd_storeu(rngs2e, vrngs2e);
+    printf("Vector engine real time = %.16f sec\n", t2e);
+    if (t2e > 0)
+        printf("speedup = vector/engine = %g\n", t2 / t2e);
+    else
+        printf("invalid speedup = %g/%g\n", t2, t2e);
+
+    // Validate run, engine has to match virtual interface
+    valid = 1;
+    for (i = 0; i < RNG_ELEMS; ++i) {
+        if (RNG_NEQ(rngs2[i], rngs2e[i])) {
+            valid = 0;
+            break;
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: " RNG_TYPE_STR " vector engine generator passed the reproducibility test.\n");
+    else
+        printf("FAILED: " RNG_TYPE_STR " vector engine generator does not reproduce correct stream.\n");
+    printf("\n");
+
+    // Bulk array interface
+    double t3;
+    RNG_TYPE *rngs3 = NULL;
+    scalar_malloc(&rngs3, SIMD_WIDTH_BYTES, rng_lim * RNG_ELEMS);
+    memset(rngs3, 0, rng_lim * RNG_ELEMS * sizeof(RNG_TYPE));  // first touch
+
+    // RNG object
+    VSPRNG *vrng2 = selectTypeSIMD(RNG_TYPE_NUM);
+    if (!vrng2)
+        return -1;
+    vrng2->init_rng(0, 1, iseeds, m, nstrms);
+
+    // Run kernel
+    startTime(timers);
+    vrng2->get_rn_array(rngs3, rng_lim * RNG_ELEMS);
+    t3 = stopTime(timers);
+
+    // Print results
+    printf("Vector array real time = %.16f sec\n", t3);
+    const VLCG * const vlcg2 = dynamic_cast<const VLCG *>(vrng2);
+    if (vlcg2)
+        printf("Vector array SIMD mode = %s\n", vlcg2->get_isa());
+    for (i = 0; i < RNG_ELEMS; ++i)
+        printf("array = " RNG_FMT "\n", rngs3[(rng_lim - 1) * RNG_ELEMS + i]);
+    printf("\n");
+
+    if (t3 > 0)
+        printf("speedup = vector/array = %g\n", t2 / t3);
+    else
+        printf("invalid speedup = %g/%g\n", t2, t3);
+
+    // Validate run, last register of array has to match per-call interface
+    valid = 1;
+    for (i = 0; i < RNG_ELEMS; ++i) {
+        if (RNG_NEQ(rngs2[i], rngs3[(rng_lim - 1) * RNG_ELEMS + i])) {
+            valid = 0;
+            break;
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: " RNG_TYPE_STR " array generator passed the reproducibility test.\n");
+    else
+        printf("FAILED: " RNG_TYPE_STR " array generator does not reproduce correct stream.\n");
+    printf("\n");
+
+#if TEST == 2
+    // Paired double interface, all SIMD_STREAMS_32 streams are used
+    double t3d;
+    double *rngs3d = NULL;
+    scalar_malloc(&rngs3d, SIMD_WIDTH_BYTES, rng_lim * nstrms);
+    memset(rngs3d, 0, rng_lim * nstrms * sizeof(double));  // first touch
+
+    // RNG object
+    VSPRNG *vrng2d = selectTypeSIMD(RNG_TYPE_NUM);
+    if (!vrng2d)
+        return -1;
+    vrng2d->init_rng(0, 1, iseeds, m, nstrms);
+
+    // Run kernel
+    startTime(timers);
+    vrng2d->get_rn_dbl2_array(rngs3d, rng_lim * nstrms);
+    t3d = stopTime(timers);
+
+    // Print results
+    printf("Vector paired array real time = %.16f sec\n", t3d);
+    for (i = 0; i < nstrms; ++i)
+        printf("paired = " RNG_FMT "\n", rngs3d[(rng_lim - 1) * nstrms + i]);
+    printf("\n");
+
+    // Throughput per random number
+    if (t3d > 0)
+        printf("speedup = array/paired = %g\n", (t3 / RNG_ELEMS) / (t3d / nstrms));
+    else
+        printf("invalid speedup = %g/%g\n", t3, t3d);
+
+    // Validate run, low half has to match array interface, high half scalar streams
+    valid = 1;
+    for (i = 0; i < RNG_ELEMS; ++i) {
+        if (RNG_NEQ(rngs3[(rng_lim - 1) * RNG_ELEMS + i], rngs3d[(rng_lim - 1) * nstrms + i])) {
+            valid = 0;
+            break;
+        }
+    }
+    for (i = RNG_ELEMS; i < nstrms; ++i) {
+        LCG_ENGINE engd;
+        double rnd = 0.0;
+        engd.init_rng(0, 1, iseeds[i], m[i]);
+        for (j = 0; j < rng_lim; ++j)
+            rnd = engd.get_rn_dbl();
+        if (RNG_NEQ(rnd, rngs3d[(rng_lim - 1) * nstrms + i])) {
+            valid = 0;
+            break;
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: " RNG_TYPE_STR " paired array generator passed the reproducibility test.\n");
+    else
+        printf("FAILED: " RNG_TYPE_STR " paired array generator does not reproduce correct stream.\n");
+    printf("\n");
+
+    scalar_free(&rngs3d);
+    delete vrng2d;
+#endif
+
+    // Stream-major layout, all SIMD_STREAMS_32 streams are used
+    double t6[2];
+    VSPRNG *vrng6 = selectTypeSIMD(RNG_TYPE_NUM);
+    if (!vrng6)
+        return -1;
+    const int stride6 = vrng6->get_stream_stride(rng_lim);
+
+    RNG_TYPE *rngs6 = NULL;   // interleaved streams
+    RNG_TYPE *rngs6s = NULL;  // user-side scatter
+    RNG_TYPE *rngs6t = NULL;  // transposed in registers
+    scalar_malloc(&rngs6, SIMD_WIDTH_BYTES, rng_lim * nstrms);
+    scalar_malloc(&rngs6s, SIMD_WIDTH_BYTES, stride6 * nstrms);
+    scalar_malloc(&rngs6t, SIMD_WIDTH_BYTES, stride6 * nstrms);
+    memset(rngs6, 0, rng_lim * nstrms * sizeof(RNG_TYPE));  // first touch
+    memset(rngs6s, 0, stride6 * nstrms * sizeof(RNG_TYPE));
+    memset(rngs6t, 0, stride6 * nstrms * sizeof(RNG_TYPE));
+
+    // Run kernel, interleaved array then scatter each stream
+    vrng6->init_rng(0, 1, iseeds, m, nstrms);
+    startTime(timers);
+    vrng6->get_rn_all_array(rngs6, rng_lim * nstrms);
+    for (j = 0; j < rng_lim; ++j)
+        for (i = 0; i < nstrms; ++i)
+            rngs6s[i * stride6 + j] = rngs6[j * nstrms + i];
+    t6[0] = stopTime(timers);
+
+    // Run kernel, stream-major array
+    vrng6->init_rng(0, 1, iseeds, m, nstrms);
+    startTime(timers);
+    vrng6->get_rn_streams(rngs6t, rng_lim, stride6);
+    t6[1] = stopTime(timers);
+
+    // Print results
+    printf("Vector scatter real time = %.16f sec\n", t6[0]);
+    printf("Vector streams real time = %.16f sec\n", t6[1]);
+    for (i = 0; i < nstrms; ++i)
+        printf("streams = " RNG_FMT "\n", rngs6t[i * stride6 + rng_lim - 1]);
+    printf("\n");
+
+    if (t6[1] > 0)
+        printf("speedup = scatter/streams = %g\n", t6[0] / t6[1]);
+    else
+        printf("invalid speedup = %g/%g\n", t6[0], t6[1]);
+
+    // Validate run, streams have to match scattered interleaved array
+    valid = 1;
+    for (i = 0; i < nstrms && valid; ++i) {
+        for (j = 0; j < rng_lim; ++j) {
+            if (RNG_NEQ(rngs6s[i * stride6 + j], rngs6t[i * stride6 + j])) {
+                valid = 0;
+                break;
+            }
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: " RNG_TYPE_STR " streams generator passed the reproducibility test.\n");
+    else
+        printf("FAILED: " RNG_TYPE_STR " streams generator does not reproduce correct stream.\n");
+    printf("\n");
+
+    scalar_free(&rngs6t);
+    scalar_free(&rngs6s);
+    scalar_free(&rngs6);
+    delete vrng6;
+
+    // One generator number per stream, stream i is generator gn7 + i
+    double t12[2];
+    const int gn7 = 5;
+    const int tg7 = gn7 + nstrms;
+    RNG_TYPE *rngs7 = NULL;   // scalar generators
+    RNG_TYPE *rngs7v = NULL;  // vector generator
+    scalar_malloc(&rngs7, SIMD_WIDTH_BYTES, rng_lim * RNG_ELEMS);
+    scalar_malloc(&rngs7v, SIMD_WIDTH_BYTES, rng_lim * RNG_ELEMS);
+    memset(rngs7, 0, rng_lim * RNG_ELEMS * sizeof(RNG_TYPE));  // first touch
+    memset(rngs7v, 0, rng_lim * RNG_ELEMS * sizeof(RNG_TYPE));
+
+    // Run kernel, scalar objects
+    SPRNG *rng7[RNG_ELEMS];
+    startTime(timers);
+    for (i = 0; i < RNG_ELEMS; ++i) {
+        rng7[i] = selectType(RNG_TYPE_NUM);
+        if (!rng7[i])
+            return -1;
+        rng7[i]->init_rng(gn7 + i, tg7, iseeds[i], m[i]);
+    }
+    for (j = 0; j < rng_lim; ++j)
+        for (i = 0; i < RNG_ELEMS; ++i)
+            rngs7[j * RNG_ELEMS + i] = rng7[i]->get_rn();
+    t12[0] = stopTime(timers);
+
+    // Run kernel, vector object
+    VSPRNG *vrng7 = selectTypeSIMD(RNG_TYPE_NUM);
+    if (!vrng7)
+        return -1;
+    startTime(timers);
+    vrng7->init_rng_lanes(gn7, tg7, iseeds, m, nstrms);
+    vrng7->get_rn_array(rngs7v, rng_lim * RNG_ELEMS);
+    t12[1] = stopTime(timers);
+
+    // Print results
+    printf("Scalar generators real time = %.16f sec\n", t12[0]);
+    printf("Vector generators real time = %.16f sec\n", t12[1]);
+    for (i = 0; i < RNG_ELEMS; ++i)
+        printf("lanes = " RNG_FMT "\n", rngs7v[(rng_lim - 1) * RNG_ELEMS + i]);
+    printf("\n");
+
+    if (t12[1] > 0)
+        printf("speedup = scalar/lanes = %g\n", t12[0] / t12[1]);
+    else
+        printf("invalid speedup = %g/%g\n", t12[0], t12[1]);
+
+    // Validate run, stream i has to match scalar generator gn7 + i
+    valid = 1;
+    for (i = 0; i < rng_lim * RNG_ELEMS; ++i) {
+        if (RNG_NEQ(rngs7[i], rngs7v[i])) {
+            valid = 0;
+            break;
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: " RNG_TYPE_STR " per-stream generators passed the reproducibility test.\n");
+    else
+        printf("FAILED: " RNG_TYPE_STR " per-stream generators do not reproduce correct stream.\n");
+    printf("\n");
+
+    for (i = 0; i < RNG_ELEMS; ++i)
+        delete rng7[i];
+    delete vrng7;
+    scalar_free(&rngs7v);
+    scalar_free(&rngs7);
+
+    // Spawning, mode 0 uses one generator number per object, mode 1 one per stream
+    for (int mode = 0; mode < 2; ++mode) {
+        double t13[2];
+        const int gn13 = (mode) ? 0 : 1;
+        const int tg13 = (mode) ? 2 * nstrms : 3;
+        VRNG_TYPE vrngs13[2];
+
+        // Run kernel, initialize each child generator
+        VSPRNG **gens13 = new VSPRNG*[NSPAWN];
+        startTime(timers);
+        for (i = 0; i < NSPAWN; ++i) {
+            const int gn = gn13 + tg13 * (i + 1);
+            gens13[i] = selectTypeSIMD(RNG_TYPE_NUM);
+            if (mode)
+                gens13[i]->init_rng_lanes(gn, gn + nstrms, iseeds, m, nstrms);
+            else
+                gens13[i]->init_rng(gn, gn + 1, iseeds, m, nstrms);
+        }
+        t13[0] = stopTime(timers);
+
+        // Run kernel, spawn children
+        VSPRNG *vrng13 = selectTypeSIMD(RNG_TYPE_NUM);
+        VSPRNG **kids13 = NULL;
+        if (mode)
+            vrng13->init_rng_lanes(gn13, tg13, iseeds, m, nstrms);
+        else
+            vrng13->init_rng(gn13, tg13, iseeds, m, nstrms);
+        startTime(timers);
+        const int nspawn = vrng13->spawn_rng(NSPAWN, &kids13);
+        t13[1] = stopTime(timers);
+
+        // Spawn children into contiguous array of engines
+        VLCG_ENGINE veng13;
+        VLCG_ENGINE *engs13 = NULL;
+        if (posix_memalign((void **)&engs13, SIMD_WIDTH_BYTES, NSPAWN * sizeof(VLCG_ENGINE)))
+            return -1;
+        for (i = 0; i < NSPAWN; ++i)
+            new (engs13 + i) VLCG_ENGINE();
+        if (mode)
+            veng13.init_rng_lanes(gn13, tg13, iseeds, m, nstrms);
+        else
+            veng13.init_rng(gn13, tg13, iseeds, m, nstrms);
+        veng13.spawn_rng(NSPAWN, engs13);
+
+        // Print results
+        printf("Vector init children (%s) real time = %.16f sec\n", (mode) ? "lanes" : "object", t13[0]);
+        printf("Vector spawn children (%s) real time = %.16f sec\n", (mode) ? "lanes" : "object", t13[1]);
+        if (t13[1] > 0)
+            printf("speedup = init/spawn = %g\n", t13[0] / t13[1]);
+        else
+            printf("invalid speedup = %g/%g\n", t13[0], t13[1]);
+
+        // Validate run, children have to match initialized generators
+        valid = (nspawn == NSPAWN);
+        for (i = 0; i < NSPAWN && valid; ++i) {
+            RNG_TYPE rn13[3][RNG_ELEMS];
+            for (j = 0; j < rng_lim; ++j) {
+                vrngs13[0] = gens13[i]->get_rn();
+                vrngs13[1] = kids13[i]->get_rn();
+                simd_storeu(rn13[0], vrngs13[0]);
+                simd_storeu(rn13[1], vrngs13[1]);
+                simd_storeu(rn13[2], engs13[i].get_rn());
+                for (int k = 0; k < RNG_ELEMS; ++k) {
+                    if (RNG_NEQ(rn13[0][k], rn13[1][k]) || RNG_NEQ(rn13[0][k], rn13[2][k])) {
+                        valid = 0;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (valid > 0)
+            printf("PASSED: " RNG_TYPE_STR " spawned generators passed the reproducibility test.\n");
+        else
+            printf("FAILED: " RNG_TYPE_STR " spawned generators do not reproduce correct stream.\n");
+        printf("\n");
+
+        for (i = 0; i < NSPAWN; ++i) {
+            engs13[i].~VLCG_ENGINE();
+            if (kids13)
+                delete kids13[i];
+            delete gens13[i];
+        }
+        free(engs13);
+        delete [] kids13;
+        delete [] gens13;
+        delete vrng13;
+    }
+
+    // Reseed an existing generator per sample, mode 0 uses one generator number per object, mode 1 one per stream
+    for (int mode = 0; mode < 2; ++mode) {
+        double t18[2];
+        const int gn18 = 1000;
+        const int tg18 = gn18 + nstrms;
+        int seeds18[nstrms];
+        VRNG_TYPE vrngs18[2];
+        VSPRNG *vrng18[2];
+        for (i = 0; i < 2; ++i) {
+            vrng18[i] = selectTypeSIMD(RNG_TYPE_NUM);
+            if (!vrng18[i])
+                return -1;
+            if (mode)
+                vrng18[i]->init_rng_lanes(gn18, tg18, iseeds, m, nstrms);
+            else
+                vrng18[i]->init_rng(gn18, tg18, iseeds, m, nstrms);
+        }
+        memcpy(seeds18, iseeds, sizeof(seeds18));
+
+        // Run kernel, initialize again
+        startTime(timers);
+        for (i = 0; i < NRESEED; ++i) {
+            seeds18[0] = iseeds[0] + i;
+            if (mode)
+                vrng18[0]->init_rng_lanes(gn18, tg18, seeds18, m, nstrms);
+            else
+                vrng18[0]->init_rng(gn18, tg18, seeds18, m, nstrms);
+        }
+        t18[0] = stopTime(timers);
+
+        // Run kernel, reseed in place
+        startTime(timers);
+        for (i = 0; i < NRESEED; ++i) {
+            seeds18[0] = iseeds[0] + i;
+            vrng18[1]->reseed_rng(seeds18);
+        }
+        t18[1] = stopTime(timers);
+
+        // Print results
+        printf("Vector init per sample (%s) real time = %.16f sec (%g per sec)\n", (mode) ? "lanes" : "object", t18[0], NRESEED / t18[0]);
+        printf("Vector reseed per sample (%s) real time = %.16f sec (%g per sec)\n", (mode) ? "lanes" : "object", t18[1], NRESEED / t18[1]);
+        if (t18[1] > 0)
+            printf("speedup = init/reseed = %g\n", t18[0] / t18[1]);
+        else
+            printf("invalid speedup = %g/%g\n", t18[0], t18[1]);
+
+        // Validate run, reseeded generator has to match initialized generator
+        valid = 1;
+        for (j = 0; j < rng_lim && valid; ++j) {
+            RNG_TYPE rn18[2][RNG_ELEMS];
+            vrngs18[0] = vrng18[0]->get_rn();
+            vrngs18[1] = vrng18[1]->get_rn();
+            simd_storeu(rn18[0], vrngs18[0]);
+            simd_storeu(rn18[1], vrngs18[1]);
+            for (int k = 0; k < RNG_ELEMS; ++k) {
+                if (RNG_NEQ(rn18[0][k], rn18[1][k])) {
+                    valid = 0;
+                    break;
+                }
+            }
+        }
+
+        if (valid > 0)
+            printf("PASSED: " RNG_TYPE_STR " reseeded generator passed the reproducibility test.\n");
+        else
+            printf("FAILED: " RNG_TYPE_STR " reseeded generator does not reproduce correct stream.\n");
+        printf("\n");
+
+        delete vrng18[0];
+        delete vrng18[1];
+    }
+
+    // Multiple register sets engine, register set k uses generator number k
+    double t4;
+    const int nstrms4 = ILP_SETS * nstrms;
+    int iseeds4[nstrms4];
+    int m4[nstrms4];
+    for (i = 0; i < nstrms4; ++i) {
+        iseeds4[i] = iseeds[i % nstrms];
+        m4[i] = m[i % nstrms];
+    }
+
+    RNG_TYPE *rngs4 = NULL;
+    scalar_malloc(&rngs4, SIMD_WIDTH_BYTES, ILP_SETS * rng_lim * RNG_ELEMS);
+    memset(rngs4, 0, ILP_SETS * rng_lim * RNG_ELEMS * sizeof(RNG_TYPE));  // first touch
+
+    // RNG object
+    VLCG_ILP<ILP_SETS> *vrng3 = new VLCG_ILP<ILP_SETS>();
+    vrng3->init_rng(0, ILP_SETS, iseeds4, m4);
+
+    // Run kernel
+    startTime(timers);
+    vrng3->get_rn_array(rngs4, ILP_SETS * rng_lim * RNG_ELEMS);
+    t4 = stopTime(timers);
+
+    // Print results
+    printf("Vector %d register sets real time = %.16f sec\n", ILP_SETS, t4);
+    for (i = 0; i < RNG_ELEMS; ++i)
+        printf("sets = " RNG_FMT "\n", rngs4[(rng_lim - 1) * ILP_SETS * RNG_ELEMS + i]);
+    printf("\n");
+
+    // Throughput per random number
+    if (t4 > 0)
+        printf("speedup = array/sets = %g\n", (t3 / rng_lim) / (t4 / (ILP_SETS * rng_lim)));
+    else
+        printf("invalid speedup = %g/%g\n", t3, t4);
+
+    // Validate run, first register set has to match array interface
+    valid = 1;
+    for (i = 0; i < RNG_ELEMS; ++i) {
+        if (RNG_NEQ(rngs3[(rng_lim - 1) * RNG_ELEMS + i], rngs4[(rng_lim - 1) * ILP_SETS * RNG_ELEMS + i])) {
+            valid = 0;
+            break;
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: " RNG_TYPE_STR " register sets generator passed the reproducibility test.\n");
+    else
+        printf("FAILED: " RNG_TYPE_STR " register sets generator does not reproduce correct stream.\n");
+    printf("\n");
+
     // Clean SPRNG objects
+    scalar_free(&rngs4);
+    scalar_free(&rngs3);
+    delete vrng3;
+    delete vrng2;
     delete vrng;
 #endif // SIMD_MODE
 
-    // Clean SPRNG objects
-    for (i = 0; i < RNG_ELEMS; ++i)
-        delete rng[i];
+    // Runtime SIMD dispatch, streams use same seeds/multipliers as scalar streams
+    double t5;
+    VLCG_DISPATCH *vrng5 = new VLCG_DISPATCH();
+    const int nelems5 = vrng5->get_nstreams();
+    int iseeds5[16];  // maximum number of streams (AVX512)
+    int m5[16];
+    for (i = 0; i < 16; ++i) {
+        iseeds5[i] = 985456376 - i;
+        m5[i] = i % 7;
+    }
+    vrng5->init_rng(0, 1, iseeds5, m5);
 
-    return 0;
-}
+    RNG_TYPE *rngs5 = NULL;
+    scalar_malloc(&rngs5, 64, rng_lim * nelems5);
+    memset(rngs5, 0, rng_lim * nelems5 * sizeof(RNG_TYPE));  // first touch
+
+    // Run kernel
+    startTime(timers);
+    vrng5->get_rn_array(rngs5, rng_lim * nelems5);
+    t5 = stopTime(timers);
+
+    // Print results
+    printf("Dispatch (%s) real time = %.16f sec\n", vrng5->get_isa(), t5);
+    for (i = 0; i < nelems5; ++i)
+        printf("dispatch = " RNG_FMT "\n", rngs5[(rng_lim - 1) * nelems5 + i]);
+    printf("\n");
+
+    // Throughput per random number
+    if (t5 > 0)
+        printf("speedup = scalar/dispatch = %g\n", (t1 / RNG_ELEMS) / (t5 / nelems5));
+    else
+        printf("invalid speedup = %g/%g\n", t1, t5);
+
+    // Validate run, last register has to match scalar streams
+    valid = 1;
+    for (i = 0; i < RNG_ELEMS && i < nelems5; ++i) {
+        if (RNG_NEQ(rngs[i], rngs5[(rng_lim - 1) * nelems5 + i])) {
+            valid = 0;
+            break;
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: " RNG_TYPE_STR " dispatch generator passed the reproducibility test.\n");
+    else
+        printf("FAILED: " RNG_TYPE_STR " dispatch generator does not reproduce correct stream.\n");
+    printf("\n");
+
+    scalar_free(&rngs5);
+    delete vrng5;
+
+    // Generator creation from multiple threads, up to all hardware threads
+    const int nprocs = (int)getNumProcOnline();
+    const int ngens7 = rng[0]->get_ngens();
+    double t7[2] = {0.0, 0.0};
+    pthread_t *threads = new pthread_t[nprocs];
+    NGENS_ARGS *args = new NGENS_ARGS[nprocs];
+    pthread_barrier_t barrier;
 
+    valid = 1;
+    for (int nt = 1; nt > 0; ) {
+        pthread_barrier_init(&barrier, NULL, nt);
+        for (i = 0; i < nt; ++i) {
+            args[i].barrier = &barrier;
+            args[i].tid = i;
+            args[i].ngens = 0;
+        }
+
+        // Run kernel
+        startTime(timers);
+        for (i = 0; i < nt; ++i)
+            pthread_create(&threads[i], NULL, create_gens, &args[i]);
+        for (i = 0; i < nt; ++i)
+            pthread_join(threads[i], NULL);
+        t7[1] = stopTime(timers);
+        if (nt == 1)
+            t7[0] = t7[1];
+        pthread_barrier_destroy(&barrier);
+
+        // Print results, throughput of generators created and destroyed
+        printf("Generators %d threads real time = %.16f sec\n", nt, t7[1]);
+        if (t7[1] > 0)
+            printf("speedup = 1 thread/%d threads = %g\n", nt, (t7[0] / NGENS_THREAD) / (t7[1] / (nt * NGENS_THREAD)));
+        else
+            printf("invalid speedup = %g/%g\n", t7[0], t7[1]);
+
+        // Validate run, counts while alive and after destruction
+        if (args[0].ngens != ngens7 + nt * NGENS_THREAD || rng[0]->get_ngens() != ngens7)
+            valid = 0;
+
+        if (nt == nprocs)
+            nt = 0;
+        else
+            nt = (2 * nt < nprocs) ? (2 * nt) : nprocs;
+    }
+    printf("\n");
+
+    if (valid > 0)
+        printf("PASSED: generators count passed the concurrent creation test.\n");
+    else
+        printf("FAILED: generators count does not match concurrent creation.\n");
+    printf("\n");
+
+    delete [] args;
+    delete [] threads;
+
+    // Concurrent initialization of generators from all hardware threads
+    // NOTE: first use of prime tables (high generator numbers) happens here
+    double t11;
+    const int step11 = GLOBALS.LCG_MAX_STREAMS / NGENS_STRESS;
+    int *rngs11 = new int[NGENS_STRESS];
+    threads = new pthread_t[nprocs];
+    STRESS_ARGS *args11 = new STRESS_ARGS[nprocs];
+    for (i = 0; i < nprocs; ++i) {
+        args11[i].tid = i;
+        args11[i].nthreads = nprocs;
+        args11[i].rn = rngs11;
+    }
+
+    // Run kernel
+    startTime(timers);
+    for (i = 0; i < nprocs; ++i)
+        pthread_create(&threads[i], NULL, init_gens, &args11[i]);
+    for (i = 0; i < nprocs; ++i)
+        pthread_join(threads[i], NULL);
+    t11 = stopTime(timers);
+
+    // Print results
+    printf("Concurrent init %d generators %d threads real time = %.16f sec\n", NGENS_STRESS, nprocs, t11);
+
+    // Validate run, generators and primes have to match single thread initialization
+    valid = 1;
+    for (i = 0; i < NGENS_STRESS; ++i) {
+        LCG_ENGINE eng11;
+        eng11.init_rng(i * step11, GLOBALS.LCG_MAX_STREAMS, 985456376, i % 7);
+        if (eng11.get_rn_int() != rngs11[i]) {
+            valid = 0;
+            break;
+        }
+    }
+    for (i = 0; i < NGENS_STRESS && valid; i += NGENS_STRESS / 64) {
+        int prime11[2];
+        getprime_32(1, &prime11[0], i * step11);
+        getprime_32_trial(1, &prime11[1], i * step11);
+        if (prime11[0] != prime11[1])
+            valid = 0;
+    }
+
+    if (valid > 0)
+        printf("PASSED: concurrent initialization passed the reproducibility test.\n");
+    else
+        printf("FAILED: concurrent initialization does not reproduce correct streams.\n");
+    printf("\n");
+
+    delete [] args11;
+    delete [] threads;
+    delete [] rngs11;
+
+    // Prime search for generator numbers [0, MAXPRIMEOFFSET], sieve vs trial division
+    // NOTE: single prime calls are timed on a sample of offsets
+    double t10[4];
+    const int nprimes10 = MAXPRIMEOFFSET + 1;
+    const int step10 = nprimes10 / INIT_SAMPLES;
+    int *primes10[2];
+    primes10[0] = new int[nprimes10];
+    primes10[1] = new int[nprimes10];
+
+    // Run kernel
+    startTime(timers);
+    getprime_32_trial(nprimes10, primes10[0], 0);
+    t10[0] = stopTime(timers);
+
+    startTime(timers);
+    getprime_32(nprimes10, primes10[1], 0);
+    t10[1] = stopTime(timers);
+
+    valid = (memcmp(primes10[0], primes10[1], nprimes10 * sizeof(int)) == 0);
+
+    startTime(timers);
+    for (i = 0; i < nprimes10; i += step10)
+        getprime_32_trial(1, &primes10[0][i], i);
+    t10[2] = stopTime(timers);
+
+    startTime(timers);
+    for (i = 0; i < nprimes10; i += step10)
+        getprime_32(1, &primes10[1][i], i);
+    t10[3] = stopTime(timers);
+
+    // Print results
+    printf("Trial division %d primes real time = %.16f sec\n", nprimes10, t10[0]);
+    printf("Sieve %d primes real time = %.16f sec\n", nprimes10, t10[1]);
+    if (t10[1] > 0)
+        printf("speedup = trial/sieve = %g\n", t10[0] / t10[1]);
+    else
+        printf("invalid speedup = %g/%g\n", t10[0], t10[1]);
+    printf("Trial division %d single primes real time = %.16f sec\n", nprimes10 / step10, t10[2]);
+    printf("Sieve %d single primes real time = %.16f sec\n", nprimes10 / step10, t10[3]);
+    if (t10[3] > 0)
+        printf("speedup = trial/sieve = %g\n", t10[2] / t10[3]);
+    else
+        printf("invalid speedup = %g/%g\n", t10[2], t10[3]);
+
+    // Validate run, sieve has to match trial division
+    for (i = 0; i < nprimes10 && valid; i += step10)
+        if (primes10[0][i] != primes10[1][i])
+            valid = 0;
+
+    if (valid > 0)
+        printf("PASSED: prime sieve passed the reproducibility test.\n");
+    else
+        printf("FAILED: prime sieve does not reproduce correct primes.\n");
+    printf("\n");
+
+    delete [] primes10[0];
+    delete [] primes10[1];
+
+    // Prime search for 64 bit primes, first call includes small primes
+    // NOTE: trial division is timed on a sample of offsets
+    double t14[4];
+    const int step14 = MAXPRIMEOFFSET_64 / PRIME64_SAMPLES;
+    unsigned int primes14[2][PRIME64_SAMPLES];
+
+    // Run kernel
+    startTime(timers);
+    getprime_64(1, &primes14[1][0], step14 / 2);
+    t14[0] = stopTime(timers);
+
+    startTime(timers);
+    getprime_64(1, &primes14[1][0], step14 / 3);
+    t14[1] = stopTime(timers);
+
+    startTime(timers);
+    for (i = 0; i < PRIME64_SAMPLES; ++i)
+        getprime_64_trial(1, &primes14[0][i], i * step14 + i);
+    t14[2] = stopTime(timers);
+
+    startTime(timers);
+    for (i = 0; i < PRIME64_SAMPLES; ++i)
+        getprime_64(1, &primes14[1][i], i * step14 + i);
+    t14[3] = stopTime(timers);
+
+    // Print results
+    printf("Sieve 64 bit prime first call real time = %.16f sec\n", t14[0]);
+    printf("Sieve 64 bit prime second call real time = %.16f sec\n", t14[1]);
+    printf("Trial division %d 64 bit primes real time = %.16f sec\n", PRIME64_SAMPLES, t14[2]);
+    printf("Sieve %d 64 bit primes real time = %.16f sec\n", PRIME64_SAMPLES, t14[3]);
+    if (t14[3] > 0)
+        printf("speedup = trial/sieve = %g\n", t14[2] / t14[3]);
+    else
+        printf("invalid speedup = %g/%g\n", t14[2], t14[3]);
+
+    // Validate run, sieve has to match trial division
+    valid = (memcmp(primes14[0], primes14[1], sizeof(primes14[0])) == 0);
+
+    if (valid > 0)
+        printf("PASSED: 64 bit prime sieve passed the reproducibility test.\n");
+    else
+        printf("FAILED: 64 bit prime sieve does not reproduce correct primes.\n");
+    printf("\n");
+
+    // Batch initialization of consecutive generators, scalar streams
+    // NOTE: per-object initialization is timed on a sample of generators and scaled
+    double t8[2];
+    const int ngen8 = GLOBALS.LCG_MAX_STREAMS;
+    const int step8 = (ngen8 > INIT_SAMPLES) ? (ngen8 / INIT_SAMPLES) : 1;
+    LCG_ENGINE *rngs8 = new LCG_ENGINE[ngen8];
+    LCG_ENGINE **prngs8 = new LCG_ENGINE*[ngen8];
+    LCG_ENGINE eng8;
+    for (i = 0; i < ngen8; ++i)
+        prngs8[i] = &rngs8[i];
+
+    // Run kernel
+    startTime(timers);
+    LCG_ENGINE::init_rng_many(prngs8, ngen8, 0, ngen8, iseeds[0], m[0]);
+    t8[0] = stopTime(timers);
+
+    startTime(timers);
+    for (i = 0; i < ngen8; i += step8)
+        eng8.init_rng(i, ngen8, iseeds[0], m[0]);
+    t8[1] = stopTime(timers) * step8;
+
+    // Print results
+    printf("Batch init %d scalar streams real time = %.16f sec\n", ngen8, t8[0]);
+    printf("Per-object init %d scalar streams real time = %.16f sec (estimated)\n", ngen8, t8[1]);
+    if (t8[0] > 0)
+        printf("speedup = per-object/batch = %g\n", t8[1] / t8[0]);
+    else
+        printf("invalid speedup = %g/%g\n", t8[1], t8[0]);
+
+    // Validate run, sampled generators have to match per-object initialization
+    valid = 1;
+    for (i = 0; i < ngen8 && valid; i += step8) {
+        eng8.init_rng(i, ngen8, iseeds[0], m[0]);
+        for (j = 0; j < 4; ++j) {
+            if (eng8.get_rn_int() != rngs8[i].get_rn_int()) {
+                valid = 0;
+                break;
+            }
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: scalar batch initialization passed the reproducibility test.\n");
+    else
+        printf("FAILED: scalar batch initialization does not reproduce correct streams.\n");
+    printf("\n");
+
+    delete [] prngs8;
+    delete [] rngs8;
+
+#if defined(SIMD_MODE)
+    // Batch initialization of consecutive generators, SIMD_STREAMS_32 streams each
+    const int ngen9 = INIT_STREAMS / SIMD_STREAMS_32;
+    const int step9 = (ngen9 > INIT_SAMPLES) ? (ngen9 / INIT_SAMPLES) : 1;
+    double t9[2];
+    VLCG_ENGINE *rngs9 = NULL;
+    VLCG_ENGINE **prngs9 = new VLCG_ENGINE*[ngen9];
+    VLCG_ENGINE eng9;
+    if (posix_memalign((void **)&rngs9, SIMD_WIDTH_BYTES, ngen9 * sizeof(VLCG_ENGINE)))
+        return -1;
+    for (i = 0; i < ngen9; ++i)
+        prngs9[i] = new (&rngs9[i]) VLCG_ENGINE();
+
+    // Run kernel
+    startTime(timers);
+    VLCG_ENGINE::init_rng_many(prngs9, ngen9, 0, ngen9, iseeds, m);
+    t9[0] = stopTime(timers);
+
+    startTime(timers);
+    for (i = 0; i < ngen9; i += step9)
+        eng9.init_rng(i, ngen9, iseeds, m);
+    t9[1] = stopTime(timers) * step9;
+
+    // Print results
+    printf("Batch init %d vector streams real time = %.16f sec\n", INIT_STREAMS, t9[0]);
+    printf("Per-object init %d vector streams real time = %.16f sec (estimated)\n", INIT_STREAMS, t9[1]);
+    if (t9[0] > 0)
+        printf("speedup = per-object/batch = %g\n", t9[1] / t9[0]);
+    else
+        printf("invalid speedup = %g/%g\n", t9[1], t9[0]);
+
+    // Validate run, sampled generators have to match per-object initialization
+    valid = 1;
+    for (i = 0; i < ngen9 && valid; i += step9) {
+        int rn9[2][SIMD_STREAMS_32] __SIMD_ALIGN__;
+        eng9.init_rng(i, ngen9, iseeds, m);
+        simd_store(rn9[0], eng9.get_rn_int());
+        simd_store(rn9[1], rngs9[i].get_rn_int());
+        if (memcmp(rn9[0], rn9[1], sizeof(rn9[0])))
+            valid = 0;
+    }
+
+    if (valid > 0)
+        printf("PASSED: vector batch initialization passed the reproducibility test.\n");
+    else
+        printf("FAILED: vector batch initialization does not reproduce correct streams.\n");
+    printf("\n");
+
+    for (i = 0; i < ngen9; ++i)
+        rngs9[i].~VLCG_ENGINE();
+    free(rngs9);
+    delete [] prngs9;
+#endif
+
+    // Checkpoint of CKPT_STREAMS scalar streams, packed back to back in a single buffer
+    // NOTE: generators are restored in place after drawing a number, the number has to repeat
+    double t15[4];
+    const int ngen15 = CKPT_STREAMS;
+    const int half15 = (ngen15 < GLOBALS.LCG_MAX_STREAMS) ? ngen15 : GLOBALS.LCG_MAX_STREAMS;
+    LCG_ENGINE *rngs15 = new LCG_ENGINE[ngen15];
+    LCG_ENGINE **prngs15 = new LCG_ENGINE*[ngen15];
+    int *rn15 = new int[ngen15];
+    for (i = 0; i < ngen15; ++i)
+        prngs15[i] = &rngs15[i];
+    for (i = 0; i < ngen15; i += half15)
+        LCG_ENGINE::init_rng_many(prngs15 + i, half15, 0, half15, iseeds[0] - i, m[0]);
+
+    const int size15 = rngs15[0].pack_size();
+    char *buf15 = NULL;
+    if (posix_memalign((void **)&buf15, 64, (size_t)ngen15 * size15))
+        return -1;
+    memset(buf15, 0, (size_t)ngen15 * size15);  // first touch
+
+    // Run kernel
+    startTime(timers);
+    for (i = 0; i < ngen15; ++i)
+        rngs15[i].pack_rng(buf15 + (size_t)i * size15, size15);
+    t15[0] = stopTime(timers);
+
+    for (i = 0; i < ngen15; ++i)
+        rn15[i] = rngs15[i].get_rn_int();
+
+    startTime(timers);
+    for (i = 0; i < ngen15; ++i)
+        rngs15[i].unpack_rng(buf15 + (size_t)i * size15, size15);
+    t15[1] = stopTime(timers);
+
+    // Print results
+    printf("Pack %d scalar streams (%d bytes) real time = %.16f sec\n", ngen15, ngen15 * size15, t15[0]);
+    printf("Unpack %d scalar streams real time = %.16f sec\n", ngen15, t15[1]);
+
+    // Validate run, restored generators have to repeat last number
+    valid = 1;
+    for (i = 0; i < ngen15; ++i) {
+        if (rngs15[i].get_rn_int() != rn15[i]) {
+            valid = 0;
+            break;
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: scalar checkpoint passed the reproducibility test.\n");
+    else
+        printf("FAILED: scalar checkpoint does not reproduce correct streams.\n");
+    printf("\n");
+
+    free(buf15);
+    delete [] rn15;
+    delete [] prngs15;
+    delete [] rngs15;
+
+    // Store/load of STORE_WORDS 32/64 bit words in SPRNG packed format (big-endian)
+    // NOTE: buffers are offset by 1 byte, packed buffers are not aligned
+    double t17[6];
+    unsigned long int *words17[2];
+    unsigned char *buf17[2];
+    scalar_malloc(&words17[0], SIMD_WIDTH_BYTES, STORE_WORDS);
+    scalar_malloc(&words17[1], SIMD_WIDTH_BYTES, STORE_WORDS);
+    buf17[0] = new unsigned char[8 * STORE_WORDS + 1];
+    buf17[1] = new unsigned char[8 * STORE_WORDS + 1];
+    for (i = 0; i < STORE_WORDS; ++i)
+        words17[0][i] = ((unsigned long int)rand() << 40) ^ ((unsigned long int)rand() << 20) ^ (unsigned long int)rand();
+    memset(words17[1], 0, 8 * STORE_WORDS);  // first touch
+    memset(buf17[0], 0, 8 * STORE_WORDS + 1);
+    memset(buf17[1], 0, 8 * STORE_WORDS + 1);
+
+    // Run kernel
+    startTime(timers);
+    store_long_bytes(words17[0], STORE_WORDS, 8, buf17[0] + 1);
+    t17[0] = stopTime(timers);
+
+    startTime(timers);
+    store_longarray(words17[0], STORE_WORDS, 8, buf17[1] + 1);
+    t17[1] = stopTime(timers);
+
+    // Validate run, packed bytes have to match
+    valid = (memcmp(buf17[0], buf17[1], 8 * STORE_WORDS + 1) == 0);
+
+    startTime(timers);
+    load_long_bytes(buf17[1] + 1, STORE_WORDS, 8, words17[1]);
+    t17[2] = stopTime(timers);
+
+    startTime(timers);
+    load_longarray(buf17[1] + 1, STORE_WORDS, 8, words17[1]);
+    t17[3] = stopTime(timers);
+
+    if (memcmp(words17[0], words17[1], 8 * STORE_WORDS))
+        valid = 0;
+
+    // 32 bit words, use low halves of 64 bit words
+    unsigned int * const iwords17[2] = { (unsigned int *)words17[0], (unsigned int *)words17[1] };
+    store_long_bytes(words17[0], STORE_WORDS, 4, buf17[0] + 1);
+    memset(words17[1], 0, 8 * STORE_WORDS);
+    for (i = 0; i < STORE_WORDS; ++i)
+        iwords17[0][i] = (unsigned int)words17[0][i];
+
+    startTime(timers);
+    store_intarray(iwords17[0], STORE_WORDS, 4, buf17[1] + 1);
+    t17[4] = stopTime(timers);
+
+    if (memcmp(buf17[0], buf17[1], 4 * STORE_WORDS + 1))
+        valid = 0;
+
+    startTime(timers);
+    load_intarray(buf17[1] + 1, STORE_WORDS, 4, iwords17[1]);
+    t17[5] = stopTime(timers);
+
+    if (memcmp(iwords17[0], iwords17[1], 4 * STORE_WORDS))
+        valid = 0;
+
+    // Print results
+    printf("Store %d 64 bit words per byte real time = %.16f sec (%g GB/s)\n", STORE_WORDS, t17[0], 8e-9 * STORE_WORDS / t17[0]);
+    printf("Store %d 64 bit words array real time = %.16f sec (%g GB/s)\n", STORE_WORDS, t17[1], 8e-9 * STORE_WORDS / t17[1]);
+    printf("Load %d 64 bit words per byte real time = %.16f sec (%g GB/s)\n", STORE_WORDS, t17[2], 8e-9 * STORE_WORDS / t17[2]);
+    printf("Load %d 64 bit words array real time = %.16f sec (%g GB/s)\n", STORE_WORDS, t17[3], 8e-9 * STORE_WORDS / t17[3]);
+    printf("Store %d 32 bit words array real time = %.16f sec (%g GB/s)\n", STORE_WORDS, t17[4], 4e-9 * STORE_WORDS / t17[4]);
+    printf("Load %d 32 bit words array real time = %.16f sec (%g GB/s)\n", STORE_WORDS, t17[5], 4e-9 * STORE_WORDS / t17[5]);
+    if (t17[1] > 0 && t17[3] > 0) {
+        printf("speedup = bytes/array store = %g\n", t17[0] / t17[1]);
+        printf("speedup = bytes/array load = %g\n", t17[2] / t17[3]);
+    }
+    else
+        printf("invalid speedup = %g/%g\n", t17[0], t17[1]);
+
+    if (valid > 0)
+        printf("PASSED: store/load passed the reproducibility test.\n");
+    else
+        printf("FAILED: store/load does not reproduce packed format.\n");
+    printf("\n");
+
+    delete [] buf17[0];
+    delete [] buf17[1];
+    scalar_free(&words17[0]);
+    scalar_free(&words17[1]);
+
+#if defined(SIMD_MODE)
+    // Checkpoint of CKPT_STREAMS streams, SIMD_STREAMS_32 streams per generator
+    const int ngen16 = CKPT_STREAMS / SIMD_STREAMS_32;
+    VLCG_ENGINE *rngs16 = NULL;
+    VLCG_ENGINE **prngs16 = new VLCG_ENGINE*[ngen16];
+    int *rn16 = NULL;
+    if (posix_memalign((void **)&rngs16, SIMD_WIDTH_BYTES, ngen16 * sizeof(VLCG_ENGINE)))
+        return -1;
+    scalar_malloc(&rn16, SIMD_WIDTH_BYTES, CKPT_STREAMS);
+    for (i = 0; i < ngen16; ++i)
+        prngs16[i] = new (&rngs16[i]) VLCG_ENGINE();
+    VLCG_ENGINE::init_rng_many(prngs16, ngen16, 0, ngen16, iseeds, m);
+
+    const int size16 = rngs16[0].pack_size();
+    char *buf16 = NULL;
+    if (posix_memalign((void **)&buf16, 64, (size_t)ngen16 * size16))
+        return -1;
+    memset(buf16, 0, (size_t)ngen16 * size16);  // first touch
+
+    // Run kernel
+    startTime(timers);
+    for (i = 0; i < ngen16; ++i)
+        rngs16[i].pack_rng(buf16 + (size_t)i * size16, size16);
+    t15[2] = stopTime(timers);
+
+    for (i = 0; i < ngen16; ++i)
+        simd_store(rn16 + i * SIMD_STREAMS_32, rngs16[i].get_rn_int());
+
+    startTime(timers);
+    for (i = 0; i < ngen16; ++i)
+        rngs16[i].unpack_rng(buf16 + (size_t)i * size16, size16);
+    t15[3] = stopTime(timers);
+
+    // Print results
+    printf("Pack %d vector streams (%d bytes) real time = %.16f sec\n", CKPT_STREAMS, ngen16 * size16, t15[2]);
+    printf("Unpack %d vector streams real time = %.16f sec\n", CKPT_STREAMS, t15[3]);
+    if (t15[2] > 0 && t15[3] > 0) {
+        printf("speedup = scalar/vector pack = %g\n", t15[0] / t15[2]);
+        printf("speedup = scalar/vector unpack = %g\n", t15[1] / t15[3]);
+    }
+    else
+        printf("invalid speedup = %g/%g\n", t15[0], t15[2]);
+
+    // Validate run, restored generators have to repeat last numbers
+    valid = 1;
+    for (i = 0; i < ngen16 && valid; ++i) {
+        int rn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        simd_store(rn, rngs16[i].get_rn_int());
+        if (memcmp(rn, rn16 + i * SIMD_STREAMS_32, sizeof(rn)))
+            valid = 0;
+    }
+
+    if (valid > 0)
+        printf("PASSED: vector checkpoint passed the reproducibility test.\n");
+    else
+        printf("FAILED: vector checkpoint does not reproduce correct streams.\n");
+    printf("\n");
+
+    free(buf16);
+    scalar_free(&rn16);
+    for (i = 0; i < ngen16; ++i)
+        rngs16[i].~VLCG_ENGINE();
+    free(rngs16);
+    delete [] prngs16;
+#endif
+
+    // Clean SPRNG objects
+    for (i = 0; i < RNG_ELEMS; ++i)
+        delete rng[i];
+
+    return 0;
+}
+
+
+/*
+ *  64 bit LCG, scalar and vector throughput and reproducibility of vector streams.
+ */
+int main_lcg64(int rng_lim)
+{
+#if defined(SIMD_MODE)
+    int i, j;
+    int valid;
+
+    long int timers[2];
+    const int nstrms = SIMD_STREAMS_32;
+
+    // Initial seeds
+    int iseeds[nstrms];
+    for (i = 0; i < nstrms; ++i)
+        iseeds[i] = 985456376 - i;
+
+    // Initial multiplier indices
+    int m64[nstrms];
+    for (i = 0; i < nstrms; ++i)
+        m64[i] = i % GLOBALS64.NPARAMS;
+
+    // Throughput of 64 bit LCG, LCG64_TRIAL_SIZE integer/float/double numbers each
+    // NOTE: both generators are called through the virtual interfaces
+    double t[6];
+    SPRNG *rng = selectType(SPRNG_LCG64);
+    VSPRNG *vrng = selectTypeSIMD(VSPRNG_LCG64);
+    rng->init_rng(0, 1, 0, 0);
+    vrng->init_rng(0, 1, iseeds, m64, nstrms);
+    volatile double sink = 0.0;
+
+    // Run kernel
+    startTime(timers);
+    for (i = 0; i < LCG64_TRIAL_SIZE; ++i)
+        rng->get_rn_int();
+    t[0] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < LCG64_TRIAL_SIZE; ++i)
+        rng->get_rn_flt();
+    t[1] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < LCG64_TRIAL_SIZE; ++i)
+        rng->get_rn_dbl();
+    t[2] = stopTime(timers);
+    sink = sink + rng->get_rn_dbl();
+
+    SIMD_INT vsum;
+    SIMD_FLT vfsum;
+    SIMD_DBL vdsum[2] __SIMD_ALIGN__;
+    SIMD_DBL vrn[2] __SIMD_ALIGN__;
+    simd_set_zero(&vsum);
+    simd_set_zero(&vfsum);
+    simd_set_zero(&vdsum[0]);
+    simd_set_zero(&vdsum[1]);
+    startTime(timers);
+    for (i = 0; i < LCG64_TRIAL_SIZE / SIMD_STREAMS_32; ++i)
+        vsum = simd_add_i32(vsum, vrng->get_rn_int());
+    t[3] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < LCG64_TRIAL_SIZE / SIMD_STREAMS_32; ++i)
+        vfsum = simd_add(vfsum, vrng->get_rn_flt());
+    t[4] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < LCG64_TRIAL_SIZE / SIMD_STREAMS_32; ++i) {
+        vrng->get_rn_dbl2(vrn);
+        vdsum[0] = simd_add(vdsum[0], vrn[0]);
+        vdsum[1] = simd_add(vdsum[1], vrn[1]);
+    }
+    t[5] = stopTime(timers);
+    {
+        int isum[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        float fsum[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        double dsum[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        simd_store(isum, vsum);
+        simd_store(fsum, vfsum);
+        simd_store(dsum, simd_add(vdsum[0], vdsum[1]));
+        sink = sink + isum[0] + fsum[0] + dsum[0];
+    }
+
+    // Print results
+    const char * const type[3] = { "Integer", "Float", "Double" };
+    for (i = 0; i < 3; ++i) {
+        printf("64 bit LCG %s scalar real time = %.16f sec (%g MRS)\n", type[i], t[i], 1e-6 * LCG64_TRIAL_SIZE / t[i]);
+        printf("64 bit LCG %s vector real time = %.16f sec (%g MRS)\n", type[i], t[i + 3], 1e-6 * LCG64_TRIAL_SIZE / t[i + 3]);
+        if (t[i + 3] > 0)
+            printf("speedup = scalar/vector = %g\n", t[i] / t[i + 3]);
+        else
+            printf("invalid speedup = %g/%g\n", t[i], t[i + 3]);
+    }
+
+    // Validate run, stream i has to match scalar generator number i
+    SPRNG *rngs[SIMD_STREAMS_32];
+    for (i = 0; i < nstrms; ++i) {
+        rngs[i] = selectType(SPRNG_LCG64);
+        rngs[i]->init_rng(i, nstrms, iseeds[i], m64[i]);
+    }
+    vrng->init_rng_lanes(0, nstrms, iseeds, m64, nstrms);
+
+    valid = 1;
+    for (j = 0; j < rng_lim && valid; ++j) {
+        int irn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        float frn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        double drn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        simd_store(irn, vrng->get_rn_int());
+        simd_store(frn, vrng->get_rn_flt());
+        vrng->get_rn_dbl2(vrn);
+        simd_store(drn, vrn[0]);
+        simd_store(drn + SIMD_STREAMS_64, vrn[1]);
+        for (i = 0; i < nstrms; ++i) {
+            const int irn0 = rngs[i]->get_rn_int();
+            const float frn0 = rngs[i]->get_rn_flt();
+            const double drn0 = rngs[i]->get_rn_dbl();
+            if (irn[i] != irn0 || frn[i] != frn0 || drn[i] != drn0) {
+                valid = 0;
+                break;
+            }
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: 64 bit LCG vector streams passed the reproducibility test.\n");
+    else
+        printf("FAILED: 64 bit LCG vector streams do not reproduce scalar streams.\n");
+    printf("\n");
+
+    if (sink < 0.0)
+        printf("sink = %g\n", sink);
+    for (i = 0; i < nstrms; ++i)
+        delete rngs[i];
+    delete rng;
+    delete vrng;
+#else
+    (void)rng_lim;
+#endif
+
+    return 0;
+}
+
+
+/*
+ *  Lagged Fibonacci, vector throughput against 48 bit LCG and reproducibility of vector streams.
+ */
+int main_lfg(int rng_lim)
+{
+#if defined(SIMD_MODE)
+    int i, j;
+    int valid;
+
+    long int timers[2];
+    const int nstrms = SIMD_STREAMS_32;
+
+    // Initial seeds
+    int iseeds[nstrms];
+    for (i = 0; i < nstrms; ++i)
+        iseeds[i] = 985456376 - i;
+
+    // Initial multiplier indices, lags are the same for all streams
+    int m[nstrms];
+    for (i = 0; i < nstrms; ++i)
+        m[i] = 0;
+
+    // Throughput of arrays of LFG_TRIAL_SIZE integer/float/double numbers,
+    // arrays fit in cache and are generated LFG_TRIAL_REPS times
+    double t[6];
+    VSPRNG *vrng[2];
+    vrng[0] = selectTypeSIMD(VSPRNG_LCG);
+    vrng[1] = selectTypeSIMD(VSPRNG_LFG);
+    for (i = 0; i < 2; ++i) {
+        if (!vrng[i])
+            return -1;
+        vrng[i]->init_rng(0, 1, iseeds, m, nstrms);
+    }
+
+    int *irn = NULL;
+    float *frn = NULL;
+    double *drn = NULL;
+    scalar_malloc(&irn, SIMD_WIDTH_BYTES, LFG_TRIAL_SIZE);
+    scalar_malloc(&frn, SIMD_WIDTH_BYTES, LFG_TRIAL_SIZE);
+    scalar_malloc(&drn, SIMD_WIDTH_BYTES, LFG_TRIAL_SIZE);
+    memset(irn, 0, LFG_TRIAL_SIZE * sizeof(int));  // first touch
+    memset(frn, 0, LFG_TRIAL_SIZE * sizeof(float));
+    memset(drn, 0, LFG_TRIAL_SIZE * sizeof(double));
+
+    // Run kernel
+    for (i = 0; i < 2; ++i) {
+        startTime(timers);
+        for (j = 0; j < LFG_TRIAL_REPS; ++j)
+            vrng[i]->get_rn_int_array(irn, LFG_TRIAL_SIZE);
+        t[3 * i] = stopTime(timers);
+        startTime(timers);
+        for (j = 0; j < LFG_TRIAL_REPS; ++j)
+            vrng[i]->get_rn_flt_array(frn, LFG_TRIAL_SIZE);
+        t[3 * i + 1] = stopTime(timers);
+        startTime(timers);
+        for (j = 0; j < LFG_TRIAL_REPS; ++j)
+            vrng[i]->get_rn_dbl2_array(drn, LFG_TRIAL_SIZE);
+        t[3 * i + 2] = stopTime(timers);
+    }
+
+    // Print results
+    const char * const type[3] = { "Integer", "Float", "Double" };
+    for (i = 0; i < 3; ++i) {
+        printf("LCG %s vector array real time = %.16f sec (%g MRS)\n", type[i], t[i], 1e-6 * LFG_TRIAL_SIZE * LFG_TRIAL_REPS / t[i]);
+        printf("LFG %s vector array real time = %.16f sec (%g MRS)\n", type[i], t[i + 3], 1e-6 * LFG_TRIAL_SIZE * LFG_TRIAL_REPS / t[i + 3]);
+        if (t[i + 3] > 0)
+            printf("speedup = VLCG/VLFG = %g\n", t[i] / t[i + 3]);
+        else
+            printf("invalid speedup = %g/%g\n", t[i], t[i + 3]);
+    }
+
+    // Validate run, stream i has to match scalar generator number i,
+    // several blocks of the longest lag are compared
+    const int nsteps = rng_lim + 3 * LFG_MAX_LAG;
+    SPRNG *rngs[SIMD_STREAMS_32];
+    for (i = 0; i < nstrms; ++i) {
+        rngs[i] = selectType(SPRNG_LFG);
+        rngs[i]->init_rng(i, nstrms, iseeds[i], m[i]);
+    }
+    vrng[1]->init_rng_lanes(0, nstrms, iseeds, m, nstrms);
+
+    valid = 1;
+    for (j = 0; j < nsteps && valid; ++j) {
+        int irn1[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        float frn1[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        double drn1[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        SIMD_DBL vrn[2] __SIMD_ALIGN__;
+        simd_store(irn1, vrng[1]->get_rn_int());
+        simd_store(frn1, vrng[1]->get_rn_flt());
+        vrng[1]->get_rn_dbl2(vrn);
+        simd_store(drn1, vrn[0]);
+        simd_store(drn1 + SIMD_STREAMS_64, vrn[1]);
+        for (i = 0; i < nstrms; ++i) {
+            const int irn0 = rngs[i]->get_rn_int();
+            const float frn0 = rngs[i]->get_rn_flt();
+            const double drn0 = rngs[i]->get_rn_dbl();
+            if (irn1[i] != irn0 || frn1[i] != frn0 || drn1[i] != drn0) {
+                valid = 0;
+                break;
+            }
+        }
+    }
+
+    // Arrays have to match single calls
+    delete vrng[0];
+    vrng[0] = selectTypeSIMD(VSPRNG_LFG);
+    vrng[0]->init_rng(0, 1, iseeds, m, nstrms);
+    vrng[1]->init_rng(0, 1, iseeds, m, nstrms);
+    const int nvec = (nsteps < LFG_TRIAL_SIZE / SIMD_STREAMS_32) ? nsteps : LFG_TRIAL_SIZE / SIMD_STREAMS_32;
+    vrng[1]->get_rn_int_array(irn, nvec * SIMD_STREAMS_32);
+    for (j = 0; j < nvec && valid; ++j) {
+        int irn1[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        simd_store(irn1, vrng[0]->get_rn_int());
+        if (memcmp(irn1, irn + j * SIMD_STREAMS_32, sizeof(irn1)))
+            valid = 0;
+    }
+
+    // Streams asking for different lags are rejected
+    m[nstrms - 1] = 1;
+    if (nstrms > 1 && vrng[0]->init_rng(0, 1, iseeds, m, nstrms) != -1)
+        valid = 0;
+    m[nstrms - 1] = 0;
+
+    if (valid > 0)
+        printf("PASSED: lagged Fibonacci vector streams passed the reproducibility test.\n");
+    else
+        printf("FAILED: lagged Fibonacci vector streams do not reproduce scalar streams.\n");
+    printf("\n");
+
+    scalar_free(&irn);
+    scalar_free(&frn);
+    scalar_free(&drn);
+    for (i = 0; i < nstrms; ++i)
+        delete rngs[i];
+    delete vrng[0];
+    delete vrng[1];
+#else
+    (void)rng_lim;
+#endif
+
+    return 0;
+}
+
+
+/*
+ *  Combined multiple recursive, scalar and vector throughput and reproducibility of vector streams.
+ */
+int main_cmrg(int rng_lim)
+{
+#if defined(SIMD_MODE)
+    int i, j;
+    int valid;
+
+    long int timers[2];
+    const int nstrms = SIMD_STREAMS_32;
+
+    // Initial seeds
+    int iseeds[nstrms];
+    for (i = 0; i < nstrms; ++i)
+        iseeds[i] = 985456376 - i;
+
+    // Initial multiplier indices
+    int mc[nstrms];
+    for (i = 0; i < nstrms; ++i)
+        mc[i] = i % GLOBALS_CMRG.NPARAMS;
+
+    // Throughput of CMRG, CMRG_TRIAL_SIZE integer/float/double numbers each
+    // NOTE: both generators are called through the virtual interfaces
+    double t[6];
+    SPRNG *rng = new CMRG();
+    VSPRNG *vrng = new VCMRG();
+    rng->init_rng(0, 1, 0, 0);
+    vrng->init_rng(0, 1, iseeds, mc, nstrms);
+    volatile double sink = 0.0;
+
+    // Run kernel
+    startTime(timers);
+    for (i = 0; i < CMRG_TRIAL_SIZE; ++i)
+        rng->get_rn_int();
+    t[0] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < CMRG_TRIAL_SIZE; ++i)
+        rng->get_rn_flt();
+    t[1] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < CMRG_TRIAL_SIZE; ++i)
+        rng->get_rn_dbl();
+    t[2] = stopTime(timers);
+    sink = sink + rng->get_rn_dbl();
+
+    SIMD_INT vsum;
+    SIMD_FLT vfsum;
+    SIMD_DBL vdsum[2] __SIMD_ALIGN__;
+    SIMD_DBL vrn[2] __SIMD_ALIGN__;
+    simd_set_zero(&vsum);
+    simd_set_zero(&vfsum);
+    simd_set_zero(&vdsum[0]);
+    simd_set_zero(&vdsum[1]);
+    startTime(timers);
+    for (i = 0; i < CMRG_TRIAL_SIZE / SIMD_STREAMS_32; ++i)
+        vsum = simd_add_i32(vsum, vrng->get_rn_int());
+    t[3] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < CMRG_TRIAL_SIZE / SIMD_STREAMS_32; ++i)
+        vfsum = simd_add(vfsum, vrng->get_rn_flt());
+    t[4] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < CMRG_TRIAL_SIZE / SIMD_STREAMS_32; ++i) {
+        vrng->get_rn_dbl2(vrn);
+        vdsum[0] = simd_add(vdsum[0], vrn[0]);
+        vdsum[1] = simd_add(vdsum[1], vrn[1]);
+    }
+    t[5] = stopTime(timers);
+    {
+        int isum[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        float fsum[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        double dsum[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        simd_store(isum, vsum);
+        simd_store(fsum, vfsum);
+        simd_store(dsum, simd_add(vdsum[0], vdsum[1]));
+        sink = sink + isum[0] + fsum[0] + dsum[0];
+    }
+
+    // Print results
+    const char * const type[3] = { "Integer", "Float", "Double" };
+    for (i = 0; i < 3; ++i) {
+        printf("CMRG %s scalar real time = %.16f sec (%g MRS)\n", type[i], t[i], 1e-6 * CMRG_TRIAL_SIZE / t[i]);
+        printf("CMRG %s vector real time = %.16f sec (%g MRS)\n", type[i], t[i + 3], 1e-6 * CMRG_TRIAL_SIZE / t[i + 3]);
+        if (t[i + 3] > 0)
+            printf("speedup = scalar/vector = %g\n", t[i] / t[i + 3]);
+        else
+            printf("invalid speedup = %g/%g\n", t[i], t[i + 3]);
+    }
+
+    // Validate run, stream i has to match scalar generator number i
+    SPRNG *rngs[SIMD_STREAMS_32];
+    for (i = 0; i < nstrms; ++i) {
+        rngs[i] = new CMRG();
+        rngs[i]->init_rng(i, nstrms, iseeds[i], mc[i]);
+    }
+    vrng->init_rng_lanes(0, nstrms, iseeds, mc, nstrms);
+
+    valid = 1;
+    for (j = 0; j < rng_lim && valid; ++j) {
+        int irn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        float frn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        double drn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        simd_store(irn, vrng->get_rn_int());
+        simd_store(frn, vrng->get_rn_flt());
+        vrng->get_rn_dbl2(vrn);
+        simd_store(drn, vrn[0]);
+        simd_store(drn + SIMD_STREAMS_64, vrn[1]);
+        for (i = 0; i < nstrms; ++i) {
+            const int irn0 = rngs[i]->get_rn_int();
+            const float frn0 = rngs[i]->get_rn_flt();
+            const double drn0 = rngs[i]->get_rn_dbl();
+            if (irn[i] != irn0 || frn[i] != frn0 || drn[i] != drn0) {
+                valid = 0;
+                break;
+            }
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: CMRG vector streams passed the reproducibility test.\n");
+    else
+        printf("FAILED: CMRG vector streams do not reproduce scalar streams.\n");
+    printf("\n");
+
+    if (sink < 0.0)
+        printf("sink = %g\n", sink);
+    for (i = 0; i < nstrms; ++i)
+        delete rngs[i];
+    delete rng;
+    delete vrng;
+#else
+    (void)rng_lim;
+#endif
+
+    return 0;
+}
+
+
+/*
+ *  Multiplicative lagged Fibonacci, vector throughput against 64 bit LCG and reproducibility of vector streams.
+ */
+int main_mlfg(int rng_lim)
+{
+#if defined(SIMD_MODE)
+    int i, j;
+    int valid;
+
+    long int timers[2];
+    const int nstrms = SIMD_STREAMS_32;
+
+    // Initial seeds
+    int iseeds[nstrms];
+    for (i = 0; i < nstrms; ++i)
+        iseeds[i] = 985456376 - i;
+
+    // Initial multiplier indices, lags are the same for all streams
+    int m[nstrms];
+    for (i = 0; i < nstrms; ++i)
+        m[i] = 0;
+
+    // Throughput of arrays of MLFG_TRIAL_SIZE integer/float/double numbers,
+    // arrays fit in cache and are generated MLFG_TRIAL_REPS times
+    double t[6];
+    VSPRNG *vrng[2];
+    vrng[0] = selectTypeSIMD(VSPRNG_LCG64);
+    vrng[1] = selectTypeSIMD(VSPRNG_MLFG);
+    for (i = 0; i < 2; ++i) {
+        if (!vrng[i])
+            return -1;
+        vrng[i]->init_rng(0, 1, iseeds, m, nstrms);
+    }
+
+    int *irn = NULL;
+    float *frn = NULL;
+    double *drn = NULL;
+    scalar_malloc(&irn, SIMD_WIDTH_BYTES, MLFG_TRIAL_SIZE);
+    scalar_malloc(&frn, SIMD_WIDTH_BYTES, MLFG_TRIAL_SIZE);
+    scalar_malloc(&drn, SIMD_WIDTH_BYTES, MLFG_TRIAL_SIZE);
+    memset(irn, 0, MLFG_TRIAL_SIZE * sizeof(int));  // first touch
+    memset(frn, 0, MLFG_TRIAL_SIZE * sizeof(float));
+    memset(drn, 0, MLFG_TRIAL_SIZE * sizeof(double));
+
+    // Run kernel
+    for (i = 0; i < 2; ++i) {
+        startTime(timers);
+        for (j = 0; j < MLFG_TRIAL_REPS; ++j)
+            vrng[i]->get_rn_int_array(irn, MLFG_TRIAL_SIZE);
+        t[3 * i] = stopTime(timers);
+        startTime(timers);
+        for (j = 0; j < MLFG_TRIAL_REPS; ++j)
+            vrng[i]->get_rn_flt_array(frn, MLFG_TRIAL_SIZE);
+        t[3 * i + 1] = stopTime(timers);
+        startTime(timers);
+        for (j = 0; j < MLFG_TRIAL_REPS; ++j)
+            vrng[i]->get_rn_dbl2_array(drn, MLFG_TRIAL_SIZE);
+        t[3 * i + 2] = stopTime(timers);
+    }
+
+    // Print results
+    const char * const type[3] = { "Integer", "Float", "Double" };
+    for (i = 0; i < 3; ++i) {
+        printf("LCG64 %s vector array real time = %.16f sec (%g MRS)\n", type[i], t[i], 1e-6 * MLFG_TRIAL_SIZE * MLFG_TRIAL_REPS / t[i]);
+        printf("MLFG %s vector array real time = %.16f sec (%g MRS)\n", type[i], t[i + 3], 1e-6 * MLFG_TRIAL_SIZE * MLFG_TRIAL_REPS / t[i + 3]);
+        if (t[i + 3] > 0)
+            printf("speedup = VLCG64/VMLFG = %g\n", t[i] / t[i + 3]);
+        else
+            printf("invalid speedup = %g/%g\n", t[i], t[i + 3]);
+    }
+
+    // Validate run, stream i has to match scalar generator number i,
+    // several blocks of the longest lag are compared
+    const int nsteps = rng_lim + 3 * MLFG_MAX_LAG;
+    SPRNG *rngs[SIMD_STREAMS_32];
+    for (i = 0; i < nstrms; ++i) {
+        rngs[i] = selectType(SPRNG_MLFG);
+        rngs[i]->init_rng(i, nstrms, iseeds[i], m[i]);
+    }
+    vrng[1]->init_rng_lanes(0, nstrms, iseeds, m, nstrms);
+
+    valid = 1;
+    for (j = 0; j < nsteps && valid; ++j) {
+        int irn1[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        float frn1[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        double drn1[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        SIMD_DBL vrn[2] __SIMD_ALIGN__;
+        simd_store(irn1, vrng[1]->get_rn_int());
+        simd_store(frn1, vrng[1]->get_rn_flt());
+        vrng[1]->get_rn_dbl2(vrn);
+        simd_store(drn1, vrn[0]);
+        simd_store(drn1 + SIMD_STREAMS_64, vrn[1]);
+        for (i = 0; i < nstrms; ++i) {
+            const int irn0 = rngs[i]->get_rn_int();
+            const float frn0 = rngs[i]->get_rn_flt();
+            const double drn0 = rngs[i]->get_rn_dbl();
+            if (irn1[i] != irn0 || frn1[i] != frn0 || drn1[i] != drn0) {
+                valid = 0;
+                break;
+            }
+        }
+    }
+
+    // Arrays have to match single calls
+    delete vrng[0];
+    vrng[0] = selectTypeSIMD(VSPRNG_MLFG);
+    vrng[0]->init_rng(0, 1, iseeds, m, nstrms);
+    vrng[1]->init_rng(0, 1, iseeds, m, nstrms);
+    const int nvec = (nsteps < MLFG_TRIAL_SIZE / SIMD_STREAMS_32) ? nsteps : MLFG_TRIAL_SIZE / SIMD_STREAMS_32;
+    vrng[1]->get_rn_int_array(irn, nvec * SIMD_STREAMS_32);
+    for (j = 0; j < nvec && valid; ++j) {
+        int irn1[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        simd_store(irn1, vrng[0]->get_rn_int());
+        if (memcmp(irn1, irn + j * SIMD_STREAMS_32, sizeof(irn1)))
+            valid = 0;
+    }
+
+    if (valid > 0)
+        printf("PASSED: multiplicative lagged Fibonacci vector streams passed the reproducibility test.\n");
+    else
+        printf("FAILED: multiplicative lagged Fibonacci vector streams do not reproduce scalar streams.\n");
+    printf("\n");
+
+    scalar_free(&irn);
+    scalar_free(&frn);
+    scalar_free(&drn);
+    for (i = 0; i < nstrms; ++i)
+        delete rngs[i];
+    delete vrng[0];
+    delete vrng[1];
+#else
+    (void)rng_lim;
+#endif
+
+    return 0;
+}
+
+
+/*
+ *  Prime modulus LCG, scalar (128-bit product) against vector (32-bit partial
+ *  products) throughput and reproducibility of vector streams.
+ */
+int main_pmlcg(int rng_lim)
+{
+#if defined(SIMD_MODE)
+    int i, j;
+    int valid;
+
+    long int timers[2];
+    const int nstrms = SIMD_STREAMS_32;
+
+    // Initial seeds
+    int iseeds[nstrms];
+    for (i = 0; i < nstrms; ++i)
+        iseeds[i] = 985456376 - i;
+
+    // Initial multiplier indices
+    int m[nstrms];
+    for (i = 0; i < nstrms; ++i)
+        m[i] = 0;
+
+    // Throughput of PMLCG, PMLCG_TRIAL_SIZE integer/float/double numbers each
+    // NOTE: engines are called directly so only the multiply-reduce is compared
+    double t[6];
+    PMLCG_ENGINE rng;
+    VPMLCG_ENGINE vrng;
+    rng.init_rng(0, 1, iseeds[0], m[0]);
+    vrng.init_rng(0, 1, iseeds, m, nstrms);
+    volatile double sink = 0.0;
+
+    // Run kernel
+    int isum0 = 0;
+    float fsum0 = 0.0f;
+    double dsum0 = 0.0;
+    startTime(timers);
+    for (i = 0; i < PMLCG_TRIAL_SIZE; ++i)
+        isum0 += rng.get_rn_int();
+    t[0] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < PMLCG_TRIAL_SIZE; ++i)
+        fsum0 += rng.get_rn_flt();
+    t[1] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < PMLCG_TRIAL_SIZE; ++i)
+        dsum0 += rng.get_rn_dbl();
+    t[2] = stopTime(timers);
+    sink = sink + isum0 + fsum0 + dsum0;
+
+    SIMD_INT vsum;
+    SIMD_FLT vfsum;
+    SIMD_DBL vdsum[2] __SIMD_ALIGN__;
+    SIMD_DBL vrn[2] __SIMD_ALIGN__;
+    simd_set_zero(&vsum);
+    simd_set_zero(&vfsum);
+    simd_set_zero(&vdsum[0]);
+    simd_set_zero(&vdsum[1]);
+    startTime(timers);
+    for (i = 0; i < PMLCG_TRIAL_SIZE / SIMD_STREAMS_32; ++i)
+        vsum = simd_add_i32(vsum, vrng.get_rn_int());
+    t[3] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < PMLCG_TRIAL_SIZE / SIMD_STREAMS_32; ++i)
+        vfsum = simd_add(vfsum, vrng.get_rn_flt());
+    t[4] = stopTime(timers);
+    startTime(timers);
+    for (i = 0; i < PMLCG_TRIAL_SIZE / SIMD_STREAMS_32; ++i) {
+        vrng.get_rn_dbl2(vrn);
+        vdsum[0] = simd_add(vdsum[0], vrn[0]);
+        vdsum[1] = simd_add(vdsum[1], vrn[1]);
+    }
+    t[5] = stopTime(timers);
+    {
+        int isum[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        float fsum[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        double dsum[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        simd_store(isum, vsum);
+        simd_store(fsum, vfsum);
+        simd_store(dsum, simd_add(vdsum[0], vdsum[1]));
+        sink = sink + isum[0] + fsum[0] + dsum[0];
+    }
+
+    // Print results
+    const char * const type[3] = { "Integer", "Float", "Double" };
+    for (i = 0; i < 3; ++i) {
+        printf("PMLCG %s scalar real time = %.16f sec (%g MRS)\n", type[i], t[i], 1e-6 * PMLCG_TRIAL_SIZE / t[i]);
+        printf("PMLCG %s vector real time = %.16f sec (%g MRS)\n", type[i], t[i + 3], 1e-6 * PMLCG_TRIAL_SIZE / t[i + 3]);
+        if (t[i + 3] > 0)
+            printf("speedup = scalar/vector = %g\n", t[i] / t[i + 3]);
+        else
+            printf("invalid speedup = %g/%g\n", t[i], t[i + 3]);
+    }
+
+    // Validate run, stream i has to match scalar generator number i
+    SPRNG *rngs[SIMD_STREAMS_32];
+    for (i = 0; i < nstrms; ++i) {
+        rngs[i] = selectType(SPRNG_PMLCG);
+        rngs[i]->init_rng(i, nstrms, iseeds[i], m[i]);
+    }
+    VPMLCG *vrng1 = new VPMLCG();
+    vrng1->init_rng_lanes(0, nstrms, iseeds, m, nstrms);
+
+    valid = 1;
+    for (j = 0; j < rng_lim && valid; ++j) {
+        int irn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        float frn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        double drn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        simd_store(irn, vrng1->get_rn_int());
+        simd_store(frn, vrng1->get_rn_flt());
+        vrng1->get_rn_dbl2(vrn);
+        simd_store(drn, vrn[0]);
+        simd_store(drn + SIMD_STREAMS_64, vrn[1]);
+        for (i = 0; i < nstrms; ++i) {
+            const int irn0 = rngs[i]->get_rn_int();
+            const float frn0 = rngs[i]->get_rn_flt();
+            const double drn0 = rngs[i]->get_rn_dbl();
+            if (irn[i] != irn0 || frn[i] != frn0 || drn[i] != drn0) {
+                valid = 0;
+                break;
+            }
+        }
+    }
+
+    // Advancing has to match stepping
+    vrng1->advance(rng_lim);
+    for (i = 0; i < nstrms; ++i)
+        for (j = 0; j < rng_lim; ++j)
+            rngs[i]->get_rn_int();
+    {
+        int irn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        simd_store(irn, vrng1->get_rn_int());
+        for (i = 0; i < nstrms; ++i) {
+            if (irn[i] != rngs[i]->get_rn_int())
+                valid = 0;
+        }
+    }
+
+    if (valid > 0)
+        printf("PASSED: PMLCG vector streams passed the reproducibility test.\n");
+    else
+        printf("FAILED: PMLCG vector streams do not reproduce scalar streams.\n");
+    printf("\n");
+
+    if (sink < 0.0)
+        printf("sink = %g\n", sink);
+    for (i = 0; i < nstrms; ++i)
+        delete rngs[i];
+    delete vrng1;
+#else
+    (void)rng_lim;
+#endif
+
+    return 0;
+}
@@ -0,0 +1,237 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include "sprng.h"
+#include "vsprng.h"
+#include "lcg_engine.h"
+#include "vlcg_engine.h"
+#include "timers.h"
+#include "utils.h"
+#include "vutils.h"
+#include "pool.h"
+
+
+/*
+ *  Pool checkpoint tool
+ *
+ *  write:  initialize a pool of streams, draw POOL_DRAWS numbers per stream,
+ *          and save engines to a pool file.
+ *  verify: map pool file and compare it against a pool initialized again
+ *          (restart by re-initialization), numbers drawn next have to match.
+ *
+ *  SIMD builds use VLCG engines, SIMD_STREAMS_32 streams per engine,
+ *  scalar builds use LCG engines.
+ */
+#if defined(SIMD_MODE)
+#define POOL_ENGINE VLCG_ENGINE
+#define POOL_TYPE VSPRNG_LCG
+#define POOL_LANES SIMD_STREAMS_32
+#define POOL_WIDTH SIMD_WIDTH_BYTES
+#else
+#define POOL_ENGINE LCG_ENGINE
+#define POOL_TYPE SPRNG_LCG
+#define POOL_LANES 1
+#define POOL_WIDTH 0
+#endif
+
+// Default number of streams in pool
+#define POOL_STREAMS 10000000
+
+// Numbers drawn per stream before checkpoint
+#define POOL_DRAWS 16
+
+
+/*
+ *  Initialize engines in batches of LCG_MAX_STREAMS generators, then draw POOL_DRAWS numbers.
+ */
+static int init_pool(POOL_ENGINE * const engs, const long int ngens)
+{
+    const int batch = GLOBALS.LCG_MAX_STREAMS;
+    POOL_ENGINE **pengs = new POOL_ENGINE*[batch];
+    int seeds[POOL_LANES];
+    int params[POOL_LANES];
+
+    for (long int i = 0; i < ngens; i += batch) {
+        const int n = (ngens - i < batch) ? (int)(ngens - i) : batch;
+        for (int j = 0; j < n; ++j)
+            pengs[j] = new (&engs[i + j]) POOL_ENGINE();
+        for (int j = 0; j < POOL_LANES; ++j) {
+            seeds[j] = 985456376 - (int)(i / batch) * POOL_LANES - j;
+            params[j] = j % 7;
+        }
+#if defined(SIMD_MODE)
+        if (POOL_ENGINE::init_rng_many(pengs, n, 0, n, seeds, params) < 0) {
+#else
+        if (POOL_ENGINE::init_rng_many(pengs, n, 0, n, seeds[0], params[0]) < 0) {
+#endif
+            delete [] pengs;
+            return -1;
+        }
+    }
+    delete [] pengs;
+
+    for (long int i = 0; i < ngens; ++i)
+        for (int k = 0; k < POOL_DRAWS; ++k)
+            engs[i].get_rn_int();
+
+    return 0;
+}
+
+
+/*
+ *  Draw next number of every stream.
+ */
+static void draw_pool(POOL_ENGINE * const engs, const long int ngens, int * const rn)
+{
+    for (long int i = 0; i < ngens; ++i)
+#if defined(SIMD_MODE)
+        simd_store(rn + i * POOL_LANES, engs[i].get_rn_int());
+#else
+        rn[i] = engs[i].get_rn_int();
+#endif
+}
+
+
+static POOL_ENGINE * alloc_pool(const long int ngens)
+{
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, POOL_ALIGN, (size_t)ngens * sizeof(POOL_ENGINE))) {
+        printf("ERROR: failed to allocate pool of %ld engines\n", ngens);
+        return NULL;
+    }
+    memset(ptr, 0, (size_t)ngens * sizeof(POOL_ENGINE));  // first touch
+    return (POOL_ENGINE *)ptr;
+}
+
+
+static int write_pool(const char * const fname, const long int ngens, const POOL_HEADER * const header)
+{
+    long int timers[2];
+    double t[2];
+
+    POOL_ENGINE * const engs = alloc_pool(ngens);
+    if (!engs)
+        return -1;
+
+    startTime(timers);
+    const int ierr = init_pool(engs, ngens);
+    t[0] = stopTime(timers);
+
+    startTime(timers);
+    if (ierr == 0 && pool_save(fname, header, engs, ngens) == 0)
+        t[1] = stopTime(timers);
+    else
+        t[1] = -1.0;
+
+    free(engs);
+
+    if (t[1] < 0)
+        return -1;
+
+    printf("Initialize %ld streams (%ld engines) real time = %.16f sec\n", ngens * POOL_LANES, ngens, t[0]);
+    printf("Write pool file %s (%ld bytes) real time = %.16f sec\n", fname, (long int)POOL_ALIGN + ngens * (long int)sizeof(POOL_ENGINE), t[1]);
+
+    return 0;
+}
+
+
+static int verify_pool(const char * const fname, const long int ngens, const POOL_HEADER * const header)
+{
+    long int timers[2];
+    double t[2];
+    long int nmap = 0;
+    int valid = 1;
+
+    int *rn[2] = { NULL, NULL };
+    scalar_malloc(&rn[0], POOL_ALIGN, ngens * POOL_LANES);
+    scalar_malloc(&rn[1], POOL_ALIGN, ngens * POOL_LANES);
+    POOL_ENGINE * const engs = alloc_pool(ngens);
+    if (!rn[0] || !rn[1] || !engs) {
+        free(engs);
+        scalar_free(&rn[0]);
+        scalar_free(&rn[1]);
+        return -1;
+    }
+
+    // Restart from pool file, engines are used in place
+    startTime(timers);
+    POOL_ENGINE * const mapped = (POOL_ENGINE *)pool_map(fname, header, &nmap);
+    if (mapped && nmap == ngens)
+        draw_pool(mapped, nmap, rn[1]);
+    t[1] = stopTime(timers);
+
+    // Restart by re-initialization
+    startTime(timers);
+    if (init_pool(engs, ngens) == 0)
+        draw_pool(engs, ngens, rn[0]);
+    t[0] = stopTime(timers);
+
+    if (!mapped || nmap != ngens) {
+        printf("ERROR: pool file %s does not have %ld engines\n", fname, ngens);
+        valid = 0;
+    }
+    else if (memcmp(rn[0], rn[1], (size_t)ngens * POOL_LANES * sizeof(int)))
+        valid = 0;
+
+    // Mapping has to be refused by a different build
+    POOL_HEADER other = *header;
+    other.long_sprng = !other.long_sprng;
+    printf("Expected error: ");
+    void * const bad = pool_map(fname, &other, &nmap);
+    if (bad) {
+        pool_unmap(bad);
+        valid = 0;
+    }
+
+    // Print results
+    printf("Restart %ld streams by re-initialization real time = %.16f sec\n", ngens * POOL_LANES, t[0]);
+    printf("Restart %ld streams from pool file real time = %.16f sec\n", ngens * POOL_LANES, t[1]);
+    if (t[1] > 0)
+        printf("speedup = init/map = %g\n", t[0] / t[1]);
+    else
+        printf("invalid speedup = %g/%g\n", t[0], t[1]);
+
+    if (valid > 0)
+        printf("PASSED: pool file passed the reproducibility test.\n");
+    else
+        printf("FAILED: pool file does not reproduce correct streams.\n");
+
+    if (mapped)
+        pool_unmap(mapped);
+    free(engs);
+    scalar_free(&rn[0]);
+    scalar_free(&rn[1]);
+
+    return (valid > 0) ? 0 : -1;
+}
+
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3 || (strcmp(argv[1], "write") && strcmp(argv[1], "verify"))) {
+        printf("Usage: %s write|verify file [streams]\n", argv[0]);
+        return 1;
+    }
+
+    const long int nstrms = (argc > 3) ? atol(argv[3]) : POOL_STREAMS;
+    const long int ngens = (nstrms + POOL_LANES - 1) / POOL_LANES;
+    if (ngens <= 0) {
+        printf("ERROR: invalid number of streams, %ld\n", nstrms);
+        return 1;
+    }
+
+    const POOL_HEADER header = pool_header(POOL_TYPE, POOL_WIDTH, POOL_LANES, sizeof(POOL_ENGINE));
+
+    int retval;
+    if (strcmp(argv[1], "write") == 0)
+        retval = write_pool(argv[2], ngens, &header);
+    else
+        retval = verify_pool(argv[2], ngens, &header);
+
+    if (retval)
+        printf("ERROR: program could not run successfully.\n");
+
+    return (retval) ? 1 : 0;
+}
+
@@ -31,6 +31,9 @@ class SPRNG
     virtual double get_rn_dbl() = 0;
     virtual int get_seed_rng() const = 0;
     virtual int get_ngens() const = 0;
+    virtual int pack_size() const = 0;
+    virtual int pack_rng(void * const, const int) const = 0;
+    virtual int unpack_rng(const void * const, const int) = 0;
 #if defined(DEBUG)
     virtual int get_prime() const = 0;
 # if defined(LONG_SPRNG)
@@ -31,11 +31,26 @@ class VSPRNG
   public:
     virtual ~VSPRNG() {} /*!< virtual destructor allows polymorphism to invoke derived destructors */
     virtual int init_rng(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32) = 0;
+    virtual int init_rng_lanes(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32) = 0;
+    virtual int reseed_rng(const int * const) = 0;
+    virtual int spawn_rng(const int, VSPRNG *** const) = 0;
     virtual SIMD_INT get_rn_int() const = 0;
     virtual SIMD_FLT get_rn_flt() const = 0;
     virtual SIMD_DBL get_rn_dbl() const = 0;
+    virtual void get_rn_dbl2(SIMD_DBL * const) const = 0;
+    virtual int get_rn_int_array(int * const, const int) const = 0;
+    virtual int get_rn_flt_array(float * const, const int) const = 0;
+    virtual int get_rn_dbl_array(double * const, const int) const = 0;
+    virtual int get_rn_dbl2_array(double * const, const int) const = 0;
+    virtual int get_rn_int_streams(int * const, const int, const int) const = 0;
+    virtual int get_rn_flt_streams(float * const, const int, const int) const = 0;
+    virtual int get_rn_dbl_streams(double * const, const int, const int) const = 0;
+    virtual int get_stream_stride(const int) const = 0;
     virtual SIMD_INT get_seed_rng() const = 0;
     virtual int get_ngens() const = 0;
+    virtual int pack_size() const = 0;
+    virtual int pack_rng(void * const, const int) const = 0;
+    virtual int unpack_rng(const void * const, const int) = 0;
 #if defined(DEBUG)
     virtual SIMD_INT get_prime() const = 0;
     virtual SIMD_INT get_seed() const = 0;
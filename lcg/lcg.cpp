@@ -16,14 +16,11 @@
 /*************************************************************************/
 
 
-#include <stdio.h>
-#include <string.h>
 #include "lcg.h"
 #include "lcg_globals.h"
-#include "primes_32.h"
 
 
-int LCG::LCG_NGENS = 0;
+GEN_REGISTRY LCG::LCG_NGENS;
 
 
 /*!
@@ -33,21 +30,8 @@ LCG::LCG()
 {
     gentype = GLOBALS.GENTYPE;
     rng_type = SPRNG_LCG;
-    init_seed = 0;
-    prime = 0;
-    prime_position = 0;
-    prime_next = 0;
-    parameter = 0;
-#if defined(LONG_SPRNG)
-    seed = 0;
-    multiplier = 0;
-#else
-    seed[0] = 0;
-    seed[1] = 1;
-    memset(multiplier, 0, sizeof(multiplier));
-#endif
 
-    ++LCG_NGENS;
+    LCG_NGENS.add(1);
 }
 
 
@@ -56,172 +40,96 @@ LCG::LCG()
  */
 LCG::~LCG()
 {
-    --LCG_NGENS;
-}
-
-
-#if defined(LONG_SPRNG)
-/*!
- *  \brief LCG multiply 48-bits using 64-bits.
- */
-unsigned long int LCG::multiply(const unsigned long int a, const unsigned long int b, const unsigned long int c) const
-{
-    unsigned long int res = a * b;
-
-    res += c;
-    res &= 0xFFFFFFFFFFFFUL;
-
-    return res;
+    LCG_NGENS.add(-1);
 }
-#else
-/*!
- *  \brief LCG multiply 48-bits using 32-bits.
- */
-void LCG::multiply(int * const a, const int * const b, const int c) const
-{
-    int s[4], res[4];
-
-    s[0] = a[1] & 4095U;
-    s[1] = (unsigned int)a[1] >> 0xC;
-    s[2] = a[0] & 4095U;
-    s[3] = (unsigned int)a[0] >> 0xC;
-
-    for (int i = 0; i < 4; ++i) {
-        res[i] = b[0] * s[i];
-        for (int j = 0; j < i; ++j) {
-            const int vmul = b[i-j] * s[j];
-            res[i] += vmul;
-        }
-    }
 
-    a[0] = ((unsigned int)a[1] >> 0x18) + res[2] + ((unsigned int)res[1] >> 0xC) + ((unsigned int)res[3] << 0xC);
-    a[0] &= 16777215U;
 
-    a[1] = res[0] + ((unsigned int)(res[1] & 4095U) << 0xC) + c;
-    a[1] &= 16777215U;
-}
-#endif
+int LCG::init_rng(int gn, int tg, int s, int m)
+{ return engine.init_rng(gn, tg, s, m); }
 
 
 /*!
- *  \brief Initialize RNG
+ *  \brief Initialize RNGs of consecutive generator numbers [gn, gn + ngen)
  *
- *  Gives back one generator (node gennum) with updated spawning info.
- *  Should be called total_gen times, with different value
- *  of gennum in [0,total_gen) each call.
+ *  See LCG_ENGINE::init_rng_many().
  */
-int LCG::init_rng(int gn, int tg, int s, int m)
+int LCG::init_rng_many(LCG * const * const rngs, const int ngen, int gn, int tg, int s, int m)
 {
-    if (tg <= 0) {
-        printf("ERROR: total_gen out of range, %d\n", tg);
-        tg = 1;
-    }
-    prime_next = tg;
-
-    if (gn >= GLOBALS.LCG_MAX_STREAMS)
-        printf("WARNING: generator number (%d) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", gn, GLOBALS.LCG_MAX_STREAMS);
-
-    if (gn < 0 || gn >= tg) {
-        printf("ERROR: generator number is out of range, %d\n", gn);
+    if (!rngs || ngen <= 0) {
+        printf("ERROR: invalid array of generators, %d\n", ngen);
         return -1;
     }
-    prime_position = gn;
-    getprime_32(1, &prime, prime_position);
 
-    if (m < 0 || m >= GLOBALS.NPARAMS) {
-        printf("ERROR: multiplier out of range, %d\n", m);
-        m = 0;
-    }
-    parameter = m;
+    LCG_ENGINE **engs = new LCG_ENGINE*[ngen];
+    for (int i = 0; i < ngen; ++i)
+        engs[i] = &rngs[i]->engine;
 
-    init_seed = s & 0x7FFFFFFFUL;
+    const int ierr = LCG_ENGINE::init_rng_many(engs, ngen, gn, tg, s, m);
+    delete [] engs;
 
-#if defined(LONG_SPRNG)
-    multiplier = GLOBALS.MULT[parameter];
+    return ierr;
+}
 
-    seed = GLOBALS.INIT_SEED ^ ((unsigned long int)init_seed << 16);
 
-    if (prime == 0)
-        seed |= 0x1;
-#else
-    memcpy(multiplier, GLOBALS.MULT[parameter], sizeof(multiplier));
+int LCG::advance(const long int n)
+{ return engine.advance(n); }
 
-    seed[0] = GLOBALS.INIT_SEED[0] ^ (((unsigned int)init_seed >> 0x8) & 0xFFFFFFU);
-    seed[1] = GLOBALS.INIT_SEED[1] ^ (((unsigned int)init_seed << 0x10) & 0xFF0000U);
 
-    if (prime == 0)
-        seed[1] |= 0x1;
-#endif
+int LCG::pack_size() const
+{ return engine.pack_size(); }
 
-    for (int i = 0; i < (GLOBALS.LCG_RUNUP * prime_position); ++i)
-        get_rn_dbl();
- 
-    return 0;
-}
+
+/*!
+ *  \brief Pack state into caller buffer, see LCG_ENGINE::pack_rng().
+ */
+int LCG::pack_rng(void * const buffer, const int size) const
+{ return engine.pack_rng(buffer, size); }
 
 
 /*!
- *  The high 31-bits out of the 48-bits are returned.
+ *  \brief Restore state in place, see LCG_ENGINE::unpack_rng().
  */
-int LCG::get_rn_int()
-{
-#if defined(LONG_SPRNG)
-    seed = multiply(seed, multiplier, prime);
+int LCG::unpack_rng(const void * const buffer, const int size)
+{ return engine.unpack_rng(buffer, size); }
 
-    return (int)(seed >> 0x11);
-#else
-    multiply(seed, multiplier, prime);
 
-    return (seed[0] << 0x7) | (seed[1] >> 0x11);
-#endif
-}
+int LCG::get_rn_int()
+{ return engine.get_rn_int(); }
 
 
 float LCG::get_rn_flt()
-{
-    return (float)get_rn_dbl();
-}
+{ return engine.get_rn_flt(); }
 
 
 double LCG::get_rn_dbl()
-{
-#if defined(LONG_SPRNG)
-    seed = multiply(seed, multiplier, prime);
-
-    return (double)seed * GLOBALS.TWO_M48;
-#else
-    multiply(seed, multiplier, prime);
-
-    return (double)seed[0] * GLOBALS.TWO_M24 + (double)seed[1] * GLOBALS.TWO_M48;
-#endif
-}
+{ return engine.get_rn_dbl(); }
 
 
 int LCG::get_seed_rng() const
-{ return init_seed; }
+{ return engine.get_seed_rng(); }
 
 
 int LCG::get_ngens() const
-{ return LCG_NGENS; }
+{ return LCG_NGENS.count(); }
 
 
 #if defined(DEBUG)
 int LCG::get_prime() const
-{ return prime; }
+{ return engine.get_prime(); }
 
 # if defined(LONG_SPRNG)
 unsigned long int LCG::get_seed() const
-{ return seed; }
+{ return engine.get_seed(); }
 
 unsigned long int LCG::get_multiplier() const
-{ return multiplier; }
+{ return engine.get_multiplier(); }
 
 # else
 int LCG::get_seed() const
-{ return seed[0]; }
+{ return engine.get_seed(); }
 
 int LCG::get_multiplier() const
-{ return multiplier[0]; }
+{ return engine.get_multiplier(); }
 # endif
 #endif
 
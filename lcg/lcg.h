@@ -3,24 +3,34 @@
 
 
 #include "sprng.h"
+#include "lcg_engine.h"
+#include "registry.h"
 
 
 /*! \class LCG
  *  \brief Class for linear congruential RNG.
+ *
+ *  Adapter of LCG_ENGINE for the virtual SPRNG interface.
  */
 class LCG: public SPRNG
 {
-    static int LCG_NGENS;
+    // Number of generators, per-thread counts
+    static GEN_REGISTRY LCG_NGENS;
 
   public:
     LCG();
     ~LCG();
     int init_rng(int, int, int, int);
+    static int init_rng_many(LCG * const * const, const int, int, int, int, int);
     int get_rn_int();
     float get_rn_flt();
     double get_rn_dbl();
     int get_seed_rng() const;
     int get_ngens() const;
+    int advance(const long int);
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
 #if defined(DEBUG)
     int get_prime() const;
 # if defined(LONG_SPRNG)
@@ -35,20 +45,7 @@ class LCG: public SPRNG
   private:
     const char *gentype;
     int rng_type;
-    int init_seed;
-    int prime;
-    int prime_position;
-    int prime_next;
-    int parameter;
-#if defined(LONG_SPRNG)
-    unsigned long int seed;
-    unsigned long int multiplier;
-    unsigned long int multiply(const unsigned long int, const unsigned long int, const unsigned long int) const;
-#else
-    int seed[2];
-    int multiplier[4];
-    void multiply(int * const, const int * const, const int) const;
-#endif
+    LCG_ENGINE engine;
 };
 
 
@@ -0,0 +1,424 @@
+#ifndef __LCG_ENGINE_H
+#define __LCG_ENGINE_H
+
+
+#include <stdio.h>
+#include <string.h>
+#include "lcg_globals.h"
+#include "lcg_jump.h"
+#include "lcg_pack.h"
+#include "primes_32.h"
+#include "vutils.h"
+
+
+/*! \class LCG_ENGINE
+ *  \brief Header-only linear congruential RNG.
+ *
+ *  Statically dispatched version of LCG, all methods are inline so that
+ *  user code can keep the state in registers across calls.
+ *  The LCG class is a thin adapter for the virtual SPRNG interface.
+ */
+class LCG_ENGINE
+{
+  public:
+    LCG_ENGINE();
+    int init_rng(int, int, int, int);
+    static int init_rng_many(LCG_ENGINE * const * const, const int, int, int, int, int);
+    int get_rn_int();
+    float get_rn_flt();
+    double get_rn_dbl();
+    int get_seed_rng() const;
+    int advance(const long int);
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    int get_prime() const;
+# if defined(LONG_SPRNG)
+    unsigned long int get_seed() const;
+    unsigned long int get_multiplier() const;
+# else
+    int get_seed() const;
+    int get_multiplier() const;
+# endif
+#endif
+
+  private:
+    int init_seed;
+    int prime;
+    int prime_position;
+    int prime_next;
+    int parameter;
+#if defined(LONG_SPRNG)
+    unsigned long int seed;
+    unsigned long int multiplier;
+    unsigned long int multiply(const unsigned long int, const unsigned long int, const unsigned long int) const;
+#else
+    int seed[2];
+    int multiplier[4];
+    void multiply(int * const, const int * const, const int) const;
+#endif
+    void set_stream(const int, const int);
+};
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+inline LCG_ENGINE::LCG_ENGINE()
+{
+    init_seed = 0;
+    prime = 0;
+    prime_position = 0;
+    prime_next = 0;
+    parameter = 0;
+#if defined(LONG_SPRNG)
+    seed = 0;
+    multiplier = 0;
+#else
+    seed[0] = 0;
+    seed[1] = 1;
+    memset(multiplier, 0, sizeof(multiplier));
+#endif
+}
+
+
+#if defined(LONG_SPRNG)
+/*!
+ *  \brief LCG multiply 48-bits using 64-bits.
+ */
+inline unsigned long int LCG_ENGINE::multiply(const unsigned long int a, const unsigned long int b, const unsigned long int c) const
+{
+    unsigned long int res = a * b;
+
+    res += c;
+    res &= 0xFFFFFFFFFFFFUL;
+
+    return res;
+}
+#else
+/*!
+ *  \brief LCG multiply 48-bits using 32-bits.
+ */
+inline void LCG_ENGINE::multiply(int * const a, const int * const b, const int c) const
+{
+    int s[4], res[4];
+
+    s[0] = a[1] & 4095U;
+    s[1] = (unsigned int)a[1] >> 0xC;
+    s[2] = a[0] & 4095U;
+    s[3] = (unsigned int)a[0] >> 0xC;
+
+    for (int i = 0; i < 4; ++i) {
+        res[i] = b[0] * s[i];
+        for (int j = 0; j < i; ++j) {
+            const int vmul = b[i-j] * s[j];
+            res[i] += vmul;
+        }
+    }
+
+    a[1] = res[0] + ((unsigned int)(res[1] & 4095U) << 0xC) + c;
+
+    a[0] = ((unsigned int)a[1] >> 0x18) + res[2] + ((unsigned int)res[1] >> 0xC) + ((unsigned int)res[3] << 0xC);
+    a[0] &= 16777215U;
+    a[1] &= 16777215U;
+}
+#endif
+
+
+/*!
+ *  \brief Initialize RNG
+ *
+ *  Gives back one generator (node gennum) with updated spawning info.
+ *  Should be called total_gen times, with different value
+ *  of gennum in [0,total_gen) each call.
+ */
+inline int LCG_ENGINE::init_rng(int gn, int tg, int s, int m)
+{
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+    prime_next = tg;
+
+    if (gn >= GLOBALS.LCG_MAX_STREAMS)
+        printf("WARNING: generator number (%d) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", gn, GLOBALS.LCG_MAX_STREAMS);
+
+    if (gn < 0 || gn >= tg) {
+        printf("ERROR: generator number is out of range, %d\n", gn);
+        return -1;
+    }
+    prime_position = gn;
+    getprime_32(1, &prime, prime_position);
+
+    if (m < 0 || m >= GLOBALS.NPARAMS) {
+        printf("ERROR: multiplier out of range, %d\n", m);
+        m = 0;
+    }
+    set_stream(s, m);
+
+    advance(GLOBALS.LCG_RUNUP * prime_position);
+    return 0;
+}
+
+
+/*!
+ *  \brief Initial state of stream from seed and multiplier (prime already set).
+ */
+inline void LCG_ENGINE::set_stream(const int s, const int m)
+{
+    parameter = m;
+
+    init_seed = s & 0x7FFFFFFFUL;
+
+#if defined(LONG_SPRNG)
+    multiplier = GLOBALS.MULT[parameter];
+
+    seed = GLOBALS.INIT_SEED ^ ((unsigned long int)init_seed << 16);
+
+    if (prime == 0)
+        seed |= 0x1;
+#else
+    memcpy(multiplier, GLOBALS.MULT[parameter], sizeof(multiplier));
+
+    seed[0] = GLOBALS.INIT_SEED[0] ^ (((unsigned int)init_seed >> 0x8) & 0xFFFFFFU);
+    seed[1] = GLOBALS.INIT_SEED[1] ^ (((unsigned int)init_seed << 0x10) & 0xFF0000U);
+
+    if (prime == 0)
+        seed[1] |= 0x1;
+#endif
+}
+
+
+/*!
+ *  \brief Initialize RNGs of consecutive generator numbers [gn, gn + ngen)
+ *
+ *  Same as calling engs[i]->init_rng(gn + i, tg, s, m) for each generator.
+ *  Primes are obtained in a single search and warm-up jumps of consecutive
+ *  generators are computed incrementally, O(1) per generator instead of O(log n).
+ *  Returns 0 on success or -1 on error.
+ */
+inline int LCG_ENGINE::init_rng_many(LCG_ENGINE * const * const engs, const int ngen, int gn, int tg, int s, int m)
+{
+    if (!engs || ngen <= 0) {
+        printf("ERROR: invalid array of generators, %d\n", ngen);
+        return -1;
+    }
+
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+
+    if (gn + ngen - 1 >= GLOBALS.LCG_MAX_STREAMS)
+        printf("WARNING: generator number (%d) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", gn + ngen - 1, GLOBALS.LCG_MAX_STREAMS);
+
+    if (gn < 0 || gn > tg - ngen) {
+        printf("ERROR: generator numbers are out of range, [%d, %d)\n", gn, gn + ngen);
+        return -1;
+    }
+
+    if (m < 0 || m >= GLOBALS.NPARAMS) {
+        printf("ERROR: multiplier out of range, %d\n", m);
+        m = 0;
+    }
+
+    int *primes = NULL;
+    if (scalar_malloc(&primes, sizeof(void *), ngen))
+        return -1;
+    if (getprimes_32(ngen, primes, gn) < ngen) {
+        scalar_free(&primes);
+        return -1;
+    }
+
+    // Jump coefficients (prime of 1) of warm-up of generator gn, and of one more generator
+#if defined(LONG_SPRNG)
+    unsigned long int A, S, AR, SR;
+    lcg_jump(&A, &S, GLOBALS.MULT[m], 0x1UL, GLOBALS.LCG_RUNUP * (long int)gn);
+    lcg_jump(&AR, &SR, GLOBALS.MULT[m], 0x1UL, GLOBALS.LCG_RUNUP);
+#else
+    int A[4], S[2], AR[4], SR[2];
+    lcg_jump(A, S, GLOBALS.MULT[m], 1, GLOBALS.LCG_RUNUP * (long int)gn);
+    lcg_jump(AR, SR, GLOBALS.MULT[m], 1, GLOBALS.LCG_RUNUP);
+#endif
+
+    for (int i = 0; i < ngen; ++i) {
+        LCG_ENGINE * const eng = engs[i];
+        eng->prime_next = tg;
+        eng->prime_position = gn + i;
+        eng->prime = primes[i];
+        eng->set_stream(s, m);
+
+#if defined(LONG_SPRNG)
+        eng->seed = lcg_jump_apply(eng->seed, A, lcg_jump_scale(S, (unsigned long int)eng->prime));
+        lcg_jump_compose(&A, &S, AR, SR);
+#else
+        int C[2];
+        lcg_jump_scale(C, S, eng->prime);
+        lcg_jump_apply(eng->seed, A, C);
+        lcg_jump_compose(A, S, AR, SR);
+#endif
+    }
+
+    scalar_free(&primes);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Advance stream n steps in O(log n) operations.
+ *
+ *  Equivalent to calling get_rn_dbl() n times.
+ */
+inline int LCG_ENGINE::advance(const long int n)
+{
+    if (n < 0) {
+        printf("ERROR: number of steps to advance is out of range, %ld\n", n);
+        return -1;
+    }
+
+#if defined(LONG_SPRNG)
+    unsigned long int A, C;
+    lcg_jump(&A, &C, multiplier, (unsigned long int)prime, n);
+    seed = lcg_jump_apply(seed, A, C);
+#else
+    int A[4], C[2];
+    lcg_jump(A, C, multiplier, prime, n);
+    lcg_jump_apply(seed, A, C);
+#endif
+
+    return 0;
+}
+
+
+/*!
+ *  The high 31-bits out of the 48-bits are returned.
+ */
+inline int LCG_ENGINE::get_rn_int()
+{
+#if defined(LONG_SPRNG)
+    seed = multiply(seed, multiplier, prime);
+
+    return (int)(seed >> 0x11);
+#else
+    multiply(seed, multiplier, prime);
+
+    return (seed[0] << 0x7) | (seed[1] >> 0x11);
+#endif
+}
+
+
+inline float LCG_ENGINE::get_rn_flt()
+{
+    return (float)get_rn_dbl();
+}
+
+
+inline double LCG_ENGINE::get_rn_dbl()
+{
+#if defined(LONG_SPRNG)
+    seed = multiply(seed, multiplier, prime);
+
+    return (double)seed * GLOBALS.TWO_M48;
+#else
+    multiply(seed, multiplier, prime);
+
+    return (double)seed[0] * GLOBALS.TWO_M24 + (double)seed[1] * GLOBALS.TWO_M48;
+#endif
+}
+
+
+/*!
+ *  \brief Size in bytes of packed state.
+ */
+inline int LCG_ENGINE::pack_size() const
+{ return lcg_pack_size(1); }
+
+
+/*!
+ *  \brief Pack state into caller buffer (see lcg_pack.h).
+ *
+ *  Returns number of bytes written or -1 on error.
+ */
+inline int LCG_ENGINE::pack_rng(void * const buffer, const int size) const
+{
+    const int nbytes = lcg_pack_check(buffer, size, 1);
+    if (nbytes < 0)
+        return -1;
+
+    const LCG_PACK_VIEW pack = lcg_pack_view(buffer, 1);
+    lcg_pack_header(pack.header, 1, 0, prime_position, prime_next);
+#if defined(LONG_SPRNG)
+    pack.seed[0] = seed;
+#else
+    pack.seed[0] = ((uint64_t)seed[0] << 24) | (uint64_t)seed[1];
+#endif
+    pack.init_seed[0] = init_seed;
+    pack.prime[0] = prime;
+    pack.parameter[0] = parameter;
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Restore state in place from packed state (see lcg_pack.h).
+ *
+ *  Returns number of bytes read or -1 on error, state is not modified on error.
+ */
+inline int LCG_ENGINE::unpack_rng(const void * const buffer, const int size)
+{
+    if (lcg_unpack_check(buffer, size, 1) < 0)
+        return -1;
+
+    const LCG_PACK_VIEW pack = lcg_pack_view(buffer, 1);
+    if (pack.parameter[0] < 0 || pack.parameter[0] >= GLOBALS.NPARAMS) {
+        printf("ERROR: Unpacked parameters not acceptable.\n");
+        return -1;
+    }
+
+    prime_position = pack.header->prime_position;
+    prime_next = pack.header->prime_next;
+    init_seed = pack.init_seed[0];
+    prime = pack.prime[0];
+    parameter = pack.parameter[0];
+#if defined(LONG_SPRNG)
+    multiplier = GLOBALS.MULT[parameter];
+    seed = pack.seed[0] & 0xFFFFFFFFFFFFUL;
+#else
+    memcpy(multiplier, GLOBALS.MULT[parameter], sizeof(multiplier));
+    seed[0] = (int)((pack.seed[0] >> 24) & 0xFFFFFFU);
+    seed[1] = (int)(pack.seed[0] & 0xFFFFFFU);
+#endif
+
+    return lcg_pack_size(1);
+}
+
+
+inline int LCG_ENGINE::get_seed_rng() const
+{ return init_seed; }
+
+
+#if defined(DEBUG)
+inline int LCG_ENGINE::get_prime() const
+{ return prime; }
+
+# if defined(LONG_SPRNG)
+inline unsigned long int LCG_ENGINE::get_seed() const
+{ return seed; }
+
+inline unsigned long int LCG_ENGINE::get_multiplier() const
+{ return multiplier; }
+
+# else
+inline int LCG_ENGINE::get_seed() const
+{ return seed[0]; }
+
+inline int LCG_ENGINE::get_multiplier() const
+{ return multiplier[0]; }
+# endif
+#endif
+
+
+#endif  // __LCG_ENGINE_H
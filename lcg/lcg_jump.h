@@ -0,0 +1,186 @@
+#ifndef __LCG_JUMP_H
+#define __LCG_JUMP_H
+
+
+/*
+ *  Jump-ahead for 48-bit LCG.
+ *
+ *  n steps of x = a * x + p (mod 2^48) form the affine map x = A * x + C with
+ *  A = a^n and C = p * (a^(n-1) + ... + a + 1). Both coefficients are obtained
+ *  in O(log n) by repeated squaring of the single step map.
+ *
+ *  Scalar functions are shared by LCG and VLCG (applied per lane).
+ */
+
+
+#if defined(LONG_SPRNG)
+/*!
+ *  \brief Compute jump coefficients for n steps using 64-bit integers.
+ */
+inline static void lcg_jump(unsigned long int * const A, unsigned long int * const C, const unsigned long int mult, const unsigned long int prime, long int n)
+{
+    const unsigned long int msk_lsb48 = 0xFFFFFFFFFFFFUL;
+    unsigned long int acur = mult;
+    unsigned long int ccur = prime;
+
+    *A = 0x1UL;
+    *C = 0x0UL;
+    while (n > 0) {
+        if (n & 0x1L) {
+            *A = (*A * acur) & msk_lsb48;
+            *C = (*C * acur + ccur) & msk_lsb48;
+        }
+        ccur = (ccur * acur + ccur) & msk_lsb48;
+        acur = (acur * acur) & msk_lsb48;
+        n >>= 1;
+    }
+}
+
+
+/*!
+ *  \brief Apply jump coefficients, x = A * x + C (mod 2^48).
+ */
+inline static unsigned long int lcg_jump_apply(const unsigned long int x, const unsigned long int A, const unsigned long int C)
+{ return (A * x + C) & 0xFFFFFFFFFFFFUL; }
+
+
+/*!
+ *  \brief Append jump coefficients of R steps, (A, S) = (A * AR, S * AR + SR).
+ *
+ *  Coefficients computed with a prime of 1 (S) are scaled by the
+ *  prime of a generator afterwards, C = prime * S (see lcg_jump_scale()).
+ *  Allows warm-up of consecutive generator numbers in O(1) each.
+ */
+inline static void lcg_jump_compose(unsigned long int * const A, unsigned long int * const S, const unsigned long int AR, const unsigned long int SR)
+{
+    *A = (*A * AR) & 0xFFFFFFFFFFFFUL;
+    *S = (*S * AR + SR) & 0xFFFFFFFFFFFFUL;
+}
+
+
+/*!
+ *  \brief Scale additive coefficient computed with a prime of 1, C = prime * S.
+ */
+inline static unsigned long int lcg_jump_scale(const unsigned long int S, const unsigned long int prime)
+{ return (S * prime) & 0xFFFFFFFFFFFFUL; }
+
+#else
+/*!
+ *  \brief Multiply-add 48-bits using 32-bits, r = x * y + c (mod 2^48).
+ *
+ *  x, c, and r are split into 24-bit limbs {high, low} as the seed,
+ *  y is split into 12-bit limbs (lowest first) as the multiplier.
+ *  r may alias x or c.
+ */
+inline static void lcg_muladd(int * const r, const int * const x, const int * const y, const int * const c)
+{
+    unsigned int s[4], res[4];
+    unsigned int lo, hi;
+
+    s[0] = (unsigned int)x[1] & 4095U;
+    s[1] = (unsigned int)x[1] >> 0xC;
+    s[2] = (unsigned int)x[0] & 4095U;
+    s[3] = (unsigned int)x[0] >> 0xC;
+
+    for (int i = 0; i < 4; ++i) {
+        res[i] = (unsigned int)y[0] * s[i];
+        for (int j = 0; j < i; ++j)
+            res[i] += (unsigned int)y[i-j] * s[j];
+    }
+
+    lo = res[0] + ((res[1] & 4095U) << 0xC) + (unsigned int)c[1];
+    hi = (lo >> 0x18) + res[2] + (res[1] >> 0xC) + (res[3] << 0xC) + (unsigned int)c[0];
+
+    r[0] = (int)(hi & 16777215U);
+    r[1] = (int)(lo & 16777215U);
+}
+
+
+/*!
+ *  \brief Split 24-bit limbs {high, low} into 12-bit limbs (lowest first).
+ */
+inline static void lcg_split(int * const y, const int * const x)
+{
+    y[0] = x[1] & 4095;
+    y[1] = (unsigned int)x[1] >> 0xC;
+    y[2] = x[0] & 4095;
+    y[3] = (unsigned int)x[0] >> 0xC;
+}
+
+
+/*!
+ *  \brief Compute jump coefficients for n steps using 32-bit integers.
+ *
+ *  A is returned as 12-bit limbs (multiplier layout) and
+ *  C as 24-bit limbs (seed layout).
+ */
+inline static void lcg_jump(int * const A, int * const C, const int * const mult, const int prime, long int n)
+{
+    const int zero[2] = {0, 0};
+    int acur[4] = {mult[0], mult[1], mult[2], mult[3]};
+    int ccur[2] = {0, prime};
+    int ares[2] = {0, 1};
+    int atmp[2];
+
+    C[0] = 0;
+    C[1] = 0;
+    while (n > 0) {
+        if (n & 0x1L) {
+            lcg_muladd(ares, ares, acur, zero);
+            lcg_muladd(C, C, acur, ccur);
+        }
+        lcg_muladd(ccur, ccur, acur, ccur);
+
+        atmp[0] = (acur[3] << 0xC) | acur[2];
+        atmp[1] = (acur[1] << 0xC) | acur[0];
+        lcg_muladd(atmp, atmp, acur, zero);
+        lcg_split(acur, atmp);
+        n >>= 1;
+    }
+
+    lcg_split(A, ares);
+}
+
+
+/*!
+ *  \brief Apply jump coefficients, x = A * x + C (mod 2^48).
+ */
+inline static void lcg_jump_apply(int * const x, const int * const A, const int * const C)
+{ lcg_muladd(x, x, A, C); }
+
+
+/*!
+ *  \brief Append jump coefficients of R steps, (A, S) = (A * AR, S * AR + SR).
+ *
+ *  A and AR are 12-bit limbs, S and SR are 24-bit limbs (see lcg_jump()).
+ */
+inline static void lcg_jump_compose(int * const A, int * const S, const int * const AR, const int * const SR)
+{
+    const int zero[2] = {0, 0};
+    int atmp[2];
+
+    lcg_muladd(S, S, AR, SR);
+
+    atmp[0] = (A[3] << 0xC) | A[2];
+    atmp[1] = (A[1] << 0xC) | A[0];
+    lcg_muladd(atmp, atmp, AR, zero);
+    lcg_split(A, atmp);
+}
+
+
+/*!
+ *  \brief Scale additive coefficient computed with a prime of 1, C = prime * S.
+ */
+inline static void lcg_jump_scale(int * const C, const int * const S, const int prime)
+{
+    const int zero[2] = {0, 0};
+    const int p[2] = {0, prime};
+    int y[4];
+
+    lcg_split(y, p);
+    lcg_muladd(C, S, y, zero);
+}
+#endif
+
+
+#endif  // __LCG_JUMP_H
@@ -0,0 +1,116 @@
+#ifndef __LCG_PACK_H
+#define __LCG_PACK_H
+
+
+#include <stdint.h>  // fixed width integers
+#include "sprng.h"   // SPRNG_LCG, SPRNG_LCG64
+#include "pack.h"
+
+
+/*
+ *  Checkpoint format of LCG and VLCG (packed state), version 1.
+ *  LCG64 and VLCG64 use the same format with their own rng_type.
+ *
+ *  Fixed layout in host byte order, independent of SIMD mode and LONG_SPRNG:
+ *
+ *    LCG_PACK_HEADER            24 bytes
+ *    uint64_t seed[n]           48-bit (64-bit for LCG64) seeds
+ *    int32_t init_seed[n]
+ *    int32_t prime[n]
+ *    int32_t parameter[n]       multiplier index
+ *
+ *  for n streams, padded with zeros to a multiple of 8 bytes. Buffers have
+ *  to be 8-byte aligned, packed generators can be placed back to back.
+ *  Multipliers are restored from parameters. An LCG and a VLCG with a
+ *  single active stream use the same packed state.
+ */
+const uint32_t LCG_PACK_MAGIC = 0x47434C53U;  /*!< "SLCG" */
+const uint16_t LCG_PACK_VERSION = 1;
+
+
+struct LCG_PACK_HEADER
+{
+    PACK_HEADER base;
+    int32_t per_lane;  /*!< streams use generator numbers prime_position + i */
+    int32_t prime_position;
+    int32_t prime_next;
+};
+
+
+/*!
+ *  Arrays of packed state of n streams.
+ */
+struct LCG_PACK_VIEW
+{
+    LCG_PACK_HEADER *header;
+    uint64_t *seed;
+    int32_t *init_seed;
+    int32_t *prime;
+    int32_t *parameter;
+};
+
+
+/*!
+ *  \brief Size in bytes of packed state of n streams.
+ */
+inline static int lcg_pack_size(const int n)
+{
+    return pack_align((int)sizeof(LCG_PACK_HEADER) + n * (int)(sizeof(uint64_t) + 3 * sizeof(int32_t)));
+}
+
+
+/*!
+ *  \brief Arrays of packed state of n streams in buffer.
+ */
+inline static LCG_PACK_VIEW lcg_pack_view(const void * const buffer, const int n)
+{
+    LCG_PACK_VIEW view;
+    view.header = (LCG_PACK_HEADER *)buffer;
+    view.seed = (uint64_t *)(view.header + 1);
+    view.init_seed = (int32_t *)(view.seed + n);
+    view.prime = view.init_seed + n;
+    view.parameter = view.prime + n;
+    return view;
+}
+
+
+/*!
+ *  \brief Check buffer for packing n streams, clears padding.
+ *
+ *  Returns packed size or -1 on error.
+ */
+inline static int lcg_pack_check(void * const buffer, const int size, const int n)
+{
+    return pack_check(buffer, size, lcg_pack_size(n));
+}
+
+
+/*!
+ *  \brief Check header of packed state of type rng_type with at most max_streams streams.
+ *
+ *  Returns number of streams or -1 on error.
+ */
+inline static int lcg_unpack_check(const void * const buffer, const int size, const int max_streams, const int rng_type = SPRNG_LCG)
+{
+    const int n = pack_check_header(buffer, size, LCG_PACK_MAGIC, LCG_PACK_VERSION, rng_type, max_streams, (int)sizeof(LCG_PACK_HEADER));
+    if (n < 0 || pack_check_size(size, lcg_pack_size(n)) < 0)
+        return -1;
+
+    return n;
+}
+
+
+/*!
+ *  \brief Fill header of packed state.
+ */
+inline static void lcg_pack_header(LCG_PACK_HEADER * const header, const int n, const int per_lane, const int prime_position, const int prime_next, const int rng_type = SPRNG_LCG)
+{
+    pack_header(&header->base, LCG_PACK_MAGIC, LCG_PACK_VERSION, rng_type, n);
+    header->per_lane = per_lane;
+    header->prime_position = prime_position;
+    header->prime_next = prime_next;
+}
+
+
+#endif  // __LCG_PACK_H
+
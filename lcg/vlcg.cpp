@@ -18,69 +18,40 @@
 
 
 #include <stdio.h>   // printf
-#include <string.h>  // memset
+#include <stdlib.h>  // posix_memalign, free
+#include <new>       // placement new, std::bad_alloc
 #include "vlcg.h"
 #include "lcg_globals.h"
-#include "primes_32.h"
-#include "vutils.h"
+#include "vlcg_isa.h"
 
 
-int VLCG::LCG_NGENS = 0;
+GEN_REGISTRY VLCG::LCG_NGENS;
 
 
 /*!
  *  \brief Constructor (no parameters)
+ *
+ *  Engine is allocated aligned to SIMD_WIDTH_BYTES since it holds SIMD registers by value.
+ *  Throws std::bad_alloc if allocation fails, as new does.
  */
 VLCG::VLCG()
 {
     gentype = GLOBALS.GENTYPE;
     rng_type = VSPRNG_LCG;
-    prime_position = 0;
-    prime_next = 0;
-    strm_mask32 = NULL;
-    strm_mask64 = NULL;
-
-#if defined(LONG_SPRNG)
-    simd_malloc(&init_seed, SIMD_WIDTH_BYTES, 2);
-    simd_set_zero(&init_seed[0]);
-    simd_set_zero(&init_seed[1]);
-
-    simd_malloc(&parameter, SIMD_WIDTH_BYTES, 2);
-    simd_set_zero(&parameter[0]);
-    simd_set_zero(&parameter[1]);
-
-    simd_malloc(&prime, SIMD_WIDTH_BYTES, 2);
-    simd_set_zero(&prime[0]);
-    simd_set_zero(&prime[1]);
-
-    simd_malloc(&seed, SIMD_WIDTH_BYTES, 2);
-    simd_set_zero(&seed[0]);
-    simd_set_zero(&seed[1]);
-
-    simd_malloc(&multiplier, SIMD_WIDTH_BYTES, 2);
-    simd_set_zero(&multiplier[0]);
-    simd_set_zero(&multiplier[1]);
-
-#else
-    simd_malloc(&init_seed, SIMD_WIDTH_BYTES, 1);
-    simd_set_zero(&init_seed[0]);
 
-    simd_malloc(&parameter, SIMD_WIDTH_BYTES, 1);
-    simd_set_zero(&parameter[0]);
-
-    simd_malloc(&prime, SIMD_WIDTH_BYTES, 1);
-    simd_set_zero(&prime[0]);
-
-    simd_malloc(&seed, SIMD_WIDTH_BYTES, 2);
-    simd_set_zero(&seed[0]);
-    seed[1] = simd_set(0x1U);
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, SIMD_WIDTH_BYTES, sizeof(VLCG_ENGINE))) {
+        printf("ERROR: failed to allocate aligned memory for VLCG engine\n");
+        throw std::bad_alloc();
+    }
+    engine = new (ptr) VLCG_ENGINE();
 
-    simd_malloc(&multiplier, SIMD_WIDTH_BYTES, 4);
-    for (int i = 0; i < 4; ++i)
-        simd_set_zero(multiplier+i);
-#endif
+    // Array kernels of a better SIMD mode with the same engine layout
+    isa = vlcg_isa_select(SIMD_LEVEL_AVX512, SIMD_WIDTH_BYTES);
+    if (isa && (isa->level <= VLCG_ISA_LEVEL || isa->engine_size != (int)sizeof(VLCG_ENGINE)))
+        isa = NULL;
 
-    ++LCG_NGENS;
+    LCG_NGENS.add(1);
 }
 
 
@@ -89,440 +60,202 @@ VLCG::VLCG()
  */
 VLCG::~VLCG()
 {
-    simd_free(&init_seed);
-    simd_free(&parameter);
-    simd_free(&prime);
-    simd_free(&seed);
-    simd_free(&multiplier);
-    simd_free(&strm_mask32);
-    simd_free(&strm_mask64);
-
-    --LCG_NGENS;
+    engine->~VLCG_ENGINE();
+    free(engine);
+
+    LCG_NGENS.add(-1);
 }
 
 
-#if defined(LONG_SPRNG)
-/*!
- *  \brief LCG multiply 48-bits using 64-bits.
- */
-void VLCG::multiply(SIMD_INT * const a, const SIMD_INT * const b, const SIMD_INT * const c) const
-{
-    const SIMD_INT vmsk_lsb48 = simd_set(0xFFFFFFFFFFFFUL);
+int VLCG::init_rng(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{ return engine->init_rng(gn, tg, gs, gm, ns); }
+
 
-    a[0] = simd_mul_u64(a[0], b[0]);
-    a[0] = simd_add_i64(a[0], c[0]);
-    a[0] = simd_and(a[0], vmsk_lsb48);
-}
-#else
 /*!
- *  \brief LCG multiply 48-bits using 32-bits.
+ *  \brief Initialize RNG with generator numbers [gn, gn + ns), one per stream
+ *
+ *  See VLCG_ENGINE::init_rng_lanes().
  */
-void VLCG::multiply(SIMD_INT * const a, const SIMD_INT * const b, const SIMD_INT * const c) const
-{
+int VLCG::init_rng_lanes(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{ return engine->init_rng_lanes(gn, tg, gs, gm, ns); }
 
-    const SIMD_INT vmsk_fac[2] __SIMD_ALIGN__ = { simd_set(4095U),
-                                              simd_set(16777215U) };
-    SIMD_INT s[4] __SIMD_ALIGN__;
-    SIMD_INT res[4] __SIMD_ALIGN__;
-    SIMD_INT vtmp[3] __SIMD_ALIGN__;
-
-    s[0] = simd_and(a[1], vmsk_fac[0]);
-    s[1] = simd_srl_32(a[1], 0xC);
-    s[2] = simd_and(a[0], vmsk_fac[0]);
-    s[3] = simd_srl_32(a[0], 0xC);
-
-    for (int i = 0; i < 4; ++i) {
-        SIMD_INT * const res_ptr __SIMD_ALIGN__ = res + i;
-
-        *res_ptr = simd_mullo_i32(b[0], *(s+i));
-        for (int j = 0; j < i; ++j) {
-            const SIMD_INT vmul = simd_mullo_i32(*(b+i-j), *(s+j));
-            *res_ptr = simd_add_i32(*res_ptr, vmul);
-        }
-    }
 
-    vtmp[0] = simd_srl_32(a[1], 0x18);
-    vtmp[1] = simd_srl_32(res[1], 0xC);
-    vtmp[2] = simd_sll_32(res[3], 0xC);
-    vtmp[0] = simd_add_i32(vtmp[0], res[2]);
-    vtmp[1] = simd_add_i32(vtmp[1], vtmp[2]);
-    vtmp[0] = simd_add_i32(vtmp[0], vtmp[1]);
-    a[0] = simd_and(vtmp[0], vmsk_fac[1]);
-
-    vtmp[0] = simd_and(res[1], vmsk_fac[0]);
-    vtmp[1] = simd_add_i32(res[0], c[0]);
-    vtmp[0] = simd_sll_32(vtmp[0], 0xC);
-    vtmp[0] = simd_add_i32(vtmp[0], vtmp[1]);
-    a[1] = simd_and(vtmp[0], vmsk_fac[1]);
-}
-#endif
+/*!
+ *  \brief Reseed streams in place, without heap allocation
+ *
+ *  See VLCG_ENGINE::reseed_rng().
+ */
+int VLCG::reseed_rng(const int * const gs)
+{ return engine->reseed_rng(gs); }
 
 
 /*!
- *  \brief Initialize RNG
- *
- *  NOTE: The gn parameter is the same for all streams since the generators are run
- *  for a while based on gn. This also applies to tg parameter.
- *  Consequently, a single and same prime number is used for all streams.
+ *  \brief Initialize RNGs of consecutive generator numbers [gn, gn + ngen)
  *
- *  NOTE: int and float streams use all parameters from input arrays,
- *  double stream use the first half of the parameters from input arrays.
+ *  See VLCG_ENGINE::init_rng_many().
  */
-int VLCG::init_rng(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+int VLCG::init_rng_many(VLCG * const * const rngs, const int ngen, int gn, int tg, const int * const gs, const int * const gm, const int ns)
 {
-    // Check total generators
-    if (tg <= 0) {
-        printf("ERROR: total_gen out of range, %d\n", tg);
-        tg = 1;
+    if (!rngs || ngen <= 0) {
+        printf("ERROR: invalid array of generators, %d\n", ngen);
+        return -1;
     }
 
-    // Check generator number
-    if (gn < 0 || gn >= tg) {
-        printf("ERROR: generator number is out of range, %d\n", gn);
-        gn = tg - 1;
-    }
-    if (gn >= GLOBALS.LCG_MAX_STREAMS)
-        printf("WARNING: generator number (%d) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", gn, GLOBALS.LCG_MAX_STREAMS);
-
-    // Check number of streams requested
-    int nstrms = ns;
-    if (nstrms <= 0 || nstrms > SIMD_STREAMS_32) {
-        printf("ERROR: number of streams is out of range, %d, default is to use all available streams.\n", nstrms);
-        nstrms = SIMD_STREAMS_32;
-    }
+    VLCG_ENGINE **engs = new VLCG_ENGINE*[ngen];
+    for (int i = 0; i < ngen; ++i)
+        engs[i] = rngs[i]->engine;
 
-    // Check multipliers
-    int *m = NULL;
-    scalar_malloc(&m, SIMD_WIDTH_BYTES, SIMD_STREAMS_32);
-    memset(m, 0, SIMD_STREAMS_32 * sizeof(int));
-    if (!gm)
-        printf("WARNING: no array for multipliers provided, default is zero.\n");
-    else {
-        for (int strm = 0; strm < nstrms; ++strm)
-            if (gm[strm] < 0 || gm[strm] >= GLOBALS.NPARAMS)
-                printf("ERROR: multiplier out of range, %d\n", gm[strm]);
-            else
-                m[strm] = gm[strm];
-    }
+    const int ierr = VLCG_ENGINE::init_rng_many(engs, ngen, gn, tg, gs, gm, ns);
+    delete [] engs;
 
-    // Check seeds
-    int *s = NULL;
-    scalar_malloc(&s, SIMD_WIDTH_BYTES, SIMD_STREAMS_32);
-    memset(s, 0, SIMD_STREAMS_32 * sizeof(int));
-    if (!gs)
-        printf("WARNING: no array for seeds provided, default is zero.\n");
-    else {
-        for (int strm = 0; strm < nstrms; ++strm)
-            s[strm] = gs[strm];
-    }
-
-    // Generate prime number
-    int lprime;
-    prime_next = tg;
-    prime_position = gn;
-    getprime_32(1, &lprime, prime_position);
-
-    // Activate 32-bit global output masks, only if not using maximum number of streams
-    int *mask32 = NULL;
-    if (nstrms < SIMD_STREAMS_32) {
-        simd_malloc(&strm_mask32, SIMD_WIDTH_BYTES, 1);
-
-        scalar_malloc(&mask32, SIMD_WIDTH_BYTES, SIMD_STREAMS_32);
-        for (int strm = 0; strm < nstrms; ++strm)
-            mask32[strm] = 0xFFFFFFFF;
-        for (int strm = nstrms; strm < SIMD_STREAMS_32; ++strm)
-            mask32[strm] = 0x00000000;
-
-        strm_mask32[0] = simd_set(&mask32[0], SIMD_STREAMS_32);
-        scalar_free(&mask32);
-    }
-
-    // Activate 64-bit global output masks, only if not using maximum number of streams
-    long int *mask64 = NULL;
-    if (nstrms < SIMD_STREAMS_32) {
-        simd_malloc(&strm_mask64, SIMD_WIDTH_BYTES, 2);
+    return ierr;
+}
 
-        scalar_malloc(&mask64, SIMD_WIDTH_BYTES, SIMD_STREAMS_32);
-        for (int strm = 0; strm < nstrms; ++strm)
-            mask64[strm] = 0xFFFFFFFFFFFFFFFFL;
-        for (int strm = nstrms; strm < SIMD_STREAMS_32; ++strm)
-            mask64[strm] = 0x0000000000000000L;
 
-        strm_mask64[0] = simd_set(&mask64[0], SIMD_STREAMS_64);
-        strm_mask64[1] = simd_set(&mask64[SIMD_STREAMS_64], SIMD_STREAMS_64);
-        scalar_free(&mask64);
+/*!
+ *  \brief Spawn new generators
+ *
+ *  Array of generators is allocated with new[], each generator has to be
+ *  deleted and then the array. See VLCG_ENGINE::spawn_rng().
+ *  Returns number of generators spawned or -1 on error.
+ */
+int VLCG::spawn_rng(const int nspawned, VSPRNG *** const newgens)
+{
+    if (!newgens || nspawned <= 0) {
+        printf("ERROR: invalid array of generators, %d\n", nspawned);
+        return -1;
     }
 
-#if defined(LONG_SPRNG)
-    parameter[0] = simd_set(&m[0], SIMD_STREAMS_64);
-    parameter[1] = simd_set(&m[SIMD_STREAMS_64], SIMD_STREAMS_64);
-
-    long int lmultiplier[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
-    for (int i = 0; i < SIMD_STREAMS_64; ++i) {
-        lmultiplier[0][i] = GLOBALS.MULT[m[i]];
-        lmultiplier[1][i] = GLOBALS.MULT[m[i+SIMD_STREAMS_64]];
-    }
-    multiplier[0] = simd_set(lmultiplier[0], SIMD_STREAMS_64);
-    multiplier[1] = simd_set(lmultiplier[1], SIMD_STREAMS_64);
-
-    SIMD_INT vs[2] __SIMD_ALIGN__;
-    vs[0] = simd_set(&s[0], SIMD_STREAMS_64);
-    vs[1] = simd_set(&s[SIMD_STREAMS_64], SIMD_STREAMS_64);
-
-    const SIMD_INT vmsk_lsb31 = simd_set(0x7FFFFFFFUL);
-    init_seed[0] = simd_and(vs[0], vmsk_lsb31);
-    init_seed[1] = simd_and(vs[1], vmsk_lsb31);
-
-    vs[0] = simd_sll_64(init_seed[0], 0x10);
-    vs[1] = simd_sll_64(init_seed[1], 0x10);
-
-    const SIMD_INT vmsk_seed = simd_set(GLOBALS.INIT_SEED);
-    seed[0] = simd_xor(vmsk_seed, vs[0]);
-    seed[1] = simd_xor(vmsk_seed, vs[1]);
-
-    const SIMD_INT vmsk_lsb1 = simd_set(0x1UL);
-    prime[0] = simd_set_64(lprime);
-    prime[1] = simd_set_64(lprime);
-    if (lprime == 0) {
-        seed[0] = simd_or(seed[0], vmsk_lsb1);
-        seed[1] = simd_or(seed[1], vmsk_lsb1);
+    VSPRNG **gens = new VSPRNG*[nspawned];
+    VLCG_ENGINE **engs = new VLCG_ENGINE*[nspawned];
+    for (int i = 0; i < nspawned; ++i) {
+        VLCG * const gen = new VLCG();
+        gens[i] = gen;
+        engs[i] = gen->engine;
     }
 
-#else
-    parameter[0] = simd_set(m, SIMD_STREAMS_32);
+    const int nspawn = engine->spawn_rng(nspawned, engs);
+    delete [] engs;
 
-    int lmultiplier[SIMD_STREAMS_32] __SIMD_ALIGN__;
-    for (int j = 0; j < 4; ++j) {
-        for (int i = 0; i < SIMD_STREAMS_32; ++i) {
-            lmultiplier[i] = GLOBALS.MULT[m[i]][j];
-        }
-        multiplier[j] = simd_set(lmultiplier, SIMD_STREAMS_32);
+    if (nspawn < 0) {
+        for (int i = 0; i < nspawned; ++i)
+            delete gens[i];
+        delete [] gens;
+        *newgens = NULL;
+        return -1;
     }
 
-    const SIMD_INT vmsk_lsb31 = simd_set(0x7FFFFFFFU);
-    const SIMD_INT vs = simd_set(s, SIMD_STREAMS_32);
-    init_seed[0] = simd_and(vs, vmsk_lsb31);
+    *newgens = gens;
 
-    const SIMD_INT vmsk_lsb24 = simd_set(0xFFFFFFU);
-    SIMD_INT vtmp[2] __SIMD_ALIGN__;
-    vtmp[0] = simd_srl_32(init_seed[0], 0x8);
-    vtmp[0] = simd_and(vtmp[0], vmsk_lsb24);
+    return nspawn;
+}
 
-    const SIMD_INT vmsk_msb8_24 = simd_set(0xFF0000U);
-    vtmp[1] = simd_sll_32(init_seed[0], 0x10);
-    vtmp[1] = simd_and(vtmp[1], vmsk_msb8_24);
 
-    const SIMD_INT vmsk_seed[2] __SIMD_ALIGN__ = { simd_set(GLOBALS.INIT_SEED[0]),
-                                                   simd_set(GLOBALS.INIT_SEED[1]) };
-    seed[0] = simd_xor(vmsk_seed[0], vtmp[0]);
-    seed[1] = simd_xor(vmsk_seed[1], vtmp[1]);
+int VLCG::advance(const long int n)
+{ return engine->advance(n); }
 
-    const SIMD_INT vmsk_lsb1 = simd_set(0x1U);
-    prime[0] = simd_set(lprime);
-    if (lprime == 0)
-        seed[1] = simd_or(seed[1], vmsk_lsb1);
-#endif
 
-    // Run generator several times
-    for (int i = 0; i < (GLOBALS.LCG_RUNUP * prime_position); ++i)
-        get_rn_dbl();
+int VLCG::advance(const long int * const n)
+{ return engine->advance(n); }
 
-    scalar_free(&m);
-    scalar_free(&s);
 
-    return 0;
-}
+int VLCG::pack_size() const
+{ return engine->pack_size(); }
 
 
 /*!
- *  The high 31-bits out of the 48-bits are returned.
+ *  \brief Pack state of active streams into caller buffer, see VLCG_ENGINE::pack_rng().
  */
-SIMD_INT VLCG::get_rn_int() const
-{
-#if defined(LONG_SPRNG)
-    SIMD_INT rn[2] __SIMD_ALIGN__;
+int VLCG::pack_rng(void * const buffer, const int size) const
+{ return engine->pack_rng(buffer, size); }
 
-    multiply(&seed[0], &multiplier[0], &prime[0]);
-    multiply(&seed[1], &multiplier[1], &prime[1]);
 
-    rn[0] = simd_srl_64(seed[0], 0x11);
-    rn[1] = simd_srl_64(seed[1], 0x11);
+/*!
+ *  \brief Restore state in place, see VLCG_ENGINE::unpack_rng().
+ */
+int VLCG::unpack_rng(const void * const buffer, const int size)
+{ return engine->unpack_rng(buffer, size); }
 
-    rn[0] = simd_packmerge_i32(rn[0], rn[1]);
-    if (strm_mask32)
-        return simd_and(rn[0], strm_mask32[0]);
 
-    return rn[0];
-#else
-    SIMD_INT rn[2] __SIMD_ALIGN__;
+SIMD_INT VLCG::get_rn_int() const
+{ return engine->get_rn_int(); }
 
-    multiply(&seed[0], &multiplier[0], &prime[0]);
 
-    rn[0] = simd_sll_32(seed[0], 0x7);
-    rn[1] = simd_srl_32(seed[1], 0x11);
+SIMD_DBL VLCG::get_rn_dbl() const
+{ return engine->get_rn_dbl(); }
 
-    rn[0] = simd_or(rn[0], rn[1]);
-    if (strm_mask32)
-        return simd_and(rn[0], strm_mask32[0]);
 
-    return rn[0];
-#endif
-}
+void VLCG::get_rn_dbl2(SIMD_DBL * const rn) const
+{ engine->get_rn_dbl2(rn); }
 
 
-SIMD_DBL VLCG::get_rn_dbl() const
-{
-#if defined(LONG_SPRNG)
-    const SIMD_DBL vfac = simd_set(GLOBALS.TWO_M48);
-    SIMD_DBL rn;
+SIMD_FLT VLCG::get_rn_flt() const
+{ return engine->get_rn_flt(); }
 
-    multiply(&seed[0], &multiplier[0], &prime[0]);
-    rn = simd_cvt_u64_f64(seed[0]);
 
-    rn = simd_mul(rn, vfac);
-    if (strm_mask64)
-        return simd_and(rn, strm_mask64[0]);
+int VLCG::get_rn_int_array(int * const rn, const int nrn) const
+{ return (isa) ? isa->get_rn_int_array(engine, rn, nrn) : engine->get_rn_int_array(rn, nrn); }
 
-    return rn;
-#else
-    const SIMD_DBL vfac[2] __SIMD_ALIGN__ = { simd_set(GLOBALS.TWO_M24),
-                                              simd_set(GLOBALS.TWO_M48) };
-    SIMD_DBL rn[2] __SIMD_ALIGN__;
 
-    multiply(&seed[0], &multiplier[0], &prime[0]);
-    rn[0] = simd_cvt_i32_f64(seed[0]);
-    rn[1] = simd_cvt_i32_f64(seed[1]);
+int VLCG::get_rn_dbl_array(double * const rn, const int nrn) const
+{ return (isa) ? isa->get_rn_dbl_array(engine, rn, nrn) : engine->get_rn_dbl_array(rn, nrn); }
 
-    rn[0] = simd_mul(rn[0], vfac[0]);
-    rn[0] = simd_fmadd(rn[1], vfac[1], rn[0]);
-    if (strm_mask64)
-        return simd_and(rn[0], strm_mask64[0]);
 
-    return rn[0];
-#endif
-}
+int VLCG::get_rn_dbl2_array(double * const rn, const int nrn) const
+{ return (isa) ? isa->get_rn_dbl2_array(engine, rn, nrn) : engine->get_rn_dbl2_array(rn, nrn); }
 
 
-SIMD_FLT VLCG::get_rn_flt() const
-{
-#if defined(LONG_SPRNG)
-    const SIMD_FLT vfac = simd_set((float)GLOBALS.TWO_M48);
-    SIMD_FLT rn[2] __SIMD_ALIGN__;
+int VLCG::get_rn_flt_array(float * const rn, const int nrn) const
+{ return (isa) ? isa->get_rn_flt_array(engine, rn, nrn) : engine->get_rn_flt_array(rn, nrn); }
 
-    multiply(&seed[0], &multiplier[0], &prime[0]);
-    multiply(&seed[1], &multiplier[1], &prime[1]);
 
-    rn[0] = simd_cvt_u64_f32(seed[0]);
-    rn[1] = simd_cvt_u64_f32(seed[1]);
+int VLCG::get_rn_int_streams(int * const rn, const int nrn, const int stride) const
+{ return (isa) ? isa->get_rn_int_streams(engine, rn, nrn, stride) : engine->get_rn_int_streams(rn, nrn, stride); }
 
-    rn[0] = simd_mul(rn[0], vfac);
-    rn[1] = simd_mul(rn[1], vfac);
 
-    rn[0] = simd_merge_lo(rn[0], rn[1]);
-    if (strm_mask32)
-        return simd_and(rn[0], strm_mask32[0]);
+int VLCG::get_rn_flt_streams(float * const rn, const int nrn, const int stride) const
+{ return (isa) ? isa->get_rn_flt_streams(engine, rn, nrn, stride) : engine->get_rn_flt_streams(rn, nrn, stride); }
 
-    return rn[0];
-#else
-    const SIMD_FLT vfac[2] __SIMD_ALIGN__ = { simd_set((float)GLOBALS.TWO_M24),
-                                              simd_set((float)GLOBALS.TWO_M48) };
-    SIMD_FLT rn[2] __SIMD_ALIGN__;
 
-    multiply(&seed[0], &multiplier[0], &prime[0]);
-    rn[0] = simd_cvt_i32_f32(seed[0]);
-    rn[1] = simd_cvt_i32_f32(seed[1]);
+int VLCG::get_rn_dbl_streams(double * const rn, const int nrn, const int stride) const
+{ return (isa) ? isa->get_rn_dbl_streams(engine, rn, nrn, stride) : engine->get_rn_dbl_streams(rn, nrn, stride); }
 
-    rn[0] = simd_mul(rn[0], vfac[0]);
-    rn[0] = simd_fmadd(rn[1], vfac[1], rn[0]);
-    if (strm_mask32)
-        return simd_and(rn[0], strm_mask32[0]);
 
-    return rn[0];
-#endif
-}
+int VLCG::get_stream_stride(const int nrn) const
+{ return engine->get_stream_stride(nrn); }
 
 
-#if defined(LONG_SPRNG)
 SIMD_INT VLCG::get_seed_rng() const
-{
-    const SIMD_INT va = simd_packmerge_i32(init_seed[0], init_seed[1]);
-    if (strm_mask32)
-        return simd_and(va, strm_mask32[0]);
-    return va;
-}
-#else
-SIMD_INT VLCG::get_seed_rng() const
-{
-    if (strm_mask32)
-        return simd_and(init_seed[0], strm_mask32[0]);
-    return init_seed[0];
-}
-#endif
+{ return engine->get_seed_rng(); }
 
 
 int VLCG::get_ngens() const
-{ return LCG_NGENS; }
+{ return LCG_NGENS.count(); }
+
+
+/*!
+ *  \brief Name of SIMD mode used by array functions.
+ */
+const char * VLCG::get_isa() const
+{ return (isa) ? isa->name : VLCG_ISA_NAME; }
 
 
 #if defined(DEBUG)
-# if defined(LONG_SPRNG)
 SIMD_INT VLCG::get_seed() const
-{
-    if (strm_mask64)
-        return simd_and(seed[0], strm_mask64[0]);
-    return seed[0];
-}
-
-SIMD_INT VLCG::get_seed2() const
-{
-    if (strm_mask64)
-        return simd_and(seed[1], strm_mask64[1]);
-    return seed[1];
-}
+{ return engine->get_seed(); }
 
 SIMD_INT VLCG::get_multiplier() const
-{
-    if (strm_mask64)
-        return simd_and(multiplier[0], strm_mask64[0]);
-    return multiplier[0];
-}
-
-SIMD_INT VLCG::get_multiplier2() const
-{
-    if (strm_mask64)
-        return simd_and(multiplier[1], strm_mask64[1]);
-    return multiplier[1];
-}
+{ return engine->get_multiplier(); }
 
 SIMD_INT VLCG::get_prime() const
-{
-    const SIMD_INT va = simd_packmerge_i32(prime[0], prime[1]);
-    if (strm_mask32)
-        return simd_and(va, strm_mask32[0]);
-    return va;
-}
+{ return engine->get_prime(); }
 
-# else
-SIMD_INT VLCG::get_seed() const
-{
-    if (strm_mask32)
-        return simd_and(seed[0], strm_mask32[0]);
-    return seed[0];
-}
-
-SIMD_INT VLCG::get_multiplier() const
-{
-    if (strm_mask32)
-        return simd_and(multiplier[0], strm_mask32[0]);
-    return multiplier[0];
-}
+# if defined(LONG_SPRNG)
+SIMD_INT VLCG::get_seed2() const
+{ return engine->get_seed2(); }
 
-SIMD_INT VLCG::get_prime() const
-{
-    if (strm_mask32)
-        return simd_and(prime[0], strm_mask32[0]);
-    return prime[0];
-}
+SIMD_INT VLCG::get_multiplier2() const
+{ return engine->get_multiplier2(); }
 # endif
 #endif
 
@@ -7,25 +7,58 @@
 
 
 #include "vsprng.h"
+#include "vlcg_engine.h"
+#include "registry.h"
+
+
+struct VLCG_ISA_TABLE;
 
 
 /*! \class VLCG
  *  \brief Class for SIMD linear congruential RNG.
+ *
+ *  Adapter of VLCG_ENGINE for the virtual VSPRNG interface.
+ *
+ *  Array functions use the kernels of the best SIMD mode supported by the
+ *  CPU with the same register width (see vlcg_isa.h), e.g., SSE4.1 kernels
+ *  in a SSE2 build. Register functions use the SIMD mode compiled.
  */
 class VLCG: public VSPRNG
 {
-    // NOTE: thread-safe?
-    static int LCG_NGENS;
+    // Number of generators, per-thread counts
+    static GEN_REGISTRY LCG_NGENS;
+
+    // Multiple register sets engine accesses state of its register sets
+    template <int K> friend class VLCG_ILP;
 
   public:
     VLCG();
     ~VLCG();
     int init_rng(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int init_rng_lanes(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    static int init_rng_many(VLCG * const * const, const int, int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int reseed_rng(const int * const);
+    int spawn_rng(const int, VSPRNG *** const);
     SIMD_INT get_rn_int() const;
     SIMD_FLT get_rn_flt() const;
     SIMD_DBL get_rn_dbl() const;
+    void get_rn_dbl2(SIMD_DBL * const) const;
+    int get_rn_int_array(int * const, const int) const;
+    int get_rn_flt_array(float * const, const int) const;
+    int get_rn_dbl_array(double * const, const int) const;
+    int get_rn_dbl2_array(double * const, const int) const;
+    int get_rn_int_streams(int * const, const int, const int) const;
+    int get_rn_flt_streams(float * const, const int, const int) const;
+    int get_rn_dbl_streams(double * const, const int, const int) const;
+    int get_stream_stride(const int) const;
     SIMD_INT get_seed_rng() const;
     int get_ngens() const;
+    const char * get_isa() const;
+    int advance(const long int);
+    int advance(const long int * const);
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
 #if defined(DEBUG)
     SIMD_INT get_prime() const;
     SIMD_INT get_seed() const;
@@ -39,16 +72,8 @@ class VLCG: public VSPRNG
   private:
     const char *gentype;
     int32_t rng_type;
-    int32_t prime_position;
-    int32_t prime_next;
-    SIMD_INT *init_seed;
-    SIMD_INT *parameter;
-    SIMD_INT *prime;
-    SIMD_INT *seed;
-    SIMD_INT *multiplier;
-    SIMD_INT *strm_mask32;
-    SIMD_INT *strm_mask64;
-    void multiply(SIMD_INT * const, const SIMD_INT * const, const SIMD_INT * const) const;
+    VLCG_ENGINE *engine;
+    const VLCG_ISA_TABLE *isa;
 };
 
 
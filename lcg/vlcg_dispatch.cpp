@@ -0,0 +1,220 @@
+/*************************************************************************/
+/*************************************************************************/
+/*             Parallel 48 bit Linear Congruential Generator             */
+/*                   Runtime selection of SIMD mode                      */
+/*                                                                       */
+/* Modified by: Eduardo Ponce                                            */
+/*              The University of Tennessee, Knoxville                   */
+/*              Email: eponcemo@utk.edu (Jan 2017)                       */
+/*                                                                       */
+/* Based on the implementation by:                                       */
+/*             J. Ren                                                    */
+/*             Ashok Srinivasan (Apr 13, 1998)                           */
+/*************************************************************************/
+/*************************************************************************/
+
+
+#include <stdio.h>   // printf
+#include <stdlib.h>  // NULL
+#include "vlcg_dispatch.h"
+#include "vlcg_isa.h"
+#include "utils.h"
+
+
+/*
+ *  Tables in decreasing order of preference
+ */
+static const VLCG_ISA_TABLE * const VLCG_ISA_TABLES[] = { &VLCG_ISA_AVX512, &VLCG_ISA_AVX2, &VLCG_ISA_SSE4_1, &VLCG_ISA_SSE2 };
+
+
+/*!
+ *  \brief Select kernels of best SIMD mode supported by CPU, up to a given level.
+ *
+ *  AVX kernels are not provided (avx.h requires AVX2 integer operations),
+ *  so AVX level uses SSE4.1 kernels.
+ *  Returns NULL if CPU does not support any SIMD mode available.
+ */
+const VLCG_ISA_TABLE * vlcg_isa_select(const int max_level, const int width_bytes)
+{
+    const int cpu_level = detectProcSIMDLevel();
+    const int level = (cpu_level < max_level) ? cpu_level : max_level;
+
+    for (unsigned int i = 0; i < sizeof(VLCG_ISA_TABLES) / sizeof(VLCG_ISA_TABLES[0]); ++i) {
+        const VLCG_ISA_TABLE * const tab = VLCG_ISA_TABLES[i];
+        if (tab->level <= level && (width_bytes == 0 || tab->width_bytes == width_bytes))
+            return tab;
+    }
+
+    return NULL;
+}
+
+
+/*!
+ *  \brief Select kernels of best SIMD mode supported by CPU, up to a given level.
+ */
+const VLCG_ISA_TABLE * VLCG_DISPATCH::select(const int max_level)
+{ return vlcg_isa_select(max_level); }
+
+
+/*!
+ *  \brief Name of SIMD mode that would be selected, up to a given level.
+ */
+const char * VLCG_DISPATCH::select_isa(const int max_level)
+{
+    const VLCG_ISA_TABLE * const tab = select(max_level);
+    return (tab) ? tab->name : "none";
+}
+
+
+/*!
+ *  \brief Constructor
+ *
+ *  Parameter limits the SIMD mode selected (SIMD_LEVEL), default is best available.
+ */
+VLCG_DISPATCH::VLCG_DISPATCH(const int max_level)
+{
+    isa = select(max_level);
+    engine = (isa) ? isa->create() : NULL;
+    if (!engine)
+        printf("ERROR: no SIMD mode available for VLCG\n");
+}
+
+
+/*!
+ *  \brief Destructor
+ */
+VLCG_DISPATCH::~VLCG_DISPATCH()
+{
+    if (engine)
+        isa->destroy(engine);
+}
+
+
+int VLCG_DISPATCH::init_rng(int gn, int tg, const int * const gs, const int * const gm, const int nstrms)
+{
+    if (!engine)
+        return -1;
+    return isa->init_rng(engine, gn, tg, gs, gm, (nstrms > 0) ? nstrms : isa->nstreams_32);
+}
+
+
+int VLCG_DISPATCH::init_rng_lanes(int gn, int tg, const int * const gs, const int * const gm, const int nstrms)
+{
+    if (!engine)
+        return -1;
+    return isa->init_rng_lanes(engine, gn, tg, gs, gm, (nstrms > 0) ? nstrms : isa->nstreams_32);
+}
+
+
+int VLCG_DISPATCH::reseed_rng(const int * const gs)
+{
+    if (!engine)
+        return -1;
+    return isa->reseed_rng(engine, gs);
+}
+
+
+int VLCG_DISPATCH::get_rn_int_array(int * const rn, const int nrn)
+{
+    if (!engine)
+        return -1;
+    return isa->get_rn_int_array(engine, rn, nrn);
+}
+
+
+int VLCG_DISPATCH::get_rn_flt_array(float * const rn, const int nrn)
+{
+    if (!engine)
+        return -1;
+    return isa->get_rn_flt_array(engine, rn, nrn);
+}
+
+
+int VLCG_DISPATCH::get_rn_dbl_array(double * const rn, const int nrn)
+{
+    if (!engine)
+        return -1;
+    return isa->get_rn_dbl_array(engine, rn, nrn);
+}
+
+
+int VLCG_DISPATCH::get_rn_dbl2_array(double * const rn, const int nrn)
+{
+    if (!engine)
+        return -1;
+    return isa->get_rn_dbl2_array(engine, rn, nrn);
+}
+
+
+int VLCG_DISPATCH::get_rn_int_streams(int * const rn, const int nrn, const int stride)
+{
+    if (!engine)
+        return -1;
+    return isa->get_rn_int_streams(engine, rn, nrn, stride);
+}
+
+
+int VLCG_DISPATCH::get_rn_flt_streams(float * const rn, const int nrn, const int stride)
+{
+    if (!engine)
+        return -1;
+    return isa->get_rn_flt_streams(engine, rn, nrn, stride);
+}
+
+
+int VLCG_DISPATCH::get_rn_dbl_streams(double * const rn, const int nrn, const int stride)
+{
+    if (!engine)
+        return -1;
+    return isa->get_rn_dbl_streams(engine, rn, nrn, stride);
+}
+
+
+int VLCG_DISPATCH::advance(const long int n)
+{
+    if (!engine)
+        return -1;
+    return isa->advance(engine, n);
+}
+
+
+/*!
+ *  \brief Name of SIMD mode selected.
+ */
+const char * VLCG_DISPATCH::get_isa() const
+{ return (isa) ? isa->name : "none"; }
+
+
+int VLCG_DISPATCH::get_width_bytes() const
+{ return (isa) ? isa->width_bytes : 0; }
+
+
+int VLCG_DISPATCH::get_nstreams_32() const
+{ return (isa) ? isa->nstreams_32 : 0; }
+
+
+int VLCG_DISPATCH::get_nstreams_64() const
+{ return (isa) ? isa->nstreams_64 : 0; }
+
+
+/*!
+ *  \brief Stride for stream-major arrays, depends on SIMD mode selected.
+ */
+int VLCG_DISPATCH::get_stream_stride(const int nrn) const
+{
+    const int ns = (isa) ? isa->nstreams_32 : 1;
+    if (nrn <= 0)
+        return ns;
+    return ((nrn + ns - 1) / ns) * ns;
+}
+
+
+/***********************************************************************************
+* SPRNG (c) 2016 by The University of Tennessee, Knoxville                         *
+*                                                                                  *
+* SPRNG is licensed under a                                                        *
+* Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License. *
+*                                                                                  *
+* You should have received a copy of the license along with this                   *
+* work. If not, see <http://creativecommons.org/licenses/by-nc-sa/4.0/>.           *
+************************************************************************************/
@@ -0,0 +1,59 @@
+#ifndef __VLCG_DISPATCH_H
+#define __VLCG_DISPATCH_H
+
+
+#include "utils.h"  // SIMD_LEVEL
+
+
+struct VLCG_ISA_TABLE;
+
+
+/*! \class VLCG_DISPATCH
+ *  \brief SIMD linear congruential RNG with SIMD mode selected at runtime.
+ *
+ *  A single binary carries VLCG kernels for SSE2, SSE4.1, AVX2, and AVX512
+ *  (vlcg_isa.cpp compiled once per mode), the best mode supported by the CPU
+ *  is selected at construction. Interface is limited to arrays since
+ *  register types depend on the mode selected.
+ *
+ *  Streams and output layout are the same as VLCG with get_nstreams_32()
+ *  streams, stream i uses seed gs[i] and multiplier gm[i].
+ *  Arrays have to be aligned to get_width_bytes() (64 bytes is always valid).
+ *
+ *  AVX mode is not provided as a separate implementation (avx.h requires
+ *  AVX2 integer operations), CPUs with AVX but no AVX2 use SSE4.1 kernels.
+ */
+class VLCG_DISPATCH
+{
+  public:
+    VLCG_DISPATCH(const int = SIMD_LEVEL_AVX512);
+    ~VLCG_DISPATCH();
+    int init_rng(int, int, const int * const, const int * const, const int = 0);
+    int init_rng_lanes(int, int, const int * const, const int * const, const int = 0);
+    int reseed_rng(const int * const);
+    int get_rn_int_array(int * const, const int);
+    int get_rn_flt_array(float * const, const int);
+    int get_rn_dbl_array(double * const, const int);
+    int get_rn_dbl2_array(double * const, const int);
+    int get_rn_int_streams(int * const, const int, const int);
+    int get_rn_flt_streams(float * const, const int, const int);
+    int get_rn_dbl_streams(double * const, const int, const int);
+    int get_stream_stride(const int) const;
+    int advance(const long int);
+    const char * get_isa() const;
+    int get_width_bytes() const;
+    int get_nstreams_32() const;
+    int get_nstreams_64() const;
+
+    static const char * select_isa(const int = SIMD_LEVEL_AVX512);
+
+  private:
+    const VLCG_ISA_TABLE *isa;
+    void *engine;
+
+    static const VLCG_ISA_TABLE * select(const int);
+};
+
+
+#endif  // __VLCG_DISPATCH_H
+
@@ -0,0 +1,1475 @@
+#ifndef __VLCG_ENGINE_H
+#define __VLCG_ENGINE_H
+
+
+#include "simd.h"
+#if defined SIMD_MODE
+
+
+#include <stdio.h>   // printf
+#include <string.h>  // memset, memcpy
+#include <limits.h>  // INT_MAX
+#include "lcg_globals.h"
+#include "lcg_jump.h"
+#include "lcg_pack.h"
+#include "vlcg_kernels.h"
+#include "primes_32.h"
+#include "vutils.h"
+
+
+/*! \class VLCG_ENGINE
+ *  \brief Header-only SIMD linear congruential RNG.
+ *
+ *  Statically dispatched version of VLCG, state is held by value and all
+ *  methods are inline so that user loops keep the state in registers.
+ *  The VLCG class is a thin adapter for the virtual VSPRNG interface.
+ *
+ *  Kernels for full width (no masking) or partial width (masked streams)
+ *  are selected once by init_rng(). Masked kernels use opmask registers
+ *  on AVX512 and a bitwise AND on other SIMD modes.
+ *
+ *  NOTE: objects have to be aligned to SIMD_WIDTH_BYTES (stack or simd_malloc'ed).
+ */
+class VLCG_ENGINE
+{
+    // Multiple register sets engine accesses state of its register sets
+    template <int K> friend class VLCG_ILP;
+
+  public:
+    VLCG_ENGINE();
+    int init_rng(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int init_rng_lanes(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    static int init_rng_many(VLCG_ENGINE * const * const, const int, int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int reseed_rng(const int * const);
+    int spawn_rng(const int, VLCG_ENGINE * const * const);
+    int spawn_rng(const int, VLCG_ENGINE * const);
+    SIMD_INT get_rn_int();
+    SIMD_FLT get_rn_flt();
+    SIMD_DBL get_rn_dbl();
+    void get_rn_dbl2(SIMD_DBL * const);
+    int get_rn_int_array(int * const, const int);
+    int get_rn_flt_array(float * const, const int);
+    int get_rn_dbl_array(double * const, const int);
+    int get_rn_dbl2_array(double * const, const int);
+    int get_rn_int_streams(int * const, const int, const int);
+    int get_rn_flt_streams(float * const, const int, const int);
+    int get_rn_dbl_streams(double * const, const int, const int);
+    int get_stream_stride(const int) const;
+    SIMD_INT get_seed_rng() const;
+    int advance(const long int);
+    int advance(const long int * const);
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    SIMD_INT get_prime() const;
+    SIMD_INT get_seed() const;
+    SIMD_INT get_multiplier() const;
+# if defined(LONG_SPRNG)
+    SIMD_INT get_seed2() const;
+    SIMD_INT get_multiplier2() const;
+# endif
+#endif
+
+  private:
+    SIMD_INT seed[VLCG_SEED_REGS];
+    SIMD_INT multiplier[VLCG_MULT_REGS];
+    SIMD_INT prime[VLCG_PRIME_REGS];
+    SIMD_MSK strm_mask32;
+    SIMD_MSK strm_mask64[2];
+#if defined(LONG_SPRNG)
+    SIMD_INT init_seed[2];
+    SIMD_INT parameter[2];
+#else
+    SIMD_INT init_seed[1];
+    SIMD_INT parameter[1];
+#endif
+    int32_t prime_position;
+    int32_t prime_next;
+    int32_t masked;
+    int32_t nstreams;
+    int32_t per_lane;
+
+    template <int MASKED> SIMD_INT next_int();
+    template <int MASKED> SIMD_FLT next_flt();
+    template <int MASKED> SIMD_DBL next_dbl();
+    template <int MASKED> void next_dbl2(SIMD_DBL * const);
+    template <int MASKED> int fill_int_array(int * const, const int);
+    template <int MASKED> int fill_flt_array(float * const, const int);
+    template <int MASKED> int fill_dbl_array(double * const, const int);
+    template <int MASKED> int fill_dbl2_array(double * const, const int);
+    int check_streams_args(const void * const, const int, const int) const;
+    void set_streams(const int * const, const int * const, const int, const int * const);
+#if defined(LONG_SPRNG)
+    void jump(const unsigned long int * const, const unsigned long int * const);
+#else
+    void jump(const int (* const)[4], const int (* const)[2]);
+#endif
+    static int check_params(int * const, int * const, const int * const, const int * const, const int);
+};
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+inline VLCG_ENGINE::VLCG_ENGINE()
+{
+    prime_position = 0;
+    prime_next = 0;
+    masked = 0;
+    nstreams = SIMD_STREAMS_32;
+    per_lane = 0;
+    strm_mask32 = simd_set_mask_32(SIMD_STREAMS_32);
+    strm_mask64[0] = simd_set_mask_64(SIMD_STREAMS_64);
+    strm_mask64[1] = simd_set_mask_64(SIMD_STREAMS_64);
+
+#if defined(LONG_SPRNG)
+    simd_set_zero(&init_seed[0]);
+    simd_set_zero(&init_seed[1]);
+    simd_set_zero(&parameter[0]);
+    simd_set_zero(&parameter[1]);
+    simd_set_zero(&prime[0]);
+    simd_set_zero(&prime[1]);
+    simd_set_zero(&seed[0]);
+    simd_set_zero(&seed[1]);
+    simd_set_zero(&multiplier[0]);
+    simd_set_zero(&multiplier[1]);
+#else
+    simd_set_zero(&init_seed[0]);
+    simd_set_zero(&parameter[0]);
+    simd_set_zero(&prime[0]);
+    simd_set_zero(&seed[0]);
+    seed[1] = simd_set(0x1U);
+    for (int i = 0; i < 4; ++i)
+        simd_set_zero(multiplier+i);
+#endif
+}
+
+
+/*!
+ *  \brief Initialize RNG
+ *
+ *  NOTE: The gn parameter is the same for all streams since the generators are run
+ *  for a while based on gn. This also applies to tg parameter.
+ *  Consequently, a single and same prime number is used for all streams
+ *  (see init_rng_lanes() for one generator number per stream).
+ *
+ *  NOTE: int and float streams use all parameters from input arrays,
+ *  double stream use the first half of the parameters from input arrays.
+ */
+inline int VLCG_ENGINE::init_rng(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{
+    // Check total generators
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+
+    // Check generator number
+    if (gn < 0 || gn >= tg) {
+        printf("ERROR: generator number is out of range, %d\n", gn);
+        gn = tg - 1;
+    }
+    if (gn >= GLOBALS.LCG_MAX_STREAMS)
+        printf("WARNING: generator number (%d) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", gn, GLOBALS.LCG_MAX_STREAMS);
+
+    // Check seeds, multipliers, and number of streams
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    const int nstrms = check_params(s, m, gs, gm, ns);
+
+    // Generate prime number
+    int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    prime_next = tg;
+    prime_position = gn;
+    per_lane = 0;
+    getprime_32(1, lprime, prime_position);
+    for (int strm = 1; strm < SIMD_STREAMS_32; ++strm)
+        lprime[strm] = lprime[0];
+
+    set_streams(s, m, nstrms, lprime);
+
+    // Run generator several times
+    advance(GLOBALS.LCG_RUNUP * prime_position);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Initialize RNG with one generator number per stream
+ *
+ *  Stream i is SPRNG generator gn + i, it uses the prime and warm-up of
+ *  that generator, so its output is identical to a scalar LCG initialized
+ *  with init_rng(gn + i, tg, gs[i], gm[i]). A single object then replaces
+ *  ns scalar objects.
+ *
+ *  NOTE: double streams are the first half of the generators.
+ *  Returns 0 on success or -1 on error.
+ */
+inline int VLCG_ENGINE::init_rng_lanes(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{
+    // Check total generators
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+
+    // Check seeds, multipliers, and number of streams
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    const int nstrms = check_params(s, m, gs, gm, ns);
+
+    // Check generator numbers
+    if (gn < 0 || gn > tg - nstrms) {
+        printf("ERROR: generator numbers are out of range, [%d, %d)\n", gn, gn + nstrms);
+        return -1;
+    }
+    if (gn + nstrms - 1 >= GLOBALS.LCG_MAX_STREAMS)
+        printf("WARNING: generator number (%d) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", gn + nstrms - 1, GLOBALS.LCG_MAX_STREAMS);
+
+    // Generate prime numbers, inactive streams reuse prime of first generator
+    int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    if (getprimes_32(nstrms, lprime, gn) < nstrms)
+        return -1;
+    for (int strm = nstrms; strm < SIMD_STREAMS_32; ++strm)
+        lprime[strm] = lprime[0];
+
+    prime_next = tg;
+    prime_position = gn;
+    per_lane = 1;
+    set_streams(s, m, nstrms, lprime);
+
+    // Run each generator several times based on its generator number
+    long int nsteps[SIMD_STREAMS_32];
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm)
+        nsteps[strm] = (strm < nstrms) ? GLOBALS.LCG_RUNUP * (long int)(gn + strm) : 0;
+
+    return advance(nsteps);
+}
+
+
+/*!
+ *  \brief Reseed streams in place
+ *
+ *  Generator numbers, primes, multipliers, and number of streams are kept,
+ *  resulting state is the same as init_rng() (or init_rng_lanes()) with
+ *  seeds gs. Parameters are taken from the registers of the object, so a
+ *  reseed has no heap allocation and no prime search.
+ *  Returns 0 on success or -1 on error.
+ */
+inline int VLCG_ENGINE::reseed_rng(const int * const gs)
+{
+    if (!gs) {
+        printf("ERROR: no array for seeds provided.\n");
+        return -1;
+    }
+
+    // Parameters and primes of streams, inactive streams have zero seeds
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+#if defined(LONG_SPRNG)
+    simd_store(m, simd_packmerge_i32(parameter[0], parameter[1]));
+    simd_store(lprime, simd_packmerge_i32(prime[0], prime[1]));
+#else
+    simd_store(m, parameter[0]);
+    simd_store(lprime, prime[0]);
+#endif
+    memset(s, 0, sizeof(s));
+    memcpy(s, gs, nstreams * sizeof(int));
+
+    set_streams(s, m, nstreams, lprime);
+
+    // Run generators several times, same warm-up as initialization
+    if (!per_lane)
+        return advance(GLOBALS.LCG_RUNUP * prime_position);
+
+    long int nsteps[SIMD_STREAMS_32];
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm)
+        nsteps[strm] = (strm < nstreams) ? GLOBALS.LCG_RUNUP * (long int)(prime_position + strm) : 0;
+
+    return advance(nsteps);
+}
+
+
+/*!
+ *  \brief Seeds and multipliers of streams, inactive streams are zero.
+ *
+ *  Returns number of streams.
+ */
+inline int VLCG_ENGINE::check_params(int * const s, int * const m, const int * const gs, const int * const gm, const int ns)
+{
+    // Check number of streams requested
+    int nstrms = ns;
+    if (nstrms <= 0 || nstrms > SIMD_STREAMS_32) {
+        printf("ERROR: number of streams is out of range, %d, default is to use all available streams.\n", nstrms);
+        nstrms = SIMD_STREAMS_32;
+    }
+
+    // Check multipliers
+    memset(m, 0, SIMD_STREAMS_32 * sizeof(int));
+    if (!gm)
+        printf("WARNING: no array for multipliers provided, default is zero.\n");
+    else {
+        for (int strm = 0; strm < nstrms; ++strm)
+            if (gm[strm] < 0 || gm[strm] >= GLOBALS.NPARAMS)
+                printf("ERROR: multiplier out of range, %d\n", gm[strm]);
+            else
+                m[strm] = gm[strm];
+    }
+
+    // Check seeds
+    memset(s, 0, SIMD_STREAMS_32 * sizeof(int));
+    if (!gs)
+        printf("WARNING: no array for seeds provided, default is zero.\n");
+    else {
+        for (int strm = 0; strm < nstrms; ++strm)
+            s[strm] = gs[strm];
+    }
+
+    return nstrms;
+}
+
+
+/*!
+ *  \brief Initial state of streams from seeds, multipliers, and primes (no warm-up).
+ *
+ *  One prime per stream, lprime has SIMD_STREAMS_32 entries.
+ */
+inline void VLCG_ENGINE::set_streams(const int * const s, const int * const m, const int nstrms, const int * const lprime)
+{
+    // Select masked kernels, only if not using maximum number of streams
+    masked = (nstrms < SIMD_STREAMS_32);
+    nstreams = nstrms;
+    strm_mask32 = simd_set_mask_32(nstrms);
+    strm_mask64[0] = simd_set_mask_64(nstrms);
+    strm_mask64[1] = simd_set_mask_64(nstrms - SIMD_STREAMS_64);
+
+#if defined(LONG_SPRNG)
+    parameter[0] = simd_set(&m[0], SIMD_STREAMS_64);
+    parameter[1] = simd_set(&m[SIMD_STREAMS_64], SIMD_STREAMS_64);
+
+    long int lmultiplier[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    for (int i = 0; i < SIMD_STREAMS_64; ++i) {
+        lmultiplier[0][i] = GLOBALS.MULT[m[i]];
+        lmultiplier[1][i] = GLOBALS.MULT[m[i+SIMD_STREAMS_64]];
+    }
+    multiplier[0] = simd_set(lmultiplier[0], SIMD_STREAMS_64);
+    multiplier[1] = simd_set(lmultiplier[1], SIMD_STREAMS_64);
+
+    SIMD_INT vs[2] __SIMD_ALIGN__;
+    vs[0] = simd_set(&s[0], SIMD_STREAMS_64);
+    vs[1] = simd_set(&s[SIMD_STREAMS_64], SIMD_STREAMS_64);
+
+    const SIMD_INT vmsk_lsb31 = simd_set(0x7FFFFFFFUL);
+    init_seed[0] = simd_and(vs[0], vmsk_lsb31);
+    init_seed[1] = simd_and(vs[1], vmsk_lsb31);
+
+    vs[0] = simd_sll_64(init_seed[0], 0x10);
+    vs[1] = simd_sll_64(init_seed[1], 0x10);
+
+    const SIMD_INT vmsk_seed = simd_set(GLOBALS.INIT_SEED);
+    seed[0] = simd_xor(vmsk_seed, vs[0]);
+    seed[1] = simd_xor(vmsk_seed, vs[1]);
+
+    // Streams without prime need an odd seed
+    int lsb1[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    for (int i = 0; i < SIMD_STREAMS_32; ++i)
+        lsb1[i] = (lprime[i] == 0) ? 0x1 : 0x0;
+    prime[0] = simd_set(&lprime[0], SIMD_STREAMS_64);
+    prime[1] = simd_set(&lprime[SIMD_STREAMS_64], SIMD_STREAMS_64);
+    seed[0] = simd_or(seed[0], simd_set(&lsb1[0], SIMD_STREAMS_64));
+    seed[1] = simd_or(seed[1], simd_set(&lsb1[SIMD_STREAMS_64], SIMD_STREAMS_64));
+
+#else
+    parameter[0] = simd_set(m, SIMD_STREAMS_32);
+
+    int lmultiplier[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    for (int j = 0; j < 4; ++j) {
+        for (int i = 0; i < SIMD_STREAMS_32; ++i) {
+            lmultiplier[i] = GLOBALS.MULT[m[i]][j];
+        }
+        multiplier[j] = simd_set(lmultiplier, SIMD_STREAMS_32);
+    }
+
+    const SIMD_INT vmsk_lsb31 = simd_set(0x7FFFFFFFU);
+    const SIMD_INT vs = simd_set(s, SIMD_STREAMS_32);
+    init_seed[0] = simd_and(vs, vmsk_lsb31);
+
+    const SIMD_INT vmsk_lsb24 = simd_set(0xFFFFFFU);
+    SIMD_INT vtmp[2] __SIMD_ALIGN__;
+    vtmp[0] = simd_srl_32(init_seed[0], 0x8);
+    vtmp[0] = simd_and(vtmp[0], vmsk_lsb24);
+
+    const SIMD_INT vmsk_msb8_24 = simd_set(0xFF0000U);
+    vtmp[1] = simd_sll_32(init_seed[0], 0x10);
+    vtmp[1] = simd_and(vtmp[1], vmsk_msb8_24);
+
+    const SIMD_INT vmsk_seed[2] __SIMD_ALIGN__ = { simd_set(GLOBALS.INIT_SEED[0]),
+                                                   simd_set(GLOBALS.INIT_SEED[1]) };
+    seed[0] = simd_xor(vmsk_seed[0], vtmp[0]);
+    seed[1] = simd_xor(vmsk_seed[1], vtmp[1]);
+
+    // Streams without prime need an odd seed
+    int lsb1[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    for (int i = 0; i < SIMD_STREAMS_32; ++i)
+        lsb1[i] = (lprime[i] == 0) ? 0x1 : 0x0;
+    prime[0] = simd_set(lprime, SIMD_STREAMS_32);
+    seed[1] = simd_or(seed[1], simd_set(lsb1, SIMD_STREAMS_32));
+#endif
+}
+
+
+/*!
+ *  \brief Initialize RNGs of consecutive generator numbers [gn, gn + ngen)
+ *
+ *  Same as calling engs[i]->init_rng(gn + i, tg, gs, gm, ns) for each generator.
+ *  Primes are obtained in a single search. Warm-up jumps depend only on the
+ *  multiplier of a stream (the prime scales the additive term), these are
+ *  computed once per multiplier and appended incrementally for consecutive
+ *  generators, O(1) per generator instead of O(log n) per stream.
+ *  Returns 0 on success or -1 on error.
+ */
+inline int VLCG_ENGINE::init_rng_many(VLCG_ENGINE * const * const engs, const int ngen, int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{
+    if (!engs || ngen <= 0) {
+        printf("ERROR: invalid array of generators, %d\n", ngen);
+        return -1;
+    }
+
+    // Check total generators
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+
+    // Check generator numbers
+    if (gn < 0 || gn > tg - ngen) {
+        printf("ERROR: generator numbers are out of range, [%d, %d)\n", gn, gn + ngen);
+        return -1;
+    }
+    if (gn + ngen - 1 >= GLOBALS.LCG_MAX_STREAMS)
+        printf("WARNING: generator number (%d) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", gn + ngen - 1, GLOBALS.LCG_MAX_STREAMS);
+
+    // Check seeds, multipliers, and number of streams
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    const int nstrms = check_params(s, m, gs, gm, ns);
+
+    // Generate prime numbers
+    int *primes = NULL;
+    if (scalar_malloc(&primes, SIMD_WIDTH_BYTES, ngen))
+        return -1;
+    if (getprimes_32(ngen, primes, gn) < ngen) {
+        scalar_free(&primes);
+        return -1;
+    }
+
+    // Jump coefficients (prime of 1) of warm-up of generator gn, and of one more generator
+    const int nparams = GLOBALS.NPARAMS;
+    int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+#if defined(LONG_SPRNG)
+    unsigned long int A[7], S[7], AR[7], SR[7];
+    unsigned long int lA[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned long int lC[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned long int C[7];
+    for (int j = 0; j < nparams; ++j) {
+        lcg_jump(&A[j], &S[j], GLOBALS.MULT[j], 0x1UL, GLOBALS.LCG_RUNUP * (long int)gn);
+        lcg_jump(&AR[j], &SR[j], GLOBALS.MULT[j], 0x1UL, GLOBALS.LCG_RUNUP);
+    }
+#else
+    int A[7][4], S[7][2], AR[7][4], SR[7][2];
+    int lA[SIMD_STREAMS_32][4] __SIMD_ALIGN__;
+    int lC[SIMD_STREAMS_32][2] __SIMD_ALIGN__;
+    int C[7][2];
+    for (int j = 0; j < nparams; ++j) {
+        lcg_jump(A[j], S[j], GLOBALS.MULT[j], 1, GLOBALS.LCG_RUNUP * (long int)gn);
+        lcg_jump(AR[j], SR[j], GLOBALS.MULT[j], 1, GLOBALS.LCG_RUNUP);
+    }
+#endif
+
+    for (int i = 0; i < ngen; ++i) {
+        VLCG_ENGINE * const eng = engs[i];
+        eng->prime_next = tg;
+        eng->prime_position = gn + i;
+        eng->per_lane = 0;
+        for (int strm = 0; strm < SIMD_STREAMS_32; ++strm)
+            lprime[strm] = primes[i];
+        eng->set_streams(s, m, nstrms, lprime);
+
+        // Gather coefficients of each stream, then move to next generator
+#if defined(LONG_SPRNG)
+        for (int j = 0; j < nparams; ++j)
+            C[j] = lcg_jump_scale(S[j], (unsigned long int)primes[i]);
+        for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+            lA[strm] = A[m[strm]];
+            lC[strm] = C[m[strm]];
+        }
+        eng->jump(lA, lC);
+        for (int j = 0; j < nparams; ++j)
+            lcg_jump_compose(&A[j], &S[j], AR[j], SR[j]);
+#else
+        for (int j = 0; j < nparams; ++j)
+            lcg_jump_scale(C[j], S[j], primes[i]);
+        for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+            memcpy(lA[strm], A[m[strm]], sizeof(lA[strm]));
+            memcpy(lC[strm], C[m[strm]], sizeof(lC[strm]));
+        }
+        eng->jump(lA, lC);
+        for (int j = 0; j < nparams; ++j)
+            lcg_jump_compose(A[j], S[j], AR[j], SR[j]);
+#endif
+    }
+
+    scalar_free(&primes);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Spawn new generators
+ *
+ *  Child i is generator number prime_position + prime_next * (i + 1) with
+ *  the seeds and multipliers of this generator, as in SPRNG spawn_rng().
+ *  If streams have one generator number each (init_rng_lanes()), the
+ *  children do as well. Children are initialized together, warm-up jumps
+ *  of the first child take O(log n) operations per stream and are appended
+ *  incrementally for the other children.
+ *  Returns number of generators spawned or -1 on error.
+ */
+inline int VLCG_ENGINE::spawn_rng(const int nspawned, VLCG_ENGINE * const * const newgens)
+{
+    if (!newgens || nspawned <= 0) {
+        printf("ERROR: invalid array of generators, %d\n", nspawned);
+        return -1;
+    }
+
+    // Check generator numbers of children
+    const long int next = (long int)prime_next * (nspawned + 1);
+    const long int last = prime_position + (long int)prime_next * nspawned + ((per_lane) ? nstreams - 1 : 0);
+    if (next > INT_MAX || last > INT_MAX) {
+        printf("ERROR: generator numbers of spawned generators are out of range, %ld\n", last);
+        return -1;
+    }
+    if (last >= GLOBALS.LCG_MAX_STREAMS)
+        printf("WARNING: generator number (%ld) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", last, GLOBALS.LCG_MAX_STREAMS);
+
+    // Seeds and multipliers of streams
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+#if defined(LONG_SPRNG)
+    unsigned long int lm[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    unsigned long int ls[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    for (int j = 0; j < 2; ++j) {
+        simd_store(lm[j], parameter[j]);
+        simd_store(ls[j], init_seed[j]);
+    }
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        m[strm] = (int)lm[strm / SIMD_STREAMS_64][strm % SIMD_STREAMS_64];
+        s[strm] = (int)ls[strm / SIMD_STREAMS_64][strm % SIMD_STREAMS_64];
+    }
+#else
+    simd_store(m, parameter[0]);
+    simd_store(s, init_seed[0]);
+#endif
+
+    // Jump coefficients (prime of 1) of warm-up of first child per stream,
+    // and of distance between consecutive children per multiplier
+    const int nparams = GLOBALS.NPARAMS;
+    const long int step = GLOBALS.LCG_RUNUP * (long int)prime_next;
+    long int gn = prime_position + prime_next;
+    int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+#if defined(LONG_SPRNG)
+    unsigned long int A[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned long int S[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned long int C[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned long int AR[7], SR[7];
+    for (int j = 0; j < nparams; ++j)
+        lcg_jump(&AR[j], &SR[j], GLOBALS.MULT[j], 0x1UL, step);
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        const long int lgn = (per_lane && strm < nstreams) ? gn + strm : gn;
+        lcg_jump(&A[strm], &S[strm], GLOBALS.MULT[m[strm]], 0x1UL, GLOBALS.LCG_RUNUP * lgn);
+    }
+#else
+    int A[SIMD_STREAMS_32][4] __SIMD_ALIGN__;
+    int S[SIMD_STREAMS_32][2] __SIMD_ALIGN__;
+    int C[SIMD_STREAMS_32][2] __SIMD_ALIGN__;
+    int AR[7][4], SR[7][2];
+    for (int j = 0; j < nparams; ++j)
+        lcg_jump(AR[j], SR[j], GLOBALS.MULT[j], 1, step);
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        const long int lgn = (per_lane && strm < nstreams) ? gn + strm : gn;
+        lcg_jump(A[strm], S[strm], GLOBALS.MULT[m[strm]], 1, GLOBALS.LCG_RUNUP * lgn);
+    }
+#endif
+
+    for (int i = 0; i < nspawned; ++i, gn += prime_next) {
+        VLCG_ENGINE * const eng = newgens[i];
+
+        // Primes of child, inactive streams reuse prime of first stream
+        if (per_lane) {
+            if (getprimes_32(nstreams, lprime, (int)gn) < nstreams)
+                return -1;
+        }
+        else
+            getprime_32(1, lprime, (int)gn);
+        for (int strm = (per_lane) ? nstreams : 1; strm < SIMD_STREAMS_32; ++strm)
+            lprime[strm] = lprime[0];
+
+        eng->prime_next = (int)next;
+        eng->prime_position = (int)gn;
+        eng->per_lane = per_lane;
+        eng->set_streams(s, m, nstreams, lprime);
+
+        // Scale coefficients by prime of each stream, then move to next child
+#if defined(LONG_SPRNG)
+        for (int strm = 0; strm < SIMD_STREAMS_32; ++strm)
+            C[strm] = lcg_jump_scale(S[strm], (unsigned long int)lprime[strm]);
+        eng->jump(A, C);
+        for (int strm = 0; strm < SIMD_STREAMS_32; ++strm)
+            lcg_jump_compose(&A[strm], &S[strm], AR[m[strm]], SR[m[strm]]);
+#else
+        for (int strm = 0; strm < SIMD_STREAMS_32; ++strm)
+            lcg_jump_scale(C[strm], S[strm], lprime[strm]);
+        eng->jump(A, C);
+        for (int strm = 0; strm < SIMD_STREAMS_32; ++strm)
+            lcg_jump_compose(A[strm], S[strm], AR[m[strm]], SR[m[strm]]);
+#endif
+    }
+
+    prime_next = (int)next;
+
+    return nspawned;
+}
+
+
+/*!
+ *  \brief Spawn new generators into a contiguous array of engines
+ *
+ *  Array elements are aligned if the array is (stack or simd_malloc'ed).
+ *  See spawn_rng(const int, VLCG_ENGINE * const * const).
+ */
+inline int VLCG_ENGINE::spawn_rng(const int nspawned, VLCG_ENGINE * const newgens)
+{
+    if (!newgens || nspawned <= 0) {
+        printf("ERROR: invalid array of generators, %d\n", nspawned);
+        return -1;
+    }
+
+    VLCG_ENGINE **engs = new VLCG_ENGINE*[nspawned];
+    for (int i = 0; i < nspawned; ++i)
+        engs[i] = newgens + i;
+
+    const int nspawn = spawn_rng(nspawned, engs);
+    delete [] engs;
+
+    return nspawn;
+}
+
+
+/*!
+ *  \brief Advance all streams n steps in O(log n) operations.
+ *
+ *  Equivalent to calling get_rn_dbl() n times.
+ */
+inline int VLCG_ENGINE::advance(const long int n)
+{
+    long int nsteps[SIMD_STREAMS_32];
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm)
+        nsteps[strm] = n;
+
+    return advance(nsteps);
+}
+
+
+/*!
+ *  \brief Advance each stream a different number of steps.
+ *
+ *  Jump coefficients depend on the multiplier of each lane, so these are
+ *  computed per lane and applied to the seeds in scalar form.
+ */
+inline int VLCG_ENGINE::advance(const long int * const n)
+{
+    if (!n) {
+        printf("ERROR: no array for number of steps to advance provided.\n");
+        return -1;
+    }
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        if (n[strm] < 0) {
+            printf("ERROR: number of steps to advance is out of range, %ld\n", n[strm]);
+            return -1;
+        }
+    }
+
+#if defined(LONG_SPRNG)
+    unsigned long int lmultiplier[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    unsigned long int lprime[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    unsigned long int A[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned long int C[SIMD_STREAMS_32] __SIMD_ALIGN__;
+
+    for (int j = 0; j < 2; ++j) {
+        simd_store(lmultiplier[j], multiplier[j]);
+        simd_store(lprime[j], prime[j]);
+    }
+
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        const int j = strm / SIMD_STREAMS_64;
+        const int i = strm % SIMD_STREAMS_64;
+        lcg_jump(&A[strm], &C[strm], lmultiplier[j][i], lprime[j][i], n[strm]);
+    }
+#else
+    int lmultiplier[4][SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int A[SIMD_STREAMS_32][4];
+    int C[SIMD_STREAMS_32][2];
+
+    for (int j = 0; j < 4; ++j)
+        simd_store(lmultiplier[j], multiplier[j]);
+    simd_store(lprime, prime[0]);
+
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        const int mult[4] = {lmultiplier[0][strm], lmultiplier[1][strm], lmultiplier[2][strm], lmultiplier[3][strm]};
+        lcg_jump(A[strm], C[strm], mult, lprime[strm], n[strm]);
+    }
+#endif
+
+    jump(A, C);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Apply jump coefficients of each stream to the seeds, x = A * x + C.
+ */
+#if defined(LONG_SPRNG)
+inline void VLCG_ENGINE::jump(const unsigned long int * const A, const unsigned long int * const C)
+{
+    unsigned long int lseed[SIMD_STREAMS_64] __SIMD_ALIGN__;
+
+    for (int j = 0; j < 2; ++j) {
+        simd_store(lseed, seed[j]);
+        for (int i = 0; i < SIMD_STREAMS_64; ++i)
+            lseed[i] = lcg_jump_apply(lseed[i], A[i + j * SIMD_STREAMS_64], C[i + j * SIMD_STREAMS_64]);
+        seed[j] = simd_load(lseed);
+    }
+}
+#else
+inline void VLCG_ENGINE::jump(const int (* const A)[4], const int (* const C)[2])
+{
+    int lseed[2][SIMD_STREAMS_32] __SIMD_ALIGN__;
+
+    simd_store(lseed[0], seed[0]);
+    simd_store(lseed[1], seed[1]);
+
+    for (int i = 0; i < SIMD_STREAMS_32; ++i) {
+        int x[2] = {lseed[0][i], lseed[1][i]};
+        lcg_jump_apply(x, A[i], C[i]);
+        lseed[0][i] = x[0];
+        lseed[1][i] = x[1];
+    }
+
+    seed[0] = simd_load(lseed[0]);
+    seed[1] = simd_load(lseed[1]);
+}
+#endif
+
+
+/*!
+ *  \brief Full width (MASKED = 0) and partial width (MASKED = 1) kernels.
+ */
+template <int MASKED>
+ARCH_ATTR_INLINE inline SIMD_INT VLCG_ENGINE::next_int()
+{
+    const SIMD_INT rn = vlcg_next_int(seed, multiplier, prime);
+    if (MASKED)
+        return simd_maskz_32(rn, strm_mask32);
+
+    return rn;
+}
+
+
+template <int MASKED>
+ARCH_ATTR_INLINE inline SIMD_DBL VLCG_ENGINE::next_dbl()
+{
+    const SIMD_DBL rn = vlcg_next_dbl(seed, multiplier, prime);
+    if (MASKED)
+        return simd_maskz(rn, strm_mask64[0]);
+
+    return rn;
+}
+
+
+template <int MASKED>
+ARCH_ATTR_INLINE inline void VLCG_ENGINE::next_dbl2(SIMD_DBL * const rn)
+{
+    vlcg_next_dbl2(rn, seed, multiplier, prime);
+    if (MASKED) {
+        rn[0] = simd_maskz(rn[0], strm_mask64[0]);
+        rn[1] = simd_maskz(rn[1], strm_mask64[1]);
+    }
+}
+
+
+template <int MASKED>
+ARCH_ATTR_INLINE inline SIMD_FLT VLCG_ENGINE::next_flt()
+{
+    const SIMD_FLT rn = vlcg_next_flt(seed, multiplier, prime);
+    if (MASKED)
+        return simd_maskz(rn, strm_mask32);
+
+    return rn;
+}
+
+
+/*
+ *  Kernel is fixed at init, the test on masked is loop invariant
+ *  and perfectly predicted. Full width kernels do not load masks.
+ */
+inline SIMD_INT VLCG_ENGINE::get_rn_int()
+{ return (masked) ? next_int<1>() : next_int<0>(); }
+
+
+inline SIMD_DBL VLCG_ENGINE::get_rn_dbl()
+{ return (masked) ? next_dbl<1>() : next_dbl<0>(); }
+
+
+/*!
+ *  \brief Double-precision random numbers of all streams.
+ *
+ *  rn[0] holds streams [0, SIMD_STREAMS_64), rn[1] holds streams
+ *  [SIMD_STREAMS_64, SIMD_STREAMS_32). Unlike get_rn_dbl(), no stream
+ *  is discarded, a single step produces SIMD_STREAMS_32 numbers.
+ */
+inline void VLCG_ENGINE::get_rn_dbl2(SIMD_DBL * const rn)
+{
+    if (masked)
+        next_dbl2<1>(rn);
+    else
+        next_dbl2<0>(rn);
+}
+
+
+inline SIMD_FLT VLCG_ENGINE::get_rn_flt()
+{ return (masked) ? next_flt<1>() : next_flt<0>(); }
+
+
+/*!
+ *  \brief Fill an array with integer random numbers.
+ *
+ *  The array must be aligned to SIMD_WIDTH_BYTES. Its contents are identical
+ *  to storing consecutive get_rn_int() registers, the state is kept in registers
+ *  for the whole loop and written back once. If nrn is not a multiple of
+ *  SIMD_STREAMS_32, the last register is truncated (streams still advance).
+ *  Returns the number of elements written or -1 on error.
+ */
+inline int VLCG_ENGINE::get_rn_int_array(int * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    if (masked)
+        return fill_int_array<1>(rn, nrn);
+    return fill_int_array<0>(rn, nrn);
+}
+
+
+template <int MASKED>
+inline int VLCG_ENGINE::fill_int_array(int * const rn, const int nrn)
+{
+    SIMD_INT vseed[VLCG_SEED_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG_MULT_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG_PRIME_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const SIMD_MSK vmsk = strm_mask32;
+    const int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    int *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        const SIMD_INT vrn = vlcg_next_int(vseed, vmult, vprime);
+        if (MASKED)
+            simd_store(rn_ptr, simd_maskz_32(vrn, vmsk));
+        else
+            simd_store(rn_ptr, vrn);
+        rn_ptr += SIMD_STREAMS_32;
+    }
+
+    if (nrem > 0) {
+        int rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        const SIMD_INT vrn = vlcg_next_int(vseed, vmult, vprime);
+        simd_store(rn_tail, (MASKED) ? simd_maskz_32(vrn, vmsk) : vrn);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(int));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers.
+ *
+ *  Same as get_rn_int_array() but with SIMD_STREAMS_64 elements per register.
+ */
+inline int VLCG_ENGINE::get_rn_dbl_array(double * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    if (masked)
+        return fill_dbl_array<1>(rn, nrn);
+    return fill_dbl_array<0>(rn, nrn);
+}
+
+
+template <int MASKED>
+inline int VLCG_ENGINE::fill_dbl_array(double * const rn, const int nrn)
+{
+    SIMD_INT vseed[VLCG_SEED_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG_MULT_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG_PRIME_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const SIMD_MSK vmsk = strm_mask64[0];
+    const int nvec = nrn / SIMD_STREAMS_64;
+    const int nrem = nrn % SIMD_STREAMS_64;
+
+    double *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        const SIMD_DBL vrn = vlcg_next_dbl(vseed, vmult, vprime);
+        if (MASKED)
+            simd_store(rn_ptr, simd_maskz(vrn, vmsk));
+        else
+            simd_store(rn_ptr, vrn);
+        rn_ptr += SIMD_STREAMS_64;
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        const SIMD_DBL vrn = vlcg_next_dbl(vseed, vmult, vprime);
+        simd_store(rn_tail, (MASKED) ? simd_maskz(vrn, vmsk) : vrn);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(double));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers of all streams.
+ *
+ *  Same as get_rn_int_array() but for double elements, each step of the
+ *  streams stores SIMD_STREAMS_32 elements (contents of get_rn_dbl2()).
+ */
+inline int VLCG_ENGINE::get_rn_dbl2_array(double * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    if (masked)
+        return fill_dbl2_array<1>(rn, nrn);
+    return fill_dbl2_array<0>(rn, nrn);
+}
+
+
+template <int MASKED>
+inline int VLCG_ENGINE::fill_dbl2_array(double * const rn, const int nrn)
+{
+    SIMD_INT vseed[VLCG_SEED_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG_MULT_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG_PRIME_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const SIMD_MSK vmsk[2] = { strm_mask64[0], strm_mask64[1] };
+    const int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    SIMD_DBL vrn[2] __SIMD_ALIGN__;
+    double *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        vlcg_next_dbl2(vrn, vseed, vmult, vprime);
+        if (MASKED) {
+            simd_store(rn_ptr, simd_maskz(vrn[0], vmsk[0]));
+            simd_store(rn_ptr + SIMD_STREAMS_64, simd_maskz(vrn[1], vmsk[1]));
+        }
+        else {
+            simd_store(rn_ptr, vrn[0]);
+            simd_store(rn_ptr + SIMD_STREAMS_64, vrn[1]);
+        }
+        rn_ptr += SIMD_STREAMS_32;
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        vlcg_next_dbl2(vrn, vseed, vmult, vprime);
+        simd_store(rn_tail, (MASKED) ? simd_maskz(vrn[0], vmsk[0]) : vrn[0]);
+        simd_store(rn_tail + SIMD_STREAMS_64, (MASKED) ? simd_maskz(vrn[1], vmsk[1]) : vrn[1]);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(double));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with single-precision random numbers.
+ *
+ *  Same as get_rn_int_array() but for float elements.
+ */
+inline int VLCG_ENGINE::get_rn_flt_array(float * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    if (masked)
+        return fill_flt_array<1>(rn, nrn);
+    return fill_flt_array<0>(rn, nrn);
+}
+
+
+template <int MASKED>
+inline int VLCG_ENGINE::fill_flt_array(float * const rn, const int nrn)
+{
+    SIMD_INT vseed[VLCG_SEED_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG_MULT_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG_PRIME_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const SIMD_MSK vmsk = strm_mask32;
+    const int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    float *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        const SIMD_FLT vrn = vlcg_next_flt(vseed, vmult, vprime);
+        if (MASKED)
+            simd_store(rn_ptr, simd_maskz(vrn, vmsk));
+        else
+            simd_store(rn_ptr, vrn);
+        rn_ptr += SIMD_STREAMS_32;
+    }
+
+    if (nrem > 0) {
+        float rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        const SIMD_FLT vrn = vlcg_next_flt(vseed, vmult, vprime);
+        simd_store(rn_tail, (MASKED) ? simd_maskz(vrn, vmsk) : vrn);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(float));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Smallest valid stride for stream-major arrays of nrn numbers per stream.
+ *
+ *  Stride is nrn rounded up to a multiple of SIMD_STREAMS_32, so that each
+ *  stream begins at an aligned address. Arrays hold nstrms * stride elements.
+ */
+inline int VLCG_ENGINE::get_stream_stride(const int nrn) const
+{
+    if (nrn <= 0)
+        return SIMD_STREAMS_32;
+    return ((nrn + SIMD_STREAMS_32 - 1) / SIMD_STREAMS_32) * SIMD_STREAMS_32;
+}
+
+
+inline int VLCG_ENGINE::check_streams_args(const void * const rn, const int nrn, const int stride) const
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+    if (stride < nrn || stride % SIMD_STREAMS_32 != 0) {
+        printf("ERROR: stride of streams is out of range, %d (see get_stream_stride())\n", stride);
+        return -1;
+    }
+    return 0;
+}
+
+
+/*!
+ *  \brief Fill an array with integer random numbers, stream-major layout.
+ *
+ *  The nrn numbers of stream i are contiguous, starting at rn[i * stride].
+ *  Values are the same as get_rn_int_array(), blocks of SIMD_STREAMS_32 steps
+ *  are transposed in registers before storing. Only active streams are written,
+ *  inactive streams (masked) are not part of the array.
+ *  The array must be aligned to SIMD_WIDTH_BYTES and stride a multiple of
+ *  SIMD_STREAMS_32 not less than nrn (see get_stream_stride()).
+ *  Returns the number of elements written per stream or -1 on error.
+ */
+inline int VLCG_ENGINE::get_rn_int_streams(int * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    SIMD_INT vseed[VLCG_SEED_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG_MULT_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG_PRIME_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const int nblk = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    SIMD_INT vrn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_32; k += SIMD_STREAMS_32) {
+        for (int j = 0; j < SIMD_STREAMS_32; ++j)
+            vrn[j] = vlcg_next_int(vseed, vmult, vprime);
+        simd_transpose_i32(vrn);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm]);
+    }
+
+    if (nrem > 0) {
+        int rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j)
+            vrn[j] = vlcg_next_int(vseed, vmult, vprime);
+        for (int j = nrem; j < SIMD_STREAMS_32; ++j)
+            simd_set_zero(&vrn[j]);
+        simd_transpose_i32(vrn);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_32, rn_tail, nrem * sizeof(int));
+        }
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with single-precision random numbers, stream-major layout.
+ *
+ *  Same as get_rn_int_streams() but for float elements.
+ */
+inline int VLCG_ENGINE::get_rn_flt_streams(float * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    SIMD_INT vseed[VLCG_SEED_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG_MULT_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG_PRIME_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const int nblk = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    SIMD_FLT vrn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_32; k += SIMD_STREAMS_32) {
+        for (int j = 0; j < SIMD_STREAMS_32; ++j)
+            vrn[j] = vlcg_next_flt(vseed, vmult, vprime);
+        simd_transpose(vrn);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm]);
+    }
+
+    if (nrem > 0) {
+        float rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j)
+            vrn[j] = vlcg_next_flt(vseed, vmult, vprime);
+        for (int j = nrem; j < SIMD_STREAMS_32; ++j)
+            simd_set_zero(&vrn[j]);
+        simd_transpose(vrn);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_32, rn_tail, nrem * sizeof(float));
+        }
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers, stream-major layout.
+ *
+ *  Same as get_rn_int_streams() but for double elements, all streams are
+ *  generated (values of get_rn_dbl2_array()). Blocks are SIMD_STREAMS_64
+ *  steps, each half of the streams is transposed separately.
+ */
+inline int VLCG_ENGINE::get_rn_dbl_streams(double * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    SIMD_INT vseed[VLCG_SEED_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG_MULT_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG_PRIME_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const int nblk = nrn / SIMD_STREAMS_64;
+    const int nrem = nrn % SIMD_STREAMS_64;
+
+    // vrn[0] holds streams [0, SIMD_STREAMS_64), vrn[1] the remaining streams
+    SIMD_DBL vrn[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    SIMD_DBL vpair[2] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_64; k += SIMD_STREAMS_64) {
+        for (int j = 0; j < SIMD_STREAMS_64; ++j) {
+            vlcg_next_dbl2(vpair, vseed, vmult, vprime);
+            vrn[0][j] = vpair[0];
+            vrn[1][j] = vpair[1];
+        }
+        simd_transpose(vrn[0]);
+        simd_transpose(vrn[1]);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm / SIMD_STREAMS_64][strm % SIMD_STREAMS_64]);
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j) {
+            vlcg_next_dbl2(vpair, vseed, vmult, vprime);
+            vrn[0][j] = vpair[0];
+            vrn[1][j] = vpair[1];
+        }
+        for (int j = nrem; j < SIMD_STREAMS_64; ++j) {
+            simd_set_zero(&vrn[0][j]);
+            simd_set_zero(&vrn[1][j]);
+        }
+        simd_transpose(vrn[0]);
+        simd_transpose(vrn[1]);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm / SIMD_STREAMS_64][strm % SIMD_STREAMS_64]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_64, rn_tail, nrem * sizeof(double));
+        }
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Size in bytes of packed state of active streams.
+ */
+inline int VLCG_ENGINE::pack_size() const
+{ return lcg_pack_size(nstreams); }
+
+
+/*!
+ *  \brief Pack state of active streams into caller buffer (see lcg_pack.h).
+ *
+ *  Registers are stored to aligned arrays and copied to the packed
+ *  arrays, the packed state of stream i is the same as an LCG with the
+ *  parameters of stream i.
+ *  Returns number of bytes written or -1 on error.
+ */
+inline int VLCG_ENGINE::pack_rng(void * const buffer, const int size) const
+{
+    const int nbytes = lcg_pack_check(buffer, size, nstreams);
+    if (nbytes < 0)
+        return -1;
+
+    const LCG_PACK_VIEW pack = lcg_pack_view(buffer, nstreams);
+    lcg_pack_header(pack.header, nstreams, per_lane, prime_position, prime_next);
+
+    uint64_t lseed[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int32_t ls[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int32_t lm[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int32_t lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+#if defined(LONG_SPRNG)
+    simd_store((unsigned long int *)&lseed[0], seed[0]);
+    simd_store((unsigned long int *)&lseed[SIMD_STREAMS_64], seed[1]);
+    simd_store((int *)ls, simd_packmerge_i32(init_seed[0], init_seed[1]));
+    simd_store((int *)lm, simd_packmerge_i32(parameter[0], parameter[1]));
+    simd_store((int *)lprime, simd_packmerge_i32(prime[0], prime[1]));
+#else
+    int lseed2[2][SIMD_STREAMS_32] __SIMD_ALIGN__;
+    simd_store(lseed2[0], seed[0]);
+    simd_store(lseed2[1], seed[1]);
+    for (int strm = 0; strm < nstreams; ++strm)
+        lseed[strm] = ((uint64_t)lseed2[0][strm] << 24) | (uint64_t)lseed2[1][strm];
+    simd_store((int *)ls, init_seed[0]);
+    simd_store((int *)lm, parameter[0]);
+    simd_store((int *)lprime, prime[0]);
+#endif
+
+    memcpy(pack.seed, lseed, nstreams * sizeof(uint64_t));
+    memcpy(pack.init_seed, ls, nstreams * sizeof(int32_t));
+    memcpy(pack.prime, lprime, nstreams * sizeof(int32_t));
+    memcpy(pack.parameter, lm, nstreams * sizeof(int32_t));
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Restore state in place from packed state (see lcg_pack.h).
+ *
+ *  Packed streams become the active streams, at most SIMD_STREAMS_32.
+ *  Returns number of bytes read or -1 on error, state is not modified on error.
+ */
+inline int VLCG_ENGINE::unpack_rng(const void * const buffer, const int size)
+{
+    const int nstrms = lcg_unpack_check(buffer, size, SIMD_STREAMS_32);
+    if (nstrms < 0)
+        return -1;
+
+    const LCG_PACK_VIEW pack = lcg_pack_view(buffer, nstrms);
+    for (int strm = 0; strm < nstrms; ++strm) {
+        if (pack.parameter[strm] < 0 || pack.parameter[strm] >= GLOBALS.NPARAMS) {
+            printf("ERROR: Unpacked parameters not acceptable.\n");
+            return -1;
+        }
+    }
+
+    // Parameters of inactive streams are zero, as in init_rng()
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    memset(m, 0, sizeof(m));
+    memset(s, 0, sizeof(s));
+    memcpy(m, pack.parameter, nstrms * sizeof(int));
+    memcpy(s, pack.init_seed, nstrms * sizeof(int));
+    memcpy(lprime, pack.prime, nstrms * sizeof(int));
+    for (int strm = nstrms; strm < SIMD_STREAMS_32; ++strm)
+        lprime[strm] = lprime[0];
+
+    prime_position = pack.header->prime_position;
+    prime_next = pack.header->prime_next;
+    per_lane = pack.header->per_lane;
+    set_streams(s, m, nstrms, lprime);
+
+    // Current seeds of active streams
+#if defined(LONG_SPRNG)
+    unsigned long int lseed[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    simd_store(&lseed[0], seed[0]);
+    simd_store(&lseed[SIMD_STREAMS_64], seed[1]);
+    for (int strm = 0; strm < nstrms; ++strm)
+        lseed[strm] = pack.seed[strm] & 0xFFFFFFFFFFFFUL;
+    seed[0] = simd_load(&lseed[0]);
+    seed[1] = simd_load(&lseed[SIMD_STREAMS_64]);
+#else
+    int lseed[2][SIMD_STREAMS_32] __SIMD_ALIGN__;
+    simd_store(lseed[0], seed[0]);
+    simd_store(lseed[1], seed[1]);
+    for (int strm = 0; strm < nstrms; ++strm) {
+        lseed[0][strm] = (int)((pack.seed[strm] >> 24) & 0xFFFFFFU);
+        lseed[1][strm] = (int)(pack.seed[strm] & 0xFFFFFFU);
+    }
+    seed[0] = simd_load(lseed[0]);
+    seed[1] = simd_load(lseed[1]);
+#endif
+
+    return lcg_pack_size(nstrms);
+}
+
+
+#if defined(LONG_SPRNG)
+inline SIMD_INT VLCG_ENGINE::get_seed_rng() const
+{
+    const SIMD_INT va = simd_packmerge_i32(init_seed[0], init_seed[1]);
+    if (masked)
+        return simd_maskz_32(va, strm_mask32);
+    return va;
+}
+#else
+inline SIMD_INT VLCG_ENGINE::get_seed_rng() const
+{
+    if (masked)
+        return simd_maskz_32(init_seed[0], strm_mask32);
+    return init_seed[0];
+}
+#endif
+
+
+#if defined(DEBUG)
+# if defined(LONG_SPRNG)
+inline SIMD_INT VLCG_ENGINE::get_seed() const
+{
+    if (masked)
+        return simd_maskz_64(seed[0], strm_mask64[0]);
+    return seed[0];
+}
+
+inline SIMD_INT VLCG_ENGINE::get_seed2() const
+{
+    if (masked)
+        return simd_maskz_64(seed[1], strm_mask64[1]);
+    return seed[1];
+}
+
+inline SIMD_INT VLCG_ENGINE::get_multiplier() const
+{
+    if (masked)
+        return simd_maskz_64(multiplier[0], strm_mask64[0]);
+    return multiplier[0];
+}
+
+inline SIMD_INT VLCG_ENGINE::get_multiplier2() const
+{
+    if (masked)
+        return simd_maskz_64(multiplier[1], strm_mask64[1]);
+    return multiplier[1];
+}
+
+inline SIMD_INT VLCG_ENGINE::get_prime() const
+{
+    const SIMD_INT va = simd_packmerge_i32(prime[0], prime[1]);
+    if (masked)
+        return simd_maskz_32(va, strm_mask32);
+    return va;
+}
+
+# else
+inline SIMD_INT VLCG_ENGINE::get_seed() const
+{
+    if (masked)
+        return simd_maskz_32(seed[0], strm_mask32);
+    return seed[0];
+}
+
+inline SIMD_INT VLCG_ENGINE::get_multiplier() const
+{
+    if (masked)
+        return simd_maskz_32(multiplier[0], strm_mask32);
+    return multiplier[0];
+}
+
+inline SIMD_INT VLCG_ENGINE::get_prime() const
+{
+    if (masked)
+        return simd_maskz_32(prime[0], strm_mask32);
+    return prime[0];
+}
+# endif
+#endif
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VLCG_ENGINE_H
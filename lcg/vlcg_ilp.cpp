@@ -0,0 +1,276 @@
+/*************************************************************************/
+/*************************************************************************/
+/*             Parallel 48 bit Linear Congruential Generator             */
+/*                   Multiple register sets (ILP) engine                 */
+/*                                                                       */
+/* Modified by: Eduardo Ponce                                            */
+/*              The University of Tennessee, Knoxville                   */
+/*              Email: eponcemo@utk.edu (Jan 2017)                       */
+/*                                                                       */
+/* Based on the implementation by:                                       */
+/*             J. Ren                                                    */
+/*             Ashok Srinivasan (Apr 13, 1998)                           */
+/*************************************************************************/
+/*************************************************************************/
+
+
+#include "simd.h"
+#if defined(SIMD_MODE)
+
+
+#include <stdio.h>   // printf
+#include <string.h>  // memcpy
+#include "vlcg_ilp.h"
+#include "vlcg_kernels.h"
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+template <int K>
+VLCG_ILP<K>::VLCG_ILP()
+{ }
+
+
+/*!
+ *  \brief Destructor
+ */
+template <int K>
+VLCG_ILP<K>::~VLCG_ILP()
+{ }
+
+
+/*!
+ *  \brief Initialize RNG
+ *
+ *  Register set k uses generator number gn+k, so tg has to be greater than gn+K-1.
+ *  Seeds and multipliers arrays have K*SIMD_STREAMS_32 elements,
+ *  register set k uses elements [k*SIMD_STREAMS_32, (k+1)*SIMD_STREAMS_32).
+ */
+template <int K>
+int VLCG_ILP<K>::init_rng(int gn, int tg, const int * const gs, const int * const gm)
+{
+    if (gn + K > tg) {
+        printf("ERROR: total_gen out of range for %d register sets, %d\n", K, tg);
+        tg = gn + K;
+    }
+
+    for (int k = 0; k < K; ++k) {
+        const int * const lgs = (gs) ? (gs + k * SIMD_STREAMS_32) : NULL;
+        const int * const lgm = (gm) ? (gm + k * SIMD_STREAMS_32) : NULL;
+        if (rng[k].init_rng(gn + k, tg, lgs, lgm, SIMD_STREAMS_32))
+            return -1;
+    }
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Copy state of all register sets into contiguous arrays of registers.
+ *
+ *  Register sets always use all streams, so no output masks are needed.
+ */
+template <int K>
+void VLCG_ILP<K>::load_state(SIMD_INT * const vseed, SIMD_INT * const vmult, SIMD_INT * const vprime) const
+{
+    for (int k = 0; k < K; ++k) {
+        for (int j = 0; j < VLCG_SEED_REGS; ++j)
+            vseed[k * VLCG_SEED_REGS + j] = rng[k].engine->seed[j];
+        for (int j = 0; j < VLCG_MULT_REGS; ++j)
+            vmult[k * VLCG_MULT_REGS + j] = rng[k].engine->multiplier[j];
+        for (int j = 0; j < VLCG_PRIME_REGS; ++j)
+            vprime[k * VLCG_PRIME_REGS + j] = rng[k].engine->prime[j];
+    }
+}
+
+
+/*!
+ *  \brief Write back seeds of all register sets.
+ */
+template <int K>
+void VLCG_ILP<K>::store_state(const SIMD_INT * const vseed) const
+{
+    for (int k = 0; k < K; ++k)
+        for (int j = 0; j < VLCG_SEED_REGS; ++j)
+            rng[k].engine->seed[j] = vseed[k * VLCG_SEED_REGS + j];
+}
+
+
+/*!
+ *  \brief Fill an array with integer random numbers.
+ *
+ *  The array must be aligned to SIMD_WIDTH_BYTES. Each round stores one register
+ *  per register set. If nrn is not a multiple of NSTREAMS_32, the last round
+ *  is truncated (all register sets still advance).
+ *  Returns the number of elements written or -1 on error.
+ */
+template <int K>
+int VLCG_ILP<K>::get_rn_int_array(int * const rn, const int nrn) const
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    SIMD_INT vseed[K * VLCG_SEED_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[K * VLCG_MULT_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[K * VLCG_PRIME_REGS] __SIMD_ALIGN__;
+    load_state(vseed, vmult, vprime);
+
+    const int nround = nrn / NSTREAMS_32;
+    const int nrem = nrn % NSTREAMS_32;
+
+    int *rn_ptr = rn;
+    for (int i = 0; i < nround; ++i) {
+        for (int k = 0; k < K; ++k) {
+            const SIMD_INT vrn = vlcg_next_int(vseed + k * VLCG_SEED_REGS, vmult + k * VLCG_MULT_REGS, vprime + k * VLCG_PRIME_REGS);
+            simd_store(rn_ptr, vrn);
+            rn_ptr += SIMD_STREAMS_32;
+        }
+    }
+
+    if (nrem > 0) {
+        int rn_tail[NSTREAMS_32] __SIMD_ALIGN__;
+        for (int k = 0; k < K; ++k) {
+            const SIMD_INT vrn = vlcg_next_int(vseed + k * VLCG_SEED_REGS, vmult + k * VLCG_MULT_REGS, vprime + k * VLCG_PRIME_REGS);
+            simd_store(rn_tail + k * SIMD_STREAMS_32, vrn);
+        }
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(int));
+    }
+
+    store_state(vseed);
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers.
+ *
+ *  Same as get_rn_int_array() but rounds have NSTREAMS_64 elements.
+ */
+template <int K>
+int VLCG_ILP<K>::get_rn_dbl_array(double * const rn, const int nrn) const
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    SIMD_INT vseed[K * VLCG_SEED_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[K * VLCG_MULT_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[K * VLCG_PRIME_REGS] __SIMD_ALIGN__;
+    load_state(vseed, vmult, vprime);
+
+    const int nround = nrn / NSTREAMS_64;
+    const int nrem = nrn % NSTREAMS_64;
+
+    double *rn_ptr = rn;
+    for (int i = 0; i < nround; ++i) {
+        for (int k = 0; k < K; ++k) {
+            const SIMD_DBL vrn = vlcg_next_dbl(vseed + k * VLCG_SEED_REGS, vmult + k * VLCG_MULT_REGS, vprime + k * VLCG_PRIME_REGS);
+            simd_store(rn_ptr, vrn);
+            rn_ptr += SIMD_STREAMS_64;
+        }
+    }
+
+    if (nrem > 0) {
+        double rn_tail[NSTREAMS_64] __SIMD_ALIGN__;
+        for (int k = 0; k < K; ++k) {
+            const SIMD_DBL vrn = vlcg_next_dbl(vseed + k * VLCG_SEED_REGS, vmult + k * VLCG_MULT_REGS, vprime + k * VLCG_PRIME_REGS);
+            simd_store(rn_tail + k * SIMD_STREAMS_64, vrn);
+        }
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(double));
+    }
+
+    store_state(vseed);
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with single-precision random numbers.
+ *
+ *  Same as get_rn_int_array() but for float elements.
+ */
+template <int K>
+int VLCG_ILP<K>::get_rn_flt_array(float * const rn, const int nrn) const
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    SIMD_INT vseed[K * VLCG_SEED_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[K * VLCG_MULT_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[K * VLCG_PRIME_REGS] __SIMD_ALIGN__;
+    load_state(vseed, vmult, vprime);
+
+    const int nround = nrn / NSTREAMS_32;
+    const int nrem = nrn % NSTREAMS_32;
+
+    float *rn_ptr = rn;
+    for (int i = 0; i < nround; ++i) {
+        for (int k = 0; k < K; ++k) {
+            const SIMD_FLT vrn = vlcg_next_flt(vseed + k * VLCG_SEED_REGS, vmult + k * VLCG_MULT_REGS, vprime + k * VLCG_PRIME_REGS);
+            simd_store(rn_ptr, vrn);
+            rn_ptr += SIMD_STREAMS_32;
+        }
+    }
+
+    if (nrem > 0) {
+        float rn_tail[NSTREAMS_32] __SIMD_ALIGN__;
+        for (int k = 0; k < K; ++k) {
+            const SIMD_FLT vrn = vlcg_next_flt(vseed + k * VLCG_SEED_REGS, vmult + k * VLCG_MULT_REGS, vprime + k * VLCG_PRIME_REGS);
+            simd_store(rn_tail + k * SIMD_STREAMS_32, vrn);
+        }
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(float));
+    }
+
+    store_state(vseed);
+
+    return nrn;
+}
+
+
+template <int K>
+int VLCG_ILP<K>::get_ngens() const
+{ return rng[0].get_ngens(); }
+
+
+/*!
+ *  \brief Advance all streams of all register sets n steps.
+ */
+template <int K>
+int VLCG_ILP<K>::advance(const long int n)
+{
+    for (int k = 0; k < K; ++k)
+        if (rng[k].advance(n))
+            return -1;
+
+    return 0;
+}
+
+
+/*
+ *  Supported number of register sets
+ */
+template class VLCG_ILP<2>;
+template class VLCG_ILP<4>;
+template class VLCG_ILP<8>;
+
+
+#endif // SIMD_MODE
+
+
+/***********************************************************************************
+* SPRNG (c) 2016 by The University of Tennessee, Knoxville                         *
+*                                                                                  *
+* SPRNG is licensed under a                                                        *
+* Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License. *
+*                                                                                  *
+* You should have received a copy of the license along with this                   *
+* work. If not, see <http://creativecommons.org/licenses/by-nc-sa/4.0/>.           *
+************************************************************************************/
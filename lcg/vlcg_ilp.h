@@ -0,0 +1,48 @@
+#ifndef __VLCG_ILP_H
+#define __VLCG_ILP_H
+
+
+#include "simd.h"
+#if defined SIMD_MODE
+
+
+#include "vlcg.h"
+
+
+/*! \class VLCG_ILP
+ *  \brief SIMD linear congruential RNG with K independent register sets.
+ *
+ *  Each register set is a VLCG initialized with generator number gn+k,
+ *  so an object provides K*SIMD_STREAMS_32 streams. The sets are stepped
+ *  interleaved to hide the latency of the multiply dependency chain.
+ *  Arrays hold rounds of K registers, register k of each round is identical
+ *  to the output of a VLCG initialized with gn+k.
+ *
+ *  Supported values of K are 2, 4, and 8.
+ */
+template <int K>
+class VLCG_ILP
+{
+  public:
+    enum { NSETS = K, NSTREAMS_32 = K * SIMD_STREAMS_32, NSTREAMS_64 = K * SIMD_STREAMS_64 };
+
+    VLCG_ILP();
+    ~VLCG_ILP();
+    int init_rng(int, int, const int * const, const int * const);
+    int get_rn_int_array(int * const, const int) const;
+    int get_rn_flt_array(float * const, const int) const;
+    int get_rn_dbl_array(double * const, const int) const;
+    int get_ngens() const;
+    int advance(const long int);
+
+  private:
+    VLCG rng[K];
+    void load_state(SIMD_INT * const, SIMD_INT * const, SIMD_INT * const) const;
+    void store_state(const SIMD_INT * const) const;
+};
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VLCG_ILP_H
@@ -0,0 +1,169 @@
+/*************************************************************************/
+/*************************************************************************/
+/*             Parallel 48 bit Linear Congruential Generator             */
+/*                    Kernels for a single SIMD mode                     */
+/*                                                                       */
+/* Modified by: Eduardo Ponce                                            */
+/*              The University of Tennessee, Knoxville                   */
+/*              Email: eponcemo@utk.edu (Jan 2017)                       */
+/*                                                                       */
+/* Based on the implementation by:                                       */
+/*             J. Ren                                                    */
+/*             Ashok Srinivasan (Apr 13, 1998)                           */
+/*************************************************************************/
+/*************************************************************************/
+
+
+/*
+ *  This file is compiled once per SIMD mode with the corresponding
+ *  SIMD define (SSE2_SPRNG, SSE4_1_SPRNG, AVX2_SPRNG, AVX512_SPRNG)
+ *  and compiler flags. Each object exports a VLCG_ISA_TABLE.
+ */
+#include "simd.h"
+#if defined(SIMD_MODE)
+
+
+#include <stdio.h>   // printf
+#include <stdlib.h>  // posix_memalign, free
+#include <string.h>  // memset, memcpy
+#include <new>       // placement new
+#include "lcg_globals.h"
+#include "lcg_jump.h"
+#include "vlcg_kernels.h"
+#include "primes_32.h"
+#include "vutils.h"
+#include "vlcg_isa.h"
+
+
+/*
+ *  Engine has inline member functions with external linkage, place each
+ *  SIMD mode in its own namespace so that objects do not share definitions.
+ */
+#if defined(AVX512_SPRNG)
+#define VLCG_ISA_EXPORT VLCG_ISA_AVX512
+#define VLCG_ISA_NS     vlcg_avx512
+#elif defined(AVX2_SPRNG)
+#define VLCG_ISA_EXPORT VLCG_ISA_AVX2
+#define VLCG_ISA_NS     vlcg_avx2
+#elif defined(SSE4_1_SPRNG)
+#define VLCG_ISA_EXPORT VLCG_ISA_SSE4_1
+#define VLCG_ISA_NS     vlcg_sse4_1
+#elif defined(SSE2_SPRNG)
+#define VLCG_ISA_EXPORT VLCG_ISA_SSE2
+#define VLCG_ISA_NS     vlcg_sse2
+#else
+#error "vlcg_isa.cpp requires one of SSE2_SPRNG, SSE4_1_SPRNG, AVX2_SPRNG, AVX512_SPRNG"
+#endif
+
+
+namespace VLCG_ISA_NS {
+
+
+#include "vlcg_engine.h"
+
+
+static void * isa_create()
+{
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, SIMD_WIDTH_BYTES, sizeof(VLCG_ENGINE))) {
+        printf("ERROR: failed to allocate aligned memory for VLCG engine\n");
+        return NULL;
+    }
+    return new (ptr) VLCG_ENGINE();
+}
+
+
+static void isa_destroy(void * const eng)
+{
+    if (!eng)
+        return;
+    static_cast<VLCG_ENGINE *>(eng)->~VLCG_ENGINE();
+    free(eng);
+}
+
+
+static int isa_init_rng(void * const eng, int gn, int tg, const int * const gs, const int * const gm, const int nstrms)
+{ return static_cast<VLCG_ENGINE *>(eng)->init_rng(gn, tg, gs, gm, nstrms); }
+
+
+static int isa_init_rng_lanes(void * const eng, int gn, int tg, const int * const gs, const int * const gm, const int nstrms)
+{ return static_cast<VLCG_ENGINE *>(eng)->init_rng_lanes(gn, tg, gs, gm, nstrms); }
+
+
+static int isa_reseed_rng(void * const eng, const int * const gs)
+{ return static_cast<VLCG_ENGINE *>(eng)->reseed_rng(gs); }
+
+
+static int isa_get_rn_int_array(void * const eng, int * const rn, const int nrn)
+{ return static_cast<VLCG_ENGINE *>(eng)->get_rn_int_array(rn, nrn); }
+
+
+static int isa_get_rn_flt_array(void * const eng, float * const rn, const int nrn)
+{ return static_cast<VLCG_ENGINE *>(eng)->get_rn_flt_array(rn, nrn); }
+
+
+static int isa_get_rn_dbl_array(void * const eng, double * const rn, const int nrn)
+{ return static_cast<VLCG_ENGINE *>(eng)->get_rn_dbl_array(rn, nrn); }
+
+
+static int isa_get_rn_dbl2_array(void * const eng, double * const rn, const int nrn)
+{ return static_cast<VLCG_ENGINE *>(eng)->get_rn_dbl2_array(rn, nrn); }
+
+
+static int isa_get_rn_int_streams(void * const eng, int * const rn, const int nrn, const int stride)
+{ return static_cast<VLCG_ENGINE *>(eng)->get_rn_int_streams(rn, nrn, stride); }
+
+
+static int isa_get_rn_flt_streams(void * const eng, float * const rn, const int nrn, const int stride)
+{ return static_cast<VLCG_ENGINE *>(eng)->get_rn_flt_streams(rn, nrn, stride); }
+
+
+static int isa_get_rn_dbl_streams(void * const eng, double * const rn, const int nrn, const int stride)
+{ return static_cast<VLCG_ENGINE *>(eng)->get_rn_dbl_streams(rn, nrn, stride); }
+
+
+static int isa_advance(void * const eng, const long int n)
+{ return static_cast<VLCG_ENGINE *>(eng)->advance(n); }
+
+
+} // namespace VLCG_ISA_NS
+
+
+/*!
+ *  \brief Kernels table of this SIMD mode.
+ */
+extern const VLCG_ISA_TABLE VLCG_ISA_EXPORT = {
+    VLCG_ISA_NAME,
+    VLCG_ISA_LEVEL,
+    SIMD_WIDTH_BYTES,
+    (int)sizeof(VLCG_ISA_NS::VLCG_ENGINE),
+    SIMD_STREAMS_32,
+    SIMD_STREAMS_64,
+    VLCG_ISA_NS::isa_create,
+    VLCG_ISA_NS::isa_destroy,
+    VLCG_ISA_NS::isa_init_rng,
+    VLCG_ISA_NS::isa_init_rng_lanes,
+    VLCG_ISA_NS::isa_reseed_rng,
+    VLCG_ISA_NS::isa_get_rn_int_array,
+    VLCG_ISA_NS::isa_get_rn_flt_array,
+    VLCG_ISA_NS::isa_get_rn_dbl_array,
+    VLCG_ISA_NS::isa_get_rn_dbl2_array,
+    VLCG_ISA_NS::isa_get_rn_int_streams,
+    VLCG_ISA_NS::isa_get_rn_flt_streams,
+    VLCG_ISA_NS::isa_get_rn_dbl_streams,
+    VLCG_ISA_NS::isa_advance
+};
+
+
+#endif // SIMD_MODE
+
+
+/***********************************************************************************
+* SPRNG (c) 2016 by The University of Tennessee, Knoxville                         *
+*                                                                                  *
+* SPRNG is licensed under a                                                        *
+* Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License. *
+*                                                                                  *
+* You should have received a copy of the license along with this                   *
+* work. If not, see <http://creativecommons.org/licenses/by-nc-sa/4.0/>.           *
+************************************************************************************/
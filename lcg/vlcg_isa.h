@@ -0,0 +1,86 @@
+#ifndef __VLCG_ISA_H
+#define __VLCG_ISA_H
+
+
+#include "simd.h"
+#include "utils.h"  // SIMD_LEVEL
+
+
+/*
+ *  SIMD mode of the compilation unit including this header
+ */
+#if defined(AVX512_SPRNG)
+#define VLCG_ISA_NAME  "AVX512"
+#define VLCG_ISA_LEVEL SIMD_LEVEL_AVX512
+#elif defined(AVX2_SPRNG)
+#define VLCG_ISA_NAME  "AVX2"
+#define VLCG_ISA_LEVEL SIMD_LEVEL_AVX2
+#elif defined(AVX_SPRNG)
+#define VLCG_ISA_NAME  "AVX"
+#define VLCG_ISA_LEVEL SIMD_LEVEL_AVX
+#elif defined(SSE4_1_SPRNG)
+#define VLCG_ISA_NAME  "SSE4.1"
+#define VLCG_ISA_LEVEL SIMD_LEVEL_SSE4_1
+#elif defined(SSE2_SPRNG)
+#define VLCG_ISA_NAME  "SSE2"
+#define VLCG_ISA_LEVEL SIMD_LEVEL_SSE2
+#else
+#define VLCG_ISA_NAME  "none"
+#define VLCG_ISA_LEVEL SIMD_LEVEL_NONE
+#endif
+
+
+/*
+ *  Table of VLCG kernels for a single SIMD mode.
+ *
+ *  vlcg_isa.cpp is compiled once per SIMD mode (see makefile), each object
+ *  exports one table. Engines are opaque handles, allocated aligned to the
+ *  SIMD width of the table. Functions follow the VLCG_ENGINE interface.
+ *  Engines of tables with the same width and engine size have the same
+ *  layout as a VLCG_ENGINE compiled with that width, so VLCG can pass its
+ *  own engine to a table of a better SIMD mode.
+ */
+struct VLCG_ISA_TABLE
+{
+    const char *name;
+    int level;
+    int width_bytes;
+    int engine_size;
+    int nstreams_32;
+    int nstreams_64;
+    void * (*create)();
+    void (*destroy)(void * const);
+    int (*init_rng)(void * const, int, int, const int * const, const int * const, const int);
+    int (*init_rng_lanes)(void * const, int, int, const int * const, const int * const, const int);
+    int (*reseed_rng)(void * const, const int * const);
+    int (*get_rn_int_array)(void * const, int * const, const int);
+    int (*get_rn_flt_array)(void * const, float * const, const int);
+    int (*get_rn_dbl_array)(void * const, double * const, const int);
+    int (*get_rn_dbl2_array)(void * const, double * const, const int);
+    int (*get_rn_int_streams)(void * const, int * const, const int, const int);
+    int (*get_rn_flt_streams)(void * const, float * const, const int, const int);
+    int (*get_rn_dbl_streams)(void * const, double * const, const int, const int);
+    int (*advance)(void * const, const long int);
+};
+
+
+/*
+ *  Tables available, one per object compiled from vlcg_isa.cpp
+ */
+extern const VLCG_ISA_TABLE VLCG_ISA_SSE2;
+extern const VLCG_ISA_TABLE VLCG_ISA_SSE4_1;
+extern const VLCG_ISA_TABLE VLCG_ISA_AVX2;
+extern const VLCG_ISA_TABLE VLCG_ISA_AVX512;
+
+
+/*!
+ *  \brief Table of best SIMD mode supported by CPU, up to a given level.
+ *
+ *  If width_bytes is not zero, only tables of that register width are
+ *  considered. Returns NULL if none is available.
+ */
+const VLCG_ISA_TABLE * vlcg_isa_select(const int, const int = 0);
+
+
+#endif  // __VLCG_ISA_H
+
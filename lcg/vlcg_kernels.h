@@ -0,0 +1,223 @@
+#ifndef __VLCG_KERNELS_H
+#define __VLCG_KERNELS_H
+
+
+#include "simd.h"
+#if defined(SIMD_MODE)
+
+
+#include "lcg_globals.h"
+
+
+/*
+ *  SIMD kernels for 48-bit LCG
+ *
+ *  Seeds, multipliers, and primes are passed as arrays of registers:
+ *  LONG_SPRNG uses 2 registers of 64-bit elements for each,
+ *  32-bit mode uses 2 registers (24-bit high/low limbs) for seeds,
+ *  4 registers (12-bit limbs) for multipliers, and 1 register for primes.
+ */
+#if defined(LONG_SPRNG)
+#define VLCG_SEED_REGS  2
+#define VLCG_MULT_REGS  2
+#define VLCG_PRIME_REGS 2
+#else
+#define VLCG_SEED_REGS  2
+#define VLCG_MULT_REGS  4
+#define VLCG_PRIME_REGS 1
+#endif
+
+
+#if defined(LONG_SPRNG)
+/*!
+ *  \brief LCG multiply 48-bits using 64-bits.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void vlcg_multiply(SIMD_INT * const a, const SIMD_INT * const b, const SIMD_INT * const c)
+{
+    const SIMD_INT vmsk_lsb48 = simd_set(0xFFFFFFFFFFFFUL);
+
+    a[0] = simd_mul_u64(a[0], b[0]);
+    a[0] = simd_add_i64(a[0], c[0]);
+    a[0] = simd_and(a[0], vmsk_lsb48);
+}
+#else
+/*!
+ *  \brief LCG multiply 48-bits using 32-bits.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void vlcg_multiply(SIMD_INT * const a, const SIMD_INT * const b, const SIMD_INT * const c)
+{
+    const SIMD_INT vmsk_fac[2] __SIMD_ALIGN__ = { simd_set(4095U),
+                                              simd_set(16777215U) };
+    SIMD_INT s[4] __SIMD_ALIGN__;
+    SIMD_INT res[4] __SIMD_ALIGN__;
+    SIMD_INT vtmp[3] __SIMD_ALIGN__;
+
+    s[0] = simd_and(a[1], vmsk_fac[0]);
+    s[1] = simd_srl_32(a[1], 0xC);
+    s[2] = simd_and(a[0], vmsk_fac[0]);
+    s[3] = simd_srl_32(a[0], 0xC);
+
+    for (int i = 0; i < 4; ++i) {
+        SIMD_INT * const res_ptr __SIMD_ALIGN__ = res + i;
+
+        *res_ptr = simd_mullo_i32(b[0], *(s+i));
+        for (int j = 0; j < i; ++j) {
+            const SIMD_INT vmul = simd_mullo_i32(*(b+i-j), *(s+j));
+            *res_ptr = simd_add_i32(*res_ptr, vmul);
+        }
+    }
+
+    // Low limb first, its carry propagates into the high limb
+    vtmp[0] = simd_and(res[1], vmsk_fac[0]);
+    vtmp[1] = simd_add_i32(res[0], c[0]);
+    vtmp[0] = simd_sll_32(vtmp[0], 0xC);
+    const SIMD_INT vlo = simd_add_i32(vtmp[0], vtmp[1]);
+
+    vtmp[0] = simd_srl_32(vlo, 0x18);
+    vtmp[1] = simd_srl_32(res[1], 0xC);
+    vtmp[2] = simd_sll_32(res[3], 0xC);
+    vtmp[0] = simd_add_i32(vtmp[0], res[2]);
+    vtmp[1] = simd_add_i32(vtmp[1], vtmp[2]);
+    vtmp[0] = simd_add_i32(vtmp[0], vtmp[1]);
+    a[0] = simd_and(vtmp[0], vmsk_fac[1]);
+    a[1] = simd_and(vlo, vmsk_fac[1]);
+}
+#endif
+
+
+/*!
+ *  \brief Step streams once and return integer random numbers.
+ *
+ *  State is passed explicitly so that all interfaces (single draw, arrays,
+ *  multiple register sets) share the same kernel and produce identical streams.
+ *  The high 31-bits out of the 48-bits are returned.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT vlcg_next_int(SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p)
+{
+#if defined(LONG_SPRNG)
+    SIMD_INT rn[2] __SIMD_ALIGN__;
+
+    vlcg_multiply(&s[0], &m[0], &p[0]);
+    vlcg_multiply(&s[1], &m[1], &p[1]);
+
+    rn[0] = simd_srl_64(s[0], 0x11);
+    rn[1] = simd_srl_64(s[1], 0x11);
+
+    return simd_packmerge_i32(rn[0], rn[1]);
+#else
+    SIMD_INT rn[2] __SIMD_ALIGN__;
+
+    vlcg_multiply(&s[0], &m[0], &p[0]);
+
+    rn[0] = simd_sll_32(s[0], 0x7);
+    rn[1] = simd_srl_32(s[1], 0x11);
+
+    return simd_or(rn[0], rn[1]);
+#endif
+}
+
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL vlcg_next_dbl(SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p)
+{
+#if defined(LONG_SPRNG)
+    const SIMD_DBL vfac = simd_set(GLOBALS.TWO_M48);
+    SIMD_DBL rn;
+
+    vlcg_multiply(&s[0], &m[0], &p[0]);
+    rn = simd_cvt_u64_f64(s[0]);
+
+    return simd_mul(rn, vfac);
+#else
+    const SIMD_DBL vfac[2] __SIMD_ALIGN__ = { simd_set(GLOBALS.TWO_M24),
+                                              simd_set(GLOBALS.TWO_M48) };
+    SIMD_DBL rn[2] __SIMD_ALIGN__;
+
+    vlcg_multiply(&s[0], &m[0], &p[0]);
+    rn[0] = simd_cvt_i32_f64(s[0]);
+    rn[1] = simd_cvt_i32_f64(s[1]);
+
+    rn[0] = simd_mul(rn[0], vfac[0]);
+    return simd_fmadd(rn[1], vfac[1], rn[0]);
+#endif
+}
+
+
+/*!
+ *  \brief Step all streams once and return double-precision random numbers.
+ *
+ *  rn[0] holds streams [0, SIMD_STREAMS_64), identical to vlcg_next_dbl(),
+ *  rn[1] holds streams [SIMD_STREAMS_64, SIMD_STREAMS_32).
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void vlcg_next_dbl2(SIMD_DBL * const rn, SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p)
+{
+#if defined(LONG_SPRNG)
+    const SIMD_DBL vfac = simd_set(GLOBALS.TWO_M48);
+
+    vlcg_multiply(&s[0], &m[0], &p[0]);
+    vlcg_multiply(&s[1], &m[1], &p[1]);
+
+    rn[0] = simd_cvt_u64_f64(s[0]);
+    rn[1] = simd_cvt_u64_f64(s[1]);
+
+    rn[0] = simd_mul(rn[0], vfac);
+    rn[1] = simd_mul(rn[1], vfac);
+#else
+    const SIMD_DBL vfac[2] __SIMD_ALIGN__ = { simd_set(GLOBALS.TWO_M24),
+                                              simd_set(GLOBALS.TWO_M48) };
+    SIMD_DBL vlo[2] __SIMD_ALIGN__;
+
+    vlcg_multiply(&s[0], &m[0], &p[0]);
+    rn[0] = simd_cvt_i32_f64(s[0]);
+    rn[1] = simd_cvt_i32_f64_hi(s[0]);
+    vlo[0] = simd_cvt_i32_f64(s[1]);
+    vlo[1] = simd_cvt_i32_f64_hi(s[1]);
+
+    rn[0] = simd_mul(rn[0], vfac[0]);
+    rn[1] = simd_mul(rn[1], vfac[0]);
+    rn[0] = simd_fmadd(vlo[0], vfac[1], rn[0]);
+    rn[1] = simd_fmadd(vlo[1], vfac[1], rn[1]);
+#endif
+}
+
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_FLT vlcg_next_flt(SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p)
+{
+#if defined(LONG_SPRNG)
+    const SIMD_FLT vfac = simd_set((float)GLOBALS.TWO_M48);
+    SIMD_FLT rn[2] __SIMD_ALIGN__;
+
+    vlcg_multiply(&s[0], &m[0], &p[0]);
+    vlcg_multiply(&s[1], &m[1], &p[1]);
+
+    rn[0] = simd_cvt_u64_f32(s[0]);
+    rn[1] = simd_cvt_u64_f32(s[1]);
+
+    rn[0] = simd_mul(rn[0], vfac);
+    rn[1] = simd_mul(rn[1], vfac);
+
+    return simd_merge_lo(rn[0], rn[1]);
+#else
+    const SIMD_FLT vfac[2] __SIMD_ALIGN__ = { simd_set((float)GLOBALS.TWO_M24),
+                                              simd_set((float)GLOBALS.TWO_M48) };
+    SIMD_FLT rn[2] __SIMD_ALIGN__;
+
+    vlcg_multiply(&s[0], &m[0], &p[0]);
+    rn[0] = simd_cvt_i32_f32(s[0]);
+    rn[1] = simd_cvt_i32_f32(s[1]);
+
+    rn[0] = simd_mul(rn[0], vfac[0]);
+    return simd_fmadd(rn[1], vfac[1], rn[0]);
+#endif
+}
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VLCG_KERNELS_H
@@ -0,0 +1,125 @@
+/*************************************************************************/
+/*************************************************************************/
+/*           Parallel 64-bit Linear Congruential Generator               */
+/*                                                                       */ 
+/* Modified by: J. Ren                                                   */
+/*             Florida State University                                  */
+/*             Email: ren@csit.fsu.edu                                   */
+/*                                                                       */
+/* Additional Modifications by: W. J. Thrasher                           */
+/*             Florida State University                                  */
+/*             Email: wjt1321@my.fsu.edu                                 */
+/*                                                                       */
+/* Based on the implementation by:                                       */
+/*             Ashok Srinivasan (May 1998)                               */
+/*                                                                       */
+/* Note: The modulus is 2^64                                             */
+/*************************************************************************/
+/*************************************************************************/
+
+
+#include "lcg64.h"
+#include "lcg64_globals.h"
+
+
+GEN_REGISTRY LCG64::LCG64_NGENS;
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+LCG64::LCG64()
+{
+    gentype = GLOBALS64.GENTYPE;
+    rng_type = SPRNG_LCG64;
+
+    LCG64_NGENS.add(1);
+}
+
+
+/*!
+ *  \brief Destructor
+ */
+LCG64::~LCG64()
+{
+    LCG64_NGENS.add(-1);
+}
+
+
+int LCG64::init_rng(int gn, int tg, int s, int m)
+{ return engine.init_rng(gn, tg, s, m); }
+
+
+int LCG64::advance(const long int n)
+{ return engine.advance(n); }
+
+
+int LCG64::pack_size() const
+{ return engine.pack_size(); }
+
+
+/*!
+ *  \brief Pack state into caller buffer, see LCG64_ENGINE::pack_rng().
+ */
+int LCG64::pack_rng(void * const buffer, const int size) const
+{ return engine.pack_rng(buffer, size); }
+
+
+/*!
+ *  \brief Restore state in place, see LCG64_ENGINE::unpack_rng().
+ */
+int LCG64::unpack_rng(const void * const buffer, const int size)
+{ return engine.unpack_rng(buffer, size); }
+
+
+int LCG64::get_rn_int()
+{ return engine.get_rn_int(); }
+
+
+float LCG64::get_rn_flt()
+{ return engine.get_rn_flt(); }
+
+
+double LCG64::get_rn_dbl()
+{ return engine.get_rn_dbl(); }
+
+
+int LCG64::get_seed_rng() const
+{ return engine.get_seed_rng(); }
+
+
+int LCG64::get_ngens() const
+{ return LCG64_NGENS.count(); }
+
+
+#if defined(DEBUG)
+int LCG64::get_prime() const
+{ return engine.get_prime(); }
+
+# if defined(LONG_SPRNG)
+unsigned long int LCG64::get_seed() const
+{ return engine.get_seed(); }
+
+unsigned long int LCG64::get_multiplier() const
+{ return engine.get_multiplier(); }
+
+# else
+int LCG64::get_seed() const
+{ return engine.get_seed(); }
+
+int LCG64::get_multiplier() const
+{ return engine.get_multiplier(); }
+# endif
+#endif
+
+
+/***********************************************************************************
+* SPRNG (c) 2014 by Florida State University                                       *
+*                                                                                  *
+* SPRNG is licensed under a                                                        *
+* Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License. *
+*                                                                                  *
+* You should have received a copy of the license along with this                   *
+* work. If not, see <http://creativecommons.org/licenses/by-nc-sa/4.0/>.           *
+************************************************************************************/
+
@@ -0,0 +1,52 @@
+#ifndef __LCG64_H
+#define __LCG64_H
+
+
+#include "sprng.h"
+#include "lcg64_engine.h"
+#include "registry.h"
+
+
+/*! \class LCG64
+ *  \brief Class for 64-bit linear congruential RNG.
+ *
+ *  Adapter of LCG64_ENGINE for the virtual SPRNG interface.
+ */
+class LCG64: public SPRNG
+{
+    // Number of generators, per-thread counts
+    static GEN_REGISTRY LCG64_NGENS;
+
+  public:
+    LCG64();
+    ~LCG64();
+    int init_rng(int, int, int, int);
+    int get_rn_int();
+    float get_rn_flt();
+    double get_rn_dbl();
+    int get_seed_rng() const;
+    int get_ngens() const;
+    int advance(const long int);
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    int get_prime() const;
+# if defined(LONG_SPRNG)
+    unsigned long int get_seed() const;
+    unsigned long int get_multiplier() const;
+# else
+    int get_seed() const;
+    int get_multiplier() const;
+# endif
+#endif
+
+  private:
+    const char *gentype;
+    int rng_type;
+    LCG64_ENGINE engine;
+};
+
+
+#endif  // __LCG64_H
+
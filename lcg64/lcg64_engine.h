@@ -0,0 +1,255 @@
+#ifndef __LCG64_ENGINE_H
+#define __LCG64_ENGINE_H
+
+
+#include <stdio.h>
+#include "lcg64_globals.h"
+#include "lcg64_jump.h"
+#include "lcg_pack.h"
+#include "primes_64.h"
+
+
+/*! \class LCG64_ENGINE
+ *  \brief Header-only 64-bit linear congruential RNG.
+ *
+ *  Statically dispatched version of LCG64, x = a * x + p (mod 2^64).
+ *  The LCG64 class is a thin adapter for the virtual SPRNG interface.
+ *
+ *  Integers are the high 31-bits of the state, as SPRNG. Floating-point
+ *  numbers are the high 24 (float) or 53 (double) bits of the state scaled
+ *  exactly, SPRNG rounds the full state and can return 1.0.
+ */
+class LCG64_ENGINE
+{
+  public:
+    LCG64_ENGINE();
+    int init_rng(int, int, int, int);
+    int get_rn_int();
+    float get_rn_flt();
+    double get_rn_dbl();
+    int get_seed_rng() const;
+    int advance(const long int);
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    int get_prime() const;
+# if defined(LONG_SPRNG)
+    unsigned long int get_seed() const;
+    unsigned long int get_multiplier() const;
+# else
+    int get_seed() const;
+    int get_multiplier() const;
+# endif
+#endif
+
+  private:
+    int init_seed;
+    unsigned int prime;
+    int prime_position;
+    int prime_next;
+    int parameter;
+    unsigned long int seed;
+    unsigned long int multiplier;
+    void set_stream(const int, const int);
+};
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+inline LCG64_ENGINE::LCG64_ENGINE()
+{
+    init_seed = 0;
+    prime = 0;
+    prime_position = 0;
+    prime_next = 0;
+    parameter = 0;
+    seed = 0;
+    multiplier = 0;
+}
+
+
+/*!
+ *  \brief Initialize RNG
+ *
+ *  Gives back one generator (node gennum) with updated spawning info.
+ *  Should be called total_gen times, with different value
+ *  of gennum in [0,total_gen) each call.
+ */
+inline int LCG64_ENGINE::init_rng(int gn, int tg, int s, int m)
+{
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+    prime_next = tg;
+
+    if (gn >= GLOBALS64.LCG64_MAX_STREAMS)
+        printf("WARNING: generator number (%d) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", gn, GLOBALS64.LCG64_MAX_STREAMS);
+
+    if (gn < 0 || gn >= tg) {
+        printf("ERROR: generator number is out of range, %d\n", gn);
+        return -1;
+    }
+    prime_position = gn;
+    getprime_64(1, &prime, prime_position);
+
+    if (m < 0 || m >= GLOBALS64.NPARAMS) {
+        printf("ERROR: multiplier out of range, %d\n", m);
+        m = 0;
+    }
+    set_stream(s, m);
+
+    advance(GLOBALS64.LCG64_RUNUP * (long int)prime_position);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Initial state of stream from seed and multiplier (prime and generator number already set).
+ */
+inline void LCG64_ENGINE::set_stream(const int s, const int m)
+{
+    parameter = m;
+
+    init_seed = s & 0x7FFFFFFFUL;
+
+    multiplier = GLOBALS64.MULT[parameter];
+
+    seed = GLOBALS64.INIT_SEED ^ (((unsigned long int)init_seed << 33) | (unsigned long int)prime_position);
+}
+
+
+/*!
+ *  \brief Advance stream n steps in O(log n) operations.
+ *
+ *  Equivalent to calling get_rn_dbl() n times.
+ */
+inline int LCG64_ENGINE::advance(const long int n)
+{
+    if (n < 0) {
+        printf("ERROR: number of steps to advance is out of range, %ld\n", n);
+        return -1;
+    }
+
+    unsigned long int A, C;
+    lcg64_jump(&A, &C, multiplier, (unsigned long int)prime, n);
+    seed = lcg64_jump_apply(seed, A, C);
+
+    return 0;
+}
+
+
+/*!
+ *  The high 31-bits out of the 64-bits are returned.
+ */
+inline int LCG64_ENGINE::get_rn_int()
+{
+    seed = seed * multiplier + prime;
+
+    return (int)(seed >> 0x21);
+}
+
+
+inline float LCG64_ENGINE::get_rn_flt()
+{
+    seed = seed * multiplier + prime;
+
+    return (float)(int)(seed >> 0x28) * (float)GLOBALS64.TWO_M24;
+}
+
+
+inline double LCG64_ENGINE::get_rn_dbl()
+{
+    seed = seed * multiplier + prime;
+
+    return (double)(seed >> 0xB) * GLOBALS64.TWO_M53;
+}
+
+
+/*!
+ *  \brief Size in bytes of packed state.
+ */
+inline int LCG64_ENGINE::pack_size() const
+{ return lcg_pack_size(1); }
+
+
+/*!
+ *  \brief Pack state into caller buffer (see lcg_pack.h).
+ *
+ *  Returns number of bytes written or -1 on error.
+ */
+inline int LCG64_ENGINE::pack_rng(void * const buffer, const int size) const
+{
+    const int nbytes = lcg_pack_check(buffer, size, 1);
+    if (nbytes < 0)
+        return -1;
+
+    const LCG_PACK_VIEW pack = lcg_pack_view(buffer, 1);
+    lcg_pack_header(pack.header, 1, 0, prime_position, prime_next, SPRNG_LCG64);
+    pack.seed[0] = seed;
+    pack.init_seed[0] = init_seed;
+    pack.prime[0] = (int32_t)prime;
+    pack.parameter[0] = parameter;
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Restore state in place from packed state (see lcg_pack.h).
+ *
+ *  Returns number of bytes read or -1 on error, state is not modified on error.
+ */
+inline int LCG64_ENGINE::unpack_rng(const void * const buffer, const int size)
+{
+    if (lcg_unpack_check(buffer, size, 1, SPRNG_LCG64) < 0)
+        return -1;
+
+    const LCG_PACK_VIEW pack = lcg_pack_view(buffer, 1);
+    if (pack.parameter[0] < 0 || pack.parameter[0] >= GLOBALS64.NPARAMS) {
+        printf("ERROR: Unpacked parameters not acceptable.\n");
+        return -1;
+    }
+
+    prime_position = pack.header->prime_position;
+    prime_next = pack.header->prime_next;
+    init_seed = pack.init_seed[0];
+    prime = (unsigned int)pack.prime[0];
+    parameter = pack.parameter[0];
+    multiplier = GLOBALS64.MULT[parameter];
+    seed = pack.seed[0];
+
+    return lcg_pack_size(1);
+}
+
+
+inline int LCG64_ENGINE::get_seed_rng() const
+{ return init_seed; }
+
+
+#if defined(DEBUG)
+inline int LCG64_ENGINE::get_prime() const
+{ return (int)prime; }
+
+# if defined(LONG_SPRNG)
+inline unsigned long int LCG64_ENGINE::get_seed() const
+{ return seed; }
+
+inline unsigned long int LCG64_ENGINE::get_multiplier() const
+{ return multiplier; }
+
+# else
+inline int LCG64_ENGINE::get_seed() const
+{ return (int)(seed >> 0x21); }
+
+inline int LCG64_ENGINE::get_multiplier() const
+{ return (int)(multiplier >> 0x21); }
+# endif
+#endif
+
+
+#endif  // __LCG64_ENGINE_H
+
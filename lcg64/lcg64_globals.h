@@ -0,0 +1,46 @@
+#ifndef __LCG64_GLOBALS_H
+#define __LCG64_GLOBALS_H
+
+
+// Provides access to alignment attributes required for SIMD mode.
+// Misalignment may cause segmentation faults.
+#include "simd.h"
+
+
+/*!
+ *  Global parameters for LCG64
+ *  Seeds and multipliers are 64-bit, an unsigned long int of 64 bits is
+ *  required (LP64) independently of LONG_SPRNG.
+ */
+struct LCG64_GLOBALS
+{
+    const char * GENTYPE;
+    int NPARAMS;
+    unsigned long int INIT_SEED;
+    unsigned long int MULT[3];
+    double TWO_M24;
+    double TWO_M31;
+    double TWO_M53;
+    int LCG64_RUNUP;
+    int LCG64_MAX_STREAMS;
+} __SIMD_ALIGN__;
+
+
+/*!
+ *  Global instance of configuration structure.
+ */
+const LCG64_GLOBALS GLOBALS64 __SIMD_ALIGN__ = {
+    "64 bit Linear Congruential Generator with Prime Addend",
+    3,
+    0x2BC6FFFF8CFE166DUL,
+    {0x27BB2EE687B0B0FDUL, 0x2C6FE96EE78B6955UL, 0x369DEA0F31A53F85UL},
+    5.96046447753906234e-8,
+    4.656612873077392578125e-10,
+    1.1102230246251565404e-16,
+    127,
+    146138719
+};
+
+
+#endif  // __LCG64_GLOBALS_H
+
@@ -0,0 +1,44 @@
+#ifndef __LCG64_JUMP_H
+#define __LCG64_JUMP_H
+
+
+/*
+ *  Jump-ahead for 64-bit LCG.
+ *
+ *  Same as lcg_jump.h but modulo 2^64, which is the natural wraparound of
+ *  64-bit unsigned integers. Scalar functions are shared by LCG64 and VLCG64
+ *  (applied per lane).
+ */
+
+
+/*!
+ *  \brief Compute jump coefficients for n steps, A = a^n, C = p * (a^(n-1) + ... + 1).
+ */
+inline static void lcg64_jump(unsigned long int * const A, unsigned long int * const C, const unsigned long int mult, const unsigned long int prime, long int n)
+{
+    unsigned long int acur = mult;
+    unsigned long int ccur = prime;
+
+    *A = 0x1UL;
+    *C = 0x0UL;
+    while (n > 0) {
+        if (n & 0x1L) {
+            *A = *A * acur;
+            *C = *C * acur + ccur;
+        }
+        ccur = ccur * acur + ccur;
+        acur = acur * acur;
+        n >>= 1;
+    }
+}
+
+
+/*!
+ *  \brief Apply jump coefficients, x = A * x + C (mod 2^64).
+ */
+inline static unsigned long int lcg64_jump_apply(const unsigned long int x, const unsigned long int A, const unsigned long int C)
+{ return A * x + C; }
+
+
+#endif  // __LCG64_JUMP_H
+
@@ -0,0 +1,237 @@
+/*************************************************************************/
+/*************************************************************************/
+/*        Parallel SIMD 64-bit Linear Congruential Generator             */
+/*                                                                       */
+/* Based on the implementation by:                                       */
+/*             J. Ren, W. J. Thrasher                                    */
+/*             Ashok Srinivasan (May 1998)                               */
+/*                                                                       */
+/* Note: The modulus is 2^64                                             */
+/*************************************************************************/
+/*************************************************************************/
+
+
+#include "simd.h"
+#if defined(SIMD_MODE)
+
+
+#include <stdio.h>   // printf
+#include <stdlib.h>  // posix_memalign, free
+#include <new>       // placement new, std::bad_alloc
+#include "vlcg64.h"
+#include "lcg64_globals.h"
+
+
+GEN_REGISTRY VLCG64::LCG64_NGENS;
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ *
+ *  Engine is allocated aligned to SIMD_WIDTH_BYTES since it holds SIMD registers by value.
+ *  Throws std::bad_alloc if allocation fails, as new does.
+ */
+VLCG64::VLCG64()
+{
+    gentype = GLOBALS64.GENTYPE;
+    rng_type = VSPRNG_LCG64;
+
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, SIMD_WIDTH_BYTES, sizeof(VLCG64_ENGINE))) {
+        printf("ERROR: failed to allocate aligned memory for VLCG64 engine\n");
+        throw std::bad_alloc();
+    }
+    engine = new (ptr) VLCG64_ENGINE();
+
+    LCG64_NGENS.add(1);
+}
+
+
+/*!
+ *  \brief Destructor
+ */
+VLCG64::~VLCG64()
+{
+    engine->~VLCG64_ENGINE();
+    free(engine);
+
+    LCG64_NGENS.add(-1);
+}
+
+
+int VLCG64::init_rng(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{ return engine->init_rng(gn, tg, gs, gm, ns); }
+
+
+/*!
+ *  \brief Initialize RNG with generator numbers [gn, gn + ns), one per stream
+ *
+ *  See VLCG64_ENGINE::init_rng_lanes().
+ */
+int VLCG64::init_rng_lanes(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{ return engine->init_rng_lanes(gn, tg, gs, gm, ns); }
+
+
+/*!
+ *  \brief Reseed streams in place, without heap allocation
+ *
+ *  See VLCG64_ENGINE::reseed_rng().
+ */
+int VLCG64::reseed_rng(const int * const gs)
+{ return engine->reseed_rng(gs); }
+
+
+/*!
+ *  \brief Spawn new generators
+ *
+ *  Array of generators is allocated with new[], each generator has to be
+ *  deleted and then the array. See VLCG64_ENGINE::spawn_rng().
+ *  Returns number of generators spawned or -1 on error.
+ */
+int VLCG64::spawn_rng(const int nspawned, VSPRNG *** const newgens)
+{
+    if (!newgens || nspawned <= 0) {
+        printf("ERROR: invalid array of generators, %d\n", nspawned);
+        return -1;
+    }
+
+    VSPRNG **gens = new VSPRNG*[nspawned];
+    VLCG64_ENGINE **engs = new VLCG64_ENGINE*[nspawned];
+    for (int i = 0; i < nspawned; ++i) {
+        VLCG64 * const gen = new VLCG64();
+        gens[i] = gen;
+        engs[i] = gen->engine;
+    }
+
+    const int nspawn = engine->spawn_rng(nspawned, engs);
+    delete [] engs;
+
+    if (nspawn < 0) {
+        for (int i = 0; i < nspawned; ++i)
+            delete gens[i];
+        delete [] gens;
+        *newgens = NULL;
+        return -1;
+    }
+
+    *newgens = gens;
+
+    return nspawn;
+}
+
+
+int VLCG64::advance(const long int n)
+{ return engine->advance(n); }
+
+
+int VLCG64::advance(const long int * const n)
+{ return engine->advance(n); }
+
+
+int VLCG64::pack_size() const
+{ return engine->pack_size(); }
+
+
+/*!
+ *  \brief Pack state of active streams into caller buffer, see VLCG64_ENGINE::pack_rng().
+ */
+int VLCG64::pack_rng(void * const buffer, const int size) const
+{ return engine->pack_rng(buffer, size); }
+
+
+/*!
+ *  \brief Restore state in place, see VLCG64_ENGINE::unpack_rng().
+ */
+int VLCG64::unpack_rng(const void * const buffer, const int size)
+{ return engine->unpack_rng(buffer, size); }
+
+
+SIMD_INT VLCG64::get_rn_int() const
+{ return engine->get_rn_int(); }
+
+
+SIMD_DBL VLCG64::get_rn_dbl() const
+{ return engine->get_rn_dbl(); }
+
+
+void VLCG64::get_rn_dbl2(SIMD_DBL * const rn) const
+{ engine->get_rn_dbl2(rn); }
+
+
+SIMD_FLT VLCG64::get_rn_flt() const
+{ return engine->get_rn_flt(); }
+
+
+int VLCG64::get_rn_int_array(int * const rn, const int nrn) const
+{ return engine->get_rn_int_array(rn, nrn); }
+
+
+int VLCG64::get_rn_dbl_array(double * const rn, const int nrn) const
+{ return engine->get_rn_dbl_array(rn, nrn); }
+
+
+int VLCG64::get_rn_dbl2_array(double * const rn, const int nrn) const
+{ return engine->get_rn_dbl2_array(rn, nrn); }
+
+
+int VLCG64::get_rn_flt_array(float * const rn, const int nrn) const
+{ return engine->get_rn_flt_array(rn, nrn); }
+
+
+int VLCG64::get_rn_int_streams(int * const rn, const int nrn, const int stride) const
+{ return engine->get_rn_int_streams(rn, nrn, stride); }
+
+
+int VLCG64::get_rn_flt_streams(float * const rn, const int nrn, const int stride) const
+{ return engine->get_rn_flt_streams(rn, nrn, stride); }
+
+
+int VLCG64::get_rn_dbl_streams(double * const rn, const int nrn, const int stride) const
+{ return engine->get_rn_dbl_streams(rn, nrn, stride); }
+
+
+int VLCG64::get_stream_stride(const int nrn) const
+{ return engine->get_stream_stride(nrn); }
+
+
+SIMD_INT VLCG64::get_seed_rng() const
+{ return engine->get_seed_rng(); }
+
+
+int VLCG64::get_ngens() const
+{ return LCG64_NGENS.count(); }
+
+
+#if defined(DEBUG)
+SIMD_INT VLCG64::get_seed() const
+{ return engine->get_seed(); }
+
+SIMD_INT VLCG64::get_multiplier() const
+{ return engine->get_multiplier(); }
+
+SIMD_INT VLCG64::get_prime() const
+{ return engine->get_prime(); }
+
+# if defined(LONG_SPRNG)
+SIMD_INT VLCG64::get_seed2() const
+{ return engine->get_seed2(); }
+
+SIMD_INT VLCG64::get_multiplier2() const
+{ return engine->get_multiplier2(); }
+# endif
+#endif
+
+
+#endif // SIMD_MODE
+
+
+/***********************************************************************************
+* SPRNG (c) 2016 by The University of Tennessee, Knoxville                         *
+*                                                                                  *
+* SPRNG is licensed under a                                                        *
+* Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License. *
+*                                                                                  *
+* You should have received a copy of the license along with this                   *
+* work. If not, see <http://creativecommons.org/licenses/by-nc-sa/4.0/>.           *
+************************************************************************************/
+
@@ -0,0 +1,982 @@
+#ifndef __VLCG64_ENGINE_H
+#define __VLCG64_ENGINE_H
+
+
+#include "simd.h"
+#if defined SIMD_MODE
+
+
+#include <stdio.h>   // printf
+#include <string.h>  // memset, memcpy
+#include <limits.h>  // INT_MAX
+#include "lcg64_globals.h"
+#include "lcg64_jump.h"
+#include "lcg_pack.h"
+#include "vlcg64_kernels.h"
+#include "primes_64.h"
+
+
+/*! \class VLCG64_ENGINE
+ *  \brief Header-only SIMD 64-bit linear congruential RNG.
+ *
+ *  SIMD version of LCG64, x = a * x + p (mod 2^64) with full 64-bit
+ *  wraparound multiplies per lane. Streams use 64-bit elements in 2 registers
+ *  (SIMD_STREAMS_32 streams), with or without LONG_SPRNG. Stream i of a
+ *  generator initialized with init_rng_lanes() is identical to a scalar LCG64.
+ *  The VLCG64 class is a thin adapter for the virtual VSPRNG interface.
+ *
+ *  NOTE: objects have to be aligned to SIMD_WIDTH_BYTES (stack or simd_malloc'ed).
+ */
+class VLCG64_ENGINE
+{
+  public:
+    VLCG64_ENGINE();
+    int init_rng(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int init_rng_lanes(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int reseed_rng(const int * const);
+    int spawn_rng(const int, VLCG64_ENGINE * const * const);
+    SIMD_INT get_rn_int();
+    SIMD_FLT get_rn_flt();
+    SIMD_DBL get_rn_dbl();
+    void get_rn_dbl2(SIMD_DBL * const);
+    int get_rn_int_array(int * const, const int);
+    int get_rn_flt_array(float * const, const int);
+    int get_rn_dbl_array(double * const, const int);
+    int get_rn_dbl2_array(double * const, const int);
+    int get_rn_int_streams(int * const, const int, const int);
+    int get_rn_flt_streams(float * const, const int, const int);
+    int get_rn_dbl_streams(double * const, const int, const int);
+    int get_stream_stride(const int) const;
+    SIMD_INT get_seed_rng() const;
+    int advance(const long int);
+    int advance(const long int * const);
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    SIMD_INT get_prime() const;
+    SIMD_INT get_seed() const;
+    SIMD_INT get_multiplier() const;
+# if defined(LONG_SPRNG)
+    SIMD_INT get_seed2() const;
+    SIMD_INT get_multiplier2() const;
+# endif
+#endif
+
+  private:
+    SIMD_INT seed[VLCG64_REGS];
+    SIMD_INT multiplier[VLCG64_REGS];
+    SIMD_INT prime[VLCG64_REGS];
+    SIMD_INT init_seed[VLCG64_REGS];
+    SIMD_INT parameter[VLCG64_REGS];
+    SIMD_MSK strm_mask32;
+    SIMD_MSK strm_mask64[2];
+    int32_t prime_position;
+    int32_t prime_next;
+    int32_t masked;
+    int32_t nstreams;
+    int32_t per_lane;
+
+    int check_streams_args(const void * const, const int, const int) const;
+    int init_streams(const int * const, const int * const, const int, const unsigned int * const);
+    void set_streams(const int * const, const int * const, const int, const unsigned int * const);
+    void get_params(int * const, int * const, unsigned int * const) const;
+    static int check_params(int * const, int * const, const int * const, const int * const, const int);
+};
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+inline VLCG64_ENGINE::VLCG64_ENGINE()
+{
+    prime_position = 0;
+    prime_next = 0;
+    masked = 0;
+    nstreams = SIMD_STREAMS_32;
+    per_lane = 0;
+    strm_mask32 = simd_set_mask_32(SIMD_STREAMS_32);
+    strm_mask64[0] = simd_set_mask_64(SIMD_STREAMS_64);
+    strm_mask64[1] = simd_set_mask_64(SIMD_STREAMS_64);
+
+    for (int j = 0; j < VLCG64_REGS; ++j) {
+        simd_set_zero(&seed[j]);
+        simd_set_zero(&multiplier[j]);
+        simd_set_zero(&prime[j]);
+        simd_set_zero(&init_seed[j]);
+        simd_set_zero(&parameter[j]);
+    }
+}
+
+
+/*!
+ *  \brief Initialize RNG
+ *
+ *  As VLCG_ENGINE::init_rng(), all streams use generator number gn
+ *  (same prime and warm-up) and differ by their seeds and multipliers.
+ *
+ *  NOTE: double streams are the first half of the streams.
+ */
+inline int VLCG64_ENGINE::init_rng(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{
+    // Check total generators
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+
+    // Check generator number
+    if (gn < 0 || gn >= tg) {
+        printf("ERROR: generator number is out of range, %d\n", gn);
+        gn = tg - 1;
+    }
+    if (gn >= GLOBALS64.LCG64_MAX_STREAMS)
+        printf("WARNING: generator number (%d) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", gn, GLOBALS64.LCG64_MAX_STREAMS);
+
+    // Check seeds, multipliers, and number of streams
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    const int nstrms = check_params(s, m, gs, gm, ns);
+
+    // Generate prime number
+    unsigned int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    getprime_64(1, lprime, gn);
+    for (int strm = 1; strm < SIMD_STREAMS_32; ++strm)
+        lprime[strm] = lprime[0];
+
+    prime_next = tg;
+    prime_position = gn;
+    per_lane = 0;
+
+    return init_streams(s, m, nstrms, lprime);
+}
+
+
+/*!
+ *  \brief Initialize RNG with one generator number per stream
+ *
+ *  Stream i is SPRNG generator gn + i, its output is identical to a scalar
+ *  LCG64 initialized with init_rng(gn + i, tg, gs[i], gm[i]).
+ *
+ *  NOTE: double streams are the first half of the generators.
+ *  Returns 0 on success or -1 on error.
+ */
+inline int VLCG64_ENGINE::init_rng_lanes(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{
+    // Check total generators
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+
+    // Check seeds, multipliers, and number of streams
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    const int nstrms = check_params(s, m, gs, gm, ns);
+
+    // Check generator numbers
+    if (gn < 0 || gn > tg - nstrms) {
+        printf("ERROR: generator numbers are out of range, [%d, %d)\n", gn, gn + nstrms);
+        return -1;
+    }
+    if (gn + nstrms - 1 >= GLOBALS64.LCG64_MAX_STREAMS)
+        printf("WARNING: generator number (%d) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", gn + nstrms - 1, GLOBALS64.LCG64_MAX_STREAMS);
+
+    // Generate prime numbers, inactive streams reuse prime of first generator
+    unsigned int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    if (getprime_64(nstrms, lprime, gn) < nstrms)
+        return -1;
+    for (int strm = nstrms; strm < SIMD_STREAMS_32; ++strm)
+        lprime[strm] = lprime[0];
+
+    prime_next = tg;
+    prime_position = gn;
+    per_lane = 1;
+
+    return init_streams(s, m, nstrms, lprime);
+}
+
+
+/*!
+ *  \brief Reseed streams in place
+ *
+ *  Generator numbers, primes, multipliers, and number of streams are kept,
+ *  resulting state is the same as init_rng() (or init_rng_lanes()) with
+ *  seeds gs, see VLCG_ENGINE::reseed_rng().
+ *  Returns 0 on success or -1 on error.
+ */
+inline int VLCG64_ENGINE::reseed_rng(const int * const gs)
+{
+    if (!gs) {
+        printf("ERROR: no array for seeds provided.\n");
+        return -1;
+    }
+
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    get_params(s, m, lprime);
+    memset(s, 0, sizeof(s));
+    memcpy(s, gs, nstreams * sizeof(int));
+
+    return init_streams(s, m, nstreams, lprime);
+}
+
+
+/*!
+ *  \brief Seeds and multipliers of streams, inactive streams are zero.
+ *
+ *  Returns number of streams.
+ */
+inline int VLCG64_ENGINE::check_params(int * const s, int * const m, const int * const gs, const int * const gm, const int ns)
+{
+    // Check number of streams requested
+    int nstrms = ns;
+    if (nstrms <= 0 || nstrms > SIMD_STREAMS_32) {
+        printf("ERROR: number of streams is out of range, %d, default is to use all available streams.\n", nstrms);
+        nstrms = SIMD_STREAMS_32;
+    }
+
+    // Check multipliers
+    memset(m, 0, SIMD_STREAMS_32 * sizeof(int));
+    if (!gm)
+        printf("WARNING: no array for multipliers provided, default is zero.\n");
+    else {
+        for (int strm = 0; strm < nstrms; ++strm)
+            if (gm[strm] < 0 || gm[strm] >= GLOBALS64.NPARAMS)
+                printf("ERROR: multiplier out of range, %d\n", gm[strm]);
+            else
+                m[strm] = gm[strm];
+    }
+
+    // Check seeds
+    memset(s, 0, SIMD_STREAMS_32 * sizeof(int));
+    if (!gs)
+        printf("WARNING: no array for seeds provided, default is zero.\n");
+    else {
+        for (int strm = 0; strm < nstrms; ++strm)
+            s[strm] = gs[strm];
+    }
+
+    return nstrms;
+}
+
+
+/*!
+ *  \brief Seeds, multipliers, and primes of streams from registers.
+ */
+inline void VLCG64_ENGINE::get_params(int * const s, int * const m, unsigned int * const lprime) const
+{
+    simd_store(s, simd_packmerge_i32(init_seed[0], init_seed[1]));
+    simd_store(m, simd_packmerge_i32(parameter[0], parameter[1]));
+    simd_store(lprime, simd_packmerge_i32(prime[0], prime[1]));
+}
+
+
+/*!
+ *  \brief Initial state of streams followed by warm-up.
+ *
+ *  Generator numbers are prime_position (plus stream index if per_lane).
+ *  Returns 0 on success or -1 on error.
+ */
+inline int VLCG64_ENGINE::init_streams(const int * const s, const int * const m, const int nstrms, const unsigned int * const lprime)
+{
+    set_streams(s, m, nstrms, lprime);
+
+    // Run generators several times based on their generator numbers
+    long int nsteps[SIMD_STREAMS_32];
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        const long int gn = (per_lane && strm < nstrms) ? prime_position + strm : prime_position;
+        nsteps[strm] = GLOBALS64.LCG64_RUNUP * gn;
+    }
+
+    return advance(nsteps);
+}
+
+
+/*!
+ *  \brief Initial state of streams from seeds, multipliers, and primes (no warm-up).
+ *
+ *  Seed of a stream is INIT_SEED ^ (seed << 33 | generator number), as LCG64.
+ *  One prime per stream, lprime has SIMD_STREAMS_32 entries.
+ */
+inline void VLCG64_ENGINE::set_streams(const int * const s, const int * const m, const int nstrms, const unsigned int * const lprime)
+{
+    // Select masked numbers, only if not using maximum number of streams
+    masked = (nstrms < SIMD_STREAMS_32);
+    nstreams = nstrms;
+    strm_mask32 = simd_set_mask_32(nstrms);
+    strm_mask64[0] = simd_set_mask_64(nstrms);
+    strm_mask64[1] = simd_set_mask_64(nstrms - SIMD_STREAMS_64);
+
+    unsigned long int lseed[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    unsigned long int lmultiplier[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        const int j = strm / SIMD_STREAMS_64;
+        const int i = strm % SIMD_STREAMS_64;
+        const unsigned long int gn = (per_lane && strm < nstrms) ? prime_position + strm : prime_position;
+        lseed[j][i] = GLOBALS64.INIT_SEED ^ (((unsigned long int)(s[strm] & 0x7FFFFFFF) << 33) | gn);
+        lmultiplier[j][i] = GLOBALS64.MULT[m[strm]];
+    }
+
+    const SIMD_INT vmsk_lsb31 = simd_set(0x7FFFFFFFUL);
+    for (int j = 0; j < VLCG64_REGS; ++j) {
+        seed[j] = simd_load(lseed[j]);
+        multiplier[j] = simd_load(lmultiplier[j]);
+        prime[j] = simd_set(&lprime[j * SIMD_STREAMS_64], SIMD_STREAMS_64);
+        parameter[j] = simd_set(&m[j * SIMD_STREAMS_64], SIMD_STREAMS_64);
+        init_seed[j] = simd_and(simd_set(&s[j * SIMD_STREAMS_64], SIMD_STREAMS_64), vmsk_lsb31);
+    }
+}
+
+
+/*!
+ *  \brief Spawn new generators
+ *
+ *  Child i is generator number prime_position + prime_next * (i + 1) with
+ *  the seeds and multipliers of this generator, as in SPRNG spawn_rng().
+ *  If streams have one generator number each (init_rng_lanes()), the
+ *  children do as well.
+ *  Returns number of generators spawned or -1 on error.
+ */
+inline int VLCG64_ENGINE::spawn_rng(const int nspawned, VLCG64_ENGINE * const * const newgens)
+{
+    if (!newgens || nspawned <= 0) {
+        printf("ERROR: invalid array of generators, %d\n", nspawned);
+        return -1;
+    }
+
+    // Check generator numbers of children
+    const long int next = (long int)prime_next * (nspawned + 1);
+    const long int last = prime_position + (long int)prime_next * nspawned + ((per_lane) ? nstreams - 1 : 0);
+    if (next > INT_MAX || last > INT_MAX) {
+        printf("ERROR: generator numbers of spawned generators are out of range, %ld\n", last);
+        return -1;
+    }
+    if (last >= GLOBALS64.LCG64_MAX_STREAMS)
+        printf("WARNING: generator number (%ld) is greater than maximum number of independent streams (%d), independence of streams cannot be guaranteed.\n", last, GLOBALS64.LCG64_MAX_STREAMS);
+
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    get_params(s, m, lprime);
+
+    for (int i = 0; i < nspawned; ++i) {
+        VLCG64_ENGINE * const eng = newgens[i];
+        const int gn = prime_position + prime_next * (i + 1);
+
+        // Primes of child, inactive streams reuse prime of first stream
+        if (getprime_64((per_lane) ? nstreams : 1, lprime, gn) < ((per_lane) ? nstreams : 1))
+            return -1;
+        for (int strm = (per_lane) ? nstreams : 1; strm < SIMD_STREAMS_32; ++strm)
+            lprime[strm] = lprime[0];
+
+        eng->prime_next = (int)next;
+        eng->prime_position = gn;
+        eng->per_lane = per_lane;
+        if (eng->init_streams(s, m, nstreams, lprime))
+            return -1;
+    }
+
+    prime_next = (int)next;
+
+    return nspawned;
+}
+
+
+/*!
+ *  \brief Advance all streams n steps in O(log n) operations.
+ *
+ *  Equivalent to calling get_rn_dbl() n times.
+ */
+inline int VLCG64_ENGINE::advance(const long int n)
+{
+    long int nsteps[SIMD_STREAMS_32];
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm)
+        nsteps[strm] = n;
+
+    return advance(nsteps);
+}
+
+
+/*!
+ *  \brief Advance each stream a different number of steps.
+ *
+ *  Jump coefficients are computed per lane and applied to the seeds in scalar form.
+ */
+inline int VLCG64_ENGINE::advance(const long int * const n)
+{
+    if (!n) {
+        printf("ERROR: no array for number of steps to advance provided.\n");
+        return -1;
+    }
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        if (n[strm] < 0) {
+            printf("ERROR: number of steps to advance is out of range, %ld\n", n[strm]);
+            return -1;
+        }
+    }
+
+    unsigned long int lseed[SIMD_STREAMS_64] __SIMD_ALIGN__;
+    unsigned long int lmultiplier[SIMD_STREAMS_64] __SIMD_ALIGN__;
+    unsigned long int lprime[SIMD_STREAMS_64] __SIMD_ALIGN__;
+    for (int j = 0; j < VLCG64_REGS; ++j) {
+        simd_store(lseed, seed[j]);
+        simd_store(lmultiplier, multiplier[j]);
+        simd_store(lprime, prime[j]);
+        for (int i = 0; i < SIMD_STREAMS_64; ++i) {
+            unsigned long int A, C;
+            lcg64_jump(&A, &C, lmultiplier[i], lprime[i], n[i + j * SIMD_STREAMS_64]);
+            lseed[i] = lcg64_jump_apply(lseed[i], A, C);
+        }
+        seed[j] = simd_load(lseed);
+    }
+
+    return 0;
+}
+
+
+/*
+ *  Masking is fixed at init, the test on masked is loop invariant
+ *  and perfectly predicted.
+ */
+inline SIMD_INT VLCG64_ENGINE::get_rn_int()
+{
+    const SIMD_INT rn = vlcg64_next_int(seed, multiplier, prime);
+    return (masked) ? simd_maskz_32(rn, strm_mask32) : rn;
+}
+
+
+inline SIMD_FLT VLCG64_ENGINE::get_rn_flt()
+{
+    const SIMD_FLT rn = vlcg64_next_flt(seed, multiplier, prime);
+    return (masked) ? simd_maskz(rn, strm_mask32) : rn;
+}
+
+
+inline SIMD_DBL VLCG64_ENGINE::get_rn_dbl()
+{
+    const SIMD_DBL rn = vlcg64_next_dbl(seed, multiplier, prime);
+    return (masked) ? simd_maskz(rn, strm_mask64[0]) : rn;
+}
+
+
+/*!
+ *  \brief Double-precision random numbers of all streams.
+ *
+ *  rn[0] holds streams [0, SIMD_STREAMS_64), rn[1] holds streams
+ *  [SIMD_STREAMS_64, SIMD_STREAMS_32).
+ */
+inline void VLCG64_ENGINE::get_rn_dbl2(SIMD_DBL * const rn)
+{
+    vlcg64_next_dbl2(rn, seed, multiplier, prime);
+    if (masked) {
+        rn[0] = simd_maskz(rn[0], strm_mask64[0]);
+        rn[1] = simd_maskz(rn[1], strm_mask64[1]);
+    }
+}
+
+
+/*!
+ *  \brief Fill an array with integer random numbers.
+ *
+ *  Same layout as VLCG_ENGINE::get_rn_int_array(), the array must be aligned
+ *  to SIMD_WIDTH_BYTES. State is kept in registers for the whole loop.
+ *  Returns the number of elements written or -1 on error.
+ */
+inline int VLCG64_ENGINE::get_rn_int_array(int * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    SIMD_INT vseed[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG64_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const SIMD_MSK vmsk = strm_mask32;
+    const int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    int *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        const SIMD_INT vrn = vlcg64_next_int(vseed, vmult, vprime);
+        simd_store(rn_ptr, (masked) ? simd_maskz_32(vrn, vmsk) : vrn);
+        rn_ptr += SIMD_STREAMS_32;
+    }
+
+    if (nrem > 0) {
+        int rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        const SIMD_INT vrn = vlcg64_next_int(vseed, vmult, vprime);
+        simd_store(rn_tail, (masked) ? simd_maskz_32(vrn, vmsk) : vrn);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(int));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with single-precision random numbers.
+ *
+ *  Same as get_rn_int_array() but for float elements.
+ */
+inline int VLCG64_ENGINE::get_rn_flt_array(float * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    SIMD_INT vseed[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG64_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const SIMD_MSK vmsk = strm_mask32;
+    const int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    float *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        const SIMD_FLT vrn = vlcg64_next_flt(vseed, vmult, vprime);
+        simd_store(rn_ptr, (masked) ? simd_maskz(vrn, vmsk) : vrn);
+        rn_ptr += SIMD_STREAMS_32;
+    }
+
+    if (nrem > 0) {
+        float rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        const SIMD_FLT vrn = vlcg64_next_flt(vseed, vmult, vprime);
+        simd_store(rn_tail, (masked) ? simd_maskz(vrn, vmsk) : vrn);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(float));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers.
+ *
+ *  Same as get_rn_int_array() but with SIMD_STREAMS_64 elements per register.
+ */
+inline int VLCG64_ENGINE::get_rn_dbl_array(double * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    SIMD_INT vseed[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG64_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const SIMD_MSK vmsk = strm_mask64[0];
+    const int nvec = nrn / SIMD_STREAMS_64;
+    const int nrem = nrn % SIMD_STREAMS_64;
+
+    double *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        const SIMD_DBL vrn = vlcg64_next_dbl(vseed, vmult, vprime);
+        simd_store(rn_ptr, (masked) ? simd_maskz(vrn, vmsk) : vrn);
+        rn_ptr += SIMD_STREAMS_64;
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        const SIMD_DBL vrn = vlcg64_next_dbl(vseed, vmult, vprime);
+        simd_store(rn_tail, (masked) ? simd_maskz(vrn, vmsk) : vrn);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(double));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers of all streams.
+ *
+ *  Each step of the streams stores SIMD_STREAMS_32 elements (contents of get_rn_dbl2()).
+ */
+inline int VLCG64_ENGINE::get_rn_dbl2_array(double * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    SIMD_INT vseed[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG64_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const SIMD_MSK vmsk[2] = { strm_mask64[0], strm_mask64[1] };
+    const int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    SIMD_DBL vrn[2] __SIMD_ALIGN__;
+    double *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        vlcg64_next_dbl2(vrn, vseed, vmult, vprime);
+        simd_store(rn_ptr, (masked) ? simd_maskz(vrn[0], vmsk[0]) : vrn[0]);
+        simd_store(rn_ptr + SIMD_STREAMS_64, (masked) ? simd_maskz(vrn[1], vmsk[1]) : vrn[1]);
+        rn_ptr += SIMD_STREAMS_32;
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        vlcg64_next_dbl2(vrn, vseed, vmult, vprime);
+        simd_store(rn_tail, (masked) ? simd_maskz(vrn[0], vmsk[0]) : vrn[0]);
+        simd_store(rn_tail + SIMD_STREAMS_64, (masked) ? simd_maskz(vrn[1], vmsk[1]) : vrn[1]);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(double));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Smallest valid stride for stream-major arrays of nrn numbers per stream.
+ *
+ *  See VLCG_ENGINE::get_stream_stride().
+ */
+inline int VLCG64_ENGINE::get_stream_stride(const int nrn) const
+{
+    if (nrn <= 0)
+        return SIMD_STREAMS_32;
+    return ((nrn + SIMD_STREAMS_32 - 1) / SIMD_STREAMS_32) * SIMD_STREAMS_32;
+}
+
+
+inline int VLCG64_ENGINE::check_streams_args(const void * const rn, const int nrn, const int stride) const
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+    if (stride < nrn || stride % SIMD_STREAMS_32 != 0) {
+        printf("ERROR: stride of streams is out of range, %d (see get_stream_stride())\n", stride);
+        return -1;
+    }
+    return 0;
+}
+
+
+/*!
+ *  \brief Fill an array with integer random numbers, stream-major layout.
+ *
+ *  Same layout as VLCG_ENGINE::get_rn_int_streams(), the nrn numbers of
+ *  stream i start at rn[i * stride], only active streams are written.
+ *  Returns the number of elements written per stream or -1 on error.
+ */
+inline int VLCG64_ENGINE::get_rn_int_streams(int * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    SIMD_INT vseed[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG64_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const int nblk = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    SIMD_INT vrn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_32; k += SIMD_STREAMS_32) {
+        for (int j = 0; j < SIMD_STREAMS_32; ++j)
+            vrn[j] = vlcg64_next_int(vseed, vmult, vprime);
+        simd_transpose_i32(vrn);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm]);
+    }
+
+    if (nrem > 0) {
+        int rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j)
+            vrn[j] = vlcg64_next_int(vseed, vmult, vprime);
+        for (int j = nrem; j < SIMD_STREAMS_32; ++j)
+            simd_set_zero(&vrn[j]);
+        simd_transpose_i32(vrn);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_32, rn_tail, nrem * sizeof(int));
+        }
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with single-precision random numbers, stream-major layout.
+ *
+ *  Same as get_rn_int_streams() but for float elements.
+ */
+inline int VLCG64_ENGINE::get_rn_flt_streams(float * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    SIMD_INT vseed[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG64_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const int nblk = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    SIMD_FLT vrn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_32; k += SIMD_STREAMS_32) {
+        for (int j = 0; j < SIMD_STREAMS_32; ++j)
+            vrn[j] = vlcg64_next_flt(vseed, vmult, vprime);
+        simd_transpose(vrn);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm]);
+    }
+
+    if (nrem > 0) {
+        float rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j)
+            vrn[j] = vlcg64_next_flt(vseed, vmult, vprime);
+        for (int j = nrem; j < SIMD_STREAMS_32; ++j)
+            simd_set_zero(&vrn[j]);
+        simd_transpose(vrn);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_32, rn_tail, nrem * sizeof(float));
+        }
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers, stream-major layout.
+ *
+ *  Same as get_rn_int_streams() but for double elements, all streams are
+ *  generated (values of get_rn_dbl2_array()). Blocks are SIMD_STREAMS_64
+ *  steps, each half of the streams is transposed separately.
+ */
+inline int VLCG64_ENGINE::get_rn_dbl_streams(double * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    SIMD_INT vseed[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VLCG64_REGS] __SIMD_ALIGN__;
+    SIMD_INT vprime[VLCG64_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    memcpy(vprime, prime, sizeof(vprime));
+    const int nblk = nrn / SIMD_STREAMS_64;
+    const int nrem = nrn % SIMD_STREAMS_64;
+
+    // vrn[0] holds streams [0, SIMD_STREAMS_64), vrn[1] the remaining streams
+    SIMD_DBL vrn[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    SIMD_DBL vpair[2] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_64; k += SIMD_STREAMS_64) {
+        for (int j = 0; j < SIMD_STREAMS_64; ++j) {
+            vlcg64_next_dbl2(vpair, vseed, vmult, vprime);
+            vrn[0][j] = vpair[0];
+            vrn[1][j] = vpair[1];
+        }
+        simd_transpose(vrn[0]);
+        simd_transpose(vrn[1]);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm / SIMD_STREAMS_64][strm % SIMD_STREAMS_64]);
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j) {
+            vlcg64_next_dbl2(vpair, vseed, vmult, vprime);
+            vrn[0][j] = vpair[0];
+            vrn[1][j] = vpair[1];
+        }
+        for (int j = nrem; j < SIMD_STREAMS_64; ++j) {
+            simd_set_zero(&vrn[0][j]);
+            simd_set_zero(&vrn[1][j]);
+        }
+        simd_transpose(vrn[0]);
+        simd_transpose(vrn[1]);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm / SIMD_STREAMS_64][strm % SIMD_STREAMS_64]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_64, rn_tail, nrem * sizeof(double));
+        }
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Size in bytes of packed state of active streams.
+ */
+inline int VLCG64_ENGINE::pack_size() const
+{ return lcg_pack_size(nstreams); }
+
+
+/*!
+ *  \brief Pack state of active streams into caller buffer (see lcg_pack.h).
+ *
+ *  The packed state of stream i is the same as an LCG64 with the
+ *  parameters of stream i.
+ *  Returns number of bytes written or -1 on error.
+ */
+inline int VLCG64_ENGINE::pack_rng(void * const buffer, const int size) const
+{
+    const int nbytes = lcg_pack_check(buffer, size, nstreams);
+    if (nbytes < 0)
+        return -1;
+
+    const LCG_PACK_VIEW pack = lcg_pack_view(buffer, nstreams);
+    lcg_pack_header(pack.header, nstreams, per_lane, prime_position, prime_next, SPRNG_LCG64);
+
+    unsigned long int lseed[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int ls[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int lm[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    simd_store(&lseed[0], seed[0]);
+    simd_store(&lseed[SIMD_STREAMS_64], seed[1]);
+    get_params(ls, lm, lprime);
+
+    for (int strm = 0; strm < nstreams; ++strm)
+        pack.seed[strm] = lseed[strm];
+    memcpy(pack.init_seed, ls, nstreams * sizeof(int32_t));
+    memcpy(pack.prime, lprime, nstreams * sizeof(int32_t));
+    memcpy(pack.parameter, lm, nstreams * sizeof(int32_t));
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Restore state in place from packed state (see lcg_pack.h).
+ *
+ *  Packed streams become the active streams, at most SIMD_STREAMS_32.
+ *  Returns number of bytes read or -1 on error, state is not modified on error.
+ */
+inline int VLCG64_ENGINE::unpack_rng(const void * const buffer, const int size)
+{
+    const int nstrms = lcg_unpack_check(buffer, size, SIMD_STREAMS_32, SPRNG_LCG64);
+    if (nstrms < 0)
+        return -1;
+
+    const LCG_PACK_VIEW pack = lcg_pack_view(buffer, nstrms);
+    for (int strm = 0; strm < nstrms; ++strm) {
+        if (pack.parameter[strm] < 0 || pack.parameter[strm] >= GLOBALS64.NPARAMS) {
+            printf("ERROR: Unpacked parameters not acceptable.\n");
+            return -1;
+        }
+    }
+
+    // Parameters of inactive streams are zero, as in init_rng()
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned int lprime[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    memset(m, 0, sizeof(m));
+    memset(s, 0, sizeof(s));
+    memcpy(m, pack.parameter, nstrms * sizeof(int));
+    memcpy(s, pack.init_seed, nstrms * sizeof(int));
+    memcpy(lprime, pack.prime, nstrms * sizeof(int));
+    for (int strm = nstrms; strm < SIMD_STREAMS_32; ++strm)
+        lprime[strm] = lprime[0];
+
+    prime_position = pack.header->prime_position;
+    prime_next = pack.header->prime_next;
+    per_lane = pack.header->per_lane;
+    set_streams(s, m, nstrms, lprime);
+
+    // Current seeds of active streams
+    unsigned long int lseed[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    simd_store(&lseed[0], seed[0]);
+    simd_store(&lseed[SIMD_STREAMS_64], seed[1]);
+    for (int strm = 0; strm < nstrms; ++strm)
+        lseed[strm] = pack.seed[strm];
+    seed[0] = simd_load(&lseed[0]);
+    seed[1] = simd_load(&lseed[SIMD_STREAMS_64]);
+
+    return lcg_pack_size(nstrms);
+}
+
+
+inline SIMD_INT VLCG64_ENGINE::get_seed_rng() const
+{
+    const SIMD_INT va = simd_packmerge_i32(init_seed[0], init_seed[1]);
+    if (masked)
+        return simd_maskz_32(va, strm_mask32);
+    return va;
+}
+
+
+#if defined(DEBUG)
+inline SIMD_INT VLCG64_ENGINE::get_prime() const
+{
+    const SIMD_INT va = simd_packmerge_i32(prime[0], prime[1]);
+    if (masked)
+        return simd_maskz_32(va, strm_mask32);
+    return va;
+}
+
+inline SIMD_INT VLCG64_ENGINE::get_seed() const
+{
+    if (masked)
+        return simd_maskz_64(seed[0], strm_mask64[0]);
+    return seed[0];
+}
+
+inline SIMD_INT VLCG64_ENGINE::get_multiplier() const
+{
+    if (masked)
+        return simd_maskz_64(multiplier[0], strm_mask64[0]);
+    return multiplier[0];
+}
+
+# if defined(LONG_SPRNG)
+inline SIMD_INT VLCG64_ENGINE::get_seed2() const
+{
+    if (masked)
+        return simd_maskz_64(seed[1], strm_mask64[1]);
+    return seed[1];
+}
+
+inline SIMD_INT VLCG64_ENGINE::get_multiplier2() const
+{
+    if (masked)
+        return simd_maskz_64(multiplier[1], strm_mask64[1]);
+    return multiplier[1];
+}
+# endif
+#endif
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VLCG64_ENGINE_H
+
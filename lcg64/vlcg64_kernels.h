@@ -0,0 +1,139 @@
+#ifndef __VLCG64_KERNELS_H
+#define __VLCG64_KERNELS_H
+
+
+#include "simd.h"
+#if defined(SIMD_MODE)
+
+
+#include "lcg64_globals.h"
+
+
+/*
+ *  SIMD kernels for 64-bit LCG
+ *
+ *  Seeds, multipliers, and primes are passed as arrays of 2 registers of
+ *  64-bit elements, register 0 holds streams [0, SIMD_STREAMS_64) and
+ *  register 1 streams [SIMD_STREAMS_64, SIMD_STREAMS_32). Layout is the same
+ *  with or without LONG_SPRNG.
+ *
+ *  Floating-point numbers are built from 31-bit (and 22-bit) integer parts,
+ *  so only 32-bit conversions are used and results are exact.
+ */
+#define VLCG64_REGS 2
+
+
+/*!
+ *  \brief LCG multiply 64-bits, wraparound modulo 2^64.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void vlcg64_multiply(SIMD_INT * const a, const SIMD_INT * const b, const SIMD_INT * const c)
+{
+    a[0] = simd_mul_u64(a[0], b[0]);
+    a[0] = simd_add_i64(a[0], c[0]);
+}
+
+
+/*!
+ *  \brief Step streams once and return integer random numbers.
+ *
+ *  The high 31-bits out of the 64-bits are returned.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT vlcg64_next_int(SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p)
+{
+    SIMD_INT rn[2] __SIMD_ALIGN__;
+
+    vlcg64_multiply(&s[0], &m[0], &p[0]);
+    vlcg64_multiply(&s[1], &m[1], &p[1]);
+
+    rn[0] = simd_srl_64(s[0], 0x21);
+    rn[1] = simd_srl_64(s[1], 0x21);
+
+    return simd_packmerge_i32(rn[0], rn[1]);
+}
+
+
+/*!
+ *  \brief Step streams once and return single-precision random numbers.
+ *
+ *  The high 24-bits out of the 64-bits are scaled by 2^-24.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_FLT vlcg64_next_flt(SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p)
+{
+    const SIMD_FLT vfac = simd_set((float)GLOBALS64.TWO_M24);
+    SIMD_INT rn[2] __SIMD_ALIGN__;
+
+    vlcg64_multiply(&s[0], &m[0], &p[0]);
+    vlcg64_multiply(&s[1], &m[1], &p[1]);
+
+    rn[0] = simd_srl_64(s[0], 0x28);
+    rn[1] = simd_srl_64(s[1], 0x28);
+
+    const SIMD_FLT vrn = simd_cvt_i32_f32(simd_packmerge_i32(rn[0], rn[1]));
+    return simd_mul(vrn, vfac);
+}
+
+
+/*!
+ *  \brief Step streams [0, SIMD_STREAMS_64) once and return double-precision random numbers.
+ *
+ *  The high 53-bits out of the 64-bits are scaled by 2^-53, as the sum
+ *  of the high 31-bits and the next 22-bits.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL vlcg64_next_dbl(SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p)
+{
+    const SIMD_DBL vfac[2] __SIMD_ALIGN__ = { simd_set(GLOBALS64.TWO_M31),
+                                              simd_set(GLOBALS64.TWO_M53) };
+    const SIMD_INT vmsk_lsb22 = simd_set(0x3FFFFFUL);
+    SIMD_INT vtmp[2] __SIMD_ALIGN__;
+
+    vlcg64_multiply(&s[0], &m[0], &p[0]);
+
+    vtmp[0] = simd_srl_64(s[0], 0x21);
+    vtmp[1] = simd_srl_64(s[0], 0xB);
+    vtmp[1] = simd_and(vtmp[1], vmsk_lsb22);
+
+    // High parts in low half, low parts in high half
+    const SIMD_INT vrn = simd_packmerge_i32(vtmp[0], vtmp[1]);
+    const SIMD_DBL vhi = simd_mul(simd_cvt_i32_f64(vrn), vfac[0]);
+    return simd_fmadd(simd_cvt_i32_f64_hi(vrn), vfac[1], vhi);
+}
+
+
+/*!
+ *  \brief Step all streams once and return double-precision random numbers.
+ *
+ *  rn[0] holds streams [0, SIMD_STREAMS_64), identical to vlcg64_next_dbl(),
+ *  rn[1] holds streams [SIMD_STREAMS_64, SIMD_STREAMS_32).
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void vlcg64_next_dbl2(SIMD_DBL * const rn, SIMD_INT * const s, const SIMD_INT * const m, const SIMD_INT * const p)
+{
+    const SIMD_DBL vfac[2] __SIMD_ALIGN__ = { simd_set(GLOBALS64.TWO_M31),
+                                              simd_set(GLOBALS64.TWO_M53) };
+    const SIMD_INT vmsk_lsb22 = simd_set(0x3FFFFFUL);
+    SIMD_INT vtmp[2] __SIMD_ALIGN__;
+
+    vlcg64_multiply(&s[0], &m[0], &p[0]);
+    vlcg64_multiply(&s[1], &m[1], &p[1]);
+
+    // High and low parts of all streams
+    vtmp[0] = simd_packmerge_i32(simd_srl_64(s[0], 0x21), simd_srl_64(s[1], 0x21));
+    vtmp[1] = simd_packmerge_i32(simd_and(simd_srl_64(s[0], 0xB), vmsk_lsb22),
+                                 simd_and(simd_srl_64(s[1], 0xB), vmsk_lsb22));
+
+    rn[0] = simd_mul(simd_cvt_i32_f64(vtmp[0]), vfac[0]);
+    rn[1] = simd_mul(simd_cvt_i32_f64_hi(vtmp[0]), vfac[0]);
+    rn[0] = simd_fmadd(simd_cvt_i32_f64(vtmp[1]), vfac[1], rn[0]);
+    rn[1] = simd_fmadd(simd_cvt_i32_f64_hi(vtmp[1]), vfac[1], rn[1]);
+}
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VLCG64_KERNELS_H
+
@@ -0,0 +1,110 @@
+/*************************************************************************/
+/*************************************************************************/
+/*            Parallel Additive Lagged Fibonacci Generator               */
+/*                                                                       */
+/* Note: The modulus is 2^32, two generators are combined with XOR       */
+/*************************************************************************/
+/*************************************************************************/
+
+
+#include "lfg.h"
+#include "lfg_globals.h"
+
+
+GEN_REGISTRY LFG::LFG_NGENS;
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+LFG::LFG()
+{
+    gentype = GLOBALS_LFG.GENTYPE;
+    rng_type = SPRNG_LFG;
+
+    LFG_NGENS.add(1);
+}
+
+
+/*!
+ *  \brief Destructor
+ */
+LFG::~LFG()
+{
+    LFG_NGENS.add(-1);
+}
+
+
+int LFG::init_rng(int gn, int tg, int s, int m)
+{ return engine.init_rng(gn, tg, s, m); }
+
+
+int LFG::pack_size() const
+{ return engine.pack_size(); }
+
+
+/*!
+ *  \brief Pack state into caller buffer, see LFG_ENGINE::pack_rng().
+ */
+int LFG::pack_rng(void * const buffer, const int size) const
+{ return engine.pack_rng(buffer, size); }
+
+
+/*!
+ *  \brief Restore state in place, see LFG_ENGINE::unpack_rng().
+ */
+int LFG::unpack_rng(const void * const buffer, const int size)
+{ return engine.unpack_rng(buffer, size); }
+
+
+int LFG::get_rn_int()
+{ return engine.get_rn_int(); }
+
+
+float LFG::get_rn_flt()
+{ return engine.get_rn_flt(); }
+
+
+double LFG::get_rn_dbl()
+{ return engine.get_rn_dbl(); }
+
+
+int LFG::get_seed_rng() const
+{ return engine.get_seed_rng(); }
+
+
+int LFG::get_ngens() const
+{ return LFG_NGENS.count(); }
+
+
+#if defined(DEBUG)
+int LFG::get_prime() const
+{ return engine.get_prime(); }
+
+# if defined(LONG_SPRNG)
+unsigned long int LFG::get_seed() const
+{ return engine.get_seed(); }
+
+unsigned long int LFG::get_multiplier() const
+{ return engine.get_multiplier(); }
+
+# else
+int LFG::get_seed() const
+{ return engine.get_seed(); }
+
+int LFG::get_multiplier() const
+{ return engine.get_multiplier(); }
+# endif
+#endif
+
+
+/***********************************************************************************
+* SPRNG (c) 2016 by The University of Tennessee, Knoxville                         *
+*                                                                                  *
+* SPRNG is licensed under a                                                        *
+* Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License. *
+*                                                                                  *
+* You should have received a copy of the license along with this                   *
+* work. If not, see <http://creativecommons.org/licenses/by-nc-sa/4.0/>.           *
+************************************************************************************/
+
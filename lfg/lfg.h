@@ -0,0 +1,51 @@
+#ifndef __LFG_H
+#define __LFG_H
+
+
+#include "sprng.h"
+#include "lfg_engine.h"
+#include "registry.h"
+
+
+/*! \class LFG
+ *  \brief Class for additive lagged Fibonacci RNG.
+ *
+ *  Adapter of LFG_ENGINE for the virtual SPRNG interface.
+ */
+class LFG: public SPRNG
+{
+    // Number of generators, per-thread counts
+    static GEN_REGISTRY LFG_NGENS;
+
+  public:
+    LFG();
+    ~LFG();
+    int init_rng(int, int, int, int);
+    int get_rn_int();
+    float get_rn_flt();
+    double get_rn_dbl();
+    int get_seed_rng() const;
+    int get_ngens() const;
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    int get_prime() const;
+# if defined(LONG_SPRNG)
+    unsigned long int get_seed() const;
+    unsigned long int get_multiplier() const;
+# else
+    int get_seed() const;
+    int get_multiplier() const;
+# endif
+#endif
+
+  private:
+    const char *gentype;
+    int rng_type;
+    LFG_ENGINE engine;
+};
+
+
+#endif  // __LFG_H
+
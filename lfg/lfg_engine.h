@@ -0,0 +1,239 @@
+#ifndef __LFG_ENGINE_H
+#define __LFG_ENGINE_H
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "lfg_globals.h"
+#include "lfg_fill.h"
+#include "lfg_pack.h"
+
+
+/*! \class LFG_ENGINE
+ *  \brief Header-only additive lagged Fibonacci RNG.
+ *
+ *  Statically dispatched version of LFG. Two additive generators
+ *  x[n] = x[n-l] + x[n-k] (mod 2^32) with the same lags are combined as in
+ *  SPRNG, (x0 & ~1) ^ (x1 >> 1), numbers are produced in blocks of l words.
+ *  Rings are seeded in the canonical form of SPRNG (see lfg_fill.h).
+ *  The LFG class is a thin adapter for the virtual SPRNG interface.
+ *
+ *  Integers are the high 31-bits of the combined word, floating-point
+ *  numbers are the high 24 (float) or 31 (double) bits scaled exactly.
+ */
+class LFG_ENGINE
+{
+  public:
+    LFG_ENGINE();
+    int init_rng(int, int, int, int);
+    int get_rn_int();
+    float get_rn_flt();
+    double get_rn_dbl();
+    int get_seed_rng() const;
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    int get_prime() const;
+# if defined(LONG_SPRNG)
+    unsigned long int get_seed() const;
+    unsigned long int get_multiplier() const;
+# else
+    int get_seed() const;
+    int get_multiplier() const;
+# endif
+#endif
+
+  private:
+    int init_seed;
+    int stream_position;
+    int stream_next;
+    int parameter;
+    int lval;
+    int kval;
+    int pos;
+    uint32_t ring0[LFG_MAX_LAG];
+    uint32_t ring1[LFG_MAX_LAG];
+
+    uint32_t next();
+};
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+inline LFG_ENGINE::LFG_ENGINE()
+{
+    init_seed = 0;
+    stream_position = 0;
+    stream_next = 0;
+    parameter = 0;
+    lval = GLOBALS_LFG.VALID_L[0];
+    kval = GLOBALS_LFG.VALID_K[0];
+    pos = lval;
+    memset(ring0, 0, sizeof(ring0));
+    memset(ring1, 0, sizeof(ring1));
+}
+
+
+/*!
+ *  \brief Initialize RNG
+ *
+ *  Gives back one generator (node gennum) with updated spawning info.
+ *  Should be called total_gen times, with different value
+ *  of gennum in [0,total_gen) each call.
+ */
+inline int LFG_ENGINE::init_rng(int gn, int tg, int s, int m)
+{
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+    stream_next = tg;
+
+    if (gn < 0 || gn >= tg) {
+        printf("ERROR: generator number is out of range, %d\n", gn);
+        return -1;
+    }
+    stream_position = gn;
+
+    if (m < 0 || m >= GLOBALS_LFG.NPARAMS) {
+        printf("ERROR: multiplier out of range, %d\n", m);
+        m = 0;
+    }
+    parameter = m;
+    lval = GLOBALS_LFG.VALID_L[parameter];
+    kval = GLOBALS_LFG.VALID_K[parameter];
+
+    init_seed = s & 0x7FFFFFFF;
+    lfg_fill(ring0, ring1, 1, parameter, init_seed, stream_position);
+    for (int i = 0; i < GLOBALS_LFG.RUNUP; ++i) {
+        lfg_block(ring0, lval, kval);
+        lfg_block(ring1, lval, kval);
+    }
+    pos = lval;
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Next combined word, a new block is generated every l words.
+ */
+inline uint32_t LFG_ENGINE::next()
+{
+    if (pos == lval) {
+        lfg_block(ring0, lval, kval);
+        lfg_block(ring1, lval, kval);
+        pos = 0;
+    }
+
+    const uint32_t x = (ring0[pos] & ~0x1U) ^ (ring1[pos] >> 1);
+    ++pos;
+
+    return x;
+}
+
+
+/*!
+ *  The high 31-bits out of the 32-bits are returned.
+ */
+inline int LFG_ENGINE::get_rn_int()
+{ return (int)(next() >> 1); }
+
+
+inline float LFG_ENGINE::get_rn_flt()
+{ return (float)(int)(next() >> 8) * (float)GLOBALS_LFG.TWO_M24; }
+
+
+inline double LFG_ENGINE::get_rn_dbl()
+{ return (double)(int)(next() >> 1) * GLOBALS_LFG.TWO_M31; }
+
+
+/*!
+ *  \brief Size in bytes of packed state.
+ */
+inline int LFG_ENGINE::pack_size() const
+{ return lfg_pack_size(1, lval); }
+
+
+/*!
+ *  \brief Pack state into caller buffer (see lfg_pack.h).
+ *
+ *  Returns number of bytes written or -1 on error.
+ */
+inline int LFG_ENGINE::pack_rng(void * const buffer, const int size) const
+{
+    const int nbytes = lfg_pack_check(buffer, size, 1, lval);
+    if (nbytes < 0)
+        return -1;
+
+    const LFG_PACK_VIEW pack = lfg_pack_view(buffer, 1, lval);
+    lfg_pack_header(pack.header, 1, 0, stream_position, stream_next, parameter, pos);
+    pack.init_seed[0] = init_seed;
+    memcpy(pack.ring0, ring0, lval * sizeof(uint32_t));
+    memcpy(pack.ring1, ring1, lval * sizeof(uint32_t));
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Restore state in place from packed state (see lfg_pack.h).
+ *
+ *  Returns number of bytes read or -1 on error, state is not modified on error.
+ */
+inline int LFG_ENGINE::unpack_rng(const void * const buffer, const int size)
+{
+    if (lfg_unpack_check(buffer, size, 1, GLOBALS_LFG.VALID_L, GLOBALS_LFG.NPARAMS) < 0)
+        return -1;
+
+    const LFG_PACK_HEADER * const header = (const LFG_PACK_HEADER *)buffer;
+    parameter = header->parameter;
+    lval = GLOBALS_LFG.VALID_L[parameter];
+    kval = GLOBALS_LFG.VALID_K[parameter];
+
+    const LFG_PACK_VIEW pack = lfg_pack_view(buffer, 1, lval);
+    stream_position = header->stream_position;
+    stream_next = header->stream_next;
+    pos = header->pos;
+    init_seed = pack.init_seed[0];
+    memcpy(ring0, pack.ring0, lval * sizeof(uint32_t));
+    memcpy(ring1, pack.ring1, lval * sizeof(uint32_t));
+
+    return lfg_pack_size(1, lval);
+}
+
+
+inline int LFG_ENGINE::get_seed_rng() const
+{ return init_seed; }
+
+
+/*
+ *  LFG has no prime, lags are returned instead (short lag as prime,
+ *  long lag as multiplier), seed is the last word of the first ring.
+ */
+#if defined(DEBUG)
+inline int LFG_ENGINE::get_prime() const
+{ return kval; }
+
+# if defined(LONG_SPRNG)
+inline unsigned long int LFG_ENGINE::get_seed() const
+{ return ring0[lval - 1]; }
+
+inline unsigned long int LFG_ENGINE::get_multiplier() const
+{ return lval; }
+
+# else
+inline int LFG_ENGINE::get_seed() const
+{ return (int)(ring0[lval - 1] >> 1); }
+
+inline int LFG_ENGINE::get_multiplier() const
+{ return lval; }
+# endif
+#endif
+
+
+#endif  // __LFG_ENGINE_H
+
@@ -0,0 +1,134 @@
+#ifndef __LFG_FILL_H
+#define __LFG_FILL_H
+
+
+#include <stdint.h>  // fixed width integers
+#include "lfg_globals.h"
+
+
+/*
+ *  Ring buffers of additive lagged Fibonacci generators.
+ *
+ *  A ring holds the last l words of a stream, oldest first, with the words
+ *  of a stream spaced stride elements apart. LFG uses stride 1, VLFG stores
+ *  SIMD_STREAMS_32 streams interleaved (stride SIMD_STREAMS_32), so word j
+ *  of all streams is a single register. Scalar functions are shared by LFG
+ *  and VLFG (applied per lane).
+ */
+
+
+/*!
+ *  \brief Parity of the bits of x.
+ */
+inline static uint32_t lfg_parity(uint32_t x)
+{
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    x ^= x >> 2;
+    x ^= x >> 1;
+    return x & 0x1U;
+}
+
+
+/*!
+ *  \brief Step 64-bit shift register (reg[0] is the low word) 64 times.
+ *
+ *  Bits follow s[n + 64] = s[n] ^ s[n + 1] ^ s[n + 3] ^ s[n + 4], the
+ *  primitive polynomial x^64 + x^4 + x^3 + x + 1. Bits 28-31 of the high
+ *  word depend on new bits of the low word, their taps are precomputed.
+ */
+inline static void lfg_advance_reg(uint32_t * const reg)
+{
+    const uint32_t mask = 0x1BU;
+    const uint32_t adv_hi[4] = { 0xB0000000U, 0x60000000U, 0xC0000000U, 0x80000000U };
+    const uint32_t adv_lo[4] = { 0x1BU, 0x2DU, 0x5AU, 0xAFU };
+
+    uint32_t fill[2] = { 0, 0 };
+    for (int i = 0; i < 28; ++i) {
+        fill[0] |= lfg_parity(reg[0] & (mask << i)) << i;
+        fill[1] |= lfg_parity(reg[1] & (mask << i)) << i;
+    }
+    for (int i = 28; i < 32; ++i) {
+        fill[0] |= (lfg_parity(reg[0] & (mask << i)) ^ lfg_parity(reg[1] & (mask >> (32 - i)))) << i;
+        fill[1] |= (lfg_parity(reg[1] & adv_hi[i - 28]) ^ lfg_parity(reg[0] & adv_lo[i - 28])) << i;
+    }
+
+    reg[0] = fill[0];
+    reg[1] = fill[1];
+}
+
+
+/*!
+ *  \brief Fill a ring in canonical form for a node number.
+ *
+ *  Node numbers have 31 bits per word, node[0] holds the lowest bits.
+ *  Word 0 is the lowest word of the node number, words 1 to l - 2 are
+ *  taken from a shift register started at node ^ gseed (XOR the node
+ *  number), and word l - 1 is zero. All words are shifted up by one bit,
+ *  the lowest bit is set for word first only (VALID_FIRST[m] for LFG).
+ *  Lowest bits are the same for all nodes (a single full-period cycle of
+ *  the trinomial), the node number selects one of the distinct cycles of
+ *  the upper bits.
+ *
+ *  Words are SPRNG ring words r[i]. SPRNG steps its ring backwards, ring
+ *  word j (oldest first) is r[0] for j = 0 and r[l - j] otherwise.
+ *  Also used by MLFG for its ring of exponents (see mlfg_fill.h).
+ */
+inline static void lfg_fill_ring(uint32_t * const a, const int stride, const int lval, const int first, const uint32_t gseed, const uint32_t * const node)
+{
+    uint32_t reg[2];
+    reg[0] = reg[1] = node[0] ^ gseed;
+    if (!reg[0])
+        reg[0] = GLOBALS_LFG.GS0;
+    lfg_advance_reg(reg);
+    lfg_advance_reg(reg);
+
+    a[0] = (node[0] & 0x7FFFFFFFU) << 1;
+    for (int i = 1; i < lval - 1; ++i) {
+        lfg_advance_reg(reg);
+        const uint32_t n = (i < 2) ? node[i] : 0;
+        a[(lval - i) * stride] = ((reg[0] ^ n) & 0x7FFFFFFFU) << 1;
+    }
+    a[1 * stride] = 0;
+
+    a[((first) ? lval - first : 0) * stride] |= 0x1U;
+}
+
+
+/*!
+ *  \brief Fill both rings of a stream from seed and generator number.
+ *
+ *  As SPRNG, ring0 uses node number 2 * gn and ring1 node number 2 * gn + 1,
+ *  rings have to be run up by RUNUP blocks before use.
+ */
+inline static void lfg_fill(uint32_t * const r0, uint32_t * const r1, const int stride, const int m, const int s, const int gn)
+{
+    const uint32_t gseed = (uint32_t)(s & 0x7FFFFFFF) ^ GLOBALS_LFG.GS0;
+
+    uint32_t node[2];
+    node[0] = ((uint32_t)gn << 1) & 0x7FFFFFFFU;
+    node[1] = (uint32_t)gn >> 30;
+    lfg_fill_ring(r0, stride, GLOBALS_LFG.VALID_L[m], GLOBALS_LFG.VALID_FIRST[m], gseed, node);
+
+    node[0] |= 0x1U;
+    lfg_fill_ring(r1, stride, GLOBALS_LFG.VALID_L[m], GLOBALS_LFG.VALID_FIRST[m], gseed, node);
+}
+
+
+/*!
+ *  \brief Replace ring with the next l words, x[n] = x[n-l] + x[n-k] (mod 2^32).
+ *
+ *  Words are updated in place, ring is again oldest first.
+ */
+inline static void lfg_block(uint32_t * const a, const int lval, const int kval)
+{
+    for (int j = 0; j < kval; ++j)
+        a[j] += a[j + lval - kval];
+    for (int j = kval; j < lval; ++j)
+        a[j] += a[j - kval];
+}
+
+
+#endif  // __LFG_FILL_H
+
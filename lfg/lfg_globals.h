@@ -0,0 +1,55 @@
+#ifndef __LFG_GLOBALS_H
+#define __LFG_GLOBALS_H
+
+
+// Provides access to alignment attributes required for SIMD mode.
+// Misalignment may cause segmentation faults.
+#include "simd.h"
+
+
+/*!
+ *  Longest lag, size of ring buffers of a stream
+ */
+#define LFG_MAX_LAG 1279
+
+
+/*!
+ *  Global parameters for LFG
+ *  Parameter m selects lags (VALID_L[m], VALID_K[m]) of the trinomial
+ *  x^l + x^k + 1, default is the longest lag. Rings are filled in the
+ *  canonical form of SPRNG (see lfg_fill.h): the lowest bit of word
+ *  VALID_FIRST[m] is set, the shift register of the fill starts from
+ *  node number ^ seed ^ GS0, and RUNUP blocks of l words are discarded.
+ */
+struct LFG_GLOBALS
+{
+    const char * GENTYPE;
+    int NPARAMS;
+    int VALID_L[11];
+    int VALID_K[11];
+    int VALID_FIRST[11];
+    unsigned int GS0;
+    int RUNUP;
+    double TWO_M24;
+    double TWO_M31;
+} __SIMD_ALIGN__;
+
+
+/*!
+ *  Global instance of configuration structure.
+ */
+const LFG_GLOBALS GLOBALS_LFG __SIMD_ALIGN__ = {
+    "Additive Lagged Fibonacci Generator",
+    11,
+    {1279, 17, 31, 55, 63, 127, 521, 521, 607, 607, 1279},
+    {861, 5, 6, 24, 31, 97, 353, 168, 334, 273, 418},
+    {233, 10, 2, 11, 14, 21, 100, 83, 166, 105, 208},
+    0x372F05ACU,
+    64,
+    5.96046447753906234e-8,
+    4.656612873077392578125e-10
+};
+
+
+#endif  // __LFG_GLOBALS_H
+
@@ -0,0 +1,147 @@
+#ifndef __LFG_PACK_H
+#define __LFG_PACK_H
+
+
+#include <stdio.h>   // printf
+#include <stdint.h>  // fixed width integers
+#include "sprng.h"   // SPRNG_LFG
+#include "pack.h"
+
+
+/*
+ *  Checkpoint format of LFG and VLFG (packed state), version 1.
+ *
+ *  Fixed layout in host byte order, independent of SIMD mode and LONG_SPRNG:
+ *
+ *    LFG_PACK_HEADER            32 bytes
+ *    int32_t init_seed[n]
+ *    uint32_t ring0[n][l]       oldest word first
+ *    uint32_t ring1[n][l]
+ *
+ *  for n streams with lag l (from parameter), padded with zeros to a
+ *  multiple of 8 bytes. Buffers have to be 8-byte aligned, packed
+ *  generators can be placed back to back. An LFG and a VLFG with a single
+ *  active stream use the same packed state.
+ */
+const uint32_t LFG_PACK_MAGIC = 0x47464C53U;  /*!< "SLFG" */
+const uint16_t LFG_PACK_VERSION = 1;
+
+
+struct LFG_PACK_HEADER
+{
+    PACK_HEADER base;
+    int32_t per_lane;  /*!< streams use generator numbers stream_position + i */
+    int32_t stream_position;
+    int32_t stream_next;
+    int32_t parameter;  /*!< lags index, same for all streams */
+    int32_t pos;  /*!< words of rings already returned */
+};
+
+
+/*!
+ *  Arrays of packed state of n streams.
+ */
+struct LFG_PACK_VIEW
+{
+    LFG_PACK_HEADER *header;
+    int32_t *init_seed;
+    uint32_t *ring0;
+    uint32_t *ring1;
+};
+
+
+/*!
+ *  \brief Size in bytes of packed state of n streams with lag l.
+ */
+inline static int lfg_pack_size(const int n, const int lval)
+{
+    return pack_align((int)sizeof(LFG_PACK_HEADER) + n * (int)(sizeof(int32_t) + 2 * lval * sizeof(uint32_t)));
+}
+
+
+/*!
+ *  \brief Arrays of packed state of n streams with lag l in buffer.
+ */
+inline static LFG_PACK_VIEW lfg_pack_view(const void * const buffer, const int n, const int lval)
+{
+    LFG_PACK_VIEW view;
+    view.header = (LFG_PACK_HEADER *)buffer;
+    view.init_seed = (int32_t *)(view.header + 1);
+    view.ring0 = (uint32_t *)(view.init_seed + n);
+    view.ring1 = view.ring0 + n * lval;
+    return view;
+}
+
+
+/*!
+ *  \brief Check buffer for packing n streams with lag l, clears padding.
+ *
+ *  Returns packed size or -1 on error.
+ */
+inline static int lfg_pack_check(void * const buffer, const int size, const int n, const int lval)
+{
+    return pack_check(buffer, size, lfg_pack_size(n, lval));
+}
+
+
+/*!
+ *  \brief Check packed state with at most max_streams streams.
+ *
+ *  Lags are VALID_L/VALID_K of the packed parameter, nparams entries.
+ *  Every ring needs an odd word, otherwise the least significant bits stay
+ *  zero and the period is reduced.
+ *  Returns number of streams or -1 on error.
+ */
+inline static int lfg_unpack_check(const void * const buffer, const int size, const int max_streams, const int * const valid_l, const int nparams)
+{
+    const int n = pack_check_header(buffer, size, LFG_PACK_MAGIC, LFG_PACK_VERSION, SPRNG_LFG, max_streams, (int)sizeof(LFG_PACK_HEADER));
+    if (n < 0)
+        return -1;
+
+    const LFG_PACK_HEADER * const header = (const LFG_PACK_HEADER *)buffer;
+    if (header->parameter < 0 || header->parameter >= nparams) {
+        printf("ERROR: Unpacked parameters not acceptable.\n");
+        return -1;
+    }
+    const int lval = valid_l[header->parameter];
+    if (header->pos < 0 || header->pos > lval) {
+        printf("ERROR: Unpacked parameters not acceptable.\n");
+        return -1;
+    }
+    if (pack_check_size(size, lfg_pack_size(n, lval)) < 0)
+        return -1;
+
+    const LFG_PACK_VIEW pack = lfg_pack_view(buffer, n, lval);
+    for (int strm = 0; strm < n; ++strm) {
+        uint32_t odd0 = 0;
+        uint32_t odd1 = 0;
+        for (int i = 0; i < lval; ++i) {
+            odd0 |= pack.ring0[strm * lval + i];
+            odd1 |= pack.ring1[strm * lval + i];
+        }
+        if (!(odd0 & odd1 & 0x1)) {
+            printf("ERROR: Unpacked parameters not acceptable.\n");
+            return -1;
+        }
+    }
+
+    return n;
+}
+
+
+/*!
+ *  \brief Fill header of packed state.
+ */
+inline static void lfg_pack_header(LFG_PACK_HEADER * const header, const int n, const int per_lane, const int stream_position, const int stream_next, const int parameter, const int pos)
+{
+    pack_header(&header->base, LFG_PACK_MAGIC, LFG_PACK_VERSION, SPRNG_LFG, n);
+    header->per_lane = per_lane;
+    header->stream_position = stream_position;
+    header->stream_next = stream_next;
+    header->parameter = parameter;
+    header->pos = pos;
+}
+
+
+#endif  // __LFG_PACK_H
+
@@ -0,0 +1,857 @@
+#ifndef __VLFG_ENGINE_H
+#define __VLFG_ENGINE_H
+
+
+#include "simd.h"
+#if defined SIMD_MODE
+
+
+#include <stdio.h>   // printf
+#include <stdint.h>  // fixed width integers
+#include <string.h>  // memset, memcpy
+#include <limits.h>  // INT_MAX
+#include "lfg_globals.h"
+#include "lfg_fill.h"
+#include "lfg_pack.h"
+#include "vlfg_kernels.h"
+
+
+/*! \class VLFG_ENGINE
+ *  \brief Header-only SIMD additive lagged Fibonacci RNG.
+ *
+ *  SIMD version of LFG. Rings of all streams are stored interleaved (SoA),
+ *  so word j of all streams is one aligned register and a block of l words
+ *  is generated with whole-register additions (see vlfg_kernels.h). All
+ *  streams share the lags, stream i is identical to a scalar LFG with the
+ *  seed and generator number of stream i.
+ *  The VLFG class is a thin adapter for the virtual VSPRNG interface.
+ *
+ *  NOTE: objects have to be aligned to SIMD_WIDTH_BYTES (stack or simd_malloc'ed).
+ */
+class VLFG_ENGINE
+{
+  public:
+    VLFG_ENGINE();
+    int init_rng(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int init_rng_lanes(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int reseed_rng(const int * const);
+    int spawn_rng(const int, VLFG_ENGINE * const * const);
+    SIMD_INT get_rn_int();
+    SIMD_FLT get_rn_flt();
+    SIMD_DBL get_rn_dbl();
+    void get_rn_dbl2(SIMD_DBL * const);
+    int get_rn_int_array(int * const, const int);
+    int get_rn_flt_array(float * const, const int);
+    int get_rn_dbl_array(double * const, const int);
+    int get_rn_dbl2_array(double * const, const int);
+    int get_rn_int_streams(int * const, const int, const int);
+    int get_rn_flt_streams(float * const, const int, const int);
+    int get_rn_dbl_streams(double * const, const int, const int);
+    int get_stream_stride(const int) const;
+    SIMD_INT get_seed_rng() const;
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    SIMD_INT get_prime() const;
+    SIMD_INT get_seed() const;
+    SIMD_INT get_multiplier() const;
+# if defined(LONG_SPRNG)
+    SIMD_INT get_seed2() const;
+    SIMD_INT get_multiplier2() const;
+# endif
+#endif
+
+  private:
+    uint32_t ring0[LFG_MAX_LAG * SIMD_STREAMS_32] __SIMD_ALIGN__;
+    uint32_t ring1[LFG_MAX_LAG * SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int32_t init_seed[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    SIMD_MSK strm_mask32;
+    SIMD_MSK strm_mask64[2];
+    int32_t stream_position;
+    int32_t stream_next;
+    int32_t parameter;
+    int32_t lval;
+    int32_t kval;
+    int32_t pos;
+    int32_t masked;
+    int32_t nstreams;
+    int32_t per_lane;
+
+    SIMD_INT next();
+    void refill();
+    int check_streams_args(const void * const, const int, const int) const;
+    void init_streams(const int * const, const int);
+    static int check_params(int * const, int * const, const int * const, const int * const, const int);
+};
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+inline VLFG_ENGINE::VLFG_ENGINE()
+{
+    stream_position = 0;
+    stream_next = 0;
+    parameter = 0;
+    lval = GLOBALS_LFG.VALID_L[0];
+    kval = GLOBALS_LFG.VALID_K[0];
+    pos = lval;
+    masked = 0;
+    nstreams = SIMD_STREAMS_32;
+    per_lane = 0;
+    strm_mask32 = simd_set_mask_32(SIMD_STREAMS_32);
+    strm_mask64[0] = simd_set_mask_64(SIMD_STREAMS_64);
+    strm_mask64[1] = simd_set_mask_64(SIMD_STREAMS_64);
+
+    memset(ring0, 0, sizeof(ring0));
+    memset(ring1, 0, sizeof(ring1));
+    memset(init_seed, 0, sizeof(init_seed));
+}
+
+
+/*!
+ *  \brief Initialize RNG
+ *
+ *  As VLCG_ENGINE::init_rng(), all streams use generator number gn and
+ *  differ by their seeds. Lags are the same for all streams, multipliers
+ *  of all active streams have to be equal.
+ *
+ *  NOTE: double streams are the first half of the streams.
+ *  Returns 0 on success or -1 on error.
+ */
+inline int VLFG_ENGINE::init_rng(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{
+    // Check total generators
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+
+    // Check generator number
+    if (gn < 0 || gn >= tg) {
+        printf("ERROR: generator number is out of range, %d\n", gn);
+        gn = tg - 1;
+    }
+
+    // Check seeds, multipliers, and number of streams
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    const int nstrms = check_params(s, m, gs, gm, ns);
+    if (nstrms < 0)
+        return -1;
+
+    stream_next = tg;
+    stream_position = gn;
+    parameter = m[0];
+    per_lane = 0;
+    init_streams(s, nstrms);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Initialize RNG with one generator number per stream
+ *
+ *  Stream i is SPRNG generator gn + i, its output is identical to a scalar
+ *  LFG initialized with init_rng(gn + i, tg, gs[i], gm[0]).
+ *
+ *  NOTE: double streams are the first half of the generators.
+ *  Returns 0 on success or -1 on error.
+ */
+inline int VLFG_ENGINE::init_rng_lanes(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{
+    // Check total generators
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+
+    // Check seeds, multipliers, and number of streams
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    const int nstrms = check_params(s, m, gs, gm, ns);
+    if (nstrms < 0)
+        return -1;
+
+    // Check generator numbers
+    if (gn < 0 || gn > tg - nstrms) {
+        printf("ERROR: generator numbers are out of range, [%d, %d)\n", gn, gn + nstrms);
+        return -1;
+    }
+
+    stream_next = tg;
+    stream_position = gn;
+    parameter = m[0];
+    per_lane = 1;
+    init_streams(s, nstrms);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Reseed streams in place
+ *
+ *  Generator numbers, lags, and number of streams are kept, resulting state
+ *  is the same as init_rng() (or init_rng_lanes()) with seeds gs.
+ *  Returns 0 on success or -1 on error.
+ */
+inline int VLFG_ENGINE::reseed_rng(const int * const gs)
+{
+    if (!gs) {
+        printf("ERROR: no array for seeds provided.\n");
+        return -1;
+    }
+
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    memset(s, 0, sizeof(s));
+    memcpy(s, gs, nstreams * sizeof(int));
+    init_streams(s, nstreams);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Seeds and multipliers of streams, inactive streams are zero.
+ *
+ *  Multipliers select the lags, all active streams have to use the same.
+ *  Returns number of streams or -1 if multipliers differ.
+ */
+inline int VLFG_ENGINE::check_params(int * const s, int * const m, const int * const gs, const int * const gm, const int ns)
+{
+    // Check number of streams requested
+    int nstrms = ns;
+    if (nstrms <= 0 || nstrms > SIMD_STREAMS_32) {
+        printf("ERROR: number of streams is out of range, %d, default is to use all available streams.\n", nstrms);
+        nstrms = SIMD_STREAMS_32;
+    }
+
+    // Check multipliers
+    memset(m, 0, SIMD_STREAMS_32 * sizeof(int));
+    if (!gm)
+        printf("WARNING: no array for multipliers provided, default is zero.\n");
+    else {
+        if (gm[0] < 0 || gm[0] >= GLOBALS_LFG.NPARAMS)
+            printf("ERROR: multiplier out of range, %d\n", gm[0]);
+        else
+            m[0] = gm[0];
+        for (int strm = 1; strm < nstrms; ++strm) {
+            if (gm[strm] != gm[0]) {
+                printf("ERROR: lags are the same for all streams, multipliers %d and %d differ.\n", gm[0], gm[strm]);
+                return -1;
+            }
+        }
+        for (int strm = 1; strm < nstrms; ++strm)
+            m[strm] = m[0];
+    }
+
+    // Check seeds
+    memset(s, 0, SIMD_STREAMS_32 * sizeof(int));
+    if (!gs)
+        printf("WARNING: no array for seeds provided, default is zero.\n");
+    else {
+        for (int strm = 0; strm < nstrms; ++strm)
+            s[strm] = gs[strm];
+    }
+
+    return nstrms;
+}
+
+
+/*!
+ *  \brief Fill rings of streams from seeds and generator numbers.
+ *
+ *  Generator numbers are stream_position (plus stream index if per_lane),
+ *  lags are those of parameter. Rings are run up as in LFG_ENGINE, first
+ *  numbers are the next block.
+ */
+inline void VLFG_ENGINE::init_streams(const int * const s, const int nstrms)
+{
+    // Select masked numbers, only if not using maximum number of streams
+    masked = (nstrms < SIMD_STREAMS_32);
+    nstreams = nstrms;
+    strm_mask32 = simd_set_mask_32(nstrms);
+    strm_mask64[0] = simd_set_mask_64(nstrms);
+    strm_mask64[1] = simd_set_mask_64(nstrms - SIMD_STREAMS_64);
+
+    lval = GLOBALS_LFG.VALID_L[parameter];
+    kval = GLOBALS_LFG.VALID_K[parameter];
+
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        const int gn = (per_lane && strm < nstrms) ? stream_position + strm : stream_position;
+        init_seed[strm] = s[strm] & 0x7FFFFFFF;
+        lfg_fill(ring0 + strm, ring1 + strm, SIMD_STREAMS_32, parameter, init_seed[strm], gn);
+    }
+    for (int i = 0; i < GLOBALS_LFG.RUNUP; ++i)
+        refill();
+    pos = lval;
+}
+
+
+/*!
+ *  \brief Spawn new generators
+ *
+ *  Child i is generator number stream_position + stream_next * (i + 1) with
+ *  the seeds and lags of this generator, as in SPRNG spawn_rng().
+ *  If streams have one generator number each (init_rng_lanes()), the
+ *  children do as well.
+ *  Returns number of generators spawned or -1 on error.
+ */
+inline int VLFG_ENGINE::spawn_rng(const int nspawned, VLFG_ENGINE * const * const newgens)
+{
+    if (!newgens || nspawned <= 0) {
+        printf("ERROR: invalid array of generators, %d\n", nspawned);
+        return -1;
+    }
+
+    // Check generator numbers of children
+    const long int next = (long int)stream_next * (nspawned + 1);
+    const long int last = stream_position + (long int)stream_next * nspawned + ((per_lane) ? nstreams - 1 : 0);
+    if (next > INT_MAX || last > INT_MAX) {
+        printf("ERROR: generator numbers of spawned generators are out of range, %ld\n", last);
+        return -1;
+    }
+
+    for (int i = 0; i < nspawned; ++i) {
+        VLFG_ENGINE * const eng = newgens[i];
+        eng->stream_next = (int)next;
+        eng->stream_position = stream_position + stream_next * (i + 1);
+        eng->parameter = parameter;
+        eng->per_lane = per_lane;
+        eng->init_streams(init_seed, nstreams);
+    }
+
+    stream_next = (int)next;
+
+    return nspawned;
+}
+
+
+/*!
+ *  \brief Generate next block of l words of all streams.
+ */
+inline void VLFG_ENGINE::refill()
+{
+    vlfg_block(ring0, lval, kval);
+    vlfg_block(ring1, lval, kval);
+    pos = 0;
+}
+
+
+/*!
+ *  \brief Next combined word of all streams.
+ */
+inline SIMD_INT VLFG_ENGINE::next()
+{
+    if (pos == lval)
+        refill();
+    return vlfg_word(ring0, ring1, pos++);
+}
+
+
+/*
+ *  Masking is fixed at init, the test on masked is loop invariant
+ *  and perfectly predicted.
+ */
+inline SIMD_INT VLFG_ENGINE::get_rn_int()
+{
+    const SIMD_INT rn = vlfg_int(next());
+    return (masked) ? simd_maskz_32(rn, strm_mask32) : rn;
+}
+
+
+inline SIMD_FLT VLFG_ENGINE::get_rn_flt()
+{
+    const SIMD_FLT rn = vlfg_flt(next());
+    return (masked) ? simd_maskz(rn, strm_mask32) : rn;
+}
+
+
+inline SIMD_DBL VLFG_ENGINE::get_rn_dbl()
+{
+    const SIMD_DBL rn = vlfg_dbl(next());
+    return (masked) ? simd_maskz(rn, strm_mask64[0]) : rn;
+}
+
+
+/*!
+ *  \brief Double-precision random numbers of all streams.
+ *
+ *  rn[0] holds streams [0, SIMD_STREAMS_64), rn[1] holds streams
+ *  [SIMD_STREAMS_64, SIMD_STREAMS_32).
+ */
+inline void VLFG_ENGINE::get_rn_dbl2(SIMD_DBL * const rn)
+{
+    const SIMD_INT x = next();
+    rn[0] = vlfg_dbl(x);
+    rn[1] = vlfg_dbl_hi(x);
+    if (masked) {
+        rn[0] = simd_maskz(rn[0], strm_mask64[0]);
+        rn[1] = simd_maskz(rn[1], strm_mask64[1]);
+    }
+}
+
+
+/*!
+ *  \brief Fill an array with integer random numbers.
+ *
+ *  Same layout as VLCG_ENGINE::get_rn_int_array(), the array must be aligned
+ *  to SIMD_WIDTH_BYTES. Numbers are read from the rings in blocks of up to
+ *  l registers, a new block is generated when the rings are consumed.
+ *  Returns the number of elements written or -1 on error.
+ */
+inline int VLFG_ENGINE::get_rn_int_array(int * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    const SIMD_MSK vmsk = strm_mask32;
+    int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    int *rn_ptr = rn;
+    while (nvec > 0) {
+        if (pos == lval)
+            refill();
+        const int nblk = (lval - pos < nvec) ? lval - pos : nvec;
+        for (int j = pos; j < pos + nblk; ++j) {
+            const SIMD_INT vrn = vlfg_int(vlfg_word(ring0, ring1, j));
+            simd_store(rn_ptr, (masked) ? simd_maskz_32(vrn, vmsk) : vrn);
+            rn_ptr += SIMD_STREAMS_32;
+        }
+        pos += nblk;
+        nvec -= nblk;
+    }
+
+    if (nrem > 0) {
+        int rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        simd_store(rn_tail, get_rn_int());
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(int));
+    }
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with single-precision random numbers.
+ *
+ *  Same as get_rn_int_array() but for float elements.
+ */
+inline int VLFG_ENGINE::get_rn_flt_array(float * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    const SIMD_MSK vmsk = strm_mask32;
+    int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    float *rn_ptr = rn;
+    while (nvec > 0) {
+        if (pos == lval)
+            refill();
+        const int nblk = (lval - pos < nvec) ? lval - pos : nvec;
+        for (int j = pos; j < pos + nblk; ++j) {
+            const SIMD_FLT vrn = vlfg_flt(vlfg_word(ring0, ring1, j));
+            simd_store(rn_ptr, (masked) ? simd_maskz(vrn, vmsk) : vrn);
+            rn_ptr += SIMD_STREAMS_32;
+        }
+        pos += nblk;
+        nvec -= nblk;
+    }
+
+    if (nrem > 0) {
+        float rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        simd_store(rn_tail, get_rn_flt());
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(float));
+    }
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers.
+ *
+ *  Same as get_rn_int_array() but with SIMD_STREAMS_64 elements per register.
+ */
+inline int VLFG_ENGINE::get_rn_dbl_array(double * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    const SIMD_MSK vmsk = strm_mask64[0];
+    int nvec = nrn / SIMD_STREAMS_64;
+    const int nrem = nrn % SIMD_STREAMS_64;
+
+    double *rn_ptr = rn;
+    while (nvec > 0) {
+        if (pos == lval)
+            refill();
+        const int nblk = (lval - pos < nvec) ? lval - pos : nvec;
+        for (int j = pos; j < pos + nblk; ++j) {
+            const SIMD_DBL vrn = vlfg_dbl(vlfg_word(ring0, ring1, j));
+            simd_store(rn_ptr, (masked) ? simd_maskz(vrn, vmsk) : vrn);
+            rn_ptr += SIMD_STREAMS_64;
+        }
+        pos += nblk;
+        nvec -= nblk;
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        simd_store(rn_tail, get_rn_dbl());
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(double));
+    }
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers of all streams.
+ *
+ *  Each step of the streams stores SIMD_STREAMS_32 elements (contents of get_rn_dbl2()).
+ */
+inline int VLFG_ENGINE::get_rn_dbl2_array(double * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    const SIMD_MSK vmsk[2] = { strm_mask64[0], strm_mask64[1] };
+    int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    double *rn_ptr = rn;
+    while (nvec > 0) {
+        if (pos == lval)
+            refill();
+        const int nblk = (lval - pos < nvec) ? lval - pos : nvec;
+        for (int j = pos; j < pos + nblk; ++j) {
+            const SIMD_INT x = vlfg_word(ring0, ring1, j);
+            const SIMD_DBL vrn0 = vlfg_dbl(x);
+            const SIMD_DBL vrn1 = vlfg_dbl_hi(x);
+            simd_store(rn_ptr, (masked) ? simd_maskz(vrn0, vmsk[0]) : vrn0);
+            simd_store(rn_ptr + SIMD_STREAMS_64, (masked) ? simd_maskz(vrn1, vmsk[1]) : vrn1);
+            rn_ptr += SIMD_STREAMS_32;
+        }
+        pos += nblk;
+        nvec -= nblk;
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        SIMD_DBL vrn[2] __SIMD_ALIGN__;
+        get_rn_dbl2(vrn);
+        simd_store(rn_tail, vrn[0]);
+        simd_store(rn_tail + SIMD_STREAMS_64, vrn[1]);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(double));
+    }
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Smallest valid stride for stream-major arrays of nrn numbers per stream.
+ *
+ *  See VLCG_ENGINE::get_stream_stride().
+ */
+inline int VLFG_ENGINE::get_stream_stride(const int nrn) const
+{
+    if (nrn <= 0)
+        return SIMD_STREAMS_32;
+    return ((nrn + SIMD_STREAMS_32 - 1) / SIMD_STREAMS_32) * SIMD_STREAMS_32;
+}
+
+
+inline int VLFG_ENGINE::check_streams_args(const void * const rn, const int nrn, const int stride) const
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+    if (stride < nrn || stride % SIMD_STREAMS_32 != 0) {
+        printf("ERROR: stride of streams is out of range, %d (see get_stream_stride())\n", stride);
+        return -1;
+    }
+    return 0;
+}
+
+
+/*!
+ *  \brief Fill an array with integer random numbers, stream-major layout.
+ *
+ *  Same layout as VLCG_ENGINE::get_rn_int_streams(), the nrn numbers of
+ *  stream i start at rn[i * stride], only active streams are written.
+ *  Returns the number of elements written per stream or -1 on error.
+ */
+inline int VLFG_ENGINE::get_rn_int_streams(int * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    const int nblk = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    SIMD_INT vrn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_32; k += SIMD_STREAMS_32) {
+        for (int j = 0; j < SIMD_STREAMS_32; ++j)
+            vrn[j] = vlfg_int(next());
+        simd_transpose_i32(vrn);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm]);
+    }
+
+    if (nrem > 0) {
+        int rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j)
+            vrn[j] = vlfg_int(next());
+        for (int j = nrem; j < SIMD_STREAMS_32; ++j)
+            simd_set_zero(&vrn[j]);
+        simd_transpose_i32(vrn);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_32, rn_tail, nrem * sizeof(int));
+        }
+    }
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with single-precision random numbers, stream-major layout.
+ *
+ *  Same as get_rn_int_streams() but for float elements.
+ */
+inline int VLFG_ENGINE::get_rn_flt_streams(float * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    const int nblk = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    SIMD_FLT vrn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_32; k += SIMD_STREAMS_32) {
+        for (int j = 0; j < SIMD_STREAMS_32; ++j)
+            vrn[j] = vlfg_flt(next());
+        simd_transpose(vrn);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm]);
+    }
+
+    if (nrem > 0) {
+        float rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j)
+            vrn[j] = vlfg_flt(next());
+        for (int j = nrem; j < SIMD_STREAMS_32; ++j)
+            simd_set_zero(&vrn[j]);
+        simd_transpose(vrn);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_32, rn_tail, nrem * sizeof(float));
+        }
+    }
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers, stream-major layout.
+ *
+ *  Same as get_rn_int_streams() but for double elements, all streams are
+ *  generated (values of get_rn_dbl2_array()). Blocks are SIMD_STREAMS_64
+ *  steps, each half of the streams is transposed separately.
+ */
+inline int VLFG_ENGINE::get_rn_dbl_streams(double * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    const int nblk = nrn / SIMD_STREAMS_64;
+    const int nrem = nrn % SIMD_STREAMS_64;
+
+    // vrn[0] holds streams [0, SIMD_STREAMS_64), vrn[1] the remaining streams
+    SIMD_DBL vrn[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_64; k += SIMD_STREAMS_64) {
+        for (int j = 0; j < SIMD_STREAMS_64; ++j) {
+            const SIMD_INT x = next();
+            vrn[0][j] = vlfg_dbl(x);
+            vrn[1][j] = vlfg_dbl_hi(x);
+        }
+        simd_transpose(vrn[0]);
+        simd_transpose(vrn[1]);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm / SIMD_STREAMS_64][strm % SIMD_STREAMS_64]);
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j) {
+            const SIMD_INT x = next();
+            vrn[0][j] = vlfg_dbl(x);
+            vrn[1][j] = vlfg_dbl_hi(x);
+        }
+        for (int j = nrem; j < SIMD_STREAMS_64; ++j) {
+            simd_set_zero(&vrn[0][j]);
+            simd_set_zero(&vrn[1][j]);
+        }
+        simd_transpose(vrn[0]);
+        simd_transpose(vrn[1]);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm / SIMD_STREAMS_64][strm % SIMD_STREAMS_64]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_64, rn_tail, nrem * sizeof(double));
+        }
+    }
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Size in bytes of packed state of active streams.
+ */
+inline int VLFG_ENGINE::pack_size() const
+{ return lfg_pack_size(nstreams, lval); }
+
+
+/*!
+ *  \brief Pack state of active streams into caller buffer (see lfg_pack.h).
+ *
+ *  Rings are stored stream-major, the packed state of stream i is the same
+ *  as an LFG with the parameters of stream i.
+ *  Returns number of bytes written or -1 on error.
+ */
+inline int VLFG_ENGINE::pack_rng(void * const buffer, const int size) const
+{
+    const int nbytes = lfg_pack_check(buffer, size, nstreams, lval);
+    if (nbytes < 0)
+        return -1;
+
+    const LFG_PACK_VIEW pack = lfg_pack_view(buffer, nstreams, lval);
+    lfg_pack_header(pack.header, nstreams, per_lane, stream_position, stream_next, parameter, pos);
+    memcpy(pack.init_seed, init_seed, nstreams * sizeof(int32_t));
+
+    for (int strm = 0; strm < nstreams; ++strm) {
+        uint32_t * const r0 = pack.ring0 + strm * lval;
+        uint32_t * const r1 = pack.ring1 + strm * lval;
+        for (int j = 0; j < lval; ++j) {
+            r0[j] = ring0[j * SIMD_STREAMS_32 + strm];
+            r1[j] = ring1[j * SIMD_STREAMS_32 + strm];
+        }
+    }
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Restore state in place from packed state (see lfg_pack.h).
+ *
+ *  Packed streams become the active streams, at most SIMD_STREAMS_32,
+ *  rings of inactive streams are cleared.
+ *  Returns number of bytes read or -1 on error, state is not modified on error.
+ */
+inline int VLFG_ENGINE::unpack_rng(const void * const buffer, const int size)
+{
+    const int nstrms = lfg_unpack_check(buffer, size, SIMD_STREAMS_32, GLOBALS_LFG.VALID_L, GLOBALS_LFG.NPARAMS);
+    if (nstrms < 0)
+        return -1;
+
+    const LFG_PACK_HEADER * const header = (const LFG_PACK_HEADER *)buffer;
+    parameter = header->parameter;
+    lval = GLOBALS_LFG.VALID_L[parameter];
+    kval = GLOBALS_LFG.VALID_K[parameter];
+    stream_position = header->stream_position;
+    stream_next = header->stream_next;
+    per_lane = header->per_lane;
+    pos = header->pos;
+
+    masked = (nstrms < SIMD_STREAMS_32);
+    nstreams = nstrms;
+    strm_mask32 = simd_set_mask_32(nstrms);
+    strm_mask64[0] = simd_set_mask_64(nstrms);
+    strm_mask64[1] = simd_set_mask_64(nstrms - SIMD_STREAMS_64);
+
+    const LFG_PACK_VIEW pack = lfg_pack_view(buffer, nstrms, lval);
+    memset(init_seed, 0, sizeof(init_seed));
+    memcpy(init_seed, pack.init_seed, nstrms * sizeof(int32_t));
+
+    memset(ring0, 0, sizeof(ring0));
+    memset(ring1, 0, sizeof(ring1));
+    for (int strm = 0; strm < nstrms; ++strm) {
+        const uint32_t * const r0 = pack.ring0 + strm * lval;
+        const uint32_t * const r1 = pack.ring1 + strm * lval;
+        for (int j = 0; j < lval; ++j) {
+            ring0[j * SIMD_STREAMS_32 + strm] = r0[j];
+            ring1[j * SIMD_STREAMS_32 + strm] = r1[j];
+        }
+    }
+
+    return lfg_pack_size(nstrms, lval);
+}
+
+
+inline SIMD_INT VLFG_ENGINE::get_seed_rng() const
+{
+    const SIMD_INT va = simd_load(init_seed);
+    if (masked)
+        return simd_maskz_32(va, strm_mask32);
+    return va;
+}
+
+
+/*
+ *  VLFG has no prime, lags are returned instead (short lag as prime,
+ *  long lag as multiplier), seeds are the last words of the rings.
+ */
+#if defined(DEBUG)
+inline SIMD_INT VLFG_ENGINE::get_prime() const
+{ return simd_set(kval); }
+
+inline SIMD_INT VLFG_ENGINE::get_seed() const
+{
+    const SIMD_INT va = simd_load(ring0 + (lval - 1) * SIMD_STREAMS_32);
+    if (masked)
+        return simd_maskz_32(va, strm_mask32);
+    return va;
+}
+
+inline SIMD_INT VLFG_ENGINE::get_multiplier() const
+{ return simd_set(lval); }
+
+# if defined(LONG_SPRNG)
+inline SIMD_INT VLFG_ENGINE::get_seed2() const
+{
+    const SIMD_INT va = simd_load(ring1 + (lval - 1) * SIMD_STREAMS_32);
+    if (masked)
+        return simd_maskz_32(va, strm_mask32);
+    return va;
+}
+
+inline SIMD_INT VLFG_ENGINE::get_multiplier2() const
+{ return simd_set(kval); }
+# endif
+#endif
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VLFG_ENGINE_H
+
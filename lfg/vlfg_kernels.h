@@ -0,0 +1,95 @@
+#ifndef __VLFG_KERNELS_H
+#define __VLFG_KERNELS_H
+
+
+#include "simd.h"
+#if defined(SIMD_MODE)
+
+
+#include <stdint.h>
+#include "lfg_globals.h"
+
+
+/*
+ *  SIMD kernels for additive lagged Fibonacci generator
+ *
+ *  Rings are stored interleaved (stride SIMD_STREAMS_32, see lfg_fill.h), word j
+ *  of all streams is the aligned register at ring + j * SIMD_STREAMS_32.
+ *  Conversions use the combined word x = (ring0[j] & ~1) ^ (ring1[j] >> 1)
+ *  and are identical to LFG_ENGINE.
+ */
+
+
+/*!
+ *  \brief Replace ring with the next l words of all streams, as lfg_block().
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void vlfg_block(uint32_t * const a, const int lval, const int kval)
+{
+    uint32_t * const alag = a + (lval - kval) * SIMD_STREAMS_32;
+    for (int j = 0; j < kval * SIMD_STREAMS_32; j += SIMD_STREAMS_32)
+        simd_store(a + j, simd_add_i32(simd_load(a + j), simd_load(alag + j)));
+
+    const int koff = kval * SIMD_STREAMS_32;
+    for (int j = koff; j < lval * SIMD_STREAMS_32; j += SIMD_STREAMS_32)
+        simd_store(a + j, simd_add_i32(simd_load(a + j), simd_load(a + j - koff)));
+}
+
+
+/*!
+ *  \brief Combined word j of all streams.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT vlfg_word(const uint32_t * const r0, const uint32_t * const r1, const int j)
+{
+    const SIMD_INT vmsk = simd_set((int)~0x1);
+    return simd_xor(simd_and(simd_load(r0 + j * SIMD_STREAMS_32), vmsk), simd_srl_32(simd_load(r1 + j * SIMD_STREAMS_32), 0x1));
+}
+
+
+/*!
+ *  \brief The high 31-bits out of the 32-bits.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT vlfg_int(const SIMD_INT x)
+{ return simd_srl_32(x, 0x1); }
+
+
+/*!
+ *  \brief The high 24-bits out of the 32-bits scaled by 2^-24.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_FLT vlfg_flt(const SIMD_INT x)
+{
+    const SIMD_FLT vfac = simd_set((float)GLOBALS_LFG.TWO_M24);
+    return simd_mul(simd_cvt_i32_f32(simd_srl_32(x, 0x8)), vfac);
+}
+
+
+/*!
+ *  \brief The high 31-bits out of the 32-bits scaled by 2^-31, streams [0, SIMD_STREAMS_64).
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL vlfg_dbl(const SIMD_INT x)
+{
+    const SIMD_DBL vfac = simd_set(GLOBALS_LFG.TWO_M31);
+    return simd_mul(simd_cvt_i32_f64(simd_srl_32(x, 0x1)), vfac);
+}
+
+
+/*!
+ *  \brief Same as vlfg_dbl() for streams [SIMD_STREAMS_64, SIMD_STREAMS_32).
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL vlfg_dbl_hi(const SIMD_INT x)
+{
+    const SIMD_DBL vfac = simd_set(GLOBALS_LFG.TWO_M31);
+    return simd_mul(simd_cvt_i32_f64_hi(simd_srl_32(x, 0x1)), vfac);
+}
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VLFG_KERNELS_H
+
@@ -6,33 +6,37 @@
 
 
 #include "sprng.h"
-//#include "lfg.h"
+#include "lfg.h"
 #include "lcg.h"
-//#include "lcg64.h"
-//#include "cmrg.h"
-//#include "mlfg.h"
-//#include "pmlcg.h"
+#include "lcg64.h"
+#include "cmrg.h"
+#include "mlfg.h"
+#include "pmlcg.h"
 
 
 /*!
  *  Function used to create RNG instances.
+ *
+ *  NOTE: LFG and MLFG are seeded in the canonical form of SPRNG, but their
+ *  output has not been checked against SPRNG 5 reference data, streams may
+ *  differ from those of SPRNG LFG and MLFG.
+ *  CMRG does not initialize its MRG component as SPRNG does, it is not
+ *  created for SPRNG_CMRG (construct CMRG or VCMRG directly).
  */
 static SPRNG * selectType(const int typenum)
 {
     SPRNG *rng = NULL;
 
     switch (typenum) {
-        case SPRNG_LFG: //rng = new LFG();
+        case SPRNG_LFG: rng = new LFG();
             break;
         case SPRNG_LCG: rng = new LCG();
             break;
-        case SPRNG_LCG64: //rng = new LCG64();
+        case SPRNG_LCG64: rng = new LCG64();
             break;
-        case SPRNG_CMRG: //rng = new CMRG();
+        case SPRNG_MLFG: rng = new MLFG();
             break;
-        case SPRNG_MLFG: //rng = new MLFG();
-            break;
-        case SPRNG_PMLCG: //rng = new PMLCG();
+        case SPRNG_PMLCG: rng = new PMLCG();
             break;
     }
 
@@ -41,12 +45,14 @@ static SPRNG * selectType(const int typenum)
 
 
 #include "vsprng.h"
-//#include "vlfg.h"
+#include "vlfg.h"
 #include "vlcg.h"
-//#include "vlcg64.h"
-//#include "vcmrg.h"
-//#include "vmlfg.h"
-//#include "vpmlcg.h"
+#include "vlcg_ilp.h"
+#include "vlcg_dispatch.h"
+#include "vlcg64.h"
+#include "vcmrg.h"
+#include "vmlfg.h"
+#include "vpmlcg.h"
 
 
 #if defined(SIMD_MODE)
@@ -60,17 +66,15 @@ static VSPRNG * selectTypeSIMD(const int typenum)
     VSPRNG *rng = NULL;
 
     switch (typenum) {
-        case VSPRNG_LFG: //rng = new VLFG();
+        case VSPRNG_LFG: rng = new VLFG();
             break;
         case VSPRNG_LCG: rng = new VLCG();
             break;
-        case VSPRNG_LCG64: //rng = new VLCG64();
-            break;
-        case VSPRNG_CMRG: //rng = new VCMRG();
+        case VSPRNG_LCG64: rng = new VLCG64();
             break;
-        case VSPRNG_MLFG: //rng = new VMLFG();
+        case VSPRNG_MLFG: rng = new VMLFG();
             break;
-        case VSPRNG_PMLCG: //rng = new VPMLCG();
+        case VSPRNG_PMLCG: rng = new VPMLCG();
             break;
     }
 
@@ -0,0 +1,110 @@
+/*************************************************************************/
+/*************************************************************************/
+/*         Parallel Multiplicative Lagged Fibonacci Generator            */
+/*                                                                       */
+/* Note: The modulus is 2^64, all words are odd                          */
+/*************************************************************************/
+/*************************************************************************/
+
+
+#include "mlfg.h"
+#include "mlfg_globals.h"
+
+
+GEN_REGISTRY MLFG::MLFG_NGENS;
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+MLFG::MLFG()
+{
+    gentype = GLOBALS_MLFG.GENTYPE;
+    rng_type = SPRNG_MLFG;
+
+    MLFG_NGENS.add(1);
+}
+
+
+/*!
+ *  \brief Destructor
+ */
+MLFG::~MLFG()
+{
+    MLFG_NGENS.add(-1);
+}
+
+
+int MLFG::init_rng(int gn, int tg, int s, int m)
+{ return engine.init_rng(gn, tg, s, m); }
+
+
+int MLFG::pack_size() const
+{ return engine.pack_size(); }
+
+
+/*!
+ *  \brief Pack state into caller buffer, see MLFG_ENGINE::pack_rng().
+ */
+int MLFG::pack_rng(void * const buffer, const int size) const
+{ return engine.pack_rng(buffer, size); }
+
+
+/*!
+ *  \brief Restore state in place, see MLFG_ENGINE::unpack_rng().
+ */
+int MLFG::unpack_rng(const void * const buffer, const int size)
+{ return engine.unpack_rng(buffer, size); }
+
+
+int MLFG::get_rn_int()
+{ return engine.get_rn_int(); }
+
+
+float MLFG::get_rn_flt()
+{ return engine.get_rn_flt(); }
+
+
+double MLFG::get_rn_dbl()
+{ return engine.get_rn_dbl(); }
+
+
+int MLFG::get_seed_rng() const
+{ return engine.get_seed_rng(); }
+
+
+int MLFG::get_ngens() const
+{ return MLFG_NGENS.count(); }
+
+
+#if defined(DEBUG)
+int MLFG::get_prime() const
+{ return engine.get_prime(); }
+
+# if defined(LONG_SPRNG)
+unsigned long int MLFG::get_seed() const
+{ return engine.get_seed(); }
+
+unsigned long int MLFG::get_multiplier() const
+{ return engine.get_multiplier(); }
+
+# else
+int MLFG::get_seed() const
+{ return engine.get_seed(); }
+
+int MLFG::get_multiplier() const
+{ return engine.get_multiplier(); }
+# endif
+#endif
+
+
+/***********************************************************************************
+* SPRNG (c) 2016 by The University of Tennessee, Knoxville                         *
+*                                                                                  *
+* SPRNG is licensed under a                                                        *
+* Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License. *
+*                                                                                  *
+* You should have received a copy of the license along with this                   *
+* work. If not, see <http://creativecommons.org/licenses/by-nc-sa/4.0/>.           *
+************************************************************************************/
+
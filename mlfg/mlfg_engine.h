@@ -0,0 +1,228 @@
+#ifndef __MLFG_ENGINE_H
+#define __MLFG_ENGINE_H
+
+
+#include <stdio.h>
+#include <string.h>
+#include "mlfg_globals.h"
+#include "mlfg_fill.h"
+#include "mlfg_pack.h"
+
+
+/*! \class MLFG_ENGINE
+ *  \brief Header-only multiplicative lagged Fibonacci RNG.
+ *
+ *  Statically dispatched version of MLFG, x[n] = x[n-l] * x[n-k] (mod 2^64)
+ *  with odd words, numbers are produced in blocks of l words (see
+ *  mlfg_fill.h). The MLFG class is a thin adapter for the virtual SPRNG
+ *  interface.
+ *  Rings are seeded in the canonical form of SPRNG (see mlfg_fill.h).
+ *
+ *  Integers are the high 31-bits of the word, floating-point numbers are
+ *  the high 24 (float) or 53 (double) bits scaled exactly.
+ */
+class MLFG_ENGINE
+{
+  public:
+    MLFG_ENGINE();
+    int init_rng(int, int, int, int);
+    int get_rn_int();
+    float get_rn_flt();
+    double get_rn_dbl();
+    int get_seed_rng() const;
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    int get_prime() const;
+# if defined(LONG_SPRNG)
+    unsigned long int get_seed() const;
+    unsigned long int get_multiplier() const;
+# else
+    int get_seed() const;
+    int get_multiplier() const;
+# endif
+#endif
+
+  private:
+    int init_seed;
+    int stream_position;
+    int stream_next;
+    int parameter;
+    int lval;
+    int kval;
+    int pos;
+    unsigned long int ring[MLFG_MAX_LAG];
+
+    unsigned long int next();
+};
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+inline MLFG_ENGINE::MLFG_ENGINE()
+{
+    init_seed = 0;
+    stream_position = 0;
+    stream_next = 0;
+    parameter = 0;
+    lval = GLOBALS_MLFG.VALID_L[0];
+    kval = GLOBALS_MLFG.VALID_K[0];
+    pos = lval;
+    memset(ring, 0, sizeof(ring));
+}
+
+
+/*!
+ *  \brief Initialize RNG
+ *
+ *  Gives back one generator (node gennum) with updated spawning info.
+ *  Should be called total_gen times, with different value
+ *  of gennum in [0,total_gen) each call.
+ */
+inline int MLFG_ENGINE::init_rng(int gn, int tg, int s, int m)
+{
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+    stream_next = tg;
+
+    if (gn < 0 || gn >= tg) {
+        printf("ERROR: generator number is out of range, %d\n", gn);
+        return -1;
+    }
+    stream_position = gn;
+
+    if (m < 0 || m >= GLOBALS_MLFG.NPARAMS) {
+        printf("ERROR: multiplier out of range, %d\n", m);
+        m = 0;
+    }
+    parameter = m;
+    lval = GLOBALS_MLFG.VALID_L[parameter];
+    kval = GLOBALS_MLFG.VALID_K[parameter];
+
+    init_seed = s & 0x7FFFFFFF;
+    mlfg_fill(ring, 1, parameter, init_seed, stream_position);
+    for (int i = 0; i < GLOBALS_MLFG.RUNUP; ++i)
+        mlfg_block(ring, lval, kval);
+    pos = lval;
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Next word, a new block is generated every l words.
+ */
+inline unsigned long int MLFG_ENGINE::next()
+{
+    if (pos == lval) {
+        mlfg_block(ring, lval, kval);
+        pos = 0;
+    }
+
+    return ring[pos++];
+}
+
+
+/*!
+ *  The high 31-bits out of the 64-bits are returned.
+ */
+inline int MLFG_ENGINE::get_rn_int()
+{ return (int)(next() >> 0x21); }
+
+
+inline float MLFG_ENGINE::get_rn_flt()
+{ return (float)(int)(next() >> 0x28) * (float)GLOBALS_MLFG.TWO_M24; }
+
+
+inline double MLFG_ENGINE::get_rn_dbl()
+{ return (double)(next() >> 0xB) * GLOBALS_MLFG.TWO_M53; }
+
+
+/*!
+ *  \brief Size in bytes of packed state.
+ */
+inline int MLFG_ENGINE::pack_size() const
+{ return mlfg_pack_size(1, lval); }
+
+
+/*!
+ *  \brief Pack state into caller buffer (see mlfg_pack.h).
+ *
+ *  Returns number of bytes written or -1 on error.
+ */
+inline int MLFG_ENGINE::pack_rng(void * const buffer, const int size) const
+{
+    const int nbytes = mlfg_pack_check(buffer, size, 1, lval);
+    if (nbytes < 0)
+        return -1;
+
+    const MLFG_PACK_VIEW pack = mlfg_pack_view(buffer, 1);
+    mlfg_pack_header(pack.header, 1, 0, stream_position, stream_next, parameter, pos);
+    pack.init_seed[0] = init_seed;
+    memcpy(pack.ring, ring, lval * sizeof(uint64_t));
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Restore state in place from packed state (see mlfg_pack.h).
+ *
+ *  Returns number of bytes read or -1 on error, state is not modified on error.
+ */
+inline int MLFG_ENGINE::unpack_rng(const void * const buffer, const int size)
+{
+    if (mlfg_unpack_check(buffer, size, 1, GLOBALS_MLFG.VALID_L, GLOBALS_MLFG.NPARAMS) < 0)
+        return -1;
+
+    const MLFG_PACK_HEADER * const header = (const MLFG_PACK_HEADER *)buffer;
+    parameter = header->parameter;
+    lval = GLOBALS_MLFG.VALID_L[parameter];
+    kval = GLOBALS_MLFG.VALID_K[parameter];
+
+    const MLFG_PACK_VIEW pack = mlfg_pack_view(buffer, 1);
+    stream_position = header->stream_position;
+    stream_next = header->stream_next;
+    pos = header->pos;
+    init_seed = pack.init_seed[0];
+    memcpy(ring, pack.ring, lval * sizeof(uint64_t));
+
+    return mlfg_pack_size(1, lval);
+}
+
+
+inline int MLFG_ENGINE::get_seed_rng() const
+{ return init_seed; }
+
+
+/*
+ *  MLFG has no prime, lags are returned instead (short lag as prime,
+ *  long lag as multiplier), seed is the last word of the ring.
+ */
+#if defined(DEBUG)
+inline int MLFG_ENGINE::get_prime() const
+{ return kval; }
+
+# if defined(LONG_SPRNG)
+inline unsigned long int MLFG_ENGINE::get_seed() const
+{ return ring[lval - 1]; }
+
+inline unsigned long int MLFG_ENGINE::get_multiplier() const
+{ return lval; }
+
+# else
+inline int MLFG_ENGINE::get_seed() const
+{ return (int)(ring[lval - 1] >> 0x21); }
+
+inline int MLFG_ENGINE::get_multiplier() const
+{ return lval; }
+# endif
+#endif
+
+
+#endif  // __MLFG_ENGINE_H
+
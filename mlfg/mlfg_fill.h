@@ -0,0 +1,70 @@
+#ifndef __MLFG_FILL_H
+#define __MLFG_FILL_H
+
+
+#include <stdint.h>  // fixed width integers
+#include "mlfg_globals.h"
+#include "lfg_fill.h"
+
+
+/*
+ *  Ring buffers of multiplicative lagged Fibonacci generators.
+ *
+ *  A ring holds the last l words of a stream, oldest first, with the words
+ *  of a stream spaced stride elements apart. MLFG uses stride 1, VMLFG
+ *  stores SIMD_STREAMS_32 streams interleaved (stride SIMD_STREAMS_32), so
+ *  word j of all streams is 2 consecutive registers. Scalar functions are
+ *  shared by MLFG and VMLFG (applied per lane).
+ */
+
+
+/*!
+ *  \brief Fill ring of a stream from seed and generator number.
+ *
+ *  Words are 3^e (mod 2^64), the ring of exponents e is filled in the
+ *  canonical form of the additive LFG (lfg_fill_ring()) for node number gn.
+ *  Words of a multiplicative LFG are (-1)^s * 3^e with e following the
+ *  additive recurrence (mod 2^62), the sign s is kept zero. All words are
+ *  odd and the lowest bits of the exponents are a nonzero sequence, so that
+ *  the period is maximal (2^61 * (2^l - 1)). Ring has to be run up by RUNUP
+ *  blocks before use.
+ */
+inline static void mlfg_fill(unsigned long int * const r, const int stride, const int m, const int s, const int gn)
+{
+    const int lval = GLOBALS_MLFG.VALID_L[m];
+    const uint32_t gseed = (uint32_t)(s & 0x7FFFFFFF) ^ GLOBALS_MLFG.GS0;
+
+    uint32_t node[2];
+    node[0] = (uint32_t)gn & 0x7FFFFFFFU;
+    node[1] = (uint32_t)gn >> 31;
+
+    uint32_t e[MLFG_MAX_LAG];
+    lfg_fill_ring(e, 1, lval, GLOBALS_MLFG.VALID_FIRST[m], gseed, node);
+
+    for (int j = 0; j < lval; ++j) {
+        unsigned long int w = 1, p = 3;
+        for (uint32_t k = e[j]; k; k >>= 1) {
+            if (k & 0x1U)
+                w *= p;
+            p *= p;
+        }
+        r[j * stride] = w;
+    }
+}
+
+
+/*!
+ *  \brief Replace ring with the next l words, x[n] = x[n-l] * x[n-k] (mod 2^64).
+ *
+ *  Words are updated in place, ring is again oldest first.
+ */
+inline static void mlfg_block(unsigned long int * const a, const int lval, const int kval)
+{
+    for (int j = 0; j < kval; ++j)
+        a[j] *= a[j + lval - kval];
+    for (int j = kval; j < lval; ++j)
+        a[j] *= a[j - kval];
+}
+
+
+#endif  // __MLFG_FILL_H
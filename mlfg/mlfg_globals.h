@@ -0,0 +1,58 @@
+#ifndef __MLFG_GLOBALS_H
+#define __MLFG_GLOBALS_H
+
+
+// Provides access to alignment attributes required for SIMD mode.
+// Misalignment may cause segmentation faults.
+#include "simd.h"
+
+
+/*!
+ *  Longest lag, size of ring buffer of a stream
+ */
+#define MLFG_MAX_LAG 1279
+
+
+/*!
+ *  Global parameters for MLFG
+ *  Words are 64-bit, an unsigned long int of 64 bits is required (LP64)
+ *  independently of LONG_SPRNG. Parameter m selects lags (VALID_L[m],
+ *  VALID_K[m]), default is the shortest lag. Rings are powers of 3 with
+ *  exponents in the canonical form of SPRNG (see mlfg_fill.h): the lowest
+ *  bit of exponent VALID_FIRST[m] is set, the shift register of the fill
+ *  starts from gennum ^ seed ^ GS0, and RUNUP blocks of l words are
+ *  discarded.
+ */
+struct MLFG_GLOBALS
+{
+    const char * GENTYPE;
+    int NPARAMS;
+    int VALID_L[11];
+    int VALID_K[11];
+    int VALID_FIRST[11];
+    unsigned int GS0;
+    int RUNUP;
+    double TWO_M24;
+    double TWO_M31;
+    double TWO_M53;
+} __SIMD_ALIGN__;
+
+
+/*!
+ *  Global instance of configuration structure.
+ */
+const MLFG_GLOBALS GLOBALS_MLFG __SIMD_ALIGN__ = {
+    "Multiplicative Lagged Fibonacci Generator",
+    11,
+    {17, 31, 55, 63, 127, 521, 521, 607, 607, 1279, 1279},
+    {5, 6, 24, 31, 97, 353, 168, 334, 273, 418, 861},
+    {10, 2, 11, 14, 21, 100, 83, 166, 105, 208, 233},
+    0x372F05ACU,
+    64,
+    5.96046447753906234e-8,
+    4.656612873077392578125e-10,
+    1.1102230246251565404e-16
+};
+
+
+#endif  // __MLFG_GLOBALS_H
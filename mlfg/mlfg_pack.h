@@ -0,0 +1,146 @@
+#ifndef __MLFG_PACK_H
+#define __MLFG_PACK_H
+
+
+#include <stdio.h>   // printf
+#include <stdint.h>  // fixed width integers
+#include <string.h>  // memset
+#include "sprng.h"   // SPRNG_MLFG
+#include "pack.h"
+
+
+/*
+ *  Checkpoint format of MLFG and VMLFG (packed state), version 1.
+ *
+ *  Fixed layout in host byte order, independent of SIMD mode and LONG_SPRNG:
+ *
+ *    MLFG_PACK_HEADER           32 bytes
+ *    int32_t init_seed[n]
+ *    (4 bytes of padding if n is odd)
+ *    uint64_t ring[n][l]        oldest word first
+ *
+ *  for n streams with lag l (from parameter), padded with zeros to a
+ *  multiple of 8 bytes. Buffers have to be 8-byte aligned, packed
+ *  generators can be placed back to back. An MLFG and a VMLFG with a single
+ *  active stream use the same packed state.
+ */
+const uint32_t MLFG_PACK_MAGIC = 0x464C4D53U;  /*!< "SMLF" */
+const uint16_t MLFG_PACK_VERSION = 1;
+
+
+struct MLFG_PACK_HEADER
+{
+    PACK_HEADER base;
+    int32_t per_lane;  /*!< streams use generator numbers stream_position + i */
+    int32_t stream_position;
+    int32_t stream_next;
+    int32_t parameter;  /*!< lags index, same for all streams */
+    int32_t pos;  /*!< words of rings already returned */
+};
+
+
+/*!
+ *  Arrays of packed state of n streams.
+ */
+struct MLFG_PACK_VIEW
+{
+    MLFG_PACK_HEADER *header;
+    int32_t *init_seed;
+    uint64_t *ring;
+};
+
+
+/*!
+ *  \brief Size in bytes of packed state of n streams with lag l.
+ */
+inline static int mlfg_pack_size(const int n, const int lval)
+{
+    return pack_align((int)sizeof(MLFG_PACK_HEADER) + ((n + 1) & ~1) * (int)sizeof(int32_t) + n * lval * (int)sizeof(uint64_t));
+}
+
+
+/*!
+ *  \brief Arrays of packed state of n streams in buffer.
+ */
+inline static MLFG_PACK_VIEW mlfg_pack_view(const void * const buffer, const int n)
+{
+    MLFG_PACK_VIEW view;
+    view.header = (MLFG_PACK_HEADER *)buffer;
+    view.init_seed = (int32_t *)(view.header + 1);
+    view.ring = (uint64_t *)(view.init_seed + ((n + 1) & ~1));
+    return view;
+}
+
+
+/*!
+ *  \brief Check buffer for packing n streams with lag l, clears padding.
+ *
+ *  Returns packed size or -1 on error.
+ */
+inline static int mlfg_pack_check(void * const buffer, const int size, const int n, const int lval)
+{
+    const int nbytes = pack_check(buffer, size, mlfg_pack_size(n, lval));
+    if (nbytes < 0)
+        return -1;
+
+    if (n & 0x1)
+        memset((char *)buffer + sizeof(MLFG_PACK_HEADER) + n * sizeof(int32_t), 0, sizeof(int32_t));
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Check header of packed state with at most max_streams streams.
+ *
+ *  Lags are VALID_L/VALID_K of the packed parameter, nparams entries.
+ *  Words of all rings have to be odd.
+ *  Returns number of streams or -1 on error.
+ */
+inline static int mlfg_unpack_check(const void * const buffer, const int size, const int max_streams, const int * const valid_l, const int nparams)
+{
+    const int n = pack_check_header(buffer, size, MLFG_PACK_MAGIC, MLFG_PACK_VERSION, SPRNG_MLFG, max_streams, (int)sizeof(MLFG_PACK_HEADER));
+    if (n < 0)
+        return -1;
+
+    const MLFG_PACK_HEADER * const header = (const MLFG_PACK_HEADER *)buffer;
+    if (header->parameter < 0 || header->parameter >= nparams) {
+        printf("ERROR: Unpacked parameters not acceptable.\n");
+        return -1;
+    }
+    const int lval = valid_l[header->parameter];
+    if (header->pos < 0 || header->pos > lval) {
+        printf("ERROR: Unpacked parameters not acceptable.\n");
+        return -1;
+    }
+    if (pack_check_size(size, mlfg_pack_size(n, lval)) < 0)
+        return -1;
+
+    const MLFG_PACK_VIEW pack = mlfg_pack_view(buffer, n);
+    for (int j = 0; j < n * lval; ++j) {
+        if (!(pack.ring[j] & 0x1)) {
+            printf("ERROR: Unpacked parameters not acceptable.\n");
+            return -1;
+        }
+    }
+
+    return n;
+}
+
+
+/*!
+ *  \brief Fill header of packed state.
+ */
+inline static void mlfg_pack_header(MLFG_PACK_HEADER * const header, const int n, const int per_lane, const int stream_position, const int stream_next, const int parameter, const int pos)
+{
+    pack_header(&header->base, MLFG_PACK_MAGIC, MLFG_PACK_VERSION, SPRNG_MLFG, n);
+    header->per_lane = per_lane;
+    header->stream_position = stream_position;
+    header->stream_next = stream_next;
+    header->parameter = parameter;
+    header->pos = pos;
+}
+
+
+#endif  // __MLFG_PACK_H
+
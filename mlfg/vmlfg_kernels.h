@@ -0,0 +1,121 @@
+#ifndef __VMLFG_KERNELS_H
+#define __VMLFG_KERNELS_H
+
+
+#include "simd.h"
+#if defined(SIMD_MODE)
+
+
+#include "mlfg_globals.h"
+
+
+/*
+ *  SIMD kernels for multiplicative lagged Fibonacci generator
+ *
+ *  Rings are stored interleaved (stride SIMD_STREAMS_32, see mlfg_fill.h),
+ *  word j of all streams is 2 aligned registers of 64-bit elements at
+ *  ring + j * SIMD_STREAMS_32, register 0 holds streams [0, SIMD_STREAMS_64)
+ *  and register 1 streams [SIMD_STREAMS_64, SIMD_STREAMS_32), as in
+ *  vlcg64_kernels.h. Conversions are identical to MLFG_ENGINE.
+ */
+
+
+/*!
+ *  \brief Replace ring with the next l words of all streams, as mlfg_block().
+ *
+ *  Multiplies of a block are independent within each loop, so they
+ *  pipeline instead of waiting on the latency of the previous word.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void vmlfg_block(unsigned long int * const a, const int lval, const int kval)
+{
+    unsigned long int * const alag = a + (lval - kval) * SIMD_STREAMS_32;
+    for (int j = 0; j < kval * SIMD_STREAMS_32; j += SIMD_STREAMS_64)
+        simd_store(a + j, simd_mul_u64(simd_load(a + j), simd_load(alag + j)));
+
+    const int koff = kval * SIMD_STREAMS_32;
+    for (int j = koff; j < lval * SIMD_STREAMS_32; j += SIMD_STREAMS_64)
+        simd_store(a + j, simd_mul_u64(simd_load(a + j), simd_load(a + j - koff)));
+}
+
+
+/*!
+ *  \brief The high 31-bits out of the 64-bits of word j of all streams.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT vmlfg_int(const unsigned long int * const r, const int j)
+{
+    const unsigned long int * const w = r + j * SIMD_STREAMS_32;
+    return simd_packmerge_i32(simd_srl_64(simd_load(w), 0x21),
+                              simd_srl_64(simd_load(w + SIMD_STREAMS_64), 0x21));
+}
+
+
+/*!
+ *  \brief The high 24-bits out of the 64-bits of word j of all streams scaled by 2^-24.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_FLT vmlfg_flt(const unsigned long int * const r, const int j)
+{
+    const SIMD_FLT vfac = simd_set((float)GLOBALS_MLFG.TWO_M24);
+    const unsigned long int * const w = r + j * SIMD_STREAMS_32;
+    const SIMD_INT vrn = simd_packmerge_i32(simd_srl_64(simd_load(w), 0x28),
+                                            simd_srl_64(simd_load(w + SIMD_STREAMS_64), 0x28));
+    return simd_mul(simd_cvt_i32_f32(vrn), vfac);
+}
+
+
+/*!
+ *  \brief The high 53-bits out of the 64-bits of word j scaled by 2^-53, streams [0, SIMD_STREAMS_64).
+ *
+ *  Sum of the high 31-bits and the next 22-bits, as vlcg64_next_dbl().
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL vmlfg_dbl(const unsigned long int * const r, const int j)
+{
+    const SIMD_DBL vfac[2] __SIMD_ALIGN__ = { simd_set(GLOBALS_MLFG.TWO_M31),
+                                              simd_set(GLOBALS_MLFG.TWO_M53) };
+    const SIMD_INT vmsk_lsb22 = simd_set(0x3FFFFFUL);
+    const SIMD_INT w = simd_load(r + j * SIMD_STREAMS_32);
+
+    // High parts in low half, low parts in high half
+    const SIMD_INT vrn = simd_packmerge_i32(simd_srl_64(w, 0x21),
+                                            simd_and(simd_srl_64(w, 0xB), vmsk_lsb22));
+    const SIMD_DBL vhi = simd_mul(simd_cvt_i32_f64(vrn), vfac[0]);
+    return simd_fmadd(simd_cvt_i32_f64_hi(vrn), vfac[1], vhi);
+}
+
+
+/*!
+ *  \brief Double-precision random numbers of word j of all streams.
+ *
+ *  rn[0] holds streams [0, SIMD_STREAMS_64), identical to vmlfg_dbl(),
+ *  rn[1] holds streams [SIMD_STREAMS_64, SIMD_STREAMS_32).
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void vmlfg_dbl2(SIMD_DBL * const rn, const unsigned long int * const r, const int j)
+{
+    const SIMD_DBL vfac[2] __SIMD_ALIGN__ = { simd_set(GLOBALS_MLFG.TWO_M31),
+                                              simd_set(GLOBALS_MLFG.TWO_M53) };
+    const SIMD_INT vmsk_lsb22 = simd_set(0x3FFFFFUL);
+    const unsigned long int * const w = r + j * SIMD_STREAMS_32;
+    const SIMD_INT w0 = simd_load(w);
+    const SIMD_INT w1 = simd_load(w + SIMD_STREAMS_64);
+    SIMD_INT vtmp[2] __SIMD_ALIGN__;
+
+    // High and low parts of all streams
+    vtmp[0] = simd_packmerge_i32(simd_srl_64(w0, 0x21), simd_srl_64(w1, 0x21));
+    vtmp[1] = simd_packmerge_i32(simd_and(simd_srl_64(w0, 0xB), vmsk_lsb22),
+                                 simd_and(simd_srl_64(w1, 0xB), vmsk_lsb22));
+
+    rn[0] = simd_mul(simd_cvt_i32_f64(vtmp[0]), vfac[0]);
+    rn[1] = simd_mul(simd_cvt_i32_f64_hi(vtmp[0]), vfac[0]);
+    rn[0] = simd_fmadd(simd_cvt_i32_f64(vtmp[1]), vfac[1], rn[0]);
+    rn[1] = simd_fmadd(simd_cvt_i32_f64_hi(vtmp[1]), vfac[1], rn[1]);
+}
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VMLFG_KERNELS_H
@@ -0,0 +1,114 @@
+/*************************************************************************/
+/*************************************************************************/
+/*          Parallel Prime Modulus Linear Congruential Generator         */
+/*                                                                       */
+/* Note: The modulus is the Mersenne prime 2^61 - 1                      */
+/*************************************************************************/
+/*************************************************************************/
+
+
+#include "pmlcg.h"
+#include "pmlcg_globals.h"
+
+
+GEN_REGISTRY PMLCG::PMLCG_NGENS;
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+PMLCG::PMLCG()
+{
+    gentype = GLOBALS_PMLCG.GENTYPE;
+    rng_type = SPRNG_PMLCG;
+
+    PMLCG_NGENS.add(1);
+}
+
+
+/*!
+ *  \brief Destructor
+ */
+PMLCG::~PMLCG()
+{
+    PMLCG_NGENS.add(-1);
+}
+
+
+int PMLCG::init_rng(int gn, int tg, int s, int m)
+{ return engine.init_rng(gn, tg, s, m); }
+
+
+int PMLCG::advance(const long int n)
+{ return engine.advance(n); }
+
+
+int PMLCG::pack_size() const
+{ return engine.pack_size(); }
+
+
+/*!
+ *  \brief Pack state into caller buffer, see PMLCG_ENGINE::pack_rng().
+ */
+int PMLCG::pack_rng(void * const buffer, const int size) const
+{ return engine.pack_rng(buffer, size); }
+
+
+/*!
+ *  \brief Restore state in place, see PMLCG_ENGINE::unpack_rng().
+ */
+int PMLCG::unpack_rng(const void * const buffer, const int size)
+{ return engine.unpack_rng(buffer, size); }
+
+
+int PMLCG::get_rn_int()
+{ return engine.get_rn_int(); }
+
+
+float PMLCG::get_rn_flt()
+{ return engine.get_rn_flt(); }
+
+
+double PMLCG::get_rn_dbl()
+{ return engine.get_rn_dbl(); }
+
+
+int PMLCG::get_seed_rng() const
+{ return engine.get_seed_rng(); }
+
+
+int PMLCG::get_ngens() const
+{ return PMLCG_NGENS.count(); }
+
+
+#if defined(DEBUG)
+int PMLCG::get_prime() const
+{ return engine.get_prime(); }
+
+# if defined(LONG_SPRNG)
+unsigned long int PMLCG::get_seed() const
+{ return engine.get_seed(); }
+
+unsigned long int PMLCG::get_multiplier() const
+{ return engine.get_multiplier(); }
+
+# else
+int PMLCG::get_seed() const
+{ return engine.get_seed(); }
+
+int PMLCG::get_multiplier() const
+{ return engine.get_multiplier(); }
+# endif
+#endif
+
+
+/***********************************************************************************
+* SPRNG (c) 2014 by Florida State University                                       *
+*                                                                                  *
+* SPRNG is licensed under a                                                        *
+* Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License. *
+*                                                                                  *
+* You should have received a copy of the license along with this                   *
+* work. If not, see <http://creativecommons.org/licenses/by-nc-sa/4.0/>.           *
+************************************************************************************/
+
@@ -0,0 +1,52 @@
+#ifndef __PMLCG_H
+#define __PMLCG_H
+
+
+#include "sprng.h"
+#include "pmlcg_engine.h"
+#include "registry.h"
+
+
+/*! \class PMLCG
+ *  \brief Class for prime modulus linear congruential RNG.
+ *
+ *  Adapter of PMLCG_ENGINE for the virtual SPRNG interface.
+ */
+class PMLCG: public SPRNG
+{
+    // Number of generators, per-thread counts
+    static GEN_REGISTRY PMLCG_NGENS;
+
+  public:
+    PMLCG();
+    ~PMLCG();
+    int init_rng(int, int, int, int);
+    int get_rn_int();
+    float get_rn_flt();
+    double get_rn_dbl();
+    int get_seed_rng() const;
+    int get_ngens() const;
+    int advance(const long int);
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    int get_prime() const;
+# if defined(LONG_SPRNG)
+    unsigned long int get_seed() const;
+    unsigned long int get_multiplier() const;
+# else
+    int get_seed() const;
+    int get_multiplier() const;
+# endif
+#endif
+
+  private:
+    const char *gentype;
+    int rng_type;
+    PMLCG_ENGINE engine;
+};
+
+
+#endif  // __PMLCG_H
+
@@ -0,0 +1,228 @@
+#ifndef __PMLCG_ENGINE_H
+#define __PMLCG_ENGINE_H
+
+
+#include <stdio.h>
+#include "pmlcg_globals.h"
+#include "pmlcg_mod.h"
+#include "pmlcg_pack.h"
+
+
+/*! \class PMLCG_ENGINE
+ *  \brief Header-only prime modulus linear congruential RNG.
+ *
+ *  Statically dispatched version of PMLCG, x = a * x (mod 2^61 - 1), with
+ *  one primitive root multiplier per generator number (see pmlcg_mod.h).
+ *  The PMLCG class is a thin adapter for the virtual SPRNG interface.
+ *
+ *  Integers are the high 31-bits of the 61-bit state, floating-point
+ *  numbers are the high 24 (float) or 53 (double) bits scaled exactly.
+ */
+class PMLCG_ENGINE
+{
+  public:
+    PMLCG_ENGINE();
+    int init_rng(int, int, int, int);
+    int get_rn_int();
+    float get_rn_flt();
+    double get_rn_dbl();
+    int get_seed_rng() const;
+    int advance(const long int);
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    int get_prime() const;
+# if defined(LONG_SPRNG)
+    unsigned long int get_seed() const;
+    unsigned long int get_multiplier() const;
+# else
+    int get_seed() const;
+    int get_multiplier() const;
+# endif
+#endif
+
+  private:
+    int init_seed;
+    int stream_position;
+    int stream_next;
+    int parameter;
+    unsigned long int seed;
+    unsigned long int multiplier;
+};
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+inline PMLCG_ENGINE::PMLCG_ENGINE()
+{
+    init_seed = 0;
+    stream_position = 0;
+    stream_next = 0;
+    parameter = 0;
+    seed = 0;
+    multiplier = 0;
+}
+
+
+/*!
+ *  \brief Initialize RNG
+ *
+ *  Gives back one generator (node gennum) with updated spawning info.
+ *  Should be called total_gen times, with different value
+ *  of gennum in [0,total_gen) each call.
+ */
+inline int PMLCG_ENGINE::init_rng(int gn, int tg, int s, int m)
+{
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+    stream_next = tg;
+
+    if (gn < 0 || gn >= tg) {
+        printf("ERROR: generator number is out of range, %d\n", gn);
+        return -1;
+    }
+    stream_position = gn;
+
+    if (m < 0 || m >= GLOBALS_PMLCG.NPARAMS) {
+        printf("ERROR: multiplier out of range, %d\n", m);
+        m = 0;
+    }
+    parameter = m;
+
+    init_seed = s & 0x7FFFFFFF;
+    multiplier = pmlcg_multiplier(stream_position);
+    seed = pmlcg_seed(init_seed);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Advance stream n steps in O(log n) operations.
+ *
+ *  Equivalent to calling get_rn_dbl() n times.
+ */
+inline int PMLCG_ENGINE::advance(const long int n)
+{
+    if (n < 0) {
+        printf("ERROR: number of steps to advance is out of range, %ld\n", n);
+        return -1;
+    }
+
+    seed = pmlcg_mulmod(seed, pmlcg_powmod(multiplier, n));
+
+    return 0;
+}
+
+
+/*!
+ *  The high 31-bits out of the 61-bits are returned.
+ */
+inline int PMLCG_ENGINE::get_rn_int()
+{
+    seed = pmlcg_mulmod(seed, multiplier);
+
+    return (int)(seed >> 0x1E);
+}
+
+
+inline float PMLCG_ENGINE::get_rn_flt()
+{
+    seed = pmlcg_mulmod(seed, multiplier);
+
+    return (float)(int)(seed >> 0x25) * (float)GLOBALS_PMLCG.TWO_M24;
+}
+
+
+inline double PMLCG_ENGINE::get_rn_dbl()
+{
+    seed = pmlcg_mulmod(seed, multiplier);
+
+    return (double)(seed >> 0x8) * GLOBALS_PMLCG.TWO_M53;
+}
+
+
+/*!
+ *  \brief Size in bytes of packed state.
+ */
+inline int PMLCG_ENGINE::pack_size() const
+{ return pmlcg_pack_size(1); }
+
+
+/*!
+ *  \brief Pack state into caller buffer (see pmlcg_pack.h).
+ *
+ *  Returns number of bytes written or -1 on error.
+ */
+inline int PMLCG_ENGINE::pack_rng(void * const buffer, const int size) const
+{
+    const int nbytes = pmlcg_pack_check(buffer, size, 1);
+    if (nbytes < 0)
+        return -1;
+
+    const PMLCG_PACK_VIEW pack = pmlcg_pack_view(buffer, 1);
+    pmlcg_pack_header(pack.header, 1, 0, stream_position, stream_next);
+    pack.seed[0] = seed;
+    pack.multiplier[0] = multiplier;
+    pack.init_seed[0] = init_seed;
+    pack.parameter[0] = parameter;
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Restore state in place from packed state (see pmlcg_pack.h).
+ *
+ *  Returns number of bytes read or -1 on error, state is not modified on error.
+ */
+inline int PMLCG_ENGINE::unpack_rng(const void * const buffer, const int size)
+{
+    if (pmlcg_unpack_check(buffer, size, 1) < 0)
+        return -1;
+
+    const PMLCG_PACK_VIEW pack = pmlcg_pack_view(buffer, 1);
+    stream_position = pack.header->stream_position;
+    stream_next = pack.header->stream_next;
+    init_seed = pack.init_seed[0];
+    parameter = pack.parameter[0];
+    multiplier = pack.multiplier[0];
+    seed = pack.seed[0];
+
+    return pmlcg_pack_size(1);
+}
+
+
+inline int PMLCG_ENGINE::get_seed_rng() const
+{ return init_seed; }
+
+
+/*
+ *  PMLCG has no prime addend, zero is returned instead.
+ */
+#if defined(DEBUG)
+inline int PMLCG_ENGINE::get_prime() const
+{ return 0; }
+
+# if defined(LONG_SPRNG)
+inline unsigned long int PMLCG_ENGINE::get_seed() const
+{ return seed; }
+
+inline unsigned long int PMLCG_ENGINE::get_multiplier() const
+{ return multiplier; }
+
+# else
+inline int PMLCG_ENGINE::get_seed() const
+{ return (int)(seed >> 0x1E); }
+
+inline int PMLCG_ENGINE::get_multiplier() const
+{ return (int)(multiplier >> 0x1E); }
+# endif
+#endif
+
+
+#endif  // __PMLCG_ENGINE_H
@@ -0,0 +1,54 @@
+#ifndef __PMLCG_GLOBALS_H
+#define __PMLCG_GLOBALS_H
+
+
+// Provides access to alignment attributes required for SIMD mode.
+// Misalignment may cause segmentation faults.
+#include "simd.h"
+
+
+/*!
+ *  Number of distinct prime factors of 2^61 - 2
+ */
+#define PMLCG_NFACTORS 12
+
+
+/*!
+ *  Global parameters for PMLCG
+ *  Seeds and multipliers are 61-bit, an unsigned long int of 64 bits is
+ *  required (LP64) independently of LONG_SPRNG. Multiplier of generator
+ *  number gn is PRIM_ROOT^e (mod 2^61 - 1), e is the (gn + 1)-th integer
+ *  relatively prime to 2^61 - 2 (FACTORS), so all multipliers are
+ *  primitive roots and streams are full period.
+ */
+struct PMLCG_GLOBALS
+{
+    const char * GENTYPE;
+    int NPARAMS;
+    unsigned long int INIT_SEED;
+    unsigned long int MOD;
+    unsigned long int PRIM_ROOT;
+    unsigned long int FACTORS[PMLCG_NFACTORS];
+    double TWO_M24;
+    double TWO_M31;
+    double TWO_M53;
+} __SIMD_ALIGN__;
+
+
+/*!
+ *  Global instance of configuration structure.
+ */
+const PMLCG_GLOBALS GLOBALS_PMLCG __SIMD_ALIGN__ = {
+    "Prime Modulus Linear Congruential Generator",
+    1,
+    0x2BC6FFFF8CFE166DUL,
+    0x1FFFFFFFFFFFFFFFUL,
+    37UL,
+    {2UL, 3UL, 5UL, 7UL, 11UL, 13UL, 31UL, 41UL, 61UL, 151UL, 331UL, 1321UL},
+    5.96046447753906234e-8,
+    4.656612873077392578125e-10,
+    1.1102230246251565404e-16
+};
+
+
+#endif  // __PMLCG_GLOBALS_H
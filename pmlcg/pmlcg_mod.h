@@ -0,0 +1,109 @@
+#ifndef __PMLCG_MOD_H
+#define __PMLCG_MOD_H
+
+
+#include "pmlcg_globals.h"
+
+
+/*
+ *  Arithmetic modulo the Mersenne prime M = 2^61 - 1.
+ *
+ *  Since 2^61 = 1 (mod M), a value is reduced by adding its bits above 61
+ *  to its low 61 bits. Scalar functions are shared by PMLCG and VPMLCG
+ *  (applied per lane), the SIMD multiply-reduce is in vpmlcg_kernels.h.
+ */
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 pmlcg_uint128;
+#endif
+
+
+/*!
+ *  \brief Final reduction of t in [0, 2M], returns t (mod M).
+ */
+inline static unsigned long int pmlcg_fold(const unsigned long int t)
+{ return (t + ((t + 1) >> 61)) & GLOBALS_PMLCG.MOD; }
+
+
+/*!
+ *  \brief Multiply modulo 2^61 - 1, a and b in [0, M).
+ *
+ *  Uses a 128-bit product if the compiler supports it, otherwise the same
+ *  32x32 -> 64 partial products as the SIMD kernel. Results are identical.
+ */
+inline static unsigned long int pmlcg_mulmod(const unsigned long int a, const unsigned long int b)
+{
+#if defined(__SIZEOF_INT128__)
+    const pmlcg_uint128 p = (pmlcg_uint128)a * b;
+    return pmlcg_fold(((unsigned long int)p & GLOBALS_PMLCG.MOD) + (unsigned long int)(p >> 61));
+#else
+    const unsigned long int a0 = a & 0xFFFFFFFFUL, a1 = a >> 32;
+    const unsigned long int b0 = b & 0xFFFFFFFFUL, b1 = b >> 32;
+    const unsigned long int lo = a0 * b0;
+    const unsigned long int mid = a1 * b0 + a0 * b1;
+    const unsigned long int t = (lo & GLOBALS_PMLCG.MOD) + (lo >> 61) + ((mid << 32) & GLOBALS_PMLCG.MOD) + (mid >> 29) + ((a1 * b1) << 3);
+    return pmlcg_fold((t & GLOBALS_PMLCG.MOD) + (t >> 61));
+#endif
+}
+
+
+/*!
+ *  \brief Compute a^n (mod 2^61 - 1) in O(log n) multiplies.
+ */
+inline static unsigned long int pmlcg_powmod(unsigned long int a, long int n)
+{
+    unsigned long int r = 0x1UL;
+    while (n > 0) {
+        if (n & 0x1L)
+            r = pmlcg_mulmod(r, a);
+        a = pmlcg_mulmod(a, a);
+        n >>= 1;
+    }
+    return r;
+}
+
+
+/*!
+ *  \brief Number of integers in [1, n] not divisible by FACTORS[i], ..., FACTORS[PMLCG_NFACTORS - 1].
+ */
+inline static unsigned long int pmlcg_coprime_count(const unsigned long int n, const int i)
+{
+    if (i == PMLCG_NFACTORS || n == 0)
+        return n;
+    return pmlcg_coprime_count(n, i + 1) - pmlcg_coprime_count(n / GLOBALS_PMLCG.FACTORS[i], i + 1);
+}
+
+
+/*!
+ *  \brief Multiplier of generator number gn.
+ *
+ *  PRIM_ROOT^e where e is the (gn + 1)-th integer relatively prime to
+ *  2^61 - 2, found by bisection on the count of such integers.
+ */
+inline static unsigned long int pmlcg_multiplier(const int gn)
+{
+    const unsigned long int k = (unsigned long int)gn + 1;
+    unsigned long int lo = 1;
+    unsigned long int hi = 0x1UL << 40;
+    while (lo < hi) {
+        const unsigned long int mid = lo + (hi - lo) / 2;
+        if (pmlcg_coprime_count(mid, 0) < k)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return pmlcg_powmod(GLOBALS_PMLCG.PRIM_ROOT, (long int)lo);
+}
+
+
+/*!
+ *  \brief Initial state from seed, in [1, M), the same for all generator numbers.
+ */
+inline static unsigned long int pmlcg_seed(const int s)
+{
+    const unsigned long int x = GLOBALS_PMLCG.INIT_SEED ^ ((unsigned long int)(s & 0x7FFFFFFF) << 30);
+    const unsigned long int r = pmlcg_fold((x & GLOBALS_PMLCG.MOD) + (x >> 61));
+    return (r) ? r : 0x1UL;
+}
+
+
+#endif  // __PMLCG_MOD_H
@@ -0,0 +1,128 @@
+#ifndef __PMLCG_PACK_H
+#define __PMLCG_PACK_H
+
+
+#include <stdio.h>   // printf
+#include <stdint.h>  // fixed width integers
+#include "sprng.h"   // SPRNG_PMLCG
+#include "pack.h"
+#include "pmlcg_globals.h"
+
+
+/*
+ *  Checkpoint format of PMLCG and VPMLCG (packed state), version 1.
+ *
+ *  Fixed layout in host byte order, independent of SIMD mode and LONG_SPRNG:
+ *
+ *    PMLCG_PACK_HEADER          24 bytes
+ *    uint64_t seed[n]
+ *    uint64_t multiplier[n]
+ *    int32_t init_seed[n]
+ *    int32_t parameter[n]
+ *
+ *  for n streams, padded with zeros to a multiple of 8 bytes. Buffers have
+ *  to be 8-byte aligned, packed generators can be placed back to back.
+ *  A PMLCG and a VPMLCG with a single active stream use the same packed
+ *  state.
+ */
+const uint32_t PMLCG_PACK_MAGIC = 0x4C4D5053U;  /*!< "SPML" */
+const uint16_t PMLCG_PACK_VERSION = 1;
+
+
+struct PMLCG_PACK_HEADER
+{
+    PACK_HEADER base;
+    int32_t per_lane;  /*!< streams use generator numbers stream_position + i */
+    int32_t stream_position;
+    int32_t stream_next;
+};
+
+
+/*!
+ *  Arrays of packed state of n streams.
+ */
+struct PMLCG_PACK_VIEW
+{
+    PMLCG_PACK_HEADER *header;
+    uint64_t *seed;
+    uint64_t *multiplier;
+    int32_t *init_seed;
+    int32_t *parameter;
+};
+
+
+/*!
+ *  \brief Size in bytes of packed state of n streams.
+ */
+inline static int pmlcg_pack_size(const int n)
+{
+    return pack_align((int)sizeof(PMLCG_PACK_HEADER) + n * (int)(2 * sizeof(uint64_t) + 2 * sizeof(int32_t)));
+}
+
+
+/*!
+ *  \brief Arrays of packed state of n streams in buffer.
+ */
+inline static PMLCG_PACK_VIEW pmlcg_pack_view(const void * const buffer, const int n)
+{
+    PMLCG_PACK_VIEW view;
+    view.header = (PMLCG_PACK_HEADER *)buffer;
+    view.seed = (uint64_t *)(view.header + 1);
+    view.multiplier = view.seed + n;
+    view.init_seed = (int32_t *)(view.multiplier + n);
+    view.parameter = view.init_seed + n;
+    return view;
+}
+
+
+/*!
+ *  \brief Check buffer for packing n streams, clears padding.
+ *
+ *  Returns packed size or -1 on error.
+ */
+inline static int pmlcg_pack_check(void * const buffer, const int size, const int n)
+{
+    return pack_check(buffer, size, pmlcg_pack_size(n));
+}
+
+
+/*!
+ *  \brief Check packed state with at most max_streams streams.
+ *
+ *  Seeds have to be in [1, 2^61 - 1), multipliers in [2, 2^61 - 1), and
+ *  parameters in range.
+ *  Returns number of streams or -1 on error.
+ */
+inline static int pmlcg_unpack_check(const void * const buffer, const int size, const int max_streams)
+{
+    const int n = pack_check_header(buffer, size, PMLCG_PACK_MAGIC, PMLCG_PACK_VERSION, SPRNG_PMLCG, max_streams, (int)sizeof(PMLCG_PACK_HEADER));
+    if (n < 0 || pack_check_size(size, pmlcg_pack_size(n)) < 0)
+        return -1;
+
+    const PMLCG_PACK_VIEW pack = pmlcg_pack_view(buffer, n);
+    for (int strm = 0; strm < n; ++strm) {
+        if (pack.seed[strm] == 0 || pack.seed[strm] >= GLOBALS_PMLCG.MOD ||
+            pack.multiplier[strm] < 2 || pack.multiplier[strm] >= GLOBALS_PMLCG.MOD ||
+            pack.parameter[strm] < 0 || pack.parameter[strm] >= GLOBALS_PMLCG.NPARAMS) {
+            printf("ERROR: Unpacked parameters not acceptable.\n");
+            return -1;
+        }
+    }
+
+    return n;
+}
+
+
+/*!
+ *  \brief Fill header of packed state.
+ */
+inline static void pmlcg_pack_header(PMLCG_PACK_HEADER * const header, const int n, const int per_lane, const int stream_position, const int stream_next)
+{
+    pack_header(&header->base, PMLCG_PACK_MAGIC, PMLCG_PACK_VERSION, SPRNG_PMLCG, n);
+    header->per_lane = per_lane;
+    header->stream_position = stream_position;
+    header->stream_next = stream_next;
+}
+
+
+#endif  // __PMLCG_PACK_H
@@ -0,0 +1,931 @@
+#ifndef __VPMLCG_ENGINE_H
+#define __VPMLCG_ENGINE_H
+
+
+#include "simd.h"
+#if defined SIMD_MODE
+
+
+#include <stdio.h>   // printf
+#include <string.h>  // memset, memcpy
+#include <limits.h>  // INT_MAX
+#include "pmlcg_globals.h"
+#include "pmlcg_mod.h"
+#include "pmlcg_pack.h"
+#include "vpmlcg_kernels.h"
+
+
+/*! \class VPMLCG_ENGINE
+ *  \brief Header-only SIMD prime modulus linear congruential RNG.
+ *
+ *  SIMD version of PMLCG, x = a * x (mod 2^61 - 1) with the multiply-reduce
+ *  of vpmlcg_kernels.h per lane. Streams use 64-bit elements in 2 registers
+ *  (SIMD_STREAMS_32 streams), with or without LONG_SPRNG. Stream i of a
+ *  generator initialized with init_rng_lanes() is identical to a scalar PMLCG.
+ *  The VPMLCG class is a thin adapter for the virtual VSPRNG interface.
+ *
+ *  NOTE: objects have to be aligned to SIMD_WIDTH_BYTES (stack or simd_malloc'ed).
+ */
+class VPMLCG_ENGINE
+{
+  public:
+    VPMLCG_ENGINE();
+    int init_rng(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int init_rng_lanes(int, int, const int * const, const int * const, const int = SIMD_STREAMS_32);
+    int reseed_rng(const int * const);
+    int spawn_rng(const int, VPMLCG_ENGINE * const * const);
+    SIMD_INT get_rn_int();
+    SIMD_FLT get_rn_flt();
+    SIMD_DBL get_rn_dbl();
+    void get_rn_dbl2(SIMD_DBL * const);
+    int get_rn_int_array(int * const, const int);
+    int get_rn_flt_array(float * const, const int);
+    int get_rn_dbl_array(double * const, const int);
+    int get_rn_dbl2_array(double * const, const int);
+    int get_rn_int_streams(int * const, const int, const int);
+    int get_rn_flt_streams(float * const, const int, const int);
+    int get_rn_dbl_streams(double * const, const int, const int);
+    int get_stream_stride(const int) const;
+    SIMD_INT get_seed_rng() const;
+    int advance(const long int);
+    int advance(const long int * const);
+    int pack_size() const;
+    int pack_rng(void * const, const int) const;
+    int unpack_rng(const void * const, const int);
+#if defined(DEBUG)
+    SIMD_INT get_prime() const;
+    SIMD_INT get_seed() const;
+    SIMD_INT get_multiplier() const;
+# if defined(LONG_SPRNG)
+    SIMD_INT get_seed2() const;
+    SIMD_INT get_multiplier2() const;
+# endif
+#endif
+
+  private:
+    SIMD_INT seed[VPMLCG_REGS];
+    SIMD_INT multiplier[VPMLCG_REGS];
+    SIMD_INT init_seed[VPMLCG_REGS];
+    SIMD_INT parameter[VPMLCG_REGS];
+    SIMD_MSK strm_mask32;
+    SIMD_MSK strm_mask64[2];
+    int32_t stream_position;
+    int32_t stream_next;
+    int32_t masked;
+    int32_t nstreams;
+    int32_t per_lane;
+
+    int check_streams_args(const void * const, const int, const int) const;
+    void set_streams(const int * const, const int * const, const int);
+    void get_params(int * const, int * const) const;
+    static int check_params(int * const, int * const, const int * const, const int * const, const int);
+};
+
+
+/*!
+ *  \brief Constructor (no parameters)
+ */
+inline VPMLCG_ENGINE::VPMLCG_ENGINE()
+{
+    stream_position = 0;
+    stream_next = 0;
+    masked = 0;
+    nstreams = SIMD_STREAMS_32;
+    per_lane = 0;
+    strm_mask32 = simd_set_mask_32(SIMD_STREAMS_32);
+    strm_mask64[0] = simd_set_mask_64(SIMD_STREAMS_64);
+    strm_mask64[1] = simd_set_mask_64(SIMD_STREAMS_64);
+
+    for (int j = 0; j < VPMLCG_REGS; ++j) {
+        simd_set_zero(&seed[j]);
+        simd_set_zero(&multiplier[j]);
+        simd_set_zero(&init_seed[j]);
+        simd_set_zero(&parameter[j]);
+    }
+}
+
+
+/*!
+ *  \brief Initialize RNG
+ *
+ *  As VLCG_ENGINE::init_rng(), all streams use generator number gn
+ *  (same multiplier) and differ by their seeds.
+ *
+ *  NOTE: double streams are the first half of the streams.
+ */
+inline int VPMLCG_ENGINE::init_rng(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{
+    // Check total generators
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+
+    // Check generator number
+    if (gn < 0 || gn >= tg) {
+        printf("ERROR: generator number is out of range, %d\n", gn);
+        gn = tg - 1;
+    }
+
+    // Check seeds, multipliers, and number of streams
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    const int nstrms = check_params(s, m, gs, gm, ns);
+
+    stream_next = tg;
+    stream_position = gn;
+    per_lane = 0;
+    set_streams(s, m, nstrms);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Initialize RNG with one generator number per stream
+ *
+ *  Stream i is SPRNG generator gn + i, its output is identical to a scalar
+ *  PMLCG initialized with init_rng(gn + i, tg, gs[i], gm[i]).
+ *
+ *  NOTE: double streams are the first half of the generators.
+ *  Returns 0 on success or -1 on error.
+ */
+inline int VPMLCG_ENGINE::init_rng_lanes(int gn, int tg, const int * const gs, const int * const gm, const int ns)
+{
+    // Check total generators
+    if (tg <= 0) {
+        printf("ERROR: total_gen out of range, %d\n", tg);
+        tg = 1;
+    }
+
+    // Check seeds, multipliers, and number of streams
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    const int nstrms = check_params(s, m, gs, gm, ns);
+
+    // Check generator numbers
+    if (gn < 0 || gn > tg - nstrms) {
+        printf("ERROR: generator numbers are out of range, [%d, %d)\n", gn, gn + nstrms);
+        return -1;
+    }
+
+    stream_next = tg;
+    stream_position = gn;
+    per_lane = 1;
+    set_streams(s, m, nstrms);
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Reseed streams in place
+ *
+ *  Generator numbers, multipliers, and number of streams are kept,
+ *  resulting state is the same as init_rng() (or init_rng_lanes()) with
+ *  seeds gs, see VLCG_ENGINE::reseed_rng().
+ *  Returns 0 on success or -1 on error.
+ */
+inline int VPMLCG_ENGINE::reseed_rng(const int * const gs)
+{
+    if (!gs) {
+        printf("ERROR: no array for seeds provided.\n");
+        return -1;
+    }
+
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    get_params(s, m);
+    memset(s, 0, sizeof(s));
+    memcpy(s, gs, nstreams * sizeof(int));
+
+    // Multipliers only depend on generator numbers, seeds are set in place
+    const SIMD_INT vmsk_lsb31 = simd_set(0x7FFFFFFFUL);
+    unsigned long int lseed[SIMD_STREAMS_64] __SIMD_ALIGN__;
+    for (int j = 0; j < VPMLCG_REGS; ++j) {
+        for (int i = 0; i < SIMD_STREAMS_64; ++i)
+            lseed[i] = pmlcg_seed(s[i + j * SIMD_STREAMS_64]);
+        seed[j] = simd_load(lseed);
+        init_seed[j] = simd_and(simd_set(&s[j * SIMD_STREAMS_64], SIMD_STREAMS_64), vmsk_lsb31);
+    }
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Seeds and multipliers of streams, inactive streams are zero.
+ *
+ *  Returns number of streams.
+ */
+inline int VPMLCG_ENGINE::check_params(int * const s, int * const m, const int * const gs, const int * const gm, const int ns)
+{
+    // Check number of streams requested
+    int nstrms = ns;
+    if (nstrms <= 0 || nstrms > SIMD_STREAMS_32) {
+        printf("ERROR: number of streams is out of range, %d, default is to use all available streams.\n", nstrms);
+        nstrms = SIMD_STREAMS_32;
+    }
+
+    // Check multipliers
+    memset(m, 0, SIMD_STREAMS_32 * sizeof(int));
+    if (!gm)
+        printf("WARNING: no array for multipliers provided, default is zero.\n");
+    else {
+        for (int strm = 0; strm < nstrms; ++strm)
+            if (gm[strm] < 0 || gm[strm] >= GLOBALS_PMLCG.NPARAMS)
+                printf("ERROR: multiplier out of range, %d\n", gm[strm]);
+            else
+                m[strm] = gm[strm];
+    }
+
+    // Check seeds
+    memset(s, 0, SIMD_STREAMS_32 * sizeof(int));
+    if (!gs)
+        printf("WARNING: no array for seeds provided, default is zero.\n");
+    else {
+        for (int strm = 0; strm < nstrms; ++strm)
+            s[strm] = gs[strm];
+    }
+
+    return nstrms;
+}
+
+
+/*!
+ *  \brief Seeds and multiplier indices of streams from registers.
+ */
+inline void VPMLCG_ENGINE::get_params(int * const s, int * const m) const
+{
+    simd_store(s, simd_packmerge_i32(init_seed[0], init_seed[1]));
+    simd_store(m, simd_packmerge_i32(parameter[0], parameter[1]));
+}
+
+
+/*!
+ *  \brief Initial state of streams from seeds and generator numbers.
+ *
+ *  Generator numbers are stream_position (plus stream index if per_lane),
+ *  multipliers are computed once per distinct generator number (see
+ *  pmlcg_multiplier()). No warm-up is needed since streams differ by
+ *  multiplier.
+ */
+inline void VPMLCG_ENGINE::set_streams(const int * const s, const int * const m, const int nstrms)
+{
+    // Select masked numbers, only if not using maximum number of streams
+    masked = (nstrms < SIMD_STREAMS_32);
+    nstreams = nstrms;
+    strm_mask32 = simd_set_mask_32(nstrms);
+    strm_mask64[0] = simd_set_mask_64(nstrms);
+    strm_mask64[1] = simd_set_mask_64(nstrms - SIMD_STREAMS_64);
+
+    unsigned long int lseed[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    unsigned long int lmultiplier[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    int gn_prev = -1;
+    unsigned long int mult_prev = 0;
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        const int j = strm / SIMD_STREAMS_64;
+        const int i = strm % SIMD_STREAMS_64;
+        const int gn = (per_lane && strm < nstrms) ? stream_position + strm : stream_position;
+        if (gn != gn_prev) {
+            mult_prev = pmlcg_multiplier(gn);
+            gn_prev = gn;
+        }
+        lseed[j][i] = pmlcg_seed(s[strm]);
+        lmultiplier[j][i] = mult_prev;
+    }
+
+    const SIMD_INT vmsk_lsb31 = simd_set(0x7FFFFFFFUL);
+    for (int j = 0; j < VPMLCG_REGS; ++j) {
+        seed[j] = simd_load(lseed[j]);
+        multiplier[j] = simd_load(lmultiplier[j]);
+        parameter[j] = simd_set(&m[j * SIMD_STREAMS_64], SIMD_STREAMS_64);
+        init_seed[j] = simd_and(simd_set(&s[j * SIMD_STREAMS_64], SIMD_STREAMS_64), vmsk_lsb31);
+    }
+}
+
+
+/*!
+ *  \brief Spawn new generators
+ *
+ *  Child i is generator number stream_position + stream_next * (i + 1) with
+ *  the seeds of this generator, as in SPRNG spawn_rng().
+ *  If streams have one generator number each (init_rng_lanes()), the
+ *  children do as well.
+ *  Returns number of generators spawned or -1 on error.
+ */
+inline int VPMLCG_ENGINE::spawn_rng(const int nspawned, VPMLCG_ENGINE * const * const newgens)
+{
+    if (!newgens || nspawned <= 0) {
+        printf("ERROR: invalid array of generators, %d\n", nspawned);
+        return -1;
+    }
+
+    // Check generator numbers of children
+    const long int next = (long int)stream_next * (nspawned + 1);
+    const long int last = stream_position + (long int)stream_next * nspawned + ((per_lane) ? nstreams - 1 : 0);
+    if (next > INT_MAX || last > INT_MAX) {
+        printf("ERROR: generator numbers of spawned generators are out of range, %ld\n", last);
+        return -1;
+    }
+
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    get_params(s, m);
+
+    for (int i = 0; i < nspawned; ++i) {
+        VPMLCG_ENGINE * const eng = newgens[i];
+        eng->stream_next = (int)next;
+        eng->stream_position = stream_position + stream_next * (i + 1);
+        eng->per_lane = per_lane;
+        eng->set_streams(s, m, nstreams);
+    }
+
+    stream_next = (int)next;
+
+    return nspawned;
+}
+
+
+/*!
+ *  \brief Advance all streams n steps in O(log n) operations.
+ *
+ *  Equivalent to calling get_rn_dbl() n times.
+ */
+inline int VPMLCG_ENGINE::advance(const long int n)
+{
+    long int nsteps[SIMD_STREAMS_32];
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm)
+        nsteps[strm] = n;
+
+    return advance(nsteps);
+}
+
+
+/*!
+ *  \brief Advance each stream a different number of steps.
+ *
+ *  Seeds are multiplied by a^n per lane in scalar form (see pmlcg_powmod()).
+ */
+inline int VPMLCG_ENGINE::advance(const long int * const n)
+{
+    if (!n) {
+        printf("ERROR: no array for number of steps to advance provided.\n");
+        return -1;
+    }
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        if (n[strm] < 0) {
+            printf("ERROR: number of steps to advance is out of range, %ld\n", n[strm]);
+            return -1;
+        }
+    }
+
+    unsigned long int lseed[SIMD_STREAMS_64] __SIMD_ALIGN__;
+    unsigned long int lmultiplier[SIMD_STREAMS_64] __SIMD_ALIGN__;
+    for (int j = 0; j < VPMLCG_REGS; ++j) {
+        simd_store(lseed, seed[j]);
+        simd_store(lmultiplier, multiplier[j]);
+        for (int i = 0; i < SIMD_STREAMS_64; ++i)
+            lseed[i] = pmlcg_mulmod(lseed[i], pmlcg_powmod(lmultiplier[i], n[i + j * SIMD_STREAMS_64]));
+        seed[j] = simd_load(lseed);
+    }
+
+    return 0;
+}
+
+
+/*
+ *  Masking is fixed at init, the test on masked is loop invariant
+ *  and perfectly predicted.
+ */
+inline SIMD_INT VPMLCG_ENGINE::get_rn_int()
+{
+    const SIMD_INT rn = vpmlcg_next_int(seed, multiplier);
+    return (masked) ? simd_maskz_32(rn, strm_mask32) : rn;
+}
+
+
+inline SIMD_FLT VPMLCG_ENGINE::get_rn_flt()
+{
+    const SIMD_FLT rn = vpmlcg_next_flt(seed, multiplier);
+    return (masked) ? simd_maskz(rn, strm_mask32) : rn;
+}
+
+
+inline SIMD_DBL VPMLCG_ENGINE::get_rn_dbl()
+{
+    const SIMD_DBL rn = vpmlcg_next_dbl(seed, multiplier);
+    return (masked) ? simd_maskz(rn, strm_mask64[0]) : rn;
+}
+
+
+/*!
+ *  \brief Double-precision random numbers of all streams.
+ *
+ *  rn[0] holds streams [0, SIMD_STREAMS_64), rn[1] holds streams
+ *  [SIMD_STREAMS_64, SIMD_STREAMS_32).
+ */
+inline void VPMLCG_ENGINE::get_rn_dbl2(SIMD_DBL * const rn)
+{
+    vpmlcg_next_dbl2(rn, seed, multiplier);
+    if (masked) {
+        rn[0] = simd_maskz(rn[0], strm_mask64[0]);
+        rn[1] = simd_maskz(rn[1], strm_mask64[1]);
+    }
+}
+
+
+/*!
+ *  \brief Fill an array with integer random numbers.
+ *
+ *  Same layout as VLCG_ENGINE::get_rn_int_array(), the array must be aligned
+ *  to SIMD_WIDTH_BYTES. State is kept in registers for the whole loop.
+ *  Returns the number of elements written or -1 on error.
+ */
+inline int VPMLCG_ENGINE::get_rn_int_array(int * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    SIMD_INT vseed[VPMLCG_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VPMLCG_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    const SIMD_MSK vmsk = strm_mask32;
+    const int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    int *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        const SIMD_INT vrn = vpmlcg_next_int(vseed, vmult);
+        simd_store(rn_ptr, (masked) ? simd_maskz_32(vrn, vmsk) : vrn);
+        rn_ptr += SIMD_STREAMS_32;
+    }
+
+    if (nrem > 0) {
+        int rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        const SIMD_INT vrn = vpmlcg_next_int(vseed, vmult);
+        simd_store(rn_tail, (masked) ? simd_maskz_32(vrn, vmsk) : vrn);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(int));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with single-precision random numbers.
+ *
+ *  Same as get_rn_int_array() but for float elements.
+ */
+inline int VPMLCG_ENGINE::get_rn_flt_array(float * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    SIMD_INT vseed[VPMLCG_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VPMLCG_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    const SIMD_MSK vmsk = strm_mask32;
+    const int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    float *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        const SIMD_FLT vrn = vpmlcg_next_flt(vseed, vmult);
+        simd_store(rn_ptr, (masked) ? simd_maskz(vrn, vmsk) : vrn);
+        rn_ptr += SIMD_STREAMS_32;
+    }
+
+    if (nrem > 0) {
+        float rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        const SIMD_FLT vrn = vpmlcg_next_flt(vseed, vmult);
+        simd_store(rn_tail, (masked) ? simd_maskz(vrn, vmsk) : vrn);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(float));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers.
+ *
+ *  Same as get_rn_int_array() but with SIMD_STREAMS_64 elements per register.
+ */
+inline int VPMLCG_ENGINE::get_rn_dbl_array(double * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    SIMD_INT vseed[VPMLCG_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VPMLCG_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    const SIMD_MSK vmsk = strm_mask64[0];
+    const int nvec = nrn / SIMD_STREAMS_64;
+    const int nrem = nrn % SIMD_STREAMS_64;
+
+    double *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        const SIMD_DBL vrn = vpmlcg_next_dbl(vseed, vmult);
+        simd_store(rn_ptr, (masked) ? simd_maskz(vrn, vmsk) : vrn);
+        rn_ptr += SIMD_STREAMS_64;
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        const SIMD_DBL vrn = vpmlcg_next_dbl(vseed, vmult);
+        simd_store(rn_tail, (masked) ? simd_maskz(vrn, vmsk) : vrn);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(double));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers of all streams.
+ *
+ *  Each step of the streams stores SIMD_STREAMS_32 elements (contents of get_rn_dbl2()).
+ */
+inline int VPMLCG_ENGINE::get_rn_dbl2_array(double * const rn, const int nrn)
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+
+    SIMD_INT vseed[VPMLCG_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VPMLCG_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    const SIMD_MSK vmsk[2] = { strm_mask64[0], strm_mask64[1] };
+    const int nvec = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    SIMD_DBL vrn[2] __SIMD_ALIGN__;
+    double *rn_ptr = rn;
+    for (int i = 0; i < nvec; ++i) {
+        vpmlcg_next_dbl2(vrn, vseed, vmult);
+        simd_store(rn_ptr, (masked) ? simd_maskz(vrn[0], vmsk[0]) : vrn[0]);
+        simd_store(rn_ptr + SIMD_STREAMS_64, (masked) ? simd_maskz(vrn[1], vmsk[1]) : vrn[1]);
+        rn_ptr += SIMD_STREAMS_32;
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        vpmlcg_next_dbl2(vrn, vseed, vmult);
+        simd_store(rn_tail, (masked) ? simd_maskz(vrn[0], vmsk[0]) : vrn[0]);
+        simd_store(rn_tail + SIMD_STREAMS_64, (masked) ? simd_maskz(vrn[1], vmsk[1]) : vrn[1]);
+        memcpy(rn_ptr, rn_tail, nrem * sizeof(double));
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Smallest valid stride for stream-major arrays of nrn numbers per stream.
+ *
+ *  See VLCG_ENGINE::get_stream_stride().
+ */
+inline int VPMLCG_ENGINE::get_stream_stride(const int nrn) const
+{
+    if (nrn <= 0)
+        return SIMD_STREAMS_32;
+    return ((nrn + SIMD_STREAMS_32 - 1) / SIMD_STREAMS_32) * SIMD_STREAMS_32;
+}
+
+
+inline int VPMLCG_ENGINE::check_streams_args(const void * const rn, const int nrn, const int stride) const
+{
+    if (!rn || nrn < 0) {
+        printf("ERROR: invalid output array for random numbers, %d\n", nrn);
+        return -1;
+    }
+    if (stride < nrn || stride % SIMD_STREAMS_32 != 0) {
+        printf("ERROR: stride of streams is out of range, %d (see get_stream_stride())\n", stride);
+        return -1;
+    }
+    return 0;
+}
+
+
+/*!
+ *  \brief Fill an array with integer random numbers, stream-major layout.
+ *
+ *  Same layout as VLCG_ENGINE::get_rn_int_streams(), the nrn numbers of
+ *  stream i start at rn[i * stride], only active streams are written.
+ *  Returns the number of elements written per stream or -1 on error.
+ */
+inline int VPMLCG_ENGINE::get_rn_int_streams(int * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    SIMD_INT vseed[VPMLCG_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VPMLCG_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    const int nblk = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    SIMD_INT vrn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_32; k += SIMD_STREAMS_32) {
+        for (int j = 0; j < SIMD_STREAMS_32; ++j)
+            vrn[j] = vpmlcg_next_int(vseed, vmult);
+        simd_transpose_i32(vrn);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm]);
+    }
+
+    if (nrem > 0) {
+        int rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j)
+            vrn[j] = vpmlcg_next_int(vseed, vmult);
+        for (int j = nrem; j < SIMD_STREAMS_32; ++j)
+            simd_set_zero(&vrn[j]);
+        simd_transpose_i32(vrn);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_32, rn_tail, nrem * sizeof(int));
+        }
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with single-precision random numbers, stream-major layout.
+ *
+ *  Same as get_rn_int_streams() but for float elements.
+ */
+inline int VPMLCG_ENGINE::get_rn_flt_streams(float * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    SIMD_INT vseed[VPMLCG_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VPMLCG_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    const int nblk = nrn / SIMD_STREAMS_32;
+    const int nrem = nrn % SIMD_STREAMS_32;
+
+    SIMD_FLT vrn[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_32; k += SIMD_STREAMS_32) {
+        for (int j = 0; j < SIMD_STREAMS_32; ++j)
+            vrn[j] = vpmlcg_next_flt(vseed, vmult);
+        simd_transpose(vrn);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm]);
+    }
+
+    if (nrem > 0) {
+        float rn_tail[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j)
+            vrn[j] = vpmlcg_next_flt(vseed, vmult);
+        for (int j = nrem; j < SIMD_STREAMS_32; ++j)
+            simd_set_zero(&vrn[j]);
+        simd_transpose(vrn);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_32, rn_tail, nrem * sizeof(float));
+        }
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Fill an array with double-precision random numbers, stream-major layout.
+ *
+ *  Same as get_rn_int_streams() but for double elements, all streams are
+ *  generated (values of get_rn_dbl2_array()). Blocks are SIMD_STREAMS_64
+ *  steps, each half of the streams is transposed separately.
+ */
+inline int VPMLCG_ENGINE::get_rn_dbl_streams(double * const rn, const int nrn, const int stride)
+{
+    if (check_streams_args(rn, nrn, stride))
+        return -1;
+
+    SIMD_INT vseed[VPMLCG_REGS] __SIMD_ALIGN__;
+    SIMD_INT vmult[VPMLCG_REGS] __SIMD_ALIGN__;
+    memcpy(vseed, seed, sizeof(vseed));
+    memcpy(vmult, multiplier, sizeof(vmult));
+    const int nblk = nrn / SIMD_STREAMS_64;
+    const int nrem = nrn % SIMD_STREAMS_64;
+
+    // vrn[0] holds streams [0, SIMD_STREAMS_64), vrn[1] the remaining streams
+    SIMD_DBL vrn[2][SIMD_STREAMS_64] __SIMD_ALIGN__;
+    SIMD_DBL vpair[2] __SIMD_ALIGN__;
+    for (int k = 0; k < nblk * SIMD_STREAMS_64; k += SIMD_STREAMS_64) {
+        for (int j = 0; j < SIMD_STREAMS_64; ++j) {
+            vpmlcg_next_dbl2(vpair, vseed, vmult);
+            vrn[0][j] = vpair[0];
+            vrn[1][j] = vpair[1];
+        }
+        simd_transpose(vrn[0]);
+        simd_transpose(vrn[1]);
+        for (int strm = 0; strm < nstreams; ++strm)
+            simd_store(rn + strm * stride + k, vrn[strm / SIMD_STREAMS_64][strm % SIMD_STREAMS_64]);
+    }
+
+    if (nrem > 0) {
+        double rn_tail[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        for (int j = 0; j < nrem; ++j) {
+            vpmlcg_next_dbl2(vpair, vseed, vmult);
+            vrn[0][j] = vpair[0];
+            vrn[1][j] = vpair[1];
+        }
+        for (int j = nrem; j < SIMD_STREAMS_64; ++j) {
+            simd_set_zero(&vrn[0][j]);
+            simd_set_zero(&vrn[1][j]);
+        }
+        simd_transpose(vrn[0]);
+        simd_transpose(vrn[1]);
+        for (int strm = 0; strm < nstreams; ++strm) {
+            simd_store(rn_tail, vrn[strm / SIMD_STREAMS_64][strm % SIMD_STREAMS_64]);
+            memcpy(rn + strm * stride + nblk * SIMD_STREAMS_64, rn_tail, nrem * sizeof(double));
+        }
+    }
+
+    memcpy(seed, vseed, sizeof(vseed));
+
+    return nrn;
+}
+
+
+/*!
+ *  \brief Size in bytes of packed state of active streams.
+ */
+inline int VPMLCG_ENGINE::pack_size() const
+{ return pmlcg_pack_size(nstreams); }
+
+
+/*!
+ *  \brief Pack state of active streams into caller buffer (see pmlcg_pack.h).
+ *
+ *  The packed state of stream i is the same as a PMLCG with the
+ *  parameters of stream i.
+ *  Returns number of bytes written or -1 on error.
+ */
+inline int VPMLCG_ENGINE::pack_rng(void * const buffer, const int size) const
+{
+    const int nbytes = pmlcg_pack_check(buffer, size, nstreams);
+    if (nbytes < 0)
+        return -1;
+
+    const PMLCG_PACK_VIEW pack = pmlcg_pack_view(buffer, nstreams);
+    pmlcg_pack_header(pack.header, nstreams, per_lane, stream_position, stream_next);
+
+    unsigned long int lseed[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned long int lmultiplier[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int ls[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int lm[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    simd_store(&lseed[0], seed[0]);
+    simd_store(&lseed[SIMD_STREAMS_64], seed[1]);
+    simd_store(&lmultiplier[0], multiplier[0]);
+    simd_store(&lmultiplier[SIMD_STREAMS_64], multiplier[1]);
+    get_params(ls, lm);
+
+    for (int strm = 0; strm < nstreams; ++strm) {
+        pack.seed[strm] = lseed[strm];
+        pack.multiplier[strm] = lmultiplier[strm];
+    }
+    memcpy(pack.init_seed, ls, nstreams * sizeof(int32_t));
+    memcpy(pack.parameter, lm, nstreams * sizeof(int32_t));
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Restore state in place from packed state (see pmlcg_pack.h).
+ *
+ *  Packed streams become the active streams, at most SIMD_STREAMS_32,
+ *  inactive streams reuse the state of the first stream. Multipliers are
+ *  restored as packed, not recomputed from generator numbers.
+ *  Returns number of bytes read or -1 on error, state is not modified on error.
+ */
+inline int VPMLCG_ENGINE::unpack_rng(const void * const buffer, const int size)
+{
+    const int nstrms = pmlcg_unpack_check(buffer, size, SIMD_STREAMS_32);
+    if (nstrms < 0)
+        return -1;
+
+    const PMLCG_PACK_VIEW pack = pmlcg_pack_view(buffer, nstrms);
+    stream_position = pack.header->stream_position;
+    stream_next = pack.header->stream_next;
+    per_lane = pack.header->per_lane;
+
+    masked = (nstrms < SIMD_STREAMS_32);
+    nstreams = nstrms;
+    strm_mask32 = simd_set_mask_32(nstrms);
+    strm_mask64[0] = simd_set_mask_64(nstrms);
+    strm_mask64[1] = simd_set_mask_64(nstrms - SIMD_STREAMS_64);
+
+    // Parameters of inactive streams are zero, as in init_rng()
+    int m[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    int s[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned long int lseed[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    unsigned long int lmultiplier[SIMD_STREAMS_32] __SIMD_ALIGN__;
+    memset(m, 0, sizeof(m));
+    memset(s, 0, sizeof(s));
+    memcpy(m, pack.parameter, nstrms * sizeof(int));
+    memcpy(s, pack.init_seed, nstrms * sizeof(int));
+    for (int strm = 0; strm < SIMD_STREAMS_32; ++strm) {
+        lseed[strm] = pack.seed[(strm < nstrms) ? strm : 0];
+        lmultiplier[strm] = pack.multiplier[(strm < nstrms) ? strm : 0];
+    }
+
+    for (int j = 0; j < VPMLCG_REGS; ++j) {
+        seed[j] = simd_load(&lseed[j * SIMD_STREAMS_64]);
+        multiplier[j] = simd_load(&lmultiplier[j * SIMD_STREAMS_64]);
+        parameter[j] = simd_set(&m[j * SIMD_STREAMS_64], SIMD_STREAMS_64);
+        init_seed[j] = simd_set(&s[j * SIMD_STREAMS_64], SIMD_STREAMS_64);
+    }
+
+    return pmlcg_pack_size(nstrms);
+}
+
+
+inline SIMD_INT VPMLCG_ENGINE::get_seed_rng() const
+{
+    const SIMD_INT va = simd_packmerge_i32(init_seed[0], init_seed[1]);
+    if (masked)
+        return simd_maskz_32(va, strm_mask32);
+    return va;
+}
+
+
+/*
+ *  VPMLCG has no prime addend, zero is returned instead.
+ */
+#if defined(DEBUG)
+inline SIMD_INT VPMLCG_ENGINE::get_prime() const
+{
+    SIMD_INT va;
+    simd_set_zero(&va);
+    return va;
+}
+
+inline SIMD_INT VPMLCG_ENGINE::get_seed() const
+{
+    if (masked)
+        return simd_maskz_64(seed[0], strm_mask64[0]);
+    return seed[0];
+}
+
+inline SIMD_INT VPMLCG_ENGINE::get_multiplier() const
+{
+    if (masked)
+        return simd_maskz_64(multiplier[0], strm_mask64[0]);
+    return multiplier[0];
+}
+
+# if defined(LONG_SPRNG)
+inline SIMD_INT VPMLCG_ENGINE::get_seed2() const
+{
+    if (masked)
+        return simd_maskz_64(seed[1], strm_mask64[1]);
+    return seed[1];
+}
+
+inline SIMD_INT VPMLCG_ENGINE::get_multiplier2() const
+{
+    if (masked)
+        return simd_maskz_64(multiplier[1], strm_mask64[1]);
+    return multiplier[1];
+}
+# endif
+#endif
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VPMLCG_ENGINE_H
+
@@ -0,0 +1,146 @@
+#ifndef __VPMLCG_KERNELS_H
+#define __VPMLCG_KERNELS_H
+
+
+#include "simd.h"
+#if defined(SIMD_MODE)
+
+
+#include "pmlcg_globals.h"
+
+
+/*
+ *  SIMD kernels for prime modulus LCG
+ *
+ *  Seeds and multipliers are passed as arrays of 2 registers of 64-bit
+ *  elements, register 0 holds streams [0, SIMD_STREAMS_64) and register 1
+ *  streams [SIMD_STREAMS_64, SIMD_STREAMS_32), as in vlcg64_kernels.h.
+ *
+ *  There is no 64x64 -> 128 bit vector multiply, products are built from
+ *  32x32 -> 64 bit partial products (simd_mul_u32) and reduced modulo
+ *  M = 2^61 - 1 with shifts and adds only, as pmlcg_mulmod().
+ */
+#define VPMLCG_REGS 2
+
+
+/*!
+ *  \brief Multiply modulo 2^61 - 1, elements of va and vb in [0, M).
+ *
+ *  With a = a1 * 2^32 + a0 and b = b1 * 2^32 + b0 (a1, b1 < 2^29),
+ *  a * b = a1 * b1 * 2^64 + (a1 * b0 + a0 * b1) * 2^32 + a0 * b0, and
+ *  2^61 = 1 (mod M) folds each term into 61 bits.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT vpmlcg_mulmod(const SIMD_INT va, const SIMD_INT vb)
+{
+    const SIMD_INT vmod = simd_set(GLOBALS_PMLCG.MOD);
+    const SIMD_INT vone = simd_set(0x1UL);
+    const SIMD_INT va1 = simd_srl_64(va, 0x20);
+    const SIMD_INT vb1 = simd_srl_64(vb, 0x20);
+
+    // Partial products, mid < 2^62
+    const SIMD_INT vlo = simd_mul_u32(va, vb);
+    const SIMD_INT vmid = simd_add_i64(simd_mul_u32(va1, vb), simd_mul_u32(va, vb1));
+    const SIMD_INT vhi = simd_mul_u32(va1, vb1);
+
+    // lo = (lo & M) + (lo >> 61), mid * 2^32 = (mid << 32 & M) + (mid >> 29), hi * 2^64 = hi << 3
+    SIMD_INT vt = simd_add_i64(simd_and(vlo, vmod), simd_srl_64(vlo, 0x3D));
+    vt = simd_add_i64(vt, simd_and(simd_sll_64(vmid, 0x20), vmod));
+    vt = simd_add_i64(vt, simd_srl_64(vmid, 0x1D));
+    vt = simd_add_i64(vt, simd_sll_64(vhi, 0x3));
+
+    // Sum < 2^63, fold to [0, 2M] then subtract M if needed
+    vt = simd_add_i64(simd_and(vt, vmod), simd_srl_64(vt, 0x3D));
+    return simd_and(simd_add_i64(vt, simd_srl_64(simd_add_i64(vt, vone), 0x3D)), vmod);
+}
+
+
+/*!
+ *  \brief Step streams once and return integer random numbers.
+ *
+ *  The high 31-bits out of the 61-bits are returned.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT vpmlcg_next_int(SIMD_INT * const s, const SIMD_INT * const m)
+{
+    s[0] = vpmlcg_mulmod(s[0], m[0]);
+    s[1] = vpmlcg_mulmod(s[1], m[1]);
+
+    return simd_packmerge_i32(simd_srl_64(s[0], 0x1E), simd_srl_64(s[1], 0x1E));
+}
+
+
+/*!
+ *  \brief Step streams once and return single-precision random numbers.
+ *
+ *  The high 24-bits out of the 61-bits are scaled by 2^-24.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_FLT vpmlcg_next_flt(SIMD_INT * const s, const SIMD_INT * const m)
+{
+    const SIMD_FLT vfac = simd_set((float)GLOBALS_PMLCG.TWO_M24);
+
+    s[0] = vpmlcg_mulmod(s[0], m[0]);
+    s[1] = vpmlcg_mulmod(s[1], m[1]);
+
+    const SIMD_INT vrn = simd_packmerge_i32(simd_srl_64(s[0], 0x25), simd_srl_64(s[1], 0x25));
+    return simd_mul(simd_cvt_i32_f32(vrn), vfac);
+}
+
+
+/*!
+ *  \brief Step streams [0, SIMD_STREAMS_64) once and return double-precision random numbers.
+ *
+ *  The high 53-bits out of the 61-bits are scaled by 2^-53, as the sum
+ *  of the high 31-bits and the next 22-bits.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL vpmlcg_next_dbl(SIMD_INT * const s, const SIMD_INT * const m)
+{
+    const SIMD_DBL vfac[2] __SIMD_ALIGN__ = { simd_set(GLOBALS_PMLCG.TWO_M31),
+                                              simd_set(GLOBALS_PMLCG.TWO_M53) };
+    const SIMD_INT vmsk_lsb22 = simd_set(0x3FFFFFUL);
+
+    s[0] = vpmlcg_mulmod(s[0], m[0]);
+
+    // High parts in low half, low parts in high half
+    const SIMD_INT vrn = simd_packmerge_i32(simd_srl_64(s[0], 0x1E),
+                                            simd_and(simd_srl_64(s[0], 0x8), vmsk_lsb22));
+    const SIMD_DBL vhi = simd_mul(simd_cvt_i32_f64(vrn), vfac[0]);
+    return simd_fmadd(simd_cvt_i32_f64_hi(vrn), vfac[1], vhi);
+}
+
+
+/*!
+ *  \brief Step all streams once and return double-precision random numbers.
+ *
+ *  rn[0] holds streams [0, SIMD_STREAMS_64), identical to vpmlcg_next_dbl(),
+ *  rn[1] holds streams [SIMD_STREAMS_64, SIMD_STREAMS_32).
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void vpmlcg_next_dbl2(SIMD_DBL * const rn, SIMD_INT * const s, const SIMD_INT * const m)
+{
+    const SIMD_DBL vfac[2] __SIMD_ALIGN__ = { simd_set(GLOBALS_PMLCG.TWO_M31),
+                                              simd_set(GLOBALS_PMLCG.TWO_M53) };
+    const SIMD_INT vmsk_lsb22 = simd_set(0x3FFFFFUL);
+    SIMD_INT vtmp[2] __SIMD_ALIGN__;
+
+    s[0] = vpmlcg_mulmod(s[0], m[0]);
+    s[1] = vpmlcg_mulmod(s[1], m[1]);
+
+    // High and low parts of all streams
+    vtmp[0] = simd_packmerge_i32(simd_srl_64(s[0], 0x1E), simd_srl_64(s[1], 0x1E));
+    vtmp[1] = simd_packmerge_i32(simd_and(simd_srl_64(s[0], 0x8), vmsk_lsb22),
+                                 simd_and(simd_srl_64(s[1], 0x8), vmsk_lsb22));
+
+    rn[0] = simd_mul(simd_cvt_i32_f64(vtmp[0]), vfac[0]);
+    rn[1] = simd_mul(simd_cvt_i32_f64_hi(vtmp[0]), vfac[0]);
+    rn[0] = simd_fmadd(simd_cvt_i32_f64(vtmp[1]), vfac[1], rn[0]);
+    rn[1] = simd_fmadd(simd_cvt_i32_f64_hi(vtmp[1]), vfac[1], rn[1]);
+}
+
+
+#endif // SIMD_MODE
+
+
+#endif  // __VPMLCG_KERNELS_H
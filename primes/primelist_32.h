@@ -1,1787 +1,179 @@
+/*
+ *  Compressed table of primes below MAXPRIME (see primes_32.cpp).
+ *
+ *  Entry i < PRIMELISTSIZE1 is the i-th prime below MAXPRIME, entry
+ *  i >= PRIMELISTSIZE1 is the prime of offset (i - PRIMELISTSIZE1 + 1) * STEP
+ *  + PRIMELISTSIZE1 - 1. Entries are stored as half the difference to the
+ *  previous entry (all primes are odd): one byte in the first section, and
+ *  two bytes offset by PRIMEDIFF_MIN in the second section. Every
+ *  PRIMEMARK-th entry is also stored in full for random access.
+ *
+ *  Generated by scripts/primelist_encode.pl from the table of the original
+ *  SPRNG 32 bit primes (dev_src/primelist_32.h), do not edit. Sizes and
+ *  STEP are those of the original table, PRIMEDIFF_MIN is the smallest
+ *  half difference of the second section, and PRIMEMARK bounds the
+ *  differences decoded per lookup.
+ */
 const int PRIMELISTSIZE1 = 1000;
 const int PRIMELISTSIZE2 = 1778;
 const int STEP = 1000;
+const int PRIMEMARK = 16;
+const int PRIMEDIFF_MIN = 4572;
 
 
-int prime_list_32[PRIMELISTSIZE2] = 
+const int prime_marks_32[112] =
 {
-11863279,
-11863259,
-11863253,
-11863249,
-11863237,
-11863213,
-11863207,
-11863183,
-11863171,
-11863153,
-11863151,
-11863133,
-11863121,
-11863109,
-11863099,
-11863073,
-11863067,
-11863057,
-11863039,
-11863037,
-11863031,
-11863021,
-11862989,
-11862979,
-11862959,
-11862919,
-11862911,
-11862881,
-11862869,
-11862857,
-11862839,
-11862803,
-11862791,
-11862761,
-11862713,
-11862703,
-11862701,
-11862679,
-11862673,
-11862661,
-11862623,
-11862611,
-11862581,
-11862577,
-11862569,
-11862563,
-11862547,
-11862527,
-11862493,
-11862469,
-11862439,
-11862391,
-11862373,
-11862343,
-11862317,
-11862313,
-11862307,
-11862293,
-11862271,
-11862269,
-11862259,
-11862241,
-11862239,
-11862233,
-11862229,
-11862223,
-11862217,
-11862203,
-11862199,
-11862167,
-11862157,
-11862083,
-11862049,
-11862031,
-11862029,
-11862013,
-11862007,
-11861987,
-11861959,
-11861953,
-11861921,
-11861917,
-11861887,
-11861879,
-11861873,
-11861849,
-11861827,
-11861819,
-11861803,
-11861791,
-11861749,
-11861713,
-11861711,
-11861701,
-11861693,
-11861687,
-11861683,
-11861671,
-11861659,
-11861639,
-11861627,
-11861611,
-11861599,
-11861581,
-11861579,
-11861573,
-11861569,
-11861539,
-11861527,
-11861467,
-11861441,
-11861429,
-11861413,
-11861411,
-11861407,
-11861401,
-11861371,
-11861363,
-11861357,
-11861351,
-11861327,
-11861303,
-11861299,
-11861293,
-11861273,
-11861237,
-11861231,
-11861221,
-11861219,
-11861197,
-11861191,
-11861167,
-11861159,
-11861141,
-11861131,
-11861107,
-11861099,
-11861093,
-11861089,
-11861081,
-11861071,
-11861033,
-11861011,
-11860993,
-11860973,
-11860963,
-11860897,
-11860867,
-11860859,
-11860837,
-11860811,
-11860789,
-11860787,
-11860777,
-11860753,
-11860741,
-11860727,
-11860703,
-11860699,
-11860697,
-11860691,
-11860687,
-11860669,
-11860661,
-11860649,
-11860643,
-11860637,
-11860627,
-11860619,
-11860613,
-11860573,
-11860547,
-11860517,
-11860489,
-11860487,
-11860483,
-11860477,
-11860469,
-11860411,
-11860397,
-11860379,
-11860327,
-11860267,
-11860243,
-11860231,
-11860223,
-11860207,
-11860171,
-11860151,
-11860133,
-11860109,
-11860103,
-11860097,
-11860087,
-11860081,
-11860049,
-11860039,
-11860031,
-11860021,
-11859997,
-11859989,
-11859979,
-11859961,
-11859929,
-11859923,
-11859917,
-11859907,
-11859901,
-11859893,
-11859889,
-11859877,
-11859853,
-11859847,
-11859833,
-11859821,
-11859817,
-11859791,
-11859751,
-11859739,
-11859719,
-11859713,
-11859707,
-11859643,
-11859611,
-11859583,
-11859571,
-11859569,
-11859563,
-11859541,
-11859539,
-11859509,
-11859503,
-11859487,
-11859481,
-11859473,
-11859461,
-11859457,
-11859451,
-11859433,
-11859427,
-11859383,
-11859377,
-11859371,
-11859359,
-11859349,
-11859311,
-11859307,
-11859293,
-11859269,
-11859247,
-11859241,
-11859233,
-11859187,
-11859179,
-11859167,
-11859163,
-11859157,
-11859151,
-11859139,
-11859137,
-11859109,
-11859101,
-11859083,
-11859079,
-11859077,
-11859073,
-11859061,
-11859049,
-11859031,
-11859017,
-11858989,
-11858971,
-11858969,
-11858953,
-11858947,
-11858921,
-11858897,
-11858893,
-11858851,
-11858839,
-11858813,
-11858807,
-11858801,
-11858783,
-11858779,
-11858747,
-11858729,
-11858723,
-11858719,
-11858701,
-11858683,
-11858659,
-11858657,
-11858629,
-11858599,
-11858597,
-11858579,
-11858573,
-11858569,
-11858557,
-11858551,
-11858543,
-11858533,
-11858479,
-11858447,
-11858443,
-11858423,
-11858387,
-11858381,
-11858377,
-11858359,
-11858323,
-11858311,
-11858291,
-11858281,
-11858279,
-11858269,
-11858267,
-11858243,
-11858227,
-11858201,
-11858177,
-11858159,
-11858149,
-11858131,
-11858101,
-11858059,
-11858057,
-11858051,
-11858039,
-11858029,
-11858023,
-11858017,
-11857999,
-11857991,
-11857969,
-11857931,
-11857913,
-11857907,
-11857889,
-11857883,
-11857877,
-11857873,
-11857837,
-11857831,
-11857819,
-11857817,
-11857801,
-11857793,
-11857787,
-11857777,
-11857763,
-11857759,
-11857753,
-11857751,
-11857711,
-11857709,
-11857697,
-11857693,
-11857667,
-11857661,
-11857613,
-11857591,
-11857589,
-11857543,
-11857529,
-11857523,
-11857519,
-11857499,
-11857493,
-11857481,
-11857477,
-11857457,
-11857453,
-11857451,
-11857423,
-11857409,
-11857393,
-11857369,
-11857367,
-11857361,
-11857333,
-11857331,
-11857327,
-11857303,
-11857291,
-11857267,
-11857249,
-11857243,
-11857217,
-11857193,
-11857151,
-11857147,
-11857127,
-11857123,
-11857099,
-11857093,
-11857091,
-11857081,
-11857073,
-11857067,
-11857061,
-11857049,
-11857039,
-11857037,
-11857033,
-11857003,
-11856979,
-11856953,
-11856947,
-11856919,
-11856899,
-11856883,
-11856877,
-11856857,
-11856841,
-11856821,
-11856811,
-11856763,
-11856731,
-11856727,
-11856709,
-11856697,
-11856673,
-11856659,
-11856653,
-11856641,
-11856629,
-11856583,
-11856553,
-11856547,
-11856541,
-11856517,
-11856511,
-11856479,
-11856473,
-11856469,
-11856461,
-11856419,
-11856409,
-11856373,
-11856371,
-11856359,
-11856343,
-11856329,
-11856311,
-11856307,
-11856287,
-11856281,
-11856269,
-11856239,
-11856223,
-11856199,
-11856193,
-11856179,
-11856161,
-11856151,
-11856139,
-11856113,
-11856107,
-11856101,
-11856071,
-11856049,
-11856023,
-11856001,
-11855999,
-11855993,
-11855989,
-11855959,
-11855933,
-11855911,
-11855903,
-11855881,
-11855869,
-11855839,
-11855827,
-11855813,
-11855773,
-11855759,
-11855747,
-11855743,
-11855737,
-11855731,
-11855713,
-11855699,
-11855689,
-11855687,
-11855653,
-11855633,
-11855593,
-11855581,
-11855567,
-11855551,
-11855549,
-11855531,
-11855521,
-11855507,
-11855491,
-11855489,
-11855413,
-11855407,
-11855387,
-11855383,
-11855381,
-11855359,
-11855357,
-11855353,
-11855351,
-11855339,
-11855329,
-11855321,
-11855309,
-11855303,
-11855269,
-11855267,
-11855231,
-11855219,
-11855213,
-11855177,
-11855159,
-11855149,
-11855147,
-11855141,
-11855111,
-11855033,
-11855023,
-11855017,
-11855003,
-11854979,
-11854961,
-11854937,
-11854919,
-11854901,
-11854897,
-11854891,
-11854883,
-11854877,
-11854873,
-11854853,
-11854847,
-11854813,
-11854793,
-11854757,
-11854709,
-11854691,
-11854681,
-11854607,
-11854603,
-11854573,
-11854571,
-11854567,
-11854529,
-11854523,
-11854519,
-11854517,
-11854489,
-11854477,
-11854463,
-11854441,
-11854439,
-11854433,
-11854429,
-11854411,
-11854399,
-11854379,
-11854363,
-11854333,
-11854331,
-11854327,
-11854279,
-11854267,
-11854261,
-11854211,
-11854169,
-11854163,
-11854159,
-11854147,
-11854061,
-11854057,
-11854019,
-11854009,
-11854001,
-11853991,
-11853979,
-11853943,
-11853931,
-11853899,
-11853893,
-11853889,
-11853883,
-11853869,
-11853857,
-11853847,
-11853839,
-11853817,
-11853791,
-11853773,
-11853761,
-11853757,
-11853731,
-11853719,
-11853689,
-11853679,
-11853649,
-11853629,
-11853617,
-11853613,
-11853601,
-11853571,
-11853557,
-11853529,
-11853463,
-11853451,
-11853449,
-11853427,
-11853421,
-11853419,
-11853383,
-11853367,
-11853329,
-11853323,
-11853319,
-11853241,
-11853227,
-11853221,
-11853217,
-11853203,
-11853181,
-11853161,
-11853157,
-11853133,
-11853031,
-11853019,
-11853001,
-11852989,
-11852969,
-11852959,
-11852957,
-11852921,
-11852917,
-11852891,
-11852879,
-11852873,
-11852857,
-11852837,
-11852833,
-11852831,
-11852809,
-11852807,
-11852803,
-11852773,
-11852767,
-11852759,
-11852741,
-11852719,
-11852717,
-11852663,
-11852657,
-11852647,
-11852641,
-11852623,
-11852611,
-11852609,
-11852591,
-11852579,
-11852573,
-11852557,
-11852539,
-11852537,
-11852531,
-11852513,
-11852473,
-11852459,
-11852437,
-11852369,
-11852359,
-11852341,
-11852339,
-11852327,
-11852311,
-11852303,
-11852297,
-11852293,
-11852287,
-11852279,
-11852273,
-11852263,
-11852251,
-11852237,
-11852221,
-11852209,
-11852177,
-11852171,
-11852161,
-11852147,
-11852129,
-11852089,
-11852083,
-11852059,
-11852053,
-11852051,
-11852017,
-11851997,
-11851967,
-11851949,
-11851933,
-11851927,
-11851919,
-11851909,
-11851891,
-11851867,
-11851859,
-11851841,
-11851813,
-11851799,
-11851793,
-11851787,
-11851759,
-11851753,
-11851681,
-11851673,
-11851639,
-11851621,
-11851613,
-11851603,
-11851597,
-11851591,
-11851589,
-11851577,
-11851559,
-11851549,
-11851547,
-11851529,
-11851523,
-11851519,
-11851493,
-11851481,
-11851451,
-11851447,
-11851409,
-11851403,
-11851373,
-11851361,
-11851351,
-11851349,
-11851313,
-11851303,
-11851291,
-11851219,
-11851201,
-11851181,
-11851157,
-11851139,
-11851127,
-11851123,
-11851109,
-11851093,
-11851067,
-11851051,
-11851033,
-11850997,
-11850991,
-11850983,
-11850961,
-11850953,
-11850947,
-11850941,
-11850931,
-11850919,
-11850913,
-11850907,
-11850899,
-11850877,
-11850859,
-11850829,
-11850803,
-11850791,
-11850749,
-11850739,
-11850731,
-11850701,
-11850677,
-11850667,
-11850611,
-11850607,
-11850557,
-11850541,
-11850529,
-11850511,
-11850481,
-11850469,
-11850427,
-11850407,
-11850379,
-11850373,
-11850367,
-11850347,
-11850341,
-11850283,
-11850269,
-11850259,
-11850247,
-11850233,
-11850191,
-11850169,
-11850161,
-11850133,
-11850127,
-11850121,
-11850109,
-11850103,
-11850077,
-11850073,
-11850061,
-11850049,
-11850031,
-11850023,
-11850019,
-11850011,
-11850001,
-11849987,
-11849947,
-11849933,
-11849923,
-11849909,
-11849891,
-11849881,
-11849869,
-11849813,
-11849801,
-11849791,
-11849771,
-11849767,
-11849759,
-11849743,
-11849741,
-11849723,
-11849713,
-11849707,
-11849701,
-11849699,
-11849693,
-11849689,
-11849683,
-11849671,
-11849659,
-11849653,
-11849641,
-11849633,
-11849599,
-11849587,
-11849573,
-11849569,
-11849567,
-11849557,
-11849507,
-11849503,
-11849491,
-11849473,
-11849443,
-11849437,
-11849417,
-11849413,
-11849401,
-11849399,
-11849363,
-11849359,
-11849339,
-11849309,
-11849297,
-11849291,
-11849273,
-11849269,
-11849251,
-11849249,
-11849239,
-11849237,
-11849231,
-11849203,
-11849183,
-11849177,
-11849137,
-11849129,
-11849111,
-11849107,
-11849093,
-11849087,
-11849077,
-11849069,
-11849059,
-11849053,
-11849039,
-11849021,
-11848961,
-11848937,
-11848931,
-11848919,
-11848909,
-11848873,
-11848867,
-11848861,
-11848853,
-11848829,
-11848801,
-11848787,
-11848757,
-11848751,
-11848741,
-11848729,
-11848721,
-11848717,
-11848709,
-11848691,
-11848679,
-11848673,
-11848663,
-11848637,
-11848619,
-11848601,
-11848591,
-11848589,
-11848553,
-11848537,
-11848531,
-11848523,
-11848513,
-11848493,
-11848489,
-11848477,
-11848469,
-11848451,
-11848433,
-11848393,
-11848379,
-11848373,
-11848363,
-11848351,
-11848339,
-11848313,
-11848297,
-11848271,
-11848253,
-11848247,
-11848241,
-11848237,
-11848219,
-11848181,
-11848159,
-11848157,
-11848147,
-11848129,
-11848117,
-11848093,
-11848069,
-11848043,
-11848027,
-11848021,
-11847977,
-11847961,
-11847949,
-11847907,
-11847883,
-11847877,
-11847853,
-11847799,
-11847791,
-11847761,
-11847749,
-11847721,
-11847701,
-11847653,
-11847643,
-11847637,
-11847629,
-11847607,
-11847593,
-11847587,
-11847581,
-11847571,
-11847569,
-11847533,
-11847529,
-11847527,
-11847523,
-11847499,
-11847497,
-11847467,
-11847463,
-11847427,
-11847397,
-11847391,
-11847373,
-11847347,
-11847343,
-11847299,
-11847281,
-11847271,
-11847263,
-11847257,
-11847233,
-11830253,
-11814059,
-11797861,
-11781907,
-11765609,
-11749061,
-11732887,
-11716381,
-11699993,
-11684149,
-11667269,
-11651309,
-11634739,
-11618281,
-11602949,
-11586493,
-11570407,
-11554009,
-11538067,
-11522363,
-11505511,
-11489431,
-11472817,
-11457029,
-11441081,
-11424467,
-11408317,
-11392207,
-11375563,
-11359163,
-11343187,
-11326423,
-11310521,
-11293801,
-11278019,
-11261317,
-11245081,
-11228929,
-11212433,
-11196127,
-11179907,
-11163877,
-11148019,
-11131741,
-11114879,
-11098937,
-11082817,
-11066729,
-11050939,
-11034811,
-11018591,
-11001821,
-10985479,
-10969193,
-10953181,
-10937063,
-10921171,
-10904617,
-10888811,
-10872223,
-10856141,
-10840157,
-10824139,
-10807817,
-10791629,
-10775437,
-10758619,
-10742231,
-10726003,
-10709957,
-10693897,
-10677893,
-10662257,
-10646191,
-10629929,
-10613903,
-10597597,
-10581289,
-10565047,
-10549031,
-10533073,
-10516343,
-10500547,
-10484483,
-10468361,
-10452551,
-10436291,
-10420139,
-10403951,
-10388171,
-10371899,
-10356113,
-10339639,
-10323751,
-10307537,
-10291129,
-10274821,
-10259153,
-10243201,
-10226893,
-10210831,
-10194593,
-10178017,
-10161439,
-10145197,
-10129397,
-10113241,
-10097149,
-10080997,
-10064671,
-10048859,
-10033087,
-10017113,
-10000987,
-9984587,
-9968117,
-9951703,
-9935437,
-9919439,
-9903083,
-9887179,
-9870853,
-9854791,
-9838123,
-9821809,
-9805793,
-9790177,
-9774007,
-9757703,
-9741377,
-9725707,
-9709379,
-9693031,
-9677027,
-9661009,
-9645131,
-9628939,
-9613127,
-9596597,
-9581053,
-9565291,
-9548909,
-9533023,
-9516809,
-9500993,
-9484931,
-9468793,
-9452269,
-9436439,
-9419909,
-9403967,
-9387671,
-9371371,
-9355471,
-9339569,
-9323669,
-9307513,
-9291539,
-9275377,
-9259109,
-9243281,
-9227321,
-9211759,
-9195671,
-9179591,
-9163981,
-9147521,
-9131957,
-9115709,
-9099589,
-9083521,
-9067631,
-9051563,
-9035357,
-9019259,
-9002717,
-8986751,
-8970821,
-8954321,
-8938301,
-8922611,
-8907077,
-8890823,
-8874659,
-8858677,
-8842541,
-8826221,
-8810147,
-8794081,
-8778299,
-8762357,
-8746637,
-8730467,
-8714551,
-8698813,
-8683159,
-8666773,
-8651117,
-8635049,
-8618861,
-8603183,
-8587127,
-8571509,
-8555317,
-8539747,
-8523787,
-8508217,
-8492329,
-8476723,
-8460533,
-8444671,
-8428289,
-8412169,
-8396111,
-8380237,
-8364329,
-8348107,
-8332547,
-8316449,
-8300603,
-8284447,
-8268907,
-8252551,
-8236729,
-8220881,
-8205163,
-8189123,
-8173427,
-8157343,
-8141753,
-8125373,
-8109887,
-8093707,
-8077463,
-8061421,
-8045669,
-8029717,
-8013701,
-7997623,
-7981837,
-7965871,
-7949731,
-7934089,
-7918123,
-7902269,
-7886297,
-7870657,
-7854667,
-7839269,
-7823279,
-7807549,
-7791857,
-7775479,
-7759813,
-7743737,
-7727477,
-7711741,
-7695707,
-7680181,
-7664311,
-7648439,
-7632511,
-7616881,
-7601081,
-7585639,
-7569469,
-7553437,
-7537903,
-7521949,
-7505863,
-7489847,
-7474381,
-7457993,
-7442333,
-7426421,
-7410857,
-7394873,
-7378687,
-7363123,
-7347521,
-7331309,
-7315673,
-7299493,
-7283833,
-7268039,
-7252381,
-7236821,
-7220921,
-7204891,
-7189333,
-7173233,
-7157429,
-7141759,
-7125413,
-7109423,
-7094023,
-7078283,
-7062529,
-7046581,
-7031281,
-7015973,
-6999823,
-6984193,
-6968123,
-6952441,
-6937027,
-6921281,
-6905713,
-6889789,
-6874223,
-6858913,
-6843289,
-6827543,
-6811877,
-6796591,
-6780271,
-6764353,
-6748897,
-6733171,
-6717493,
-6702197,
-6686663,
-6670709,
-6654877,
-6639049,
-6622999,
-6607379,
-6591811,
-6576307,
-6560669,
-6545171,
-6529403,
-6513613,
-6498169,
-6482407,
-6466487,
-6451087,
-6435179,
-6419299,
-6403739,
-6388061,
-6371879,
-6355963,
-6340043,
-6324401,
-6308737,
-6293681,
-6278309,
-6262721,
-6247243,
-6231497,
-6215617,
-6199847,
-6184289,
-6168353,
-6152869,
-6137477,
-6121681,
-6105949,
-6090569,
-6074779,
-6058963,
-6043417,
-6027277,
-6011899,
-5996687,
-5981071,
-5965021,
-5949313,
-5933713,
-5918293,
-5903251,
-5887631,
-5872549,
-5856709,
-5841373,
-5825711,
-5809861,
-5794457,
-5778673,
-5762759,
-5747227,
-5731463,
-5716021,
-5700451,
-5685413,
-5669803,
-5654083,
-5638103,
-5622731,
-5607149,
-5591459,
-5575601,
-5560327,
-5544613,
-5529079,
-5513267,
-5497711,
-5481989,
-5466217,
-5450773,
-5435533,
-5420083,
-5404433,
-5388689,
-5373607,
-5357903,
-5342327,
-5327041,
-5311511,
-5295839,
-5280367,
-5264821,
-5249411,
-5234237,
-5218721,
-5203477,
-5188123,
-5172227,
-5156839,
-5141117,
-5125871,
-5110561,
-5094841,
-5079493,
-5064119,
-5048741,
-5033053,
-5017637,
-5001923,
-4986439,
-4971409,
-4956151,
-4940843,
-4925419,
-4909859,
-4894753,
-4879937,
-4864511,
-4849081,
-4833989,
-4818287,
-4803031,
-4787569,
-4771999,
-4756649,
-4740979,
-4725673,
-4710373,
-4695079,
-4679813,
-4664641,
-4649119,
-4633693,
-4618307,
-4603031,
-4587589,
-4572383,
-4556933,
-4541819,
-4526363,
-4510687,
-4495079,
-4480183,
-4464877,
-4449617,
-4434811,
-4419773,
-4404679,
-4389223,
-4373647,
-4358659,
-4342991,
-4327621,
-4312381,
-4297201,
-4281481,
-4265903,
-4250777,
-4235411,
-4220207,
-4204903,
-4189583,
-4174601,
-4159471,
-4144267,
-4128763,
-4113127,
-4097957,
-4082909,
-4067741,
-4052383,
-4037521,
-4022587,
-4007447,
-3992159,
-3976481,
-3961229,
-3945919,
-3930611,
-3915761,
-3900509,
-3885691,
-3870299,
-3854969,
-3839923,
-3824591,
-3809959,
-3794941,
-3779443,
-3764311,
-3748879,
-3733397,
-3718837,
-3703643,
-3688757,
-3673793,
-3658769,
-3643331,
-3628057,
-3613201,
-3598691,
-3583757,
-3568259,
-3553453,
-3538027,
-3522763,
-3507587,
-3492287,
-3476783,
-3461291,
-3445801,
-3431353,
-3416267,
-3401509,
-3386563,
-3371419,
-3356389,
-3341101,
-3325991,
-3311051,
-3295883,
-3280759,
-3265861,
-3250837,
-3235819,
-3220967,
-3206311,
-3191603,
-3176821,
-3162059,
-3147101,
-3131761,
-3117031,
-3102371,
-3087239,
-3072533,
-3057647,
-3042493,
-3027347,
-3012137,
-2997509,
-2982583,
-2967647,
-2952629,
-2937611,
-2922677,
-2907871,
-2892973,
-2877899,
-2862917,
-2847893,
-2833211,
-2818451,
-2804027,
-2789327,
-2774309,
-2759621,
-2744551,
-2729563,
-2714629,
-2699903,
-2685323,
-2670533,
-2655571,
-2641063,
-2626307,
-2611597,
-2596501,
-2581697,
-2567447,
-2552657,
-2537779,
-2523163,
-2508281,
-2493767,
-2478937,
-2464009,
-2449417,
-2434681,
-2419793,
-2405069,
-2390207,
-2375921,
-2361167,
-2346473,
-2331689,
-2316593,
-2301709,
-2287249,
-2272241,
-2258083,
-2243551,
-2228797,
-2214161,
-2199623,
-2184779,
-2170153,
-2155603,
-2141149,
-2126623,
-2111933,
-2097539,
-2082917,
-2068201,
-2053789,
-2038969,
-2024417,
-2010017,
-1995977,
-1981523,
-1966619,
-1952023,
-1937657,
-1923253,
-1908923,
-1894127,
-1879949,
-1865509,
-1851503,
-1836943,
-1822703,
-1808071,
-1793927,
-1779497,
-1765187,
-1750423,
-1736281,
-1721659,
-1707253,
-1692967,
-1678429,
-1664501,
-1650059,
-1635317,
-1621421,
-1606897,
-1592881,
-1578217,
-1563967,
-1549577,
-1535459,
-1520707,
-1506497,
-1492499,
-1478467,
-1464173,
-1450139,
-1435919,
-1422163,
-1407569,
-1393663,
-1379321,
-1365281,
-1351199,
-1336997,
-1322693,
-1308719,
-1294483,
-1280453,
-1266281,
-1252469,
-1238551,
-1224193,
-1210369,
-1195771,
-1181963,
-1168231,
-1154633,
-1140563,
-1126693,
-1112483,
-1099051,
-1085023,
-1071229,
-1057279,
-1043201,
-1029179,
-1015451,
-1001821,
-988061,
-973901,
-960293,
-946133,
-932357,
-918677,
-905071,
-891239,
-877469,
-864013,
-850247,
-836477,
-822883,
-809423,
-795737,
-782191,
-768671,
-755309,
-741509,
-728003,
-714563,
-701341,
-687679,
-674363,
-660893,
-647557,
-634031,
-620363,
-607127,
-593899,
-580733,
-567659,
-554167,
-540863,
-527441,
-514561,
-501217,
-488347,
-475283,
-462493,
-449161,
-435889,
-423257,
-410341,
-397223,
-384407,
-371573,
-358471,
-345769,
-333019,
-320317,
-307873,
-295291,
-282427,
-269947,
-257501,
-245083,
-232523,
-220327,
-208049,
-195787,
-183683,
-171673,
-159499,
-147551,
-135649,
-123853,
-112223,
-100547,
-89203,
-77719,
-66587,
-55589,
-44633,
-34019,
-23741,
-13877,
-4733
+11863279, 11863067, 11862791, 11862493, 11862229, 11861921, 11861683, 11861413,
+11861219, 11860973, 11860691, 11860477, 11860097, 11859893, 11859583, 11859383,
+11859157, 11858969, 11858719, 11858447, 11858201, 11857931, 11857759, 11857499,
+11857303, 11857067, 11856821, 11856517, 11856281, 11856001, 11855743, 11855507,
+11855303, 11854979, 11854691, 11854433, 11854147, 11853847, 11853571, 11853221,
+11852891, 11852663, 11852459, 11852237, 11851949, 11851673, 11851481, 11851139,
+11850919, 11850607, 11850259, 11850023, 11849767, 11849633, 11849399, 11849177,
+11848919, 11848691, 11848477, 11848237, 11847907, 11847587, 11847347, 11699993,
+11441081, 11179907, 10921171, 10662257, 10403951, 10145197, 9887179, 9628939,
+9371371, 9115709, 8858677, 8603183, 8348107, 8093707, 7839269, 7585639,
+7331309, 7078283, 6827543, 6576307, 6324401, 6074779, 5825711, 5575601,
+5327041, 5079493, 4833989, 4587589, 4342991, 4097957, 3854969, 3613201,
+3371419, 3131761, 2892973, 2655571, 2419793, 2184779, 1952023, 1721659,
+1492499, 1266281, 1043201, 822883, 607127, 397223, 195787, 13877
+};
+
+
+const unsigned char prime_gaps_32[PRIMELISTSIZE1] =
+{
+3, 10, 3, 2, 6, 12, 3, 12, 6, 9, 1, 9, 6, 6, 5, 13,
+3, 5, 9, 1, 3, 5, 16, 5, 10, 20, 4, 15, 6, 6, 9, 18,
+6, 15, 24, 5, 1, 11, 3, 6, 19, 6, 15, 2, 4, 3, 8, 10,
+17, 12, 15, 24, 9, 15, 13, 2, 3, 7, 11, 1, 5, 9, 1, 3,
+2, 3, 3, 7, 2, 16, 5, 37, 17, 9, 1, 8, 3, 10, 14, 3,
+16, 2, 15, 4, 3, 12, 11, 4, 8, 6, 21, 18, 1, 5, 4, 3,
+2, 6, 6, 10, 6, 8, 6, 9, 1, 3, 2, 15, 6, 30, 13, 6,
+8, 1, 2, 3, 15, 4, 3, 3, 12, 12, 2, 3, 10, 18, 3, 5,
+1, 11, 3, 12, 4, 9, 5, 12, 4, 3, 2, 4, 5, 19, 11, 9,
+10, 5, 33, 15, 4, 11, 13, 11, 1, 5, 12, 6, 7, 12, 2, 1,
+3, 2, 9, 4, 6, 3, 3, 5, 4, 3, 20, 13, 15, 14, 1, 2,
+3, 4, 29, 7, 9, 26, 30, 12, 6, 4, 8, 18, 10, 9, 12, 3,
+3, 5, 3, 16, 5, 4, 5, 12, 4, 5, 9, 16, 3, 3, 5, 3,
+4, 2, 6, 12, 3, 7, 6, 2, 13, 20, 6, 10, 3, 3, 32, 16,
+14, 6, 1, 3, 11, 1, 15, 3, 8, 3, 4, 6, 2, 3, 9, 3,
+22, 3, 3, 6, 5, 19, 2, 7, 12, 11, 3, 4, 23, 4, 6, 2,
+3, 3, 6, 1, 14, 4, 9, 2, 1, 2, 6, 6, 9, 7, 14, 9,
+1, 8, 3, 13, 12, 2, 21, 6, 13, 3, 3, 9, 2, 16, 9, 3,
+2, 9, 9, 12, 1, 14, 15, 1, 9, 3, 2, 6, 3, 4, 5, 27,
+16, 2, 10, 18, 3, 2, 9, 18, 6, 10, 5, 1, 5, 1, 12, 8,
+13, 12, 9, 5, 9, 15, 21, 1, 3, 6, 5, 3, 3, 9, 4, 11,
+19, 9, 3, 9, 3, 3, 2, 18, 3, 6, 1, 8, 4, 3, 5, 7,
+2, 3, 1, 20, 1, 6, 2, 13, 3, 24, 11, 1, 23, 7, 3, 2,
+10, 3, 6, 2, 10, 2, 1, 14, 7, 8, 12, 1, 3, 14, 1, 2,
+12, 6, 12, 9, 3, 13, 12, 21, 2, 10, 2, 12, 3, 1, 5, 4,
+3, 3, 6, 5, 1, 2, 15, 12, 13, 3, 14, 10, 8, 3, 10, 8,
+10, 5, 24, 16, 2, 9, 6, 12, 7, 3, 6, 6, 23, 15, 3, 3,
+12, 3, 16, 3, 2, 4, 21, 5, 18, 1, 6, 8, 7, 9, 2, 10,
+3, 6, 15, 8, 12, 3, 7, 9, 5, 6, 13, 3, 3, 15, 11, 13,
+11, 1, 3, 2, 15, 13, 11, 4, 11, 6, 15, 6, 7, 20, 7, 6,
+2, 3, 3, 9, 7, 5, 1, 17, 10, 20, 6, 7, 8, 1, 9, 5,
+7, 8, 1, 38, 3, 10, 2, 1, 11, 1, 2, 1, 6, 5, 4, 6,
+3, 17, 1, 18, 6, 3, 18, 9, 5, 1, 3, 15, 39, 5, 3, 7,
+12, 9, 12, 9, 9, 2, 3, 4, 3, 2, 10, 3, 17, 10, 18, 24,
+9, 5, 37, 2, 15, 1, 2, 19, 3, 2, 1, 14, 6, 7, 11, 1,
+3, 2, 9, 6, 10, 8, 15, 1, 2, 24, 6, 3, 25, 21, 3, 2,
+6, 43, 2, 19, 5, 4, 5, 6, 18, 6, 16, 3, 2, 3, 7, 6,
+5, 4, 11, 13, 9, 6, 2, 13, 6, 15, 5, 15, 10, 6, 2, 6,
+15, 7, 14, 33, 6, 1, 11, 3, 1, 18, 8, 19, 3, 2, 39, 7,
+3, 2, 7, 11, 10, 2, 12, 51, 6, 9, 6, 10, 5, 1, 18, 2,
+13, 6, 3, 8, 10, 2, 1, 11, 1, 2, 15, 3, 4, 9, 11, 1,
+27, 3, 5, 3, 9, 6, 1, 9, 6, 3, 8, 9, 1, 3, 9, 20,
+7, 11, 34, 5, 9, 1, 6, 8, 4, 3, 2, 3, 4, 3, 5, 6,
+7, 8, 6, 16, 3, 5, 7, 9, 20, 3, 12, 3, 1, 17, 10, 15,
+9, 8, 3, 4, 5, 9, 12, 4, 9, 14, 7, 3, 3, 14, 3, 36,
+4, 17, 9, 4, 5, 3, 3, 1, 6, 9, 5, 1, 9, 3, 2, 13,
+6, 15, 2, 19, 3, 15, 6, 5, 1, 18, 5, 6, 36, 9, 10, 12,
+9, 6, 2, 7, 8, 13, 8, 9, 18, 3, 4, 11, 4, 3, 3, 5,
+6, 3, 3, 4, 11, 9, 15, 13, 6, 21, 5, 4, 15, 12, 5, 28,
+2, 25, 8, 6, 9, 15, 6, 21, 10, 14, 3, 3, 10, 3, 29, 7,
+5, 6, 7, 21, 11, 4, 14, 3, 3, 6, 3, 13, 2, 6, 6, 9,
+4, 2, 4, 5, 7, 20, 7, 5, 7, 9, 5, 6, 28, 6, 5, 10,
+2, 4, 8, 1, 9, 5, 3, 3, 1, 3, 2, 3, 6, 6, 3, 6,
+4, 17, 6, 7, 2, 1, 5, 25, 2, 6, 9, 15, 3, 10, 2, 6,
+1, 18, 2, 10, 15, 6, 3, 9, 2, 9, 1, 5, 1, 3, 14, 10,
+3, 20, 4, 9, 2, 7, 3, 5, 4, 5, 3, 7, 9, 30, 12, 3,
+6, 5, 18, 3, 3, 4, 12, 14, 7, 15, 3, 5, 6, 4, 2, 4,
+9, 6, 3, 5, 13, 9, 9, 5, 1, 18, 8, 3, 4, 5, 10, 2,
+6, 4, 9, 9, 20, 7, 3, 5, 6, 6, 13, 8, 13, 9, 3, 3,
+2, 9, 19, 11, 1, 5, 9, 6, 12, 12, 13, 8, 3, 22, 8, 6,
+21, 12, 3, 12, 27, 4, 15, 6, 14, 10, 24, 5, 3, 4, 11, 7,
+3, 3, 5, 1, 18, 2, 1, 2, 12, 1, 15, 2, 18, 15, 3, 9,
+13, 2, 22, 9, 5, 4, 3, 12
+};
+
+
+const unsigned short prime_diffs_32[PRIMELISTSIZE2 - PRIMELISTSIZE1] =
+{
+3918, 3525, 3527, 3405, 3577, 3702, 3515, 3681, 3622, 3350, 3868, 3408,
+3713, 3657, 3094, 3656, 3471, 3627, 3399, 3280, 3854, 3468, 3735, 3322,
+3402, 3735, 3503, 3483, 3750, 3628, 3416, 3810, 3379, 3788, 3319, 3779,
+3546, 3504, 3676, 3581, 3538, 3443, 3357, 3567, 3859, 3399, 3488, 3472,
+3323, 3492, 3538, 3813, 3599, 3571, 3434, 3487, 3374, 3705, 3331, 3722,
+3469, 3420, 3437, 3589, 3522, 3524, 3837, 3622, 3542, 3451, 3458, 3430,
+3246, 3461, 3559, 3441, 3581, 3582, 3549, 3436, 3407, 3793, 3326, 3460,
+3489, 3333, 3558, 3504, 3522, 3318, 3564, 3321, 3665, 3372, 3535, 3632,
+3582, 3262, 3404, 3582, 3459, 3547, 3716, 3717, 3549, 3328, 3506, 3474,
+3504, 3591, 3334, 3314, 3415, 3491, 3628, 3663, 3635, 3561, 3427, 3606,
+3380, 3591, 3459, 3762, 3585, 3436, 3236, 3513, 3580, 3591, 3263, 3592,
+3602, 3430, 3437, 3367, 3524, 3334, 3693, 3200, 3309, 3619, 3371, 3535,
+3336, 3459, 3497, 3690, 3343, 3693, 3399, 3576, 3578, 3378, 3379, 3378,
+3506, 3415, 3509, 3562, 3342, 3408, 3209, 3472, 3468, 3233, 3658, 3210,
+3552, 3488, 3462, 3373, 3462, 3531, 3477, 3699, 3411, 3393, 3678, 3438,
+3273, 3195, 3555, 3510, 3419, 3496, 3588, 3465, 3461, 3319, 3399, 3288,
+3513, 3386, 3297, 3255, 3621, 3256, 3462, 3522, 3267, 3456, 3237, 3524,
+3213, 3408, 3213, 3372, 3231, 3523, 3359, 3619, 3488, 3457, 3365, 3382,
+3539, 3208, 3477, 3351, 3506, 3198, 3606, 3339, 3352, 3287, 3448, 3276,
+3470, 3223, 3618, 3171, 3518, 3550, 3449, 3304, 3404, 3436, 3467, 3321,
+3411, 3498, 3249, 3411, 3355, 3414, 3248, 3423, 3127, 3423, 3293, 3274,
+3617, 3261, 3466, 3558, 3296, 3445, 3191, 3363, 3364, 3392, 3243, 3328,
+3149, 3513, 3444, 3195, 3405, 3471, 3436, 3161, 3622, 3258, 3384, 3210,
+3420, 3521, 3210, 3229, 3534, 3246, 3518, 3258, 3325, 3257, 3208, 3378,
+3443, 3207, 3478, 3330, 3263, 3601, 3423, 3128, 3298, 3305, 3402, 3078,
+3082, 3503, 3243, 3463, 3269, 3135, 3301, 3212, 3390, 3211, 3083, 3240,
+3301, 3261, 3071, 3588, 3387, 3156, 3291, 3267, 3076, 3195, 3405, 3344,
+3342, 3453, 3238, 3212, 3180, 3247, 3177, 3312, 3323, 3150, 3309, 3388,
+3128, 3382, 3368, 3208, 3267, 3519, 3386, 3388, 3249, 3260, 2956, 3114,
+3222, 3167, 3301, 3368, 3313, 3207, 3396, 3170, 3124, 3326, 3294, 3118,
+3323, 3336, 3201, 3498, 3117, 3034, 3236, 3453, 3282, 3228, 3138, 2949,
+3238, 2969, 3348, 3096, 3259, 3353, 3130, 3320, 3385, 3194, 3310, 3149,
+3213, 2947, 3233, 3288, 3418, 3114, 3219, 3273, 3357, 3065, 3285, 3195,
+3334, 3206, 3289, 3314, 3150, 3048, 3153, 3253, 3300, 2969, 3280, 3216,
+3071, 3193, 3264, 3164, 3201, 3133, 3015, 3186, 3050, 3105, 3376, 3122,
+3289, 3051, 3083, 3288, 3102, 3115, 3117, 3272, 3136, 3285, 3170, 2943,
+3057, 3082, 3140, 3208, 2981, 2836, 3141, 3143, 2974, 3279, 3056, 3159,
+3213, 3103, 3263, 3081, 3078, 3075, 3061, 3014, 3189, 3141, 3121, 3066,
+3149, 3031, 3153, 2985, 3156, 3266, 3232, 2876, 3081, 3058, 2831, 2947,
+2975, 3156, 3216, 2922, 3262, 3113, 3048, 3018, 3288, 3217, 2991, 3111,
+3030, 3080, 3088, 2919, 2993, 3030, 3180, 3246, 3013, 2952, 3012, 3107,
+2859, 2895, 2998, 3072, 3267, 3054, 3083, 3082, 2853, 3054, 2837, 3124,
+3093, 2951, 3094, 2744, 2937, 3177, 2994, 3144, 3169, 2708, 3025, 2871,
+2910, 2940, 3147, 3065, 2856, 2683, 2895, 3177, 2831, 3141, 3060, 3016,
+3078, 3180, 3174, 3173, 2652, 2971, 2807, 2901, 3000, 2943, 3072, 2983,
+2898, 3012, 2990, 2877, 2940, 2937, 2854, 2756, 2782, 2819, 2809, 2907,
+3098, 2793, 2758, 2994, 2781, 2871, 3005, 3001, 3033, 2742, 2891, 2896,
+2937, 2937, 2895, 2831, 2877, 2965, 2919, 2940, 2769, 2808, 2640, 2778,
+2937, 2772, 2963, 2922, 2895, 2791, 2718, 2823, 2909, 2682, 2806, 2783,
+2976, 2830, 2553, 2823, 2867, 2736, 2869, 2685, 2843, 2892, 2724, 2796,
+2872, 2790, 2859, 2571, 2805, 2775, 2820, 2976, 2870, 2658, 2932, 2507,
+2694, 2805, 2746, 2697, 2850, 2741, 2703, 2655, 2691, 2773, 2625, 2739,
+2786, 2634, 2838, 2704, 2628, 2448, 2655, 2880, 2726, 2611, 2630, 2593,
+2826, 2517, 2648, 2431, 2708, 2548, 2744, 2500, 2643, 2583, 2810, 2499,
+2739, 2631, 2571, 2697, 2392, 2649, 2799, 2376, 2690, 2436, 2760, 2553,
+2623, 2487, 2804, 2533, 2427, 2444, 2575, 2445, 2538, 2306, 2725, 2381,
+2599, 2448, 2469, 2529, 2580, 2415, 2546, 2443, 2514, 2334, 2387, 2607,
+2340, 2727, 2332, 2294, 2227, 2463, 2363, 2533, 2144, 2442, 2325, 2403,
+2467, 2439, 2292, 2243, 2308, 2508, 2232, 2508, 2316, 2268, 2231, 2344,
+2313, 2156, 2311, 2313, 2225, 2158, 2271, 2201, 2188, 2109, 2328, 2181,
+2148, 2039, 2259, 2086, 2163, 2096, 2191, 2262, 2046, 2042, 2011, 1965,
+2174, 2080, 2139, 1868, 2100, 1863, 1960, 1823, 2094, 2064, 1744, 1886,
+1987, 1836, 1845, 1979, 1779, 1803, 1779, 1650, 1719, 1860, 1668, 1651,
+1637, 1708, 1526, 1567, 1559, 1480, 1433, 1515, 1402, 1379, 1326, 1243,
+1266, 1100, 1170, 994, 927, 906, 735, 567, 360, 0
 };
 
@@ -0,0 +1,1359 @@
+/*
+ *  Compressed table of primes below MAXPRIME_64 (see primes_64.cpp).
+ *
+ *  Entry i < PRIMELISTSIZE1_64 is the i-th prime below MAXPRIME_64, entry
+ *  i >= PRIMELISTSIZE1_64 is the prime of offset (i - PRIMELISTSIZE1_64 + 1) * STEP_64
+ *  + PRIMELISTSIZE1_64 - 1. Entries are stored as half the difference to the
+ *  previous entry (all primes are odd): one byte in the first section, and
+ *  two bytes offset by PRIMEDIFF_MIN_64 in the second section. Every
+ *  PRIMEMARK_64-th entry is also stored in full for random access.
+ *
+ *  Generated by scripts/primelist_encode.pl from the table of the original
+ *  SPRNG 64 bit primes (dev_src/primelist_64.h), do not edit. Sizes and
+ *  STEP_64 are those of the original table, PRIMEDIFF_MIN_64 is the smallest
+ *  half difference of the second section, and PRIMEMARK_64 bounds the
+ *  differences decoded per lookup.
+ */
+const int PRIMELISTSIZE1_64 = 1000;
+const int PRIMELISTSIZE2_64 = 15613;
+const int STEP_64 = 10000;
+const int PRIMEMARK_64 = 64;
+const unsigned int PRIMEDIFF_MIN_64 = 61198U;
+
+
+const unsigned int prime_marks_64[244] =
+{
+3037000493U, 3036999067U, 3036997727U, 3036996307U, 3036994931U, 3036993607U,
+3036992503U, 3036991063U, 3036989609U, 3036988309U, 3036986969U, 3036985607U,
+3036984367U, 3036982843U, 3036981481U, 3036980039U, 3031526081U, 3017544701U,
+3003576871U, 2989597759U, 2975638751U, 2961679121U, 2947712767U, 2933761433U,
+2919817627U, 2905864067U, 2891924291U, 2877978211U, 2864041781U, 2850111983U,
+2836180517U, 2822249779U, 2808327799U, 2794411001U, 2780487971U, 2766583471U,
+2752663559U, 2738750713U, 2724834121U, 2710924687U, 2697028651U, 2683137199U,
+2669247731U, 2655354607U, 2641464583U, 2627571263U, 2613692597U, 2599807471U,
+2585941643U, 2572077103U, 2558218781U, 2544362081U, 2530510111U, 2516659099U,
+2502819383U, 2488953791U, 2475110999U, 2461272043U, 2447430317U, 2433598367U,
+2419771187U, 2405944223U, 2392113121U, 2378293279U, 2364482947U, 2350663867U,
+2336851397U, 2323044107U, 2309242093U, 2295440813U, 2281654673U, 2267870603U,
+2254096151U, 2240319527U, 2226547241U, 2212766779U, 2198990219U, 2185228519U,
+2171462441U, 2157706357U, 2143959581U, 2130203653U, 2116443677U, 2102714129U,
+2088986687U, 2075249549U, 2061522713U, 2047791847U, 2034072233U, 2020350851U,
+2006644403U, 1992947581U, 1979246653U, 1965554191U, 1951860359U, 1938173087U,
+1924489667U, 1910802847U, 1897133809U, 1883458481U, 1869789989U, 1856122343U,
+1842463939U, 1828810271U, 1815158353U, 1801510229U, 1787886053U, 1774256161U,
+1760628371U, 1747002469U, 1733384509U, 1719766823U, 1706166377U, 1692562093U,
+1678968337U, 1665380273U, 1651784759U, 1638194989U, 1624630261U, 1611057827U,
+1597487621U, 1583923169U, 1570376557U, 1556815321U, 1543278167U, 1529731897U,
+1516211933U, 1502682551U, 1489166039U, 1475662079U, 1462148579U, 1448648989U,
+1435150831U, 1421659849U, 1408174433U, 1394691731U, 1381218071U, 1367742331U,
+1354287721U, 1340841889U, 1327398283U, 1313949479U, 1300522403U, 1287085523U,
+1273665233U, 1260257827U, 1246854223U, 1233451543U, 1220047229U, 1206669041U,
+1193283407U, 1179901351U, 1166538743U, 1153187417U, 1139831323U, 1126474469U,
+1113138293U, 1099811047U, 1086495727U, 1073184083U, 1059890033U, 1046584937U,
+1033301741U, 1020020171U, 1006755119U, 993491119U, 980242871U, 966990467U,
+953761241U, 940534457U, 927303313U, 914097449U, 900906637U, 887710319U,
+874517923U, 861350729U, 848183599U, 835027631U, 821884897U, 808753609U,
+795637589U, 782533847U, 769435741U, 756335977U, 743252057U, 730186241U,
+717129419U, 704081153U, 691046197U, 678035641U, 665019863U, 652026413U,
+639043667U, 626075917U, 613110397U, 600172591U, 587251337U, 574335733U,
+561436591U, 548551309U, 535676699U, 522826373U, 509981909U, 497142461U,
+484336837U, 471548069U, 458778251U, 446025029U, 433289327U, 420572881U,
+407867311U, 395188181U, 382526117U, 369899443U, 357280499U, 344684033U,
+332121589U, 319571167U, 307049789U, 294553247U, 282085339U, 269647501U,
+257237641U, 244859389U, 232517699U, 220207301U, 207925591U, 195684091U,
+183489073U, 171328837U, 159223517U, 147154583U, 135146093U, 123198661U,
+111300359U, 99482633U, 87735311U, 76067633U, 64507787U, 53058007U,
+41748299U, 30609311U, 19710289U, 9174793U
+};
+
+
+const unsigned char prime_gaps_64[PRIMELISTSIZE1_64] =
+{
+4, 20, 12, 1, 14, 4, 29, 1, 14, 7, 20, 28, 6, 2, 9, 19,
+5, 4, 17, 15, 13, 11, 4, 21, 21, 6, 5, 18, 10, 2, 3, 4,
+15, 2, 4, 11, 1, 2, 3, 114, 6, 7, 3, 5, 7, 2, 4, 14,
+12, 19, 11, 6, 7, 5, 6, 19, 12, 21, 5, 10, 12, 6, 6, 5,
+6, 3, 19, 2, 9, 1, 5, 6, 7, 3, 12, 15, 15, 8, 4, 3,
+3, 17, 13, 8, 1, 8, 13, 53, 6, 16, 2, 1, 12, 30, 14, 10,
+14, 10, 17, 7, 2, 15, 16, 5, 4, 9, 9, 15, 11, 24, 10, 11,
+10, 2, 18, 1, 18, 17, 3, 18, 22, 8, 12, 1, 12, 2, 16, 5,
+7, 3, 6, 6, 2, 25, 6, 6, 8, 3, 10, 9, 24, 5, 4, 50,
+1, 24, 2, 4, 21, 5, 31, 2, 22, 9, 9, 12, 14, 9, 21, 19,
+18, 8, 4, 11, 9, 10, 17, 6, 9, 15, 4, 12, 12, 2, 1, 17,
+21, 15, 7, 17, 13, 15, 3, 5, 15, 6, 9, 21, 3, 10, 2, 10,
+11, 4, 8, 15, 3, 18, 7, 38, 15, 7, 3, 11, 15, 3, 16, 2,
+12, 10, 6, 6, 8, 3, 3, 7, 14, 3, 3, 18, 15, 12, 7, 6,
+20, 15, 7, 9, 3, 11, 1, 3, 15, 6, 2, 18, 7, 9, 45, 44,
+7, 5, 4, 5, 25, 14, 4, 15, 17, 3, 13, 3, 5, 10, 12, 17,
+16, 5, 12, 4, 5, 16, 24, 6, 5, 15, 15, 7, 12, 3, 5, 1,
+17, 3, 1, 14, 21, 1, 8, 10, 2, 9, 10, 15, 8, 3, 10, 8,
+6, 10, 11, 9, 13, 17, 6, 4, 9, 9, 26, 21, 13, 2, 3, 10,
+2, 3, 16, 12, 20, 12, 6, 4, 11, 51, 16, 5, 4, 21, 5, 27,
+3, 3, 7, 8, 1, 14, 1, 5, 1, 8, 21, 16, 12, 23, 4, 14,
+1, 5, 18, 3, 10, 3, 5, 4, 6, 2, 18, 10, 9, 5, 1, 12,
+2, 3, 7, 3, 2, 25, 20, 3, 4, 6, 2, 16, 11, 10, 3, 2,
+30, 18, 10, 3, 2, 1, 5, 6, 4, 5, 10, 6, 15, 30, 29, 7,
+2, 21, 12, 7, 11, 9, 3, 18, 4, 20, 1, 21, 21, 8, 25, 5,
+9, 13, 2, 7, 9, 9, 8, 3, 12, 3, 16, 3, 23, 3, 4, 11,
+42, 10, 2, 3, 15, 34, 11, 4, 14, 24, 16, 5, 10, 14, 36, 10,
+2, 15, 12, 1, 15, 5, 4, 2, 1, 29, 3, 6, 12, 10, 9, 14,
+9, 7, 6, 2, 1, 5, 12, 10, 8, 6, 13, 8, 4, 3, 11, 10,
+11, 25, 5, 3, 12, 6, 9, 3, 46, 26, 34, 30, 5, 10, 5, 6,
+4, 24, 3, 20, 7, 8, 7, 3, 14, 3, 13, 2, 3, 43, 6, 5,
+6, 4, 6, 9, 3, 5, 13, 47, 21, 12, 9, 28, 15, 3, 18, 20,
+1, 3, 15, 6, 11, 31, 3, 15, 11, 19, 2, 7, 3, 2, 15, 13,
+8, 10, 26, 21, 4, 5, 10, 11, 3, 12, 3, 4, 11, 7, 18, 56,
+15, 15, 34, 6, 5, 1, 2, 12, 10, 3, 3, 8, 7, 3, 2, 22,
+5, 1, 14, 10, 20, 7, 20, 6, 9, 1, 2, 3, 9, 10, 15, 3,
+2, 4, 12, 3, 77, 3, 1, 14, 1, 18, 3, 5, 3, 15, 6, 21,
+3, 1, 6, 2, 6, 9, 6, 31, 5, 13, 15, 6, 2, 4, 14, 16,
+11, 3, 15, 6, 1, 3, 9, 3, 2, 10, 2, 3, 1, 26, 15, 6,
+33, 12, 9, 4, 9, 21, 5, 22, 15, 20, 19, 6, 2, 3, 3, 9,
+37, 6, 20, 18, 9, 6, 6, 18, 6, 1, 11, 4, 11, 12, 22, 30,
+5, 3, 12, 30, 1, 3, 11, 19, 5, 7, 3, 14, 25, 23, 4, 38,
+7, 11, 19, 3, 8, 33, 9, 7, 5, 3, 7, 15, 14, 22, 2, 18,
+4, 6, 2, 7, 14, 9, 3, 3, 1, 3, 2, 10, 6, 12, 15, 15,
+3, 2, 10, 11, 1, 6, 2, 22, 20, 10, 3, 12, 18, 6, 26, 9,
+4, 8, 7, 2, 15, 6, 10, 5, 13, 27, 2, 10, 20, 1, 15, 2,
+4, 9, 9, 5, 13, 15, 42, 2, 6, 7, 6, 5, 1, 14, 12, 12,
+3, 15, 7, 17, 10, 3, 12, 6, 23, 1, 26, 3, 4, 3, 2, 15,
+3, 3, 9, 12, 16, 14, 1, 2, 27, 4, 20, 9, 1, 21, 15, 3,
+3, 15, 42, 5, 7, 6, 15, 12, 3, 5, 7, 2, 16, 3, 36, 5,
+9, 7, 14, 3, 13, 15, 3, 11, 3, 18, 7, 21, 17, 10, 45, 8,
+16, 23, 7, 6, 5, 15, 13, 6, 8, 10, 3, 8, 30, 22, 9, 33,
+5, 1, 26, 6, 10, 15, 17, 25, 2, 19, 6, 6, 5, 10, 3, 9,
+2, 15, 10, 9, 14, 13, 5, 19, 6, 3, 9, 8, 9, 4, 41, 25,
+3, 6, 5, 4, 2, 3, 16, 9, 17, 4, 11, 6, 7, 11, 4, 3,
+27, 2, 3, 1, 15, 5, 7, 17, 15, 10, 11, 16, 53, 3, 4, 3,
+26, 30, 7, 3, 9, 5, 7, 6, 12, 5, 3, 3, 6, 1, 39, 15,
+20, 21, 15, 12, 1, 9, 6, 20, 15, 12, 3, 7, 15, 8, 16, 8,
+21, 4, 3, 23, 1, 11, 39, 10, 15, 6, 2, 7, 11, 3, 16, 18,
+26, 4, 12, 6, 29, 1, 2, 28, 23, 16, 3, 3, 20, 3, 12, 3,
+1, 3, 3, 15, 5, 25, 5, 4, 23, 6, 6, 6, 22, 3, 9, 3,
+20, 7, 15, 9, 30, 2, 9, 4, 20, 1, 3, 33, 33, 17, 7, 2,
+18, 1, 5, 1, 14, 6, 6, 7
+};
+
+
+const unsigned short prime_diffs_64[PRIMELISTSIZE2_64 - PRIMELISTSIZE1_64] =
+{
+46915, 47510, 47898, 48521, 48461, 48437, 48745, 47207, 48039, 48185, 47750, 48641,
+48244, 46476, 47408, 47708, 49156, 47811, 47491, 47517, 48070, 48386, 47312, 47606,
+47127, 47663, 46882, 48366, 47459, 48052, 48107, 48530, 47981, 49524, 48626, 47596,
+47763, 46969, 48849, 47113, 47298, 48107, 47968, 48767, 48342, 48200, 47812, 48423,
+48761, 47152, 47829, 48724, 47789, 48240, 48593, 47726, 48904, 49055, 48077, 47487,
+49310, 47012, 47341, 47846, 47462, 48789, 47609, 47434, 48960, 47065, 47682, 49346,
+48062, 47563, 48477, 48329, 47134, 47105, 48179, 48431, 47039, 48506, 49013, 47195,
+48458, 48147, 47975, 47960, 47855, 47248, 49016, 47291, 48252, 47995, 48000, 48332,
+48131, 47698, 48018, 48478, 47417, 48102, 47864, 48167, 46918, 48821, 47274, 47932,
+48527, 47591, 47277, 47699, 48041, 47867, 47750, 48053, 47963, 47356, 47723, 48021,
+46696, 47105, 49079, 47630, 46971, 48595, 48110, 47862, 47105, 49567, 48623, 48810,
+47927, 47428, 47732, 47688, 48742, 48018, 48691, 47562, 48047, 48166, 48999, 47779,
+48792, 46714, 47196, 46481, 48217, 48572, 48477, 46697, 48343, 48252, 48364, 48686,
+47868, 48451, 47477, 47541, 47719, 48419, 48284, 48002, 47852, 47922, 48298, 47801,
+47486, 46877, 48939, 47095, 48924, 48262, 48930, 47278, 49076, 48314, 47652, 48812,
+48271, 48828, 47474, 48212, 48889, 48410, 48212, 48129, 46978, 48024, 47668, 47972,
+48459, 48512, 48016, 48101, 47516, 48297, 48047, 48088, 47523, 47947, 48632, 48408,
+46954, 46365, 49061, 48758, 46307, 48560, 47278, 47805, 46519, 48491, 48059, 47181,
+48352, 48966, 47576, 48250, 48645, 48011, 47435, 48296, 47398, 48135, 46751, 46940,
+47639, 47173, 48068, 47841, 47983, 48078, 48914, 47152, 46860, 48101, 47651, 48614,
+49177, 47897, 47531, 47295, 48598, 47787, 47803, 48440, 46917, 46909, 46935, 47474,
+49421, 49078, 47612, 47940, 48104, 47320, 48129, 47476, 46661, 49215, 48179, 48089,
+47068, 48717, 47536, 47640, 47528, 47299, 48777, 47365, 47229, 47662, 48081, 47471,
+47734, 48767, 47495, 48051, 47948, 47366, 47570, 47270, 48068, 47071, 48507, 48467,
+47842, 47847, 48331, 47007, 47969, 48437, 47687, 48052, 48197, 47796, 48818, 47242,
+47160, 47927, 48929, 48590, 46595, 48809, 50860, 46842, 48059, 46373, 48608, 48316,
+48657, 47014, 49095, 47846, 46558, 48083, 48476, 48069, 47869, 47487, 47015, 48491,
+47546, 46811, 48272, 47299, 47192, 48858, 47627, 47956, 48098, 47232, 48907, 47069,
+47310, 47581, 47610, 48808, 48392, 46629, 48245, 47519, 46910, 48067, 48296, 48213,
+47612, 47833, 47672, 47907, 48685, 47180, 48147, 48074, 47500, 47220, 47633, 47852,
+47906, 47014, 48659, 47760, 47785, 47951, 47960, 48707, 48504, 47185, 47454, 47449,
+49238, 48749, 47883, 48179, 48409, 47727, 48842, 47773, 47982, 48394, 47639, 48723,
+48508, 47235, 48392, 47390, 47650, 47553, 47596, 47573, 47771, 47942, 48687, 48292,
+47568, 47138, 47989, 47843, 47544, 47765, 46468, 48548, 48317, 47231, 48285, 47797,
+47660, 47456, 47630, 47175, 48062, 47096, 48967, 47735, 47468, 48326, 46988, 48446,
+48282, 46985, 49529, 47698, 47633, 47543, 47460, 48544, 47636, 48123, 47941, 47582,
+47033, 48167, 48857, 47561, 48437, 47705, 48228, 48107, 46754, 47305, 47268, 46487,
+47170, 47367, 47804, 47968, 47552, 47555, 48261, 48203, 47453, 48017, 46261, 47949,
+48560, 47677, 49388, 47262, 48065, 47162, 48752, 47632, 48684, 47897, 48098, 47455,
+47294, 47570, 48239, 47115, 48371, 47633, 48268, 48306, 48653, 47390, 47345, 47285,
+48337, 47031, 48688, 47058, 48085, 46950, 47122, 47636, 49257, 48020, 47729, 47335,
+48327, 47297, 47533, 47808, 47407, 47690, 48200, 48171, 47275, 46895, 49011, 47482,
+47502, 47776, 48299, 46221, 47620, 48662, 47429, 47622, 47210, 46499, 47651, 48623,
+48070, 48998, 47531, 48132, 47729, 48112, 47523, 46475, 48476, 47579, 47603, 48359,
+46877, 48077, 46109, 47905, 48413, 47808, 48475, 47480, 47162, 48605, 47153, 47982,
+48440, 46115, 48037, 47960, 48909, 47624, 48103, 46958, 47220, 48373, 47966, 48512,
+47430, 46969, 48053, 47022, 49166, 47258, 48134, 47390, 47431, 48024, 47696, 47548,
+48126, 48472, 48969, 47377, 47871, 47686, 47379, 46999, 47570, 47882, 48611, 48321,
+48077, 48049, 48354, 47753, 47879, 47599, 46949, 48146, 47292, 47288, 48062, 47126,
+48214, 48179, 48302, 47655, 47792, 48434, 49355, 46049, 46742, 47627, 48158, 47801,
+47885, 48829, 47499, 47671, 46611, 48548, 47303, 47753, 46720, 48387, 47509, 47777,
+47640, 48433, 48162, 46660, 47139, 48668, 48452, 47417, 47386, 47610, 47597, 47519,
+48695, 46654, 47103, 47644, 47958, 46942, 47646, 47785, 48137, 47700, 48568, 48647,
+46742, 47993, 47295, 48002, 48101, 47719, 47781, 48296, 47498, 47198, 48442, 47087,
+47535, 47177, 46420, 47526, 48926, 47927, 48364, 46655, 48489, 47465, 47858, 47885,
+47927, 49078, 46922, 46782, 47357, 48349, 48674, 48594, 48565, 48353, 46653, 47053,
+48147, 47377, 47750, 47856, 48149, 46355, 47413, 48431, 47537, 47972, 48197, 47975,
+48239, 47730, 48422, 47260, 47783, 47345, 48290, 47594, 48144, 47488, 46394, 47373,
+48637, 48311, 47412, 47575, 47442, 48302, 48985, 46818, 46571, 47407, 48576, 47333,
+48157, 47286, 50030, 47786, 46441, 47379, 47200, 46214, 48095, 48773, 47352, 47960,
+47942, 47560, 47417, 48465, 47701, 47393, 47781, 47174, 47431, 47394, 47836, 48780,
+48488, 46729, 48114, 47984, 47032, 47982, 47755, 47724, 49118, 46717, 48582, 48037,
+47222, 48252, 47149, 46032, 47432, 47050, 48857, 48627, 47611, 47612, 48143, 47987,
+47217, 46715, 47489, 48446, 47300, 47693, 48512, 46898, 47260, 47735, 48465, 47206,
+47840, 47549, 47270, 47970, 47317, 48996, 47150, 46619, 47072, 48170, 48167, 47687,
+48755, 47614, 47694, 48469, 46856, 47063, 47360, 47483, 48098, 46467, 48491, 46738,
+47466, 48709, 48204, 48035, 47141, 48643, 48141, 46996, 47432, 47007, 47938, 48282,
+47438, 46456, 46088, 47199, 47465, 48049, 48107, 47877, 47287, 47355, 48296, 48826,
+47894, 47517, 47177, 47387, 48695, 47872, 48093, 46760, 47795, 46732, 48935, 46512,
+46804, 46377, 47372, 48589, 48785, 47694, 47449, 47597, 47126, 48246, 48770, 46219,
+46329, 46763, 48422, 48875, 47062, 47426, 47000, 47561, 47640, 47597, 46978, 47154,
+48356, 46987, 48462, 48226, 48021, 47405, 47347, 46769, 47040, 47524, 47868, 48166,
+47259, 48596, 47692, 47853, 47390, 47939, 48172, 48161, 46526, 47693, 47217, 47114,
+47441, 46697, 47626, 47366, 47310, 47461, 48360, 48737, 47690, 47800, 48198, 46781,
+48304, 47990, 47384, 47784, 47785, 47274, 47090, 47836, 48905, 47877, 48752, 46628,
+47804, 47527, 46805, 48746, 47009, 47328, 48200, 47456, 47999, 48155, 46784, 47776,
+48291, 47213, 47458, 48146, 47796, 47084, 48428, 46616, 47633, 47117, 48280, 48144,
+47185, 48587, 47828, 46833, 48061, 47283, 47152, 47510, 49353, 46780, 47018, 47256,
+49049, 47305, 47988, 47897, 48367, 47783, 48156, 47296, 48590, 47394, 47504, 48101,
+47687, 47059, 46977, 47330, 47869, 46859, 47925, 48547, 47574, 47108, 47027, 48032,
+47527, 46838, 47546, 48347, 47087, 47532, 47911, 48554, 47217, 47968, 47580, 47443,
+47813, 48957, 46559, 47987, 47933, 47492, 46316, 48145, 48050, 46784, 48000, 46313,
+46987, 47912, 47033, 47757, 48662, 46882, 47117, 48129, 47197, 47525, 47387, 46802,
+48179, 48279, 46907, 48103, 47015, 46574, 46467, 48539, 47267, 46427, 47069, 48268,
+47874, 47204, 48578, 47540, 47792, 48074, 48257, 46576, 47076, 47807, 48124, 46799,
+46443, 48016, 46947, 47669, 47765, 48227, 47153, 48202, 47549, 46676, 48000, 47882,
+46427, 48548, 47546, 48265, 47999, 46860, 48761, 48217, 47897, 46898, 48060, 46721,
+47785, 47780, 48156, 46714, 47957, 47820, 47663, 48242, 47483, 47137, 47748, 48692,
+48640, 47198, 46988, 47595, 46378, 46455, 47423, 48374, 47215, 47246, 47168, 47789,
+48755, 46992, 48469, 46574, 47477, 47252, 47567, 46622, 47457, 47173, 47739, 46954,
+47117, 47577, 47252, 47819, 47570, 47900, 47516, 48187, 47783, 47169, 48035, 47699,
+48599, 46921, 47667, 48124, 46631, 47412, 47107, 46785, 47222, 48263, 48064, 47441,
+47043, 47456, 48502, 47430, 47129, 46846, 47744, 47874, 47558, 47482, 48369, 47614,
+47895, 46759, 47748, 47464, 47879, 48470, 46467, 48184, 47153, 48468, 47441, 46079,
+48179, 47410, 47817, 47690, 48122, 47552, 47648, 47791, 47106, 47284, 47412, 48148,
+47504, 48059, 46791, 47111, 47603, 47407, 47414, 47631, 48056, 47143, 47216, 47991,
+47282, 47198, 47074, 47025, 47396, 48424, 48558, 47554, 46745, 48141, 47866, 47582,
+47391, 46877, 48083, 47246, 47579, 47833, 48369, 46522, 47469, 46673, 47852, 49009,
+47538, 46769, 48509, 47303, 46333, 47951, 47552, 48002, 46728, 47386, 48459, 47066,
+48926, 47158, 47306, 47273, 47475, 46937, 47113, 46419, 47837, 47902, 47420, 47951,
+47370, 47806, 47481, 47312, 47714, 47629, 47702, 48468, 47129, 47491, 47481, 47189,
+48077, 46702, 46860, 48194, 47461, 46736, 47573, 46211, 46968, 46853, 47197, 47685,
+48136, 48147, 46540, 47175, 48502, 47432, 47204, 47606, 47432, 47246, 46113, 47920,
+47765, 47064, 47270, 47492, 47470, 47373, 47792, 47348, 47575, 48431, 46269, 49178,
+47431, 48437, 46787, 47585, 47889, 47866, 48099, 47131, 46971, 47092, 46766, 47879,
+48617, 46358, 47436, 47162, 46766, 48499, 48215, 46911, 47360, 48335, 48098, 47401,
+47513, 47882, 48615, 47180, 47645, 47972, 48092, 47623, 48413, 45981, 47803, 47657,
+46826, 47066, 46973, 48162, 47246, 46114, 47615, 47208, 47180, 47594, 47377, 47391,
+46909, 47261, 48861, 48199, 47496, 47048, 48131, 48227, 46967, 47017, 46985, 47945,
+47279, 49155, 46624, 46773, 46636, 47483, 46406, 47415, 48370, 48758, 47321, 47481,
+47759, 47261, 46081, 47528, 48272, 48107, 47883, 47647, 47678, 47504, 48303, 47974,
+47390, 47772, 47336, 46700, 48047, 48226, 47505, 46427, 46787, 47567, 47813, 47812,
+48008, 47927, 47955, 48475, 47925, 46921, 47684, 49127, 46638, 48286, 47748, 48227,
+46160, 46708, 47477, 47523, 46811, 46595, 47243, 48584, 47851, 47042, 47256, 46307,
+46246, 48899, 47733, 46330, 47273, 47172, 46925, 47119, 48587, 46935, 47720, 47521,
+48561, 47827, 46172, 47262, 48109, 48849, 47432, 47332, 47735, 46811, 48452, 47397,
+46792, 46575, 48220, 48656, 47760, 47189, 47881, 46746, 47495, 46717, 46904, 46443,
+47101, 47043, 47926, 48623, 47117, 48471, 48028, 47348, 47565, 46994, 47245, 47580,
+47087, 49171, 48450, 48235, 46601, 48182, 47706, 48518, 47762, 47503, 47057, 46947,
+46664, 47825, 48229, 47028, 46087, 47276, 47282, 47487, 48719, 47815, 47408, 48078,
+47503, 48501, 47800, 47372, 46908, 47444, 47164, 46790, 47256, 48125, 47162, 48103,
+47886, 47890, 48069, 46712, 48134, 46963, 46920, 46223, 47465, 48509, 47023, 48270,
+47566, 46682, 47559, 46796, 47549, 46637, 48016, 47751, 47498, 47345, 46952, 47855,
+47959, 47174, 47513, 48015, 47018, 47066, 47494, 47225, 47672, 47258, 47627, 47471,
+46967, 48237, 46712, 47963, 46753, 48131, 45902, 46821, 48604, 47370, 47657, 46937,
+46589, 48380, 46991, 47075, 48586, 47538, 48034, 47523, 46252, 47126, 48069, 47290,
+47064, 47080, 47324, 46985, 48224, 46626, 47389, 47195, 48159, 47092, 46791, 47500,
+46779, 47738, 46939, 47682, 48464, 48148, 47615, 46719, 47579, 47305, 47757, 46591,
+48263, 45932, 48924, 46684, 47672, 47006, 47313, 46772, 47852, 47033, 46985, 47317,
+48029, 47804, 47304, 47468, 47011, 47315, 47925, 46529, 47989, 47021, 47163, 47042,
+46831, 46487, 48308, 47228, 47582, 47601, 46913, 46882, 46889, 47139, 48367, 46923,
+46154, 47347, 47519, 46517, 47880, 48565, 47820, 47302, 47331, 48020, 47041, 47912,
+46226, 47369, 48236, 46970, 47859, 47195, 47218, 46701, 47692, 48318, 47206, 47565,
+48001, 46913, 47001, 46898, 47537, 46609, 46812, 47489, 47690, 45650, 45550, 47352,
+47252, 47414, 48001, 46236, 47774, 47600, 48092, 47677, 47361, 47839, 47778, 46859,
+47870, 46729, 48162, 47557, 47069, 48590, 47582, 49145, 46265, 47174, 48194, 47387,
+47472, 47453, 47503, 46511, 47969, 47292, 45184, 48269, 47090, 48147, 47218, 47073,
+47233, 46665, 47818, 46568, 46895, 47549, 46269, 48110, 48725, 47089, 47841, 46297,
+46887, 48281, 46324, 47256, 46457, 48175, 47982, 47347, 47070, 47026, 47141, 47513,
+45297, 48098, 47269, 47397, 47339, 47270, 47144, 47066, 47794, 48114, 47669, 46576,
+47294, 47939, 47019, 47987, 46943, 46286, 46951, 47723, 46851, 48323, 48026, 47467,
+46464, 46745, 47141, 47285, 47365, 47729, 46965, 47051, 47245, 47724, 47614, 47376,
+47468, 46835, 48728, 46684, 47262, 46174, 47799, 45680, 48109, 48426, 47822, 46297,
+48429, 47137, 46785, 48499, 46746, 47677, 47523, 46946, 46778, 48134, 45983, 47858,
+48526, 46947, 48056, 47302, 48158, 47511, 48127, 46983, 47008, 46583, 46907, 48489,
+47677, 47985, 47069, 48082, 46800, 46157, 46876, 48242, 46931, 47268, 46712, 46483,
+46712, 46811, 46508, 47316, 46937, 46421, 48236, 47057, 47512, 46808, 47072, 47349,
+47752, 46326, 47705, 47594, 48290, 47350, 46800, 48883, 47553, 47539, 47004, 47246,
+46927, 45839, 47381, 47436, 46691, 48218, 46879, 48294, 48494, 47071, 47178, 47263,
+46799, 47354, 46572, 48302, 46928, 47257, 47384, 47063, 47072, 47241, 47584, 47837,
+47175, 48173, 46168, 48783, 47374, 48092, 47264, 47066, 47496, 47099, 47678, 47687,
+47225, 46658, 47312, 47495, 46462, 47540, 47105, 47264, 47897, 47157, 48812, 46006,
+47066, 46821, 46493, 48319, 48035, 49209, 45950, 46813, 46602, 46583, 47897, 47245,
+46649, 46782, 48014, 47582, 47833, 47607, 47837, 47207, 48146, 48029, 47762, 48008,
+46870, 47907, 47447, 46942, 47159, 46749, 47183, 48226, 47979, 47438, 47137, 46301,
+47703, 46772, 46441, 47571, 46912, 46217, 46596, 46427, 47999, 47182, 47718, 46595,
+48238, 48050, 47697, 46187, 48040, 47946, 46831, 47394, 47864, 46342, 47328, 46493,
+47315, 46790, 47600, 48278, 47867, 46102, 47000, 48173, 47682, 46499, 47104, 47655,
+47167, 46631, 46958, 48552, 47366, 47737, 47181, 47156, 47257, 47999, 47742, 46175,
+47267, 47282, 46964, 46925, 46973, 47323, 46578, 46997, 47152, 46406, 47522, 47331,
+46877, 47582, 48043, 46728, 46366, 47105, 47750, 47456, 47496, 47114, 47269, 45942,
+48538, 46397, 47676, 47488, 46872, 46532, 47723, 46753, 48611, 47432, 47967, 46592,
+47483, 46331, 47338, 46854, 46247, 47812, 47204, 47681, 48443, 47202, 46706, 47491,
+46463, 47591, 46949, 47687, 46457, 46542, 46856, 47921, 47795, 47494, 47235, 46709,
+47644, 47015, 47745, 47059, 47540, 47900, 47009, 48765, 46406, 47869, 46901, 47111,
+47250, 47174, 48002, 47582, 46942, 47604, 46391, 46571, 47509, 46275, 47054, 46336,
+47847, 47456, 49367, 46975, 47412, 47206, 46943, 47645, 45974, 48182, 49211, 46800,
+47755, 46892, 46640, 47181, 47743, 47729, 46307, 47669, 45743, 47501, 47654, 45791,
+48212, 47499, 46145, 47164, 48242, 47034, 46505, 47576, 47620, 47244, 47155, 46835,
+47517, 47426, 46163, 47936, 46052, 47077, 47306, 47376, 47812, 47820, 47159, 47572,
+46793, 47547, 46858, 47186, 47451, 46987, 46959, 46462, 46772, 47898, 46751, 47638,
+46526, 46182, 46091, 48004, 47202, 45812, 47584, 47132, 47382, 47323, 47853, 46561,
+47069, 46460, 46733, 48426, 47798, 47176, 46844, 46614, 47327, 48275, 47197, 46721,
+47453, 47546, 46152, 47843, 47747, 46105, 46973, 47771, 47499, 47336, 46606, 47607,
+47926, 46689, 47260, 47004, 46051, 47021, 46335, 47900, 47467, 47199, 47069, 46640,
+47645, 46897, 45936, 48310, 46860, 48199, 47891, 46982, 47085, 47149, 45822, 47918,
+46732, 47051, 48065, 47387, 46668, 46756, 47072, 47450, 46901, 47078, 47160, 47206,
+46868, 46442, 47229, 46637, 46940, 47344, 46754, 47433, 47513, 47462, 46862, 46112,
+46390, 48054, 46865, 47128, 47448, 47882, 47266, 45588, 47378, 48137, 47837, 45895,
+47453, 46523, 46577, 47177, 46904, 46830, 47386, 47097, 47240, 46867, 46589, 47621,
+47768, 46941, 47012, 47332, 46739, 47099, 45990, 46675, 47633, 46833, 47264, 46172,
+46652, 47035, 47597, 46326, 46175, 47779, 46713, 47119, 47870, 48351, 47255, 46669,
+45948, 46210, 47474, 46805, 47081, 48317, 47718, 48398, 47105, 46460, 46967, 47360,
+46106, 47365, 47075, 47247, 46112, 46744, 47340, 47722, 47744, 46482, 46172, 48137,
+47360, 47069, 46676, 45893, 46516, 46733, 47711, 47400, 47063, 46493, 48073, 47075,
+46178, 46587, 47636, 47498, 47233, 47724, 47567, 45470, 48242, 46505, 47297, 46327,
+47687, 47282, 47766, 47329, 46526, 47498, 46505, 47183, 46844, 44781, 47638, 46214,
+46389, 47053, 47141, 47622, 46882, 48086, 46107, 47329, 47277, 46600, 47693, 47195,
+47193, 46418, 46597, 46460, 47208, 47702, 47581, 46989, 48236, 47468, 47227, 47577,
+47206, 46562, 48434, 47316, 47365, 46847, 47204, 46803, 47087, 47300, 46868, 46178,
+46135, 47388, 47215, 46622, 47079, 47048, 47615, 47233, 47663, 46866, 47171, 46567,
+46809, 47324, 46750, 46400, 46746, 46819, 46646, 47417, 47046, 46838, 46826, 46618,
+47283, 47531, 47671, 48068, 45957, 46888, 47681, 47001, 46918, 47069, 47262, 46430,
+46733, 45913, 47517, 45655, 47829, 46934, 46823, 45896, 48052, 46695, 45884, 47548,
+47792, 48057, 46252, 46971, 46714, 47487, 46925, 46817, 47135, 47194, 47040, 46294,
+46680, 46987, 45956, 47606, 47588, 47096, 45888, 47086, 46067, 47297, 47928, 46018,
+47720, 47031, 48154, 47111, 47516, 46890, 47287, 46896, 46711, 46749, 47212, 48324,
+46595, 47624, 46955, 46835, 46351, 47049, 46382, 47656, 47838, 46526, 47461, 46212,
+46810, 47300, 47174, 47535, 46513, 46907, 47540, 47040, 47816, 46160, 47293, 46001,
+46632, 47795, 46529, 46594, 47027, 48177, 47221, 45963, 47420, 47408, 47689, 46860,
+46567, 47034, 46760, 46009, 47697, 46915, 46452, 46408, 47136, 46222, 46088, 47742,
+46876, 46418, 47106, 48152, 47017, 47417, 46113, 47155, 46818, 46988, 47558, 46727,
+47047, 47495, 47546, 45974, 46857, 47183, 47717, 46396, 47090, 46778, 46658, 46085,
+46512, 46760, 47780, 47251, 46917, 46768, 47109, 46096, 46622, 46647, 48311, 45773,
+47617, 46310, 46487, 46863, 45473, 48208, 46865, 47274, 46604, 47729, 47686, 48029,
+46124, 48125, 46596, 47755, 46725, 47159, 46159, 47666, 47667, 47191, 46052, 47783,
+47981, 46160, 45995, 47873, 46875, 46820, 47620, 46766, 46832, 47820, 46780, 47387,
+46967, 46499, 47501, 47667, 47198, 47425, 47606, 46509, 47911, 47237, 45257, 47054,
+46697, 47297, 47175, 47183, 46085, 46735, 47562, 46652, 46432, 47489, 47970, 46867,
+46671, 46961, 47089, 47291, 47006, 47546, 47235, 47195, 46289, 47632, 48785, 47342,
+46752, 46394, 46022, 47329, 47675, 47451, 47182, 46868, 46160, 47783, 47570, 46733,
+46961, 47298, 47089, 47664, 47570, 47045, 48152, 45221, 46304, 47143, 46662, 48412,
+45651, 46613, 46715, 48149, 46804, 47583, 48172, 46733, 46146, 46717, 46592, 46533,
+46900, 46689, 47036, 46132, 45954, 46472, 48587, 47404, 46485, 48331, 45891, 46934,
+45886, 46188, 46319, 47795, 46814, 48008, 47542, 45572, 46436, 48059, 46250, 46824,
+46622, 47080, 47799, 45925, 47694, 48862, 47078, 46352, 46395, 46249, 47025, 46951,
+46329, 46513, 46182, 46679, 46145, 45620, 46486, 47577, 47540, 46361, 47473, 47484,
+47023, 46476, 47029, 46271, 47043, 46771, 44559, 47681, 47357, 47273, 48016, 46947,
+46793, 45806, 47158, 47099, 46824, 47708, 46687, 47316, 47471, 46936, 45390, 46297,
+47279, 46715, 46799, 46310, 47592, 46891, 46626, 47164, 47204, 46680, 47681, 46655,
+46570, 47879, 47477, 47820, 47119, 47372, 46857, 46718, 48166, 47112, 45268, 47957,
+46308, 47116, 46958, 47706, 47557, 46536, 47627, 46423, 46277, 47006, 47787, 46835,
+46414, 47607, 46502, 47369, 46562, 46622, 47297, 47047, 47645, 46605, 46135, 46863,
+46325, 45647, 46813, 47154, 46315, 47477, 48132, 46693, 46707, 47560, 47514, 45431,
+47282, 45229, 46754, 48033, 45523, 46602, 46807, 46251, 46757, 47701, 47517, 46562,
+46985, 47602, 47856, 47117, 48388, 46626, 47095, 47057, 48167, 47453, 47477, 45783,
+46658, 46420, 48641, 47073, 46711, 46367, 47432, 46989, 45985, 46973, 46916, 45575,
+47240, 46107, 45746, 48125, 46412, 46466, 48293, 46729, 47910, 46639, 47273, 47187,
+46364, 47017, 47310, 45668, 47731, 46671, 46312, 47558, 47561, 46895, 46052, 46052,
+45935, 47838, 46562, 45571, 47102, 47348, 46376, 47247, 46363, 46943, 46179, 47230,
+45897, 47309, 45973, 46347, 46927, 47579, 48105, 46672, 45474, 47972, 47380, 46181,
+48173, 47108, 47001, 46004, 48107, 46540, 46958, 46410, 47354, 46298, 46832, 46187,
+47246, 47572, 46523, 46644, 47968, 46574, 47186, 45972, 47630, 47108, 46294, 47777,
+45591, 47546, 47842, 46476, 46529, 47306, 47183, 47170, 47427, 46184, 46376, 46769,
+47002, 46352, 46605, 46516, 46758, 47188, 46905, 46718, 45637, 46062, 47072, 46052,
+47554, 47460, 46894, 45984, 46057, 46283, 47124, 45505, 47816, 46584, 46645, 47112,
+46747, 47253, 47893, 47078, 46662, 46664, 47242, 46914, 47108, 47317, 46487, 45786,
+47447, 46043, 45551, 46291, 46922, 47339, 47027, 46646, 46233, 47125, 46403, 46871,
+47244, 45967, 48180, 46918, 47325, 47459, 47440, 46503, 46826, 46822, 46667, 46367,
+47108, 47508, 46561, 47447, 46533, 46100, 47045, 46574, 47450, 47444, 45938, 47218,
+46580, 46368, 46631, 47680, 46487, 47391, 47152, 46035, 47009, 47101, 47033, 47187,
+47281, 45969, 46567, 46622, 47354, 45393, 47272, 46938, 46250, 47660, 46105, 47898,
+46715, 47299, 46511, 45896, 46299, 47018, 47422, 47189, 47348, 46604, 47345, 46473,
+47207, 46615, 46248, 46562, 46171, 47253, 48014, 47231, 46603, 46580, 46878, 47230,
+46644, 47696, 47089, 47381, 47115, 45878, 46148, 46160, 47053, 46427, 47183, 47705,
+46092, 46934, 46625, 47363, 46928, 46066, 47412, 46148, 47812, 47477, 48095, 46763,
+46938, 46868, 46544, 46384, 47402, 46932, 47132, 45997, 46397, 47715, 46928, 46556,
+46510, 46902, 46390, 47136, 45958, 46943, 47723, 47604, 45953, 46424, 46247, 47084,
+46568, 47074, 46140, 47263, 46772, 46697, 45630, 47167, 46619, 47037, 47150, 48670,
+45960, 45689, 47584, 46782, 45685, 47046, 47200, 47613, 46262, 45478, 46785, 46358,
+47714, 47362, 46815, 46322, 47477, 46078, 46790, 46010, 46451, 45893, 46211, 47487,
+46322, 46445, 46600, 46959, 46994, 46952, 47176, 46331, 47225, 45597, 47491, 47382,
+47501, 45607, 46842, 46061, 46952, 46783, 47478, 47315, 47419, 47145, 46480, 46962,
+46412, 47054, 47075, 46000, 46913, 47031, 46721, 45715, 46560, 48208, 46296, 46808,
+47405, 46580, 46225, 45861, 47200, 46565, 46073, 48176, 46749, 47317, 45726, 46583,
+46441, 47231, 45869, 47402, 47657, 46412, 46800, 46756, 47667, 45949, 46352, 47252,
+45710, 47519, 47022, 46151, 47389, 45815, 47028, 46466, 46237, 46512, 45833, 46805,
+46472, 45653, 46622, 46826, 46942, 46403, 46532, 47694, 46634, 46520, 47191, 46286,
+46604, 46805, 47823, 47363, 46292, 47479, 45570, 46646, 47080, 46257, 45610, 46991,
+47378, 46077, 46982, 46706, 46486, 47937, 47633, 46661, 47251, 47207, 46065, 46744,
+46304, 47606, 47334, 47245, 45822, 46724, 46205, 46856, 45803, 47386, 46350, 47644,
+46560, 46682, 46231, 46847, 47243, 46295, 46872, 46438, 47622, 46990, 46469, 46433,
+46764, 47830, 46526, 46392, 47141, 46892, 45472, 45198, 47300, 46133, 47651, 46553,
+47072, 46916, 46460, 46427, 47137, 46242, 46492, 46601, 46710, 47077, 45887, 47309,
+46790, 46347, 47417, 46570, 47351, 46566, 47177, 46397, 46778, 46433, 47309, 45848,
+46694, 47482, 46484, 45935, 47625, 46183, 45371, 48498, 46442, 47138, 46607, 47225,
+47618, 47108, 46145, 47029, 47039, 45852, 45965, 46624, 47195, 47720, 47081, 45722,
+46227, 46387, 45327, 46820, 47936, 47317, 47087, 47861, 46068, 45881, 46624, 47201,
+46025, 46197, 46244, 48101, 45311, 46628, 47389, 46755, 46094, 46835, 47131, 46707,
+46534, 46367, 48080, 45117, 46267, 47138, 46611, 45872, 47270, 46444, 46829, 46172,
+46223, 46655, 46448, 46452, 46078, 47712, 47029, 46437, 46454, 46750, 47034, 46135,
+46133, 46124, 46476, 48791, 47263, 46778, 46907, 46871, 46280, 47234, 46532, 46598,
+47910, 47104, 47109, 45683, 47176, 46749, 47207, 46343, 45710, 47483, 46372, 46233,
+46489, 46065, 47519, 46847, 46832, 45725, 46595, 47122, 46952, 45752, 47331, 45719,
+46178, 47159, 46969, 47208, 46337, 46267, 47057, 46959, 46579, 47400, 46208, 46256,
+45902, 46364, 44852, 46598, 46546, 47577, 46882, 47606, 47463, 47387, 46111, 47352,
+46594, 47880, 47626, 47727, 46387, 47045, 46427, 46581, 46027, 46782, 45950, 46252,
+47010, 46411, 46031, 46727, 46128, 45607, 45882, 46888, 46536, 46751, 46964, 46136,
+46480, 47069, 46902, 46978, 47499, 47005, 45962, 44850, 46181, 45475, 46256, 46203,
+46909, 46944, 46736, 47527, 45971, 46668, 46682, 46421, 46862, 46292, 46064, 46880,
+48227, 46582, 46692, 46400, 47065, 46241, 45468, 46567, 46701, 48100, 46460, 46913,
+47037, 46267, 46202, 47133, 46420, 46872, 46057, 46686, 46627, 46490, 46796, 45998,
+47630, 47373, 46225, 47310, 45976, 46313, 47532, 46952, 47344, 46307, 45533, 47078,
+46656, 45733, 45767, 46571, 47084, 46950, 46478, 45868, 46587, 46877, 47080, 46974,
+47726, 46282, 46763, 46715, 45443, 46533, 45440, 46529, 46469, 46838, 46711, 46859,
+45890, 45878, 46917, 46576, 46133, 46778, 46292, 46407, 47026, 45884, 47985, 45872,
+46474, 46652, 45510, 46472, 46306, 46770, 46474, 45584, 47972, 47328, 46484, 47438,
+46526, 46258, 45804, 46042, 46064, 47364, 45485, 47009, 46132, 47583, 47230, 45938,
+45347, 46973, 45507, 44956, 46608, 46099, 46740, 46807, 45909, 45928, 47484, 47377,
+46662, 46144, 46442, 46425, 46835, 48352, 46217, 46479, 45179, 47045, 47222, 45925,
+46791, 47567, 46460, 47330, 46571, 46640, 45899, 47188, 46352, 46917, 47287, 47621,
+46865, 45615, 47798, 47366, 46489, 46509, 47422, 46134, 45961, 46982, 46808, 45695,
+46682, 47064, 45611, 45899, 46721, 46610, 46594, 46962, 47123, 45329, 46729, 44943,
+46691, 46078, 45917, 45986, 46682, 45663, 45634, 46710, 47480, 46238, 45437, 46751,
+45958, 46452, 45781, 46361, 45695, 46245, 46567, 46614, 45095, 46207, 47208, 45673,
+46692, 47740, 46701, 46808, 46556, 45652, 45875, 46292, 46650, 46099, 46149, 46195,
+46136, 46403, 46695, 46936, 46773, 46348, 46113, 46631, 46961, 45641, 47333, 46513,
+47082, 45503, 46465, 46883, 46341, 45587, 45863, 46430, 46183, 46229, 46196, 45678,
+45994, 46559, 46043, 46317, 46841, 46105, 45980, 46725, 47407, 45723, 45580, 45963,
+46607, 47417, 47099, 46300, 47099, 46097, 47169, 47450, 46897, 45369, 46078, 46878,
+47057, 46210, 47459, 46497, 46036, 46148, 47270, 45909, 46436, 46333, 46842, 47155,
+46685, 46256, 46928, 46314, 46909, 46400, 46197, 46735, 46875, 46267, 45354, 46361,
+45926, 45514, 46887, 45407, 46346, 46505, 47150, 47420, 46406, 45809, 45752, 47693,
+46924, 46143, 46351, 46185, 46174, 46865, 46551, 46325, 44978, 46574, 46156, 46113,
+45947, 46375, 46628, 45986, 45803, 47162, 46583, 46152, 45344, 47912, 45790, 47321,
+46721, 46868, 46031, 45867, 46933, 48035, 46518, 46117, 45944, 45524, 46512, 46600,
+47202, 45947, 47077, 45831, 47015, 45853, 46659, 45235, 46292, 47288, 46878, 46085,
+47597, 47392, 47301, 45229, 46407, 45965, 45922, 46428, 45302, 46823, 45668, 47005,
+46452, 46394, 46064, 45854, 46661, 45848, 45928, 45996, 46717, 47777, 46550, 45584,
+47705, 47175, 47152, 46524, 46039, 46320, 46802, 46898, 45929, 45890, 46322, 46912,
+47001, 46579, 46361, 45707, 44744, 46959, 45869, 47020, 45767, 47022, 46394, 45865,
+45743, 46703, 47841, 45736, 45468, 46292, 46529, 46954, 46950, 46844, 46025, 45761,
+45445, 46770, 47102, 46232, 46987, 46589, 46782, 46249, 47465, 46949, 46047, 46297,
+47055, 46922, 46450, 45867, 46364, 46705, 46059, 46922, 46705, 45839, 45800, 45845,
+45863, 47223, 45679, 45579, 46183, 47064, 46714, 45803, 46679, 46620, 47480, 46033,
+46211, 46209, 46771, 45840, 44560, 45786, 47696, 46646, 45844, 48038, 46650, 46217,
+47191, 45654, 47542, 47798, 46022, 47246, 46037, 46332, 45547, 45186, 46031, 45914,
+46280, 46409, 46517, 47270, 46949, 46088, 46885, 46181, 46380, 46180, 46622, 48053,
+45875, 45804, 46928, 46355, 45853, 46913, 45134, 46455, 46105, 45251, 46257, 47218,
+45798, 46040, 45835, 46865, 46259, 46194, 46157, 45559, 46950, 46660, 46635, 46793,
+45731, 47432, 46514, 46520, 47531, 45728, 46007, 47438, 47900, 46409, 47168, 45389,
+47300, 45907, 46355, 47084, 45860, 46772, 47147, 45377, 46323, 47707, 47331, 45937,
+45903, 47015, 45784, 46728, 46829, 46334, 46100, 46198, 45744, 47215, 45237, 46759,
+46941, 46063, 46326, 46342, 46280, 45948, 46318, 46203, 46222, 45749, 46428, 46246,
+46520, 45741, 46540, 47222, 46235, 46530, 44876, 46684, 46422, 46525, 45678, 47449,
+45977, 46121, 45923, 45777, 46511, 47152, 46455, 46265, 46382, 46550, 47141, 46630,
+46326, 45547, 45998, 46331, 46820, 46109, 47078, 46412, 45159, 45494, 45583, 46367,
+46467, 46556, 45943, 46919, 46754, 45696, 46907, 46094, 46369, 46490, 46629, 45595,
+46500, 47179, 46001, 46202, 46302, 47500, 46658, 47664, 46384, 46065, 46259, 47789,
+46060, 46172, 46758, 46288, 46140, 46214, 47123, 47149, 46557, 46187, 46448, 45619,
+45434, 45999, 45268, 46862, 46349, 46773, 46618, 46448, 44184, 47249, 46243, 45539,
+46749, 46363, 45615, 45959, 45521, 45713, 47207, 45637, 47210, 45644, 47099, 45528,
+47867, 44944, 45285, 46541, 47455, 47249, 46287, 46573, 45957, 47246, 46490, 45347,
+45494, 46598, 44968, 45732, 47713, 45129, 46894, 46398, 46454, 46714, 46233, 45796,
+46328, 47066, 45795, 46613, 46199, 46900, 45234, 46502, 45829, 46503, 45188, 47348,
+46060, 46019, 46457, 46805, 46664, 45644, 46050, 48110, 46384, 44562, 47072, 47615,
+45622, 45948, 45512, 46763, 45694, 47433, 46933, 46337, 45365, 45723, 46237, 46923,
+46141, 45414, 45352, 45560, 45384, 46241, 47270, 46729, 45266, 47177, 47363, 45848,
+46982, 46520, 44894, 46470, 47402, 45938, 46241, 46277, 47443, 45753, 46277, 47006,
+45737, 45740, 45814, 46748, 46064, 45710, 46455, 45982, 45897, 46628, 47143, 46670,
+44744, 46581, 45407, 46720, 46020, 46394, 45817, 46814, 46392, 46613, 46189, 45219,
+45983, 46799, 45209, 46933, 46401, 46811, 47173, 45632, 46776, 45958, 45920, 45858,
+46402, 45738, 47293, 45447, 45851, 47186, 46159, 45407, 45791, 45992, 45173, 46385,
+46097, 46614, 45587, 46270, 46152, 46094, 46555, 46089, 45640, 45723, 46825, 45920,
+47159, 45435, 45211, 47583, 45364, 46137, 45929, 45790, 45392, 45857, 47027, 45413,
+45963, 45338, 46786, 46011, 46813, 47088, 47002, 45312, 46379, 46205, 47107, 46596,
+46217, 45818, 46067, 46579, 45584, 46377, 46480, 46767, 46789, 46493, 46916, 45933,
+45025, 46158, 47458, 46754, 45162, 46775, 46660, 46713, 46163, 45746, 46337, 46598,
+45686, 46997, 46978, 45999, 47828, 46916, 45572, 45758, 46246, 47102, 45990, 46657,
+45959, 46220, 46572, 47437, 47142, 45751, 45783, 45184, 45753, 46237, 46314, 46666,
+47058, 46004, 46405, 47141, 45860, 47039, 45896, 45524, 46565, 46679, 46245, 46681,
+45120, 45731, 46348, 47049, 46093, 46053, 46651, 48621, 46358, 45878, 45397, 46436,
+44976, 46744, 46895, 45174, 45937, 47010, 47153, 46727, 45668, 46433, 45340, 46098,
+46030, 46583, 46548, 46243, 46236, 45820, 45774, 46763, 46462, 46569, 46709, 46331,
+45494, 45226, 46130, 46203, 46897, 46542, 46789, 46476, 46528, 46349, 44628, 45347,
+45286, 46785, 45370, 47261, 44580, 45974, 45983, 46868, 46841, 45967, 44997, 46327,
+45882, 45838, 46407, 46330, 45285, 46370, 45518, 44768, 46294, 45497, 47370, 46081,
+47306, 44787, 45352, 46374, 46459, 46403, 45477, 45844, 46307, 46289, 46680, 47302,
+46662, 45700, 46478, 45672, 45740, 46004, 45931, 44676, 45803, 45737, 45868, 46932,
+45985, 46238, 46832, 45984, 46286, 45512, 45625, 46467, 45584, 45703, 45860, 46217,
+46197, 45764, 45317, 47152, 44814, 46307, 46672, 46412, 45954, 45871, 46304, 45740,
+46458, 46451, 46288, 47943, 46099, 45774, 46312, 45642, 46202, 45665, 46882, 46245,
+46739, 45989, 45622, 45255, 45590, 45482, 45586, 45681, 45913, 47658, 45814, 45824,
+46176, 46151, 45472, 46565, 46776, 46348, 45975, 45344, 45142, 47045, 46358, 46050,
+47269, 45168, 45271, 46382, 46350, 46504, 45002, 45657, 45458, 47021, 45353, 46249,
+46440, 45836, 45128, 46079, 46802, 46327, 45924, 45965, 46273, 46937, 46494, 46325,
+46453, 45900, 46589, 45550, 45900, 47086, 46695, 46382, 45097, 46479, 45911, 46511,
+46199, 45010, 45900, 46327, 45041, 46715, 45569, 45821, 45206, 46217, 46223, 46047,
+47143, 45656, 46347, 45562, 46491, 46060, 45804, 47089, 46038, 44117, 46480, 44886,
+45980, 45895, 46787, 46304, 46832, 45980, 47316, 46105, 46581, 45880, 45795, 47525,
+45263, 45590, 44954, 46067, 45608, 46754, 46373, 45067, 45617, 44853, 46882, 45785,
+46398, 45779, 46352, 46300, 47052, 44767, 46944, 46709, 46295, 46360, 45797, 45291,
+46628, 46084, 45747, 47105, 45913, 45515, 45575, 46196, 46247, 46217, 45947, 46365,
+45782, 46820, 46732, 46949, 45957, 45794, 45922, 44892, 45992, 47672, 46106, 45958,
+46110, 45802, 45905, 45255, 46073, 45371, 45352, 45872, 46103, 45971, 46232, 45554,
+45486, 47003, 44999, 46012, 47937, 45038, 46846, 45857, 46197, 46885, 45387, 46267,
+45810, 46829, 45701, 46996, 46052, 46109, 45855, 45484, 46734, 46235, 47432, 46885,
+46109, 45800, 45578, 46698, 46289, 46072, 45954, 44821, 45944, 46929, 46289, 45590,
+45424, 46235, 46413, 46222, 45854, 44837, 45762, 47636, 46867, 46686, 46921, 45249,
+45310, 46112, 45557, 46602, 46588, 46977, 45457, 45204, 46166, 44711, 45944, 46034,
+44830, 44880, 46457, 45958, 46286, 45671, 45584, 46137, 47518, 45399, 46604, 45622,
+46010, 46067, 45612, 46624, 45858, 46576, 45702, 45440, 45482, 45797, 46334, 46442,
+45241, 46098, 45292, 46581, 46864, 44739, 45863, 44852, 45466, 46124, 45570, 46555,
+47207, 45291, 46790, 46744, 45567, 46718, 45814, 46245, 46207, 46782, 45635, 46154,
+45832, 45075, 45407, 46087, 46871, 45698, 45566, 46658, 45267, 46966, 45942, 46063,
+46281, 46013, 45844, 46157, 46916, 45573, 47119, 46065, 45970, 45777, 45851, 45458,
+44711, 45293, 46298, 45280, 46250, 45660, 46817, 45574, 45747, 45181, 46067, 45386,
+46101, 46729, 46701, 44896, 45872, 45753, 46351, 45777, 46763, 45733, 45983, 45905,
+45887, 45939, 46969, 45873, 45757, 47532, 46267, 45984, 45757, 46917, 44887, 46065,
+46861, 44978, 45348, 46756, 45999, 45271, 46067, 45473, 45564, 46490, 46511, 44315,
+47005, 46620, 46187, 46691, 45953, 46168, 45093, 45859, 45767, 46803, 46666, 45198,
+46319, 46342, 46599, 45805, 45360, 45842, 46258, 46533, 45496, 46445, 45369, 45605,
+44693, 46046, 46840, 46616, 46337, 46406, 46041, 45548, 46201, 46073, 46046, 45387,
+45889, 45236, 45584, 46481, 45195, 45839, 45055, 46853, 46149, 45626, 45265, 45510,
+45101, 44945, 44614, 46452, 44897, 46681, 46314, 45029, 45344, 46208, 45844, 45759,
+46265, 45518, 46283, 46142, 46393, 46491, 45793, 46067, 45396, 46217, 46942, 45036,
+45856, 46539, 46222, 45767, 45737, 46745, 46134, 45400, 45957, 45593, 45182, 46009,
+45636, 45980, 44509, 45212, 46721, 45771, 46397, 45682, 45845, 46320, 45368, 43828,
+46419, 45895, 45800, 46551, 44782, 46544, 44976, 45049, 45204, 46052, 45569, 44966,
+45547, 46421, 45339, 44987, 46855, 45899, 46046, 45434, 47267, 45585, 46343, 46073,
+46130, 45887, 46379, 45715, 43956, 45704, 46636, 47223, 46945, 45650, 45792, 44792,
+47071, 45833, 45402, 46741, 45828, 44854, 45885, 45370, 46586, 45414, 45512, 46820,
+45958, 44597, 45992, 45764, 46034, 46170, 46481, 45215, 45433, 46016, 45719, 45827,
+46173, 46225, 46239, 45889, 45617, 45902, 45708, 46073, 44756, 45917, 46147, 47127,
+45082, 45203, 45870, 46820, 45730, 44757, 46372, 45444, 46264, 45417, 47017, 45872,
+46142, 45554, 47375, 44864, 45785, 45330, 44267, 46585, 46677, 45092, 46441, 45729,
+45856, 46506, 45167, 47002, 45597, 45292, 45750, 44870, 47543, 44785, 45845, 45746,
+46088, 44792, 46359, 46207, 45677, 46217, 46179, 45298, 45396, 45242, 45833, 45925,
+46592, 45552, 45073, 46328, 46259, 45404, 44588, 46500, 46207, 46728, 44683, 46686,
+45382, 46022, 45507, 45277, 45848, 44624, 46077, 45328, 47063, 45677, 46226, 45972,
+44446, 46323, 45058, 45708, 45424, 44862, 45284, 44708, 45605, 46673, 46691, 46627,
+45471, 45979, 45482, 46173, 45655, 46074, 45344, 45362, 45665, 45236, 45212, 45986,
+46391, 46690, 46086, 46420, 45812, 46638, 45041, 46183, 45557, 45006, 46769, 45091,
+46062, 45683, 45305, 47627, 45040, 46296, 44561, 45683, 45818, 45824, 45985, 47691,
+45263, 45629, 45460, 45329, 45263, 46118, 45087, 46421, 46712, 45308, 46796, 47689,
+46745, 43686, 44690, 45869, 45787, 45857, 46577, 46157, 44639, 46133, 44937, 46516,
+46071, 46118, 45913, 45557, 45215, 45846, 45559, 46272, 44983, 46076, 45252, 46577,
+45982, 45996, 45617, 46184, 45650, 45676, 46797, 45490, 45540, 44734, 45632, 45107,
+45291, 45508, 47565, 45713, 45713, 45019, 44900, 45329, 45144, 45710, 46258, 44918,
+45575, 44880, 46166, 47096, 46328, 45067, 46641, 45172, 45503, 46140, 45062, 44555,
+46169, 45958, 45122, 45443, 45503, 46164, 46228, 45246, 46427, 44837, 46079, 46067,
+45707, 44740, 46923, 45247, 45587, 44876, 45339, 46081, 47082, 45802, 45242, 45612,
+45433, 46968, 45757, 45495, 46784, 43762, 46034, 45753, 45692, 46957, 45062, 45188,
+46740, 46147, 45897, 45304, 46548, 45560, 45419, 46931, 46462, 46133, 46196, 44891,
+45914, 44717, 45696, 45715, 45914, 46140, 45739, 44301, 45814, 45797, 46247, 44976,
+45356, 47161, 45714, 45533, 45085, 45219, 45362, 45845, 46159, 45597, 45412, 45894,
+45938, 45674, 46264, 44703, 45146, 46273, 45014, 46001, 45326, 44922, 45418, 46661,
+45843, 46223, 44740, 45783, 46457, 44111, 45562, 46256, 44912, 45530, 46214, 46143,
+45997, 46431, 45464, 45668, 45764, 45722, 46513, 45627, 45839, 46259, 45355, 45576,
+45346, 44801, 45480, 46129, 46007, 45573, 45197, 44708, 48242, 45700, 45255, 44659,
+45669, 46553, 45784, 46455, 47056, 45140, 45162, 45265, 45857, 45557, 46737, 44482,
+44642, 46970, 46133, 46325, 45885, 45752, 45727, 46517, 45992, 44901, 46586, 46033,
+45488, 45504, 46142, 45212, 45055, 45491, 45158, 45542, 45015, 46054, 46007, 45930,
+45521, 45898, 45567, 45502, 46269, 45500, 45112, 46091, 46539, 46310, 44507, 46592,
+45265, 45779, 45717, 45233, 45742, 46311, 45292, 45254, 45888, 45487, 46709, 45905,
+45392, 45735, 44714, 45062, 45802, 46494, 46738, 45803, 45852, 45881, 45778, 44936,
+44481, 46807, 45879, 45898, 44954, 45890, 45312, 45130, 45638, 45716, 44699, 46335,
+45887, 45413, 44936, 46151, 44957, 45632, 47372, 45890, 46742, 45859, 46065, 45320,
+45748, 45318, 44180, 45598, 44975, 44777, 45279, 45773, 46579, 45732, 45532, 44772,
+45272, 44845, 45975, 44677, 44348, 46077, 45853, 45860, 45594, 45646, 45332, 45812,
+47007, 44830, 45999, 44705, 46637, 46715, 45200, 45373, 45671, 45882, 45418, 45677,
+46226, 45666, 44869, 45428, 44982, 45250, 44301, 47324, 45895, 45863, 45444, 45455,
+46444, 45512, 45354, 45547, 45528, 46082, 44114, 45499, 45194, 45786, 43604, 44716,
+46020, 45992, 45584, 45466, 44823, 45653, 46021, 46806, 44777, 46604, 45365, 45317,
+45953, 45965, 44297, 46348, 47087, 45077, 45581, 46617, 46268, 45691, 44292, 44944,
+45102, 46561, 46103, 46248, 45244, 46214, 46818, 44771, 44788, 45914, 46619, 45546,
+46034, 45739, 46008, 46138, 45983, 44456, 45260, 45735, 44989, 46025, 44757, 46160,
+46331, 44300, 45220, 46491, 45295, 43989, 45869, 44870, 46400, 46526, 45310, 46364,
+45488, 45011, 44775, 46924, 45147, 45392, 44527, 45957, 44555, 46427, 44797, 45108,
+45901, 45944, 45636, 46037, 45512, 47386, 44778, 44621, 45073, 46506, 46028, 45766,
+45174, 44345, 45887, 45710, 46799, 44633, 45649, 45111, 45883, 46064, 45377, 45614,
+46185, 46408, 45287, 44732, 44493, 45835, 46214, 45707, 46925, 44894, 45690, 45094,
+47177, 45857, 46425, 44678, 45449, 45476, 45181, 44867, 45366, 45062, 46198, 44711,
+45734, 46430, 46325, 45395, 44967, 45496, 45552, 45343, 45566, 45309, 45758, 45167,
+46949, 46514, 44905, 45503, 45713, 45881, 45242, 46064, 45819, 44599, 45318, 45220,
+45924, 45712, 44859, 46052, 44852, 45118, 45101, 44579, 45252, 45146, 45389, 45412,
+46757, 44912, 45155, 45498, 46546, 46436, 45494, 45353, 44826, 46475, 45503, 45091,
+44843, 44661, 46175, 45332, 45406, 45123, 46417, 44829, 45890, 46361, 45128, 46229,
+45992, 44083, 46961, 46470, 45215, 46078, 44870, 45249, 45881, 46163, 45802, 45215,
+45674, 45363, 45527, 45286, 46815, 46229, 45448, 44177, 45351, 45158, 45946, 45198,
+45659, 45553, 45546, 45415, 45377, 45086, 44981, 44963, 45362, 45441, 46453, 45381,
+44534, 46012, 46107, 45016, 45243, 45649, 45389, 46556, 44472, 44998, 45318, 46154,
+45353, 46432, 44562, 45584, 46360, 45614, 45644, 46095, 45496, 44936, 44742, 45689,
+45409, 45690, 45397, 44772, 46159, 45662, 45428, 45389, 44657, 46364, 45348, 45419,
+45790, 44348, 44811, 44006, 44560, 46191, 45701, 45947, 45901, 45984, 44995, 44970,
+45119, 46585, 45296, 45480, 45677, 44675, 45671, 46498, 45824, 45233, 45192, 45146,
+45638, 45863, 45773, 44839, 44277, 45103, 45689, 46275, 44633, 46168, 44096, 45587,
+45458, 46244, 45815, 45929, 45299, 44922, 46102, 45395, 45482, 45138, 44566, 45198,
+45247, 44178, 46043, 45142, 46616, 44976, 46639, 45365, 45204, 46687, 44796, 44261,
+46012, 45044, 45875, 46026, 46012, 45422, 44690, 45164, 44922, 45802, 46080, 45436,
+46227, 45422, 46292, 44962, 46116, 44663, 44843, 46270, 45876, 45233, 45443, 45451,
+45296, 45060, 46147, 44529, 45967, 45518, 46133, 44291, 45603, 45686, 45727, 45222,
+46133, 45502, 46277, 44462, 44988, 44750, 45749, 45166, 45701, 45896, 44684, 46341,
+45538, 46331, 44883, 45121, 45021, 45823, 46014, 45175, 45162, 45362, 44683, 45080,
+45233, 45242, 45588, 45527, 45172, 45258, 45392, 45334, 45902, 45147, 45515, 45499,
+44892, 45223, 44649, 46690, 45966, 45709, 45006, 45653, 45142, 44853, 45766, 45422,
+45347, 45560, 45479, 46002, 44068, 46665, 45001, 45488, 45978, 44540, 45205, 46076,
+45903, 45002, 45229, 45314, 45000, 45539, 45731, 45359, 45694, 43769, 45677, 44667,
+45242, 46102, 44616, 45712, 45353, 44840, 43593, 46673, 45538, 44589, 44765, 44561,
+45718, 45659, 45368, 45189, 44555, 44657, 45109, 45960, 45271, 45329, 46140, 43957,
+45648, 45031, 45653, 44939, 44927, 44687, 44309, 45828, 45697, 45342, 45527, 45212,
+45049, 45090, 45781, 44790, 44606, 45772, 46148, 44076, 45676, 46121, 45072, 45797,
+45437, 45095, 45782, 45386, 44843, 45152, 45512, 45839, 44804, 46091, 45433, 45378,
+45101, 45478, 45065, 44393, 44778, 46406, 44747, 46393, 44655, 45496, 45263, 45594,
+44410, 45087, 45124, 45762, 45241, 46250, 45279, 45373, 45852, 45829, 44573, 45831,
+44645, 44449, 46163, 44171, 45350, 44454, 45529, 45188, 45009, 45343, 44429, 44852,
+47024, 44588, 46152, 44639, 46289, 44188, 45768, 44047, 45012, 45761, 43946, 45563,
+45421, 46155, 46174, 45488, 45182, 44496, 45194, 45917, 45698, 45626, 45308, 45707,
+45614, 45799, 43940, 44930, 45807, 44677, 46584, 45269, 44555, 44323, 45272, 45164,
+46997, 45171, 45326, 45149, 45685, 45552, 46352, 44668, 45131, 44271, 45368, 46507,
+44327, 44732, 46064, 45836, 45161, 45338, 44961, 45548, 44737, 44463, 45940, 45833,
+44810, 43880, 44411, 46262, 45810, 45343, 45227, 45554, 44627, 44669, 45480, 45605,
+44327, 45653, 46030, 44469, 46078, 45857, 45329, 44688, 44117, 46373, 46562, 45070,
+44823, 44948, 44755, 45410, 45141, 45236, 44449, 45587, 44481, 45740, 44918, 44582,
+45463, 46250, 45837, 45238, 44904, 45971, 45803, 45077, 45706, 44295, 44822, 45148,
+45372, 44197, 44807, 44717, 45827, 46037, 45051, 45437, 44947, 45654, 45358, 45171,
+44956, 45227, 44916, 45700, 44846, 44882, 44462, 45770, 45392, 45069, 45197, 44743,
+45512, 44994, 45044, 44240, 45535, 45071, 44373, 46936, 45702, 45056, 45641, 46133,
+45718, 45302, 44307, 44972, 46343, 44519, 46000, 44835, 43837, 45512, 44852, 45696,
+44789, 46106, 44851, 44193, 45526, 45545, 45387, 44480, 45487, 45114, 46096, 44291,
+44816, 44498, 45647, 46884, 44900, 43733, 45836, 45716, 44648, 45449, 44824, 44900,
+45540, 44249, 45695, 45556, 45018, 45244, 45887, 44606, 44535, 44834, 44266, 46116,
+45050, 45236, 44971, 46119, 44432, 45940, 44852, 44673, 46337, 45430, 45053, 46484,
+44652, 45122, 45539, 45449, 45532, 45203, 43817, 46209, 44465, 46046, 45256, 45111,
+45167, 45277, 46628, 45288, 44650, 44475, 45116, 45478, 46755, 45256, 45659, 44973,
+44960, 44099, 45217, 45357, 44641, 45591, 45524, 45770, 45389, 45662, 45797, 44287,
+43929, 44933, 45736, 44418, 44926, 45693, 44987, 45938, 46343, 44399, 44798, 46268,
+45098, 45091, 43416, 45901, 45804, 45743, 45484, 45605, 45920, 43731, 44753, 45019,
+44882, 45879, 44528, 43973, 45892, 45266, 45357, 45047, 44291, 44999, 44597, 45305,
+44855, 44855, 45353, 45638, 44335, 45647, 45708, 44947, 44657, 45323, 46077, 44440,
+44004, 44215, 44894, 44822, 45006, 45298, 45299, 44418, 44761, 45170, 45411, 45380,
+45319, 45536, 46421, 44325, 45454, 44775, 45592, 44225, 46259, 45824, 44712, 45323,
+45646, 43764, 45977, 45167, 44428, 45989, 44532, 45433, 44216, 44423, 43769, 44625,
+44914, 46422, 44984, 45689, 45251, 44579, 45440, 44716, 45224, 45150, 45065, 44146,
+44823, 45169, 44732, 43919, 46097, 44217, 44812, 45002, 45188, 45426, 44035, 45234,
+45161, 45818, 44050, 44744, 45818, 44922, 44789, 45464, 45818, 44929, 45759, 45227,
+45158, 44467, 43862, 46269, 44704, 44558, 45191, 45353, 44147, 45825, 46231, 45495,
+45844, 44775, 43822, 45564, 45505, 45575, 45249, 44866, 44801, 46094, 44649, 43643,
+45533, 44840, 44947, 44535, 46811, 44536, 45473, 45135, 45337, 45278, 45449, 45287,
+44999, 45233, 44727, 44353, 45020, 45372, 45070, 45426, 45346, 45057, 45559, 45191,
+44546, 45728, 44025, 44579, 45490, 44954, 45531, 43933, 44865, 45497, 46105, 43752,
+44152, 44472, 45016, 44258, 45261, 43757, 45802, 44253, 44324, 45049, 45642, 44651,
+45073, 46395, 46393, 44897, 43412, 46107, 43766, 45494, 45151, 44699, 44025, 44596,
+44808, 45532, 44652, 45494, 44509, 46685, 44736, 44180, 45559, 44721, 43771, 45720,
+45109, 44997, 44773, 46542, 45061, 45587, 45314, 44631, 45154, 44765, 45329, 44075,
+43773, 44732, 45308, 44911, 44186, 45951, 43982, 45154, 45278, 45645, 44081, 45392,
+44242, 45174, 44957, 44851, 44894, 45936, 45457, 44583, 44527, 46052, 44826, 46192,
+45611, 45399, 44495, 44978, 44302, 44718, 45161, 44840, 44519, 45083, 44696, 44833,
+45722, 45122, 44225, 45881, 45065, 44336, 44205, 45100, 46424, 44574, 45446, 44659,
+44792, 45357, 44764, 45893, 43739, 46041, 45133, 44346, 44588, 45716, 45491, 43573,
+44280, 44500, 44364, 45382, 44888, 44951, 46239, 45743, 44012, 44516, 46183, 44982,
+44959, 44594, 45066, 43813, 44447, 45140, 44964, 45103, 45290, 45003, 44485, 45090,
+44950, 44879, 45459, 45985, 45717, 46265, 44758, 43847, 45450, 43430, 45266, 45395,
+44482, 45227, 44843, 45168, 44653, 44256, 44695, 44618, 45318, 45730, 44310, 46094,
+44495, 44075, 45203, 45700, 45077, 44747, 45579, 45482, 45001, 44912, 45992, 44543,
+45447, 44035, 46304, 44466, 45518, 45131, 45202, 44936, 45084, 44495, 45367, 44699,
+44945, 45414, 45206, 44002, 45582, 44618, 44890, 45404, 44666, 44579, 45534, 44627,
+44797, 44672, 45143, 44322, 45949, 44714, 45240, 45206, 44920, 44003, 45107, 44777,
+44166, 46988, 45466, 44927, 44840, 46134, 44353, 46038, 44090, 45122, 46414, 44658,
+44306, 45008, 45134, 44437, 44733, 45428, 45727, 43961, 44204, 44934, 43969, 45108,
+44809, 45290, 44090, 45567, 44731, 44744, 45641, 45041, 44924, 46026, 44461, 43470,
+45361, 45018, 44837, 44609, 44192, 45305, 44192, 44876, 45568, 45675, 43844, 44275,
+44654, 45890, 44489, 44591, 44832, 44467, 44681, 45524, 44585, 43488, 43477, 44856,
+44888, 44432, 45263, 45106, 44982, 44813, 44776, 45030, 45245, 43964, 44704, 44355,
+45188, 44291, 45038, 45319, 44724, 44173, 44742, 44479, 45335, 44688, 44596, 44307,
+45017, 46033, 44082, 45202, 44996, 45333, 43883, 44962, 45407, 44784, 44762, 45062,
+44488, 45338, 44370, 45529, 44292, 45137, 45862, 44723, 45539, 44348, 44513, 45221,
+44432, 46056, 43870, 44432, 44514, 44462, 44152, 43682, 44387, 44810, 44982, 46066,
+44970, 44692, 44805, 45287, 45121, 44903, 45029, 44610, 45046, 44943, 45466, 45423,
+44231, 44782, 45398, 44871, 45037, 44133, 43552, 45917, 44786, 44043, 44956, 45377,
+45191, 44867, 45521, 44207, 44414, 44840, 45114, 45016, 45003, 44182, 44445, 44467,
+44697, 44138, 45082, 44399, 45867, 45410, 44873, 45757, 44817, 45050, 45217, 44697,
+43904, 45677, 44558, 45595, 44582, 44844, 45106, 45648, 44912, 45050, 44384, 44572,
+44957, 43806, 44776, 44994, 44362, 45375, 45332, 44156, 45127, 44603, 44213, 45393,
+44636, 44405, 45937, 44322, 44458, 43758, 44017, 44340, 44569, 44678, 45191, 45267,
+44986, 43773, 46540, 44798, 44154, 44686, 45185, 45167, 44319, 44228, 45659, 43829,
+44801, 43652, 45688, 44691, 45847, 44804, 44856, 44423, 45020, 43666, 44819, 45338,
+44129, 45390, 45004, 45992, 43767, 44957, 44002, 44448, 43891, 44253, 44518, 46113,
+45002, 45580, 45689, 45114, 44288, 45164, 45029, 44624, 45025, 45329, 43791, 43792,
+44342, 45291, 43864, 44460, 44987, 45227, 44512, 45018, 44579, 45085, 45143, 44273,
+44880, 44366, 45730, 44111, 44538, 44437, 44199, 44755, 44370, 45389, 46039, 44208,
+44024, 45230, 44576, 43802, 45284, 44840, 44762, 45395, 45416, 45086, 45004, 44556,
+45062, 44567, 44027, 44257, 44456, 44148, 43891, 45243, 44612, 45136, 45788, 43895,
+44388, 44827, 44093, 44316, 45194, 45571, 44306, 44394, 43940, 44644, 45356, 44792,
+45695, 44009, 43970, 44850, 44600, 44054, 43079, 43394, 45988, 45021, 45046, 43451,
+43685, 44465, 45912, 44654, 44812, 44031, 45173, 43769, 44438, 44264, 44116, 44666,
+45444, 45106, 44600, 44990, 44175, 45358, 44651, 45528, 44326, 43752, 45698, 45202,
+45183, 44714, 44843, 44788, 45293, 44619, 44282, 44575, 44421, 44045, 45199, 44360,
+45062, 44634, 44447, 45301, 45651, 44948, 44171, 44215, 43610, 45027, 43763, 44608,
+45681, 44360, 44270, 44879, 44453, 44921, 44705, 45476, 45335, 44879, 45515, 43984,
+44273, 43685, 45041, 44882, 45114, 45391, 44526, 44917, 44949, 45325, 45027, 45055,
+45045, 44707, 45578, 45401, 44609, 44937, 44201, 44947, 44823, 44447, 43619, 44302,
+44837, 44634, 44903, 45181, 44298, 44732, 44512, 45606, 45046, 42782, 44997, 44888,
+44198, 45904, 44138, 44154, 45169, 44492, 44432, 45143, 44628, 44962, 43671, 44761,
+45050, 44100, 44953, 44247, 44933, 44386, 45090, 45280, 44267, 44820, 44789, 44191,
+44688, 43639, 44135, 44447, 43722, 44597, 44069, 45032, 44530, 44690, 45353, 44310,
+45127, 44157, 44032, 45840, 44039, 44944, 44310, 44023, 45617, 44333, 43316, 44553,
+44665, 43434, 45410, 43888, 44594, 44441, 44357, 44177, 45702, 43352, 45145, 44633,
+46179, 44582, 44545, 44378, 44471, 44619, 44402, 44602, 43736, 45141, 44467, 45233,
+43992, 44725, 44943, 45074, 44854, 43902, 43559, 44920, 44769, 44452, 44822, 44651,
+45308, 44796, 44864, 44851, 45380, 43389, 44417, 44375, 43925, 44122, 45942, 44792,
+44222, 45514, 44253, 44536, 44999, 43566, 44921, 44654, 45536, 43576, 43998, 44903,
+44555, 45139, 44531, 44241, 45565, 44222, 44010, 45098, 45173, 44791, 45453, 45694,
+44490, 44155, 44594, 44999, 44075, 43382, 44250, 42964, 44579, 44363, 45708, 43985,
+43999, 44406, 44089, 44169, 44297, 43969, 44576, 44786, 44448, 44422, 44454, 44504,
+44897, 43664, 45253, 45104, 44279, 45087, 44347, 43766, 44832, 44156, 44635, 45045,
+44107, 45219, 44662, 43905, 43459, 44301, 45578, 43361, 45548, 44666, 44281, 44942,
+44364, 44935, 44444, 45189, 44180, 44836, 44625, 43132, 43574, 43947, 44533, 44051,
+45476, 45069, 43852, 44567, 44837, 45650, 44568, 42911, 44126, 44573, 44831, 44485,
+44501, 44415, 44810, 43819, 43824, 44108, 44146, 44862, 44558, 45251, 44378, 45175,
+44402, 43794, 45035, 44156, 44815, 44201, 45561, 44068, 43947, 45125, 45005, 45502,
+44907, 44185, 45786, 44543, 44273, 46036, 44942, 45183, 43810, 43818, 44161, 43908,
+43808, 44510, 44224, 45086, 45092, 44244, 44614, 45200, 44411, 43590, 44434, 44111,
+43484, 44019, 44720, 44821, 43997, 43250, 43535, 44802, 44324, 45389, 44141, 44804,
+44510, 44501, 44368, 45177, 45116, 44389, 44651, 44226, 44569, 45560, 44175, 44411,
+43946, 44344, 44930, 44457, 44506, 44253, 44759, 44192, 45121, 44492, 44375, 44160,
+45019, 44222, 43460, 45141, 44066, 44357, 44413, 43650, 44258, 45197, 44072, 45059,
+44132, 43877, 44384, 44068, 44202, 43939, 44357, 45125, 44004, 44495, 43771, 44304,
+44371, 44343, 43927, 43515, 44965, 44504, 44789, 44400, 44275, 42930, 43658, 43300,
+45194, 44468, 45320, 43829, 45546, 44605, 44369, 44745, 44315, 43402, 44201, 43763,
+44787, 44419, 43704, 43667, 43742, 44012, 44107, 45266, 43899, 44081, 43973, 45134,
+43760, 43400, 44794, 44765, 44352, 44807, 44858, 44026, 44613, 43855, 44255, 44036,
+44151, 44447, 44464, 44960, 45003, 44155, 44757, 45815, 44366, 43322, 43682, 45401,
+44254, 44534, 44904, 44461, 44903, 43985, 45068, 44049, 44584, 43433, 43878, 44393,
+43784, 43958, 43811, 44507, 43013, 45361, 44103, 43861, 44229, 43580, 43597, 43908,
+44203, 44151, 43793, 44356, 45348, 44677, 44448, 45734, 43424, 44455, 44100, 43909,
+44667, 43474, 43833, 43900, 44301, 44167, 44747, 44519, 45000, 43657, 44877, 44534,
+44236, 44903, 45161, 44249, 44870, 44913, 44152, 44556, 44483, 44257, 43995, 44978,
+44344, 44385, 44807, 44341, 44417, 44559, 44780, 44600, 44329, 44604, 44540, 43915,
+44562, 45340, 44892, 43718, 43780, 44234, 44022, 43886, 43171, 44543, 44198, 45620,
+44379, 43871, 44198, 43927, 45081, 44033, 43756, 44264, 43904, 43890, 44435, 44281,
+45660, 43144, 43764, 44897, 44371, 44588, 44145, 43877, 44257, 43994, 43710, 44944,
+44600, 44319, 43795, 43989, 44627, 44111, 44908, 43982, 44073, 43372, 43892, 43929,
+44519, 44173, 44564, 44010, 44635, 44558, 43863, 44996, 44635, 43974, 44530, 43584,
+45086, 45188, 43705, 44639, 44715, 44092, 44309, 44226, 45127, 44468, 43748, 44702,
+44819, 43850, 43764, 44905, 43151, 44157, 44173, 43794, 44420, 44026, 45278, 43209,
+45550, 44285, 43401, 44804, 43381, 44363, 43157, 43607, 44355, 43985, 44494, 44069,
+44510, 44915, 44262, 44576, 45335, 42932, 42787, 45470, 43274, 43514, 44705, 45315,
+44032, 45650, 45681, 43918, 44159, 42791, 43998, 44402, 43225, 44163, 44657, 44498,
+43420, 44409, 44935, 43929, 44789, 43943, 44636, 44545, 45326, 44355, 44459, 44438,
+44119, 44135, 44511, 43627, 44075, 44207, 44684, 44768, 43820, 44141, 44279, 43080,
+44245, 43976, 45462, 44543, 43090, 44972, 44946, 44933, 43738, 44535, 43769, 45488,
+43426, 43878, 42961, 45687, 44215, 43742, 43719, 44977, 43815, 44314, 44135, 42870,
+44186, 44086, 43569, 44494, 44439, 44426, 44066, 43625, 43741, 45096, 43807, 43953,
+45047, 44758, 44966, 44892, 43966, 43673, 43853, 44280, 43441, 43838, 45582, 44213,
+44750, 43885, 44802, 43739, 43280, 45025, 43092, 44218, 44517, 44606, 43808, 44693,
+43471, 44885, 45014, 44960, 43269, 43292, 43498, 44594, 44855, 44894, 43080, 43885,
+44327, 43022, 44787, 43448, 43753, 44781, 42613, 44075, 43836, 44257, 44129, 45062,
+44166, 44506, 43713, 43694, 46090, 44457, 43546, 44430, 44414, 44018, 43501, 44223,
+43756, 43907, 43859, 45053, 43454, 43884, 43106, 44443, 43725, 44542, 43832, 45642,
+43603, 44261, 43674, 45271, 44441, 44340, 43982, 43774, 45338, 44276, 43763, 44076,
+43939, 44475, 43498, 44294, 44754, 42530, 44750, 43637, 45536, 44032, 44450, 42815,
+43977, 43864, 43545, 44093, 44971, 44381, 43910, 44115, 45313, 44702, 43628, 45159,
+43642, 44399, 43853, 44234, 43940, 44117, 44204, 43523, 45263, 44166, 44033, 44411,
+43778, 44368, 44894, 43290, 45124, 44478, 44222, 43387, 43857, 43403, 44995, 44033,
+44183, 43496, 45402, 43229, 44455, 44091, 44140, 44337, 42910, 44454, 44645, 44524,
+44546, 43530, 44267, 43898, 43916, 44944, 43652, 43896, 43142, 43856, 44803, 42951,
+45227, 44315, 44012, 44017, 44594, 44585, 44097, 43397, 44587, 44342, 44352, 42790,
+42873, 44612, 43276, 43739, 45047, 42647, 44595, 42376, 43574, 43487, 44516, 44024,
+44186, 44861, 44502, 44108, 43195, 43863, 44462, 44789, 44477, 44777, 45301, 43836,
+44261, 43564, 43452, 43712, 45667, 43446, 43069, 44570, 43962, 43957, 44148, 44198,
+44722, 44660, 44201, 44484, 43645, 44769, 43750, 42498, 44542, 43121, 44037, 44234,
+44441, 43639, 43451, 43905, 44974, 44558, 43307, 44120, 44148, 43721, 43679, 44606,
+42772, 44508, 43739, 44504, 45646, 44123, 44303, 43935, 44674, 44019, 44623, 44064,
+43307, 43361, 44092, 44118, 44062, 44765, 43652, 44283, 45658, 43712, 44612, 43584,
+43759, 44388, 44134, 44568, 43712, 43657, 44283, 44456, 43327, 44444, 43950, 44959,
+44024, 43368, 43207, 44378, 43178, 43920, 44188, 43913, 43866, 44447, 43472, 44950,
+44433, 43856, 44264, 44012, 43861, 43964, 43815, 42788, 45841, 43632, 44908, 43917,
+44947, 43452, 43403, 44084, 43147, 44874, 42953, 44461, 44501, 44162, 43566, 43240,
+43571, 44660, 43224, 44786, 43987, 43659, 44396, 43960, 43463, 43856, 43235, 44334,
+44203, 43398, 44741, 43667, 43334, 43960, 44561, 44165, 44226, 44071, 43377, 44038,
+44880, 42449, 44756, 43337, 43936, 43623, 44393, 43555, 43827, 44183, 44189, 43250,
+45041, 43414, 43730, 43268, 42698, 43395, 44197, 43668, 44317, 43508, 42828, 42950,
+44887, 43271, 44367, 42983, 43481, 43093, 43842, 44264, 44177, 44974, 44553, 44698,
+43923, 43366, 43512, 43082, 44752, 44996, 44367, 43507, 43661, 45173, 43391, 43695,
+43594, 42944, 44148, 44090, 45718, 43077, 43660, 42795, 43691, 43021, 43659, 44705,
+43714, 44426, 44232, 43451, 44762, 44092, 44511, 44219, 44170, 42695, 43184, 44765,
+45320, 42881, 43350, 43760, 43844, 43849, 43970, 44079, 44455, 42309, 42388, 44172,
+43243, 43368, 43546, 44757, 43820, 43829, 45283, 44340, 44924, 44599, 44013, 42749,
+43444, 44810, 44807, 42195, 43369, 43902, 43547, 43841, 43450, 43275, 43546, 43067,
+44358, 44281, 43340, 44222, 44025, 43291, 44297, 43781, 43103, 43097, 42978, 45251,
+44911, 42749, 43302, 43289, 42473, 43094, 43079, 43877, 42817, 45342, 44963, 44117,
+41989, 44724, 44087, 44773, 45032, 43881, 43840, 44462, 42842, 44420, 43502, 43179,
+43366, 44597, 45177, 43690, 43052, 44598, 43238, 43865, 44219, 43813, 43547, 44135,
+43529, 44166, 43588, 43340, 43818, 43906, 43038, 44522, 45113, 42977, 43519, 44024,
+44982, 45005, 43522, 44145, 43979, 44294, 43738, 43707, 43042, 43365, 44413, 43431,
+42769, 43431, 44462, 44303, 43292, 43126, 44165, 44420, 43734, 43093, 42813, 44423,
+45817, 43215, 43997, 43277, 43571, 44005, 43122, 43825, 44297, 43247, 44022, 44401,
+44580, 44164, 45029, 43410, 44285, 44024, 42838, 44201, 43794, 43357, 43067, 44870,
+44174, 44180, 43875, 42979, 44795, 43509, 44189, 43858, 44219, 44162, 43457, 43335,
+43309, 44045, 43422, 44042, 43240, 43748, 43812, 43258, 43887, 43682, 43760, 43436,
+43033, 42317, 43424, 44271, 43010, 44353, 43353, 44566, 43916, 43952, 43722, 42668,
+43513, 43458, 43399, 44042, 43338, 43019, 44476, 43703, 43359, 43939, 44733, 43267,
+43685, 43548, 43745, 44464, 44225, 43518, 43802, 43426, 42839, 44133, 43474, 43709,
+43800, 43328, 42401, 44242, 45158, 43667, 42893, 44367, 43858, 43184, 43427, 44637,
+43100, 43235, 44102, 44707, 43838, 43961, 43779, 44000, 43393, 44280, 44369, 44171,
+43333, 43373, 45239, 43305, 43481, 44950, 43827, 43594, 43376, 42726, 44150, 44000,
+45593, 44561, 43541, 44369, 43253, 43187, 43276, 44003, 42714, 43595, 43304, 44143,
+43011, 43213, 43577, 43574, 44387, 43247, 44171, 43143, 43384, 43758, 43048, 43847,
+43922, 43682, 45101, 43698, 44015, 43600, 42921, 43916, 42952, 43248, 42413, 43559,
+44539, 43635, 43619, 44840, 43588, 43874, 43635, 44032, 43107, 43907, 43303, 43172,
+43260, 45455, 43627, 42674, 44582, 43980, 43585, 43629, 43970, 43696, 43709, 43940,
+44099, 42942, 43333, 43880, 44189, 42882, 43334, 44507, 42254, 42641, 44074, 43656,
+43855, 44105, 43572, 43627, 43127, 43205, 43808, 44442, 43693, 44286, 43691, 42812,
+43951, 43548, 44611, 44625, 43334, 42368, 44191, 43160, 43704, 43423, 44034, 43726,
+43653, 44092, 42881, 43433, 43955, 44232, 43894, 44246, 42545, 43952, 43515, 44141,
+43606, 43659, 44629, 42212, 43410, 43060, 42864, 43660, 43217, 43104, 43880, 43802,
+42232, 43374, 43400, 44252, 43594, 42116, 43020, 42923, 43052, 44161, 44795, 43679,
+43194, 43996, 42702, 43781, 44047, 44502, 43094, 43075, 43500, 44215, 42632, 44598,
+43513, 43200, 43313, 44557, 42971, 44147, 43158, 42850, 42617, 44444, 44607, 42827,
+44068, 42587, 44384, 43727, 43728, 43298, 43393, 42482, 43212, 43559, 43724, 43927,
+44040, 43838, 43328, 43382, 44600, 43444, 43638, 42880, 44036, 44225, 43266, 43897,
+44648, 44036, 43421, 43991, 43284, 42986, 43556, 44035, 43716, 43900, 42774, 42505,
+42588, 42506, 44120, 44204, 44699, 43903, 44145, 42494, 43241, 43396, 43322, 43541,
+43634, 42927, 43663, 43412, 43236, 42700, 42978, 43823, 43547, 43532, 43652, 42467,
+43537, 44447, 43703, 43032, 43234, 43260, 43505, 42962, 43157, 43124, 43130, 43136,
+43132, 44072, 43130, 42659, 44037, 44407, 42629, 43890, 43085, 44141, 43751, 43613,
+42748, 44207, 45645, 42499, 43484, 43412, 43812, 42934, 44448, 43112, 43726, 43490,
+43550, 44082, 43027, 43530, 44867, 43607, 43676, 43604, 44510, 43999, 42905, 43635,
+43660, 42437, 43764, 42719, 44429, 43177, 42956, 43349, 42947, 43757, 42969, 44093,
+43214, 43282, 43235, 43013, 43940, 43358, 43634, 44366, 43040, 43097, 43415, 43895,
+43907, 44157, 43507, 44166, 43738, 44034, 43189, 42255, 43315, 43527, 43901, 42013,
+43119, 42409, 44144, 43106, 42513, 43355, 43633, 44576, 43245, 43207, 43590, 44159,
+43936, 43217, 43395, 42578, 44428, 44183, 43716, 43990, 44214, 43343, 43550, 44089,
+43659, 44077, 43223, 43991, 42935, 43655, 42969, 43424, 43514, 43897, 43241, 43239,
+43655, 43453, 43107, 43466, 44458, 42473, 44552, 42876, 43393, 43776, 44510, 43727,
+42404, 42917, 43418, 43141, 42698, 42675, 42983, 43643, 43760, 43456, 43064, 43625,
+44214, 43691, 41933, 43738, 43647, 43411, 42986, 43247, 43638, 42202, 43197, 43940,
+43750, 43550, 43493, 43943, 43391, 43778, 42935, 42507, 43451, 44309, 44260, 43377,
+42512, 43268, 42554, 44042, 42770, 44549, 43142, 42197, 43286, 43633, 42891, 43697,
+44000, 43253, 42494, 43171, 44055, 43067, 43502, 43729, 43521, 42448, 44201, 43586,
+43310, 42605, 43577, 43023, 42371, 43562, 43633, 42755, 44129, 42990, 42274, 43097,
+43401, 44227, 43083, 42530, 43072, 44610, 44336, 42548, 43927, 44129, 43257, 43399,
+42903, 43975, 43592, 44112, 43612, 44067, 42362, 43231, 42432, 43249, 44195, 43319,
+44817, 42856, 43842, 43277, 44239, 43022, 43772, 42555, 42886, 42890, 42812, 42584,
+43167, 43768, 42636, 44017, 43154, 43511, 43104, 43705, 43217, 42447, 44383, 43550,
+43017, 42740, 42806, 44431, 43404, 42829, 43283, 44508, 42908, 42851, 43673, 42994,
+43203, 42641, 43738, 42636, 43927, 43889, 43347, 43540, 43163, 44447, 42912, 42719,
+43249, 44348, 42864, 43177, 43569, 43300, 42309, 43765, 42690, 43627, 43401, 42920,
+42629, 42250, 44009, 44234, 43343, 42675, 43784, 42649, 43134, 44360, 43430, 42587,
+44050, 43601, 42734, 43277, 43710, 43274, 43073, 44287, 42815, 43289, 43545, 43063,
+43455, 43199, 43123, 43746, 43633, 43422, 43604, 43514, 44365, 43434, 42737, 43768,
+43655, 43101, 43733, 41513, 43528, 43062, 43207, 42924, 43718, 44422, 43874, 43877,
+43847, 43017, 42440, 43096, 42932, 43913, 41774, 42761, 43727, 42860, 44163, 43142,
+43759, 43014, 42344, 43898, 43162, 43016, 42560, 43688, 43436, 42974, 43503, 43645,
+42989, 42327, 43229, 42697, 42734, 42773, 43307, 43710, 42781, 43283, 43236, 43864,
+43095, 41504, 43160, 44462, 42344, 43390, 43157, 43577, 42837, 43489, 43367, 43712,
+43100, 43523, 43316, 42927, 43112, 43144, 44237, 43080, 42605, 43964, 42179, 42455,
+43739, 43252, 42755, 43509, 42892, 41987, 42428, 43464, 42968, 43853, 43081, 43682,
+43344, 42089, 43159, 43257, 42938, 41746, 42488, 43107, 43145, 43376, 43400, 43564,
+43434, 42575, 43957, 43442, 43242, 42863, 44108, 43246, 43479, 43495, 43338, 42635,
+43525, 42855, 43127, 42509, 44047, 42677, 43260, 41426, 44284, 43136, 42423, 43163,
+43201, 43425, 43732, 43185, 42451, 43811, 42162, 43466, 42425, 43024, 42752, 42714,
+43516, 42716, 42675, 42689, 42745, 42377, 43545, 43814, 42515, 44264, 41887, 42815,
+42887, 43964, 42672, 43754, 42140, 44017, 43395, 41893, 43191, 43174, 43002, 41980,
+43118, 43935, 43649, 43277, 43846, 42773, 41966, 42096, 43900, 41256, 42692, 44102,
+44480, 43139, 43303, 43742, 42359, 43244, 43493, 42840, 43627, 44232, 43991, 42947,
+43162, 43530, 43151, 43718, 42766, 43272, 43565, 43844, 43435, 44090, 43010, 42198,
+43510, 42458, 43482, 43177, 42338, 43530, 42895, 42539, 43005, 43085, 42284, 41912,
+43396, 43043, 43995, 44179, 43334, 44018, 42639, 43495, 42489, 43030, 42578, 43622,
+43956, 43514, 43261, 43230, 43319, 43691, 43864, 44262, 42862, 43622, 43089, 42515,
+42266, 42578, 42851, 43138, 44121, 43048, 43320, 42409, 43469, 42879, 42865, 43979,
+42797, 42722, 44291, 42792, 43798, 42735, 42908, 42008, 43328, 41969, 43559, 43196,
+43948, 43023, 44117, 42620, 43313, 41851, 42798, 43561, 41481, 43727, 42173, 43289,
+43675, 43383, 43603, 43865, 43344, 43322, 43736, 42445, 43442, 42860, 42632, 43577,
+43302, 43142, 41777, 43457, 43547, 41497, 43101, 42170, 42938, 43648, 42962, 43631,
+42282, 42913, 43073, 43782, 41620, 43058, 42425, 43199, 42233, 43130, 43164, 44384,
+42790, 42890, 43692, 42547, 42888, 43172, 42341, 43496, 44243, 42526, 43133, 42401,
+43062, 43739, 42878, 42319, 43967, 41562, 43282, 42119, 43170, 43910, 43885, 42819,
+43105, 43092, 42289, 42840, 43987, 42417, 42859, 42675, 43268, 43222, 43083, 43255,
+42641, 43317, 43058, 42428, 42626, 43144, 43281, 42296, 42382, 42816, 42862, 42224,
+42866, 42606, 41752, 43128, 43579, 43365, 43316, 42904, 42830, 43847, 42722, 43167,
+43109, 43225, 43014, 42343, 42597, 42487, 43235, 42737, 41982, 43214, 42169, 42440,
+41720, 43281, 43324, 43586, 41907, 44357, 42958, 42467, 42252, 43651, 43349, 43296,
+42388, 42827, 43479, 42787, 42339, 42970, 43320, 43517, 42692, 42227, 43307, 42407,
+43231, 42963, 41885, 42703, 42696, 42482, 42758, 42572, 43357, 42365, 44472, 42485,
+42532, 42422, 44115, 43421, 43163, 43982, 42283, 41267, 42662, 42438, 42544, 43169,
+43368, 41831, 42563, 42841, 42452, 43002, 43076, 42688, 42743, 43289, 42458, 43197,
+42286, 42180, 43256, 43330, 43197, 42572, 42217, 44372, 43142, 43260, 42422, 42916,
+42840, 41840, 42206, 42845, 42760, 42581, 42561, 43826, 41660, 43034, 43165, 43391,
+41553, 43286, 42511, 42942, 42131, 42974, 42541, 43214, 42090, 42206, 42559, 43551,
+42914, 42101, 42481, 42657, 41486, 42542, 42280, 43466, 43172, 43743, 42274, 42320,
+42330, 42434, 42721, 43437, 43162, 41901, 43529, 43121, 42775, 42435, 42199, 43892,
+42753, 42538, 43191, 43807, 41874, 43100, 42769, 42807, 43187, 43465, 42708, 43276,
+43322, 42794, 43301, 42353, 41664, 43208, 43379, 43630, 42876, 42602, 43093, 42504,
+43234, 42545, 43319, 41943, 43121, 41687, 43423, 42432, 41602, 42747, 42077, 42886,
+42969, 43262, 43343, 42155, 42476, 42893, 42601, 42363, 42874, 42731, 42618, 42641,
+41855, 42845, 42610, 42243, 43541, 42013, 41942, 42731, 41969, 42804, 42869, 43210,
+43583, 41951, 41034, 42730, 40814, 44276, 42681, 41134, 43317, 43157, 43052, 43247,
+43300, 42002, 42722, 41763, 42863, 43346, 42964, 43077, 42332, 43679, 42665, 42634,
+43257, 42047, 42542, 42484, 43752, 42386, 42472, 42326, 43098, 41684, 42469, 42984,
+43343, 42307, 43644, 42095, 42494, 43109, 42863, 42917, 42385, 44403, 42028, 43205,
+43317, 42947, 43226, 42118, 41451, 43357, 43209, 43688, 42425, 41986, 43268, 42167,
+42054, 41837, 43436, 43343, 42557, 42409, 42143, 42557, 42233, 43050, 42325, 42615,
+43169, 42320, 43177, 42548, 42351, 43346, 43483, 42411, 43285, 41910, 43397, 42547,
+43179, 42706, 43095, 43088, 43109, 42656, 42227, 42353, 42701, 42397, 42251, 43619,
+43151, 42978, 42824, 42457, 43589, 42957, 41593, 42579, 42995, 42736, 43475, 42005,
+41961, 42388, 42941, 42707, 41612, 41831, 42873, 43565, 42032, 43499, 43192, 41127,
+42553, 41660, 42437, 42923, 42411, 42731, 42229, 42918, 42430, 41756, 42185, 43104,
+41980, 43430, 42942, 42101, 42635, 40726, 43536, 42502, 42894, 42952, 42681, 42662,
+41993, 42596, 42787, 43002, 41842, 42455, 42672, 43889, 42041, 42727, 43884, 42830,
+42392, 42409, 42746, 42276, 42553, 42257, 43721, 42176, 42905, 41307, 42589, 42479,
+43020, 42980, 42817, 41762, 42341, 42017, 42171, 43738, 40977, 42553, 43556, 42056,
+42539, 43659, 43244, 42755, 43543, 41603, 42548, 42605, 42261, 42662, 42272, 42260,
+42484, 42582, 41594, 42712, 42357, 42502, 42896, 42761, 42059, 43592, 41897, 42438,
+42731, 41812, 43833, 42701, 42290, 42952, 42699, 42098, 43139, 42572, 42362, 42620,
+41240, 42541, 41733, 43159, 42744, 42508, 42632, 42854, 43077, 42451, 42216, 42872,
+41474, 42182, 42839, 42823, 42333, 42346, 42506, 42564, 42907, 42437, 42156, 42278,
+41777, 42206, 42268, 41436, 43087, 41931, 41753, 43432, 42671, 42660, 43760, 42004,
+42557, 42684, 42553, 42051, 41297, 42188, 43478, 42175, 42222, 42835, 42302, 41921,
+43565, 41145, 43225, 41472, 42451, 42324, 43003, 43575, 42592, 42317, 42131, 43598,
+42093, 42713, 40961, 41675, 42134, 42953, 43280, 42638, 43132, 42447, 41875, 41943,
+41638, 42866, 42191, 41879, 42353, 42162, 43136, 41122, 43242, 42256, 42849, 41906,
+42646, 42207, 43157, 42689, 42839, 42370, 42389, 42710, 41162, 42446, 42572, 43718,
+42459, 42532, 43163, 43866, 42427, 42639, 42473, 42239, 41833, 41436, 42349, 41973,
+42029, 42112, 42699, 42685, 42462, 41920, 42479, 42234, 41708, 42377, 42796, 42605,
+42789, 41452, 42041, 42558, 42503, 42022, 41954, 43337, 42404, 43212, 41677, 42051,
+42313, 42650, 42044, 42078, 43324, 43217, 42309, 41851, 41517, 42253, 42170, 42345,
+42901, 41663, 43137, 41852, 42554, 42145, 42659, 41523, 43412, 41921, 43178, 42527,
+41432, 42529, 42939, 42220, 42942, 41452, 41685, 42656, 42814, 41633, 43005, 42241,
+41595, 42995, 41803, 42597, 41965, 43004, 41423, 40997, 42570, 42278, 42538, 42140,
+41223, 42682, 41687, 41988, 43375, 42251, 42539, 42252, 41576, 42293, 42941, 42542,
+42167, 42557, 42112, 42812, 42527, 42363, 41710, 42300, 44059, 41168, 42846, 42632,
+41998, 42671, 42308, 41972, 42188, 41910, 41932, 42447, 42053, 43261, 42368, 42732,
+42706, 42324, 42265, 41814, 42970, 42213, 42596, 42499, 42338, 41642, 42012, 43354,
+42765, 43091, 41261, 43274, 41860, 42611, 41600, 42680, 42807, 42941, 41452, 42732,
+41752, 41652, 42409, 42600, 41999, 42670, 41079, 42452, 42178, 42366, 42070, 42764,
+42191, 40778, 42386, 43011, 42440, 42437, 41671, 42795, 41224, 43028, 43421, 42182,
+42071, 41828, 42383, 42684, 42244, 43016, 42177, 41824, 41220, 42329, 43019, 42080,
+41906, 42418, 41222, 41537, 42732, 42670, 43139, 42254, 42122, 41898, 42011, 43027,
+41493, 41459, 41696, 42353, 41866, 42578, 41664, 41012, 42745, 42077, 41366, 42890,
+42693, 41861, 41897, 41477, 40997, 42223, 42168, 41942, 42403, 42327, 42962, 43019,
+42508, 41633, 41793, 42379, 41594, 42678, 41969, 41735, 41915, 42142, 42207, 41903,
+41375, 42343, 42246, 43073, 41462, 42053, 42203, 42514, 42132, 43073, 41177, 42778,
+42075, 42590, 42265, 42392, 42576, 41573, 42797, 41999, 41947, 42711, 42115, 42389,
+42092, 42536, 41178, 42292, 40922, 41268, 42821, 42773, 41939, 41989, 41850, 42245,
+41707, 42729, 42157, 42000, 42232, 43007, 42101, 41820, 40537, 42407, 41780, 42254,
+42467, 42384, 42731, 41263, 42653, 41766, 43748, 41672, 41840, 41761, 42933, 41446,
+41310, 41960, 42308, 42248, 42265, 43217, 42687, 42173, 42137, 42203, 42394, 42087,
+41888, 42529, 42659, 41492, 41573, 42422, 43047, 41902, 43454, 41682, 42452, 41476,
+42110, 41657, 41484, 42160, 41948, 41706, 41569, 42341, 43709, 40455, 42122, 42289,
+41202, 42235, 41364, 42572, 41656, 42242, 43067, 41556, 42067, 41688, 42251, 42206,
+41914, 41522, 42300, 41795, 41954, 42608, 41209, 42221, 43925, 42977, 42240, 41915,
+42334, 41610, 42581, 43075, 42809, 41549, 42183, 42400, 42518, 40982, 42125, 42374,
+40950, 42250, 42365, 41603, 42162, 42172, 41672, 42335, 41948, 41786, 42147, 42857,
+41992, 41952, 41825, 42872, 42587, 41959, 42393, 41936, 41557, 42218, 43589, 41066,
+40760, 42597, 41123, 42421, 41529, 41611, 41223, 42683, 41660, 41017, 42002, 41588,
+41480, 42264, 42866, 43091, 41962, 42515, 41796, 42571, 41924, 42209, 41388, 41204,
+41995, 41522, 42074, 42324, 41345, 41755, 41793, 41692, 41952, 41167, 43086, 40948,
+43113, 43474, 41355, 41866, 40341, 43057, 41373, 41336, 41267, 42362, 41551, 42057,
+41443, 41498, 41798, 42776, 41345, 41595, 41410, 41771, 40964, 40808, 42386, 42087,
+41447, 43088, 42289, 41948, 41048, 41733, 41800, 41127, 41951, 41047, 42129, 42352,
+41718, 41672, 41501, 41398, 40562, 42449, 42059, 44771, 41189, 41666, 42123, 41666,
+42230, 40825, 41082, 42190, 43208, 42356, 42939, 42730, 41537, 41522, 41837, 42108,
+41203, 41705, 41784, 40807, 42030, 41371, 42884, 42417, 41543, 42277, 41630, 42627,
+42248, 40922, 42146, 42473, 41360, 42062, 42055, 41817, 41920, 42426, 41314, 42440,
+42360, 41177, 42310, 42347, 41453, 42593, 42195, 41884, 42104, 41703, 41842, 41996,
+42342, 41513, 41104, 41747, 40904, 40767, 41843, 42146, 41608, 42296, 43113, 42259,
+42254, 41925, 42512, 41666, 41465, 41375, 41651, 42023, 42974, 41518, 42252, 41782,
+41598, 42215, 42313, 41616, 40484, 41777, 41552, 42008, 42170, 42236, 41027, 41752,
+41802, 41489, 41986, 42393, 42095, 41947, 42720, 42271, 41805, 41164, 41963, 41687,
+41315, 42804, 42596, 41501, 42028, 40643, 41715, 41941, 41480, 42332, 41436, 41566,
+41132, 42132, 42632, 42514, 42252, 41851, 42171, 41656, 41495, 41786, 42275, 41139,
+41171, 41539, 41751, 41198, 41911, 41912, 42317, 41802, 42476, 42056, 41965, 41297,
+42629, 42447, 41333, 42908, 41791, 42462, 42103, 40343, 41879, 41552, 41859, 41893,
+42507, 41372, 41429, 41782, 40958, 40862, 42119, 42977, 40932, 41156, 42086, 41618,
+42338, 42847, 41972, 41645, 42044, 41132, 41351, 41762, 40143, 42626, 41821, 42563,
+40686, 42017, 41354, 42866, 41113, 42050, 41442, 40679, 41404, 41505, 41080, 41876,
+41954, 42225, 42469, 42476, 41474, 40949, 41352, 41963, 42082, 40554, 41371, 41541,
+41357, 41608, 41057, 42896, 41453, 41906, 41127, 42613, 40637, 41616, 42868, 41000,
+40959, 42638, 41287, 41666, 42773, 41147, 42597, 41642, 41686, 42423, 42554, 42334,
+42153, 40999, 41654, 41331, 42236, 41293, 40647, 42371, 41143, 42722, 41871, 41573,
+41894, 41852, 42109, 40890, 42061, 40613, 42071, 42105, 40822, 41324, 42035, 41874,
+41393, 41726, 41141, 40508, 41663, 42296, 41192, 41956, 42108, 40943, 41891, 42613,
+41531, 40977, 42331, 41814, 41126, 41662, 42633, 41681, 41362, 40673, 41942, 42104,
+41522, 41519, 39713, 40925, 41558, 42018, 41981, 41587, 41591, 41802, 42154, 42102,
+42347, 41360, 41768, 41198, 41656, 41003, 42365, 41982, 41252, 40948, 42918, 41696,
+41683, 42417, 41720, 41464, 40502, 41085, 41603, 40432, 41595, 42254, 40720, 41408,
+40787, 41012, 43452, 41858, 41116, 41916, 41222, 41863, 41036, 42179, 40683, 40535,
+42127, 42062, 42344, 42752, 40626, 40876, 39968, 41357, 41438, 41684, 41513, 41957,
+42132, 40379, 42344, 41104, 42260, 41160, 42202, 40955, 41802, 41852, 40787, 41056,
+41348, 42003, 41891, 41293, 39950, 42464, 41273, 40779, 41512, 41487, 42244, 40863,
+41255, 42284, 42362, 40162, 41942, 42495, 40931, 40547, 41713, 41868, 41602, 42608,
+41105, 40959, 41159, 42100, 40965, 41191, 41153, 41672, 41553, 42193, 40977, 41816,
+41297, 41857, 41156, 41117, 41888, 41586, 41296, 41088, 41024, 41131, 41805, 42424,
+41595, 42460, 41441, 41397, 40940, 40868, 41903, 41560, 42419, 41597, 39083, 41829,
+42520, 41730, 41414, 41839, 42390, 40211, 41522, 40333, 41810, 41298, 41753, 41492,
+40840, 42002, 42528, 40852, 41171, 41186, 42417, 41260, 42464, 40853, 42227, 40437,
+41117, 40228, 42335, 41028, 41353, 41211, 41176, 40313, 40937, 41891, 41567, 41145,
+41422, 40881, 41267, 41803, 41610, 41129, 42347, 41047, 40749, 41222, 43150, 40752,
+41542, 41802, 41657, 42287, 41951, 40853, 40850, 41387, 41704, 40856, 41141, 41504,
+42147, 40217, 41374, 41130, 40861, 41172, 41323, 41406, 41590, 41318, 42341, 41720,
+40911, 41150, 41527, 40773, 40873, 41351, 40646, 41828, 41109, 40645, 41747, 40529,
+40581, 40918, 40814, 41120, 41796, 41278, 41382, 41339, 41582, 41402, 41890, 42171,
+41587, 41091, 41617, 41931, 41068, 39656, 41625, 41357, 40967, 41561, 40978, 40905,
+41722, 41492, 43046, 42072, 42250, 41492, 40967, 40826, 40352, 41366, 40208, 41385,
+40667, 41012, 40523, 40436, 41494, 41070, 41819, 41048, 41516, 41047, 41007, 40975,
+41595, 42295, 41946, 40553, 41612, 41047, 39977, 41826, 42710, 41044, 40737, 41360,
+41450, 40916, 41953, 40989, 41267, 41575, 40997, 41637, 41803, 40302, 40177, 42017,
+41045, 40182, 41134, 41211, 40417, 40851, 40112, 41362, 41357, 41529, 41408, 41717,
+41212, 41925, 41468, 41578, 40919, 41615, 41024, 40838, 40647, 40513, 41396, 41228,
+41063, 40667, 40614, 41704, 41780, 41078, 41157, 40499, 41372, 40942, 40830, 41267,
+40724, 41131, 41261, 40914, 40652, 42745, 39987, 40607, 41009, 41252, 40699, 42654,
+40148, 40910, 40783, 41432, 41711, 40974, 41296, 40775, 42347, 41102, 41198, 41247,
+40939, 41252, 40262, 41057, 40232, 41871, 41272, 41942, 41133, 41105, 42694, 42491,
+40292, 39740, 40733, 41787, 40912, 41264, 40884, 41162, 41762, 41149, 41652, 41993,
+41369, 40618, 40473, 40972, 40412, 42005, 40560, 40756, 41550, 40300, 42101, 40031,
+41621, 40955, 41142, 40594, 40508, 41496, 40618, 41166, 40894, 40205, 41307, 41114,
+40946, 41018, 41038, 40836, 40426, 40871, 40655, 42017, 41382, 41102, 41254, 40820,
+41342, 42152, 41805, 40937, 41438, 42041, 41138, 41296, 41577, 41749, 40859, 42513,
+40916, 40465, 41304, 40498, 40431, 41032, 41310, 39800, 40984, 41360, 40809, 41315,
+41137, 40877, 41231, 41024, 41175, 40928, 40382, 40709, 41171, 42331, 40589, 41691,
+42086, 40739, 42124, 40587, 41278, 40719, 41641, 40745, 41810, 40769, 40535, 40481,
+40053, 40955, 39283, 41555, 40467, 40363, 40866, 41269, 41340, 41342, 42554, 40970,
+40498, 42401, 40839, 41441, 39686, 41207, 40835, 39919, 41552, 41012, 41039, 42116,
+40298, 41066, 40784, 42015, 40466, 40447, 41673, 40343, 40673, 42002, 41987, 41275,
+40946, 41163, 40663, 40758, 40451, 41051, 41146, 41802, 41485, 41651, 40742, 41363,
+40614, 41794, 40481, 41832, 40606, 41877, 40580, 40882, 40364, 41018, 42006, 41114,
+40523, 41765, 41147, 41422, 41423, 40491, 40889, 40834, 41058, 40196, 39457, 41115,
+40777, 40307, 40835, 40892, 41013, 40300, 40893, 40366, 40634, 41276, 40826, 40244,
+41711, 40772, 39792, 41932, 40611, 41669, 39983, 41090, 41159, 40297, 41421, 41551,
+40028, 41007, 40166, 41678, 41162, 40862, 40646, 41308, 41181, 40669, 40257, 41365,
+42063, 40582, 40082, 40383, 41410, 41549, 40809, 40445, 41087, 40526, 42125, 40414,
+40347, 40573, 39951, 41276, 42137, 40343, 41012, 41677, 41297, 40365, 42149, 41623,
+41214, 41018, 40669, 41205, 40552, 40757, 39956, 40194, 40562, 40796, 42016, 40943,
+40392, 40979, 41345, 40199, 41147, 41011, 42423, 39572, 41200, 40296, 40715, 40661,
+40813, 40715, 41037, 39878, 41422, 40596, 39809, 40967, 40555, 40817, 40503, 40552,
+41388, 40921, 40280, 40905, 39170, 40933, 41115, 41527, 41304, 40750, 39993, 40214,
+41747, 39907, 41342, 41247, 40177, 40442, 40832, 40872, 40721, 40267, 40223, 41552,
+40496, 41030, 40829, 41060, 41417, 40443, 41056, 41102, 40943, 41934, 40786, 40688,
+40386, 41242, 40971, 41047, 40461, 40189, 41891, 40403, 40526, 39774, 40630, 40892,
+40649, 40709, 40350, 40501, 40806, 40958, 41006, 41576, 40577, 41315, 40952, 39694,
+39929, 41021, 41792, 40152, 40378, 40485, 40628, 40463, 40576, 41234, 39867, 41017,
+40512, 40447, 40571, 40785, 42143, 39487, 40691, 41154, 39683, 42724, 40592, 39735,
+40064, 40652, 40615, 40976, 40745, 40797, 40973, 41051, 40022, 40508, 40964, 40354,
+40638, 40742, 39572, 40643, 40040, 41269, 40967, 40488, 40580, 41003, 39770, 41600,
+40370, 40127, 41662, 39519, 40439, 41462, 41203, 40364, 41045, 40839, 41207, 40999,
+40437, 40660, 41151, 40940, 40232, 40190, 40235, 40019, 40399, 40682, 39758, 39963,
+39997, 41132, 39582, 40966, 39879, 41309, 41117, 41537, 41077, 40904, 40907, 39603,
+41422, 41982, 39665, 40871, 39985, 40152, 40514, 40613, 40099, 39885, 40717, 39537,
+41267, 40186, 40118, 40176, 41329, 40635, 40372, 39230, 41630, 40527, 40577, 39908,
+41077, 40017, 40367, 40325, 39775, 41174, 39840, 39911, 40225, 41687, 39155, 40166,
+40421, 40061, 41082, 39892, 40404, 40393, 40019, 40715, 40587, 41744, 40682, 39718,
+41678, 41076, 40238, 40157, 40682, 40796, 40211, 40555, 42537, 39616, 41063, 40757,
+39705, 40529, 40427, 40451, 39973, 41166, 40262, 40663, 39155, 41186, 39837, 40804,
+40896, 40634, 40970, 40532, 40273, 41232, 40531, 40124, 40979, 40398, 40861, 41178,
+40124, 40676, 39938, 41329, 40518, 40843, 40638, 40439, 40562, 39703, 39879, 40024,
+39882, 41498, 40048, 40641, 40691, 41288, 40333, 40691, 39866, 39990, 40940, 39493,
+40448, 40515, 40558, 40475, 40658, 40253, 41247, 40693, 39747, 39955, 40932, 41632,
+40053, 40355, 40144, 40343, 40100, 40602, 40364, 40876, 39707, 40370, 40332, 41470,
+38919, 41099, 41423, 40571, 39947, 40945, 39872, 40202, 40503, 39979, 40415, 41228,
+39986, 40037, 40371, 39922, 40970, 40037, 40427, 40181, 39567, 40430, 40210, 40106,
+40881, 39862, 40631, 39828, 40553, 39065, 40357, 40064, 40878, 40360, 40397, 40961,
+39797, 40425, 40121, 39815, 40532, 40034, 40025, 40648, 40239, 39454, 39534, 41753,
+40669, 40323, 40489, 40962, 40157, 40954, 40178, 39636, 39370, 40191, 40393, 40235,
+41129, 39602, 39497, 40970, 40656, 40378, 40718, 41385, 39365, 40247, 40846, 39707,
+40056, 39829, 39519, 40258, 40601, 40188, 39926, 40478, 40637, 40499, 39424, 40323,
+40987, 39516, 39988, 40398, 40106, 39556, 41244, 40108, 39555, 41267, 39862, 39851,
+40170, 38491, 40356, 40064, 41251, 39591, 40889, 40661, 40931, 40147, 39818, 41292,
+40873, 39942, 40750, 39564, 40444, 40158, 41408, 40661, 39874, 39171, 40715, 40378,
+39852, 40073, 40156, 39624, 40234, 39887, 40187, 40694, 39573, 40127, 41212, 40502,
+39887, 39866, 40205, 40412, 40284, 39391, 40599, 39346, 39870, 40663, 40638, 39493,
+39375, 39644, 39941, 40778, 40709, 39095, 40319, 40778, 40417, 39359, 39810, 39757,
+41849, 40326, 39838, 40517, 40914, 40628, 39448, 40688, 40080, 40339, 39207, 39191,
+41117, 40582, 40772, 40302, 39440, 39928, 40133, 40950, 39880, 40116, 39653, 40510,
+39627, 40633, 40262, 39608, 40046, 38742, 39838, 39740, 40367, 39767, 39528, 39685,
+40475, 40250, 40581, 39538, 40701, 40847, 39562, 39723, 40202, 39959, 39656, 39482,
+40660, 40082, 39657, 40075, 39875, 40646, 40265, 40739, 39398, 40181, 40347, 39832,
+40043, 40251, 40649, 39775, 39287, 39918, 40693, 40412, 39281, 39371, 39413, 40758,
+40591, 39992, 39539, 39260, 40293, 39433, 40400, 42683, 39753, 41011, 40352, 40316,
+39662, 39704, 41297, 40086, 39665, 39755, 40871, 38881, 38646, 40534, 40716, 39673,
+40676, 39903, 40757, 39898, 39632, 38825, 40359, 40087, 39005, 38978, 40380, 40117,
+39785, 39767, 40676, 40176, 40874, 40136, 39061, 39983, 39756, 39733, 40037, 39821,
+40313, 40745, 39848, 40971, 39460, 39747, 39251, 40078, 40286, 39623, 39932, 40187,
+39900, 39439, 40724, 39134, 39732, 40840, 40820, 39917, 40296, 40583, 40271, 39737,
+39673, 39162, 39224, 38977, 39618, 39409, 39119, 40289, 39816, 39599, 39950, 39578,
+40900, 39200, 39332, 39987, 39982, 39642, 39959, 39725, 39700, 39258, 39680, 40322,
+40633, 39857, 40016, 39869, 39170, 40349, 39723, 40664, 39730, 40451, 41018, 39482,
+39695, 39932, 39978, 39575, 39490, 39222, 38710, 39179, 39857, 38934, 40189, 40280,
+39239, 39798, 40012, 38475, 39518, 40055, 38978, 41501, 39958, 40044, 40834, 39312,
+39685, 40472, 38874, 39532, 40008, 39463, 38607, 39632, 39347, 39986, 39661, 39657,
+38992, 39729, 39547, 39036, 38836, 39237, 41495, 39050, 40552, 40317, 39973, 39698,
+39582, 39962, 39950, 39917, 39148, 39416, 39896, 41084, 40148, 38552, 40176, 39577,
+40397, 39675, 39542, 40588, 40478, 39647, 40100, 39020, 38937, 40397, 38920, 39798,
+39091, 38622, 40046, 41023, 39084, 38800, 40379, 40359, 39569, 39235, 39897, 39244,
+40556, 39222, 40403, 39895, 37980, 39626, 40037, 40406, 39299, 38824, 40649, 40068,
+39160, 39809, 39870, 39673, 40055, 38595, 39032, 39604, 40263, 39613, 40223, 39105,
+40178, 39635, 39403, 39417, 39856, 40320, 39731, 39623, 39721, 39252, 39608, 39404,
+39520, 39524, 39045, 39374, 39827, 40114, 39012, 39598, 40359, 39335, 39854, 39278,
+40402, 39357, 39382, 40803, 39220, 39935, 39725, 39132, 39701, 39868, 39282, 39496,
+39009, 39383, 39850, 39654, 40346, 38060, 41215, 39150, 39562, 39861, 39562, 39197,
+39938, 39789, 39046, 39558, 39464, 39400, 40421, 40040, 39552, 39038, 39899, 39205,
+40014, 38525, 40832, 39131, 39844, 38810, 39279, 38587, 38876, 40427, 39812, 40704,
+38392, 40100, 39414, 39427, 39762, 39674, 39235, 39906, 40553, 39079, 39137, 40295,
+39240, 39232, 38414, 40032, 39916, 38663, 39851, 39836, 40518, 38638, 39630, 38936,
+40262, 39229, 39435, 40193, 38762, 39521, 39205, 40476, 40123, 39584, 39063, 40544,
+39049, 38850, 38660, 39254, 39395, 39349, 39527, 39080, 39002, 39302, 39302, 40029,
+39076, 39138, 39301, 39491, 38399, 39135, 39728, 38552, 39086, 39406, 39638, 39798,
+39202, 39753, 38866, 38880, 39680, 39704, 39148, 38561, 38787, 39220, 39714, 39967,
+39770, 39126, 39946, 38564, 39645, 39362, 39148, 38832, 39538, 39780, 39709, 39191,
+39603, 39326, 39406, 40209, 39601, 39243, 40486, 38822, 39603, 39566, 39611, 39677,
+40072, 39513, 39220, 39519, 38540, 39035, 39959, 39427, 40215, 38797, 39002, 38015,
+40322, 39194, 39056, 40241, 39279, 38882, 38761, 39087, 39896, 39371, 39398, 39322,
+39671, 38367, 39085, 38691, 40652, 39562, 38778, 38171, 38477, 39467, 38987, 39622,
+39440, 39140, 39870, 39673, 38586, 39842, 39022, 38867, 38759, 39734, 39317, 38672,
+39843, 39032, 39839, 38699, 39560, 40147, 39401, 39600, 39419, 38680, 38970, 38656,
+38891, 39989, 38562, 40091, 39175, 39009, 39380, 38984, 38245, 39602, 38138, 39483,
+39622, 39255, 38368, 38867, 39131, 39404, 39216, 40939, 38376, 39338, 38929, 39795,
+38429, 39329, 39806, 37883, 40952, 39536, 38647, 38322, 38966, 38467, 38790, 39877,
+39560, 39789, 38536, 38507, 39543, 39676, 39480, 39470, 38774, 40283, 39172, 39446,
+38565, 39565, 37854, 39979, 38994, 38395, 39627, 38909, 39562, 38312, 38733, 38884,
+38933, 39788, 38778, 39514, 38082, 38075, 38459, 39809, 39557, 38441, 39407, 38989,
+39357, 39310, 39492, 39451, 39659, 39255, 39818, 38491, 39047, 39450, 39479, 38870,
+39041, 39608, 38651, 37892, 38380, 39833, 39167, 39399, 40307, 39610, 39554, 38769,
+39089, 40060, 39693, 39118, 38180, 38559, 39985, 38909, 38301, 39533, 39223, 38157,
+38941, 39602, 39800, 39320, 38880, 39769, 37856, 39308, 38619, 38398, 40077, 37969,
+40221, 39665, 39053, 38416, 39902, 39227, 39152, 39174, 38216, 39046, 39357, 37477,
+40590, 40349, 38044, 39197, 39731, 38157, 39643, 40052, 39815, 39182, 39212, 39050,
+38492, 38366, 39393, 39407, 38779, 38817, 38638, 39896, 39425, 39149, 38813, 38247,
+39298, 39570, 39053, 38654, 38870, 37964, 39160, 39279, 38756, 39565, 38103, 38009,
+39932, 38626, 37623, 38845, 38973, 38696, 39301, 39134, 39153, 37535, 38531, 39730,
+38331, 39800, 38939, 38107, 39965, 38018, 39017, 39273, 39340, 38844, 39046, 38508,
+38996, 38102, 40226, 38519, 38290, 37995, 39962, 37997, 38326, 38841, 39137, 39254,
+39407, 38480, 39959, 37975, 38753, 38576, 38192, 40223, 39356, 38403, 38330, 39497,
+38489, 38455, 38840, 38871, 37622, 40121, 38903, 39178, 38762, 38472, 37565, 40268,
+38597, 38707, 38295, 38987, 38317, 39279, 38750, 38872, 38475, 39952, 38906, 38250,
+38630, 38851, 38181, 39512, 39134, 38977, 37974, 39104, 38063, 38759, 37864, 38298,
+39056, 38230, 39725, 38006, 37866, 38974, 37785, 38108, 38741, 38933, 38611, 38172,
+38839, 38079, 39932, 37514, 38407, 38093, 39996, 39160, 38063, 39491, 39440, 39315,
+37982, 39058, 38985, 38513, 39608, 38138, 39344, 38539, 39153, 39616, 38673, 37436,
+39092, 38356, 38679, 38329, 39483, 38524, 37737, 39182, 37990, 39089, 39140, 38078,
+39465, 39307, 38378, 38204, 38195, 39468, 38678, 37877, 38302, 38739, 38428, 38897,
+38256, 39184, 37940, 38628, 38324, 38432, 38027, 39112, 38579, 38354, 38781, 38212,
+39174, 38395, 39389, 37517, 39051, 38590, 38118, 38552, 39088, 37190, 37385, 39435,
+38588, 38020, 38762, 39125, 38529, 38360, 38842, 37970, 38619, 38930, 38836, 38769,
+38432, 39172, 38153, 37797, 39095, 38116, 39389, 38426, 38279, 38882, 38909, 38664,
+38935, 39722, 38685, 37739, 37693, 38223, 38692, 38396, 37641, 38632, 37184, 39365,
+38174, 38151, 38269, 38991, 39397, 38447, 37545, 38495, 38882, 37825, 38547, 38507,
+38557, 39177, 38326, 39143, 37997, 38133, 37945, 38639, 38331, 38441, 38263, 38196,
+39574, 39128, 37677, 38359, 37842, 39265, 37799, 39108, 38647, 38393, 38328, 38131,
+38352, 37472, 37813, 39279, 38375, 38950, 37908, 37810, 37779, 39566, 37846, 38402,
+38928, 38564, 39212, 38231, 37658, 38641, 38436, 38947, 38639, 38112, 38110, 38339,
+38345, 37413, 38578, 37649, 37998, 38372, 38531, 38303, 37948, 38586, 37904, 37454,
+37858, 38249, 38439, 39244, 38670, 37214, 38717, 39215, 37717, 38238, 37484, 38456,
+38077, 38393, 38042, 38844, 37847, 38765, 39001, 37778, 38532, 37526, 38372, 38182,
+38726, 37457, 38844, 38935, 38409, 38437, 37926, 37636, 37722, 38708, 37012, 38840,
+38955, 37750, 39351, 38168, 38209, 37947, 38809, 38582, 37827, 38459, 39443, 37732,
+37956, 37555, 38199, 39313, 37646, 38012, 38627, 37608, 38300, 39301, 38085, 38489,
+38692, 37190, 37610, 38132, 38427, 37762, 38048, 38741, 37791, 39194, 38041, 38291,
+38342, 38309, 38703, 36599, 38212, 38285, 38342, 38565, 36517, 37817, 37322, 38997,
+37669, 38844, 37118, 38603, 37370, 38353, 37991, 37922, 39239, 37826, 37034, 38849,
+37593, 38033, 37952, 38842, 37016, 37742, 37997, 38942, 38904, 37685, 38228, 38755,
+38783, 38174, 38112, 38386, 38432, 37490, 39347, 37869, 37952, 37468, 38129, 38118,
+37277, 38203, 37616, 38373, 37970, 38690, 37997, 37534, 37929, 38468, 38581, 37475,
+37640, 37614, 38618, 37229, 37742, 37787, 38569, 37520, 37656, 38351, 38386, 38078,
+38048, 38460, 37252, 38442, 37720, 38357, 37439, 37214, 38495, 38294, 37545, 37328,
+37711, 38637, 38843, 37672, 37194, 38806, 37797, 38978, 38065, 37917, 37379, 39046,
+37581, 37118, 37597, 39131, 38244, 37436, 38206, 36932, 37553, 38202, 37628, 37847,
+37964, 37859, 37711, 38519, 37746, 37960, 38117, 36968, 37932, 37127, 38836, 37878,
+37286, 38503, 37514, 38481, 36743, 37054, 39060, 39056, 37507, 37707, 38365, 37382,
+38115, 37252, 36999, 37294, 38135, 37832, 38079, 38818, 37856, 37572, 38002, 37490,
+36989, 37698, 37837, 38072, 38121, 37466, 37481, 38240, 38941, 38363, 37556, 38378,
+37215, 37727, 36716, 37640, 38731, 37880, 36854, 37701, 37844, 38081, 37910, 39128,
+37706, 38227, 37619, 37046, 36689, 37997, 37754, 37260, 37676, 37850, 37922, 37618,
+37151, 38564, 38427, 38435, 37553, 37832, 38201, 36994, 37131, 38593, 37248, 38672,
+37805, 37268, 37198, 37781, 37551, 36793, 37748, 36912, 38525, 37858, 37121, 38511,
+37820, 37921, 37413, 37799, 38653, 36243, 38462, 38503, 38012, 36471, 38513, 37634,
+37897, 37082, 37782, 37918, 36789, 38320, 36684, 38189, 38138, 37606, 37433, 37446,
+38015, 37886, 36625, 36717, 37709, 36823, 38079, 37072, 36932, 38472, 37319, 37345,
+37958, 37598, 37548, 36301, 36926, 36987, 37624, 37284, 37733, 37144, 37407, 36580,
+37374, 37907, 37670, 37052, 38056, 37415, 37022, 36407, 37742, 36564, 36712, 37013,
+38438, 37571, 37247, 37142, 37746, 36722, 38239, 38030, 37863, 37219, 37572, 36571,
+38075, 37494, 37286, 37268, 38405, 37750, 38154, 37237, 37802, 36537, 38192, 37529,
+37727, 37762, 37455, 37348, 37448, 38820, 37319, 37385, 37150, 37032, 37355, 37384,
+37506, 37627, 36705, 37927, 35900, 38192, 37775, 36164, 37437, 36839, 37190, 37741,
+37971, 37807, 36992, 37769, 36992, 37934, 36488, 36792, 36833, 38252, 37736, 36793,
+36753, 38267, 37072, 36809, 37235, 37640, 36696, 37378, 36839, 38432, 38556, 38015,
+37273, 37614, 37792, 37499, 35822, 37407, 37364, 37567, 37710, 36892, 37505, 37221,
+37637, 37103, 37816, 37331, 37113, 37321, 37002, 37204, 37544, 37148, 37742, 36624,
+37009, 37262, 37578, 37292, 36728, 37082, 36896, 37693, 37440, 37433, 37132, 36452,
+37556, 36495, 37351, 37043, 37632, 37220, 37747, 37548, 36970, 36677, 38357, 37302,
+36944, 37096, 36308, 36836, 37103, 36941, 35991, 37669, 36800, 37658, 37409, 37491,
+37307, 37456, 37914, 37150, 37547, 36386, 37425, 37775, 37156, 36882, 36802, 36900,
+36662, 37756, 37376, 37142, 37836, 36332, 37259, 36223, 37922, 36309, 36380, 37517,
+36575, 36857, 37471, 38054, 36723, 36926, 37040, 37054, 37235, 36014, 37368, 37081,
+37061, 36894, 37232, 36602, 36121, 36803, 36614, 37692, 37537, 36690, 36106, 37368,
+36959, 36970, 36846, 37471, 37769, 36851, 37058, 36152, 37839, 36839, 36953, 37427,
+35866, 37910, 37679, 38093, 35955, 36928, 36420, 36314, 36850, 37110, 37006, 37055,
+36728, 36714, 38131, 36731, 37319, 35769, 36200, 37021, 36557, 37647, 37630, 36563,
+36879, 36287, 36620, 37394, 37550, 36694, 37650, 37594, 37379, 36335, 35549, 37230,
+37007, 36332, 37864, 37160, 36941, 37572, 36191, 36338, 36631, 37269, 36751, 36465,
+37897, 36417, 37019, 36031, 36077, 37497, 37342, 36456, 36523, 36209, 37070, 36113,
+38102, 37128, 36350, 36524, 36026, 37196, 37159, 36230, 37082, 36959, 36297, 36551,
+37030, 36789, 37148, 37369, 37029, 36826, 36897, 35516, 36773, 36914, 37061, 36958,
+36452, 36870, 36116, 37648, 37206, 37039, 36918, 37300, 36849, 36086, 36952, 36297,
+36847, 37103, 37077, 36211, 36611, 35621, 37904, 36765, 36719, 35843, 36761, 36886,
+37311, 36712, 36960, 35884, 37170, 36422, 36619, 36153, 37418, 36587, 36091, 37319,
+35924, 35973, 36446, 36619, 36230, 36950, 36582, 37769, 36725, 35969, 36482, 37733,
+36119, 36641, 36830, 36580, 36245, 36576, 36293, 37049, 36455, 35537, 36218, 36091,
+35448, 37043, 37025, 36466, 35724, 36896, 35942, 37208, 35893, 37221, 35618, 36565,
+35933, 36158, 37730, 36182, 35901, 36292, 35717, 36144, 36983, 36826, 37332, 36671,
+36364, 36341, 36920, 36390, 36521, 36802, 36362, 36398, 36855, 35983, 35912, 36708,
+36194, 36130, 36497, 36327, 36355, 36221, 35745, 36122, 36419, 36392, 36770, 37321,
+36623, 35396, 37425, 35524, 36207, 36835, 36944, 35690, 36188, 37007, 36137, 35967,
+36319, 36086, 36485, 36339, 36185, 36778, 37883, 36006, 36314, 35875, 35841, 37024,
+34896, 36149, 36220, 37013, 35535, 36889, 36617, 36627, 35678, 36154, 35514, 35647,
+37083, 36202, 35712, 35747, 35617, 37472, 36150, 37427, 36707, 35182, 35997, 35671,
+36917, 36215, 36329, 35658, 35297, 37283, 35963, 36076, 36731, 36093, 36196, 34746,
+36250, 36819, 36073, 36324, 36536, 36008, 36265, 36239, 35604, 37535, 36430, 36113,
+36975, 36052, 36279, 36712, 35952, 35210, 35765, 37300, 35994, 36440, 35732, 35987,
+36538, 36513, 36160, 36086, 35874, 35335, 36224, 36543, 36004, 36074, 35256, 36226,
+36485, 34169, 36447, 35930, 36667, 35816, 36602, 36861, 35632, 36102, 36613, 35900,
+34854, 35791, 36521, 36053, 34173, 36788, 36722, 35899, 36173, 35997, 35572, 35813,
+35226, 36236, 36919, 35595, 35678, 35077, 35294, 35882, 36327, 35405, 36067, 35934,
+36262, 35780, 35631, 35269, 36635, 36207, 35012, 36307, 35708, 37527, 36293, 36151,
+34871, 36302, 36489, 35203, 37085, 36756, 35987, 35479, 35591, 35487, 35588, 35300,
+36842, 35618, 35569, 35390, 36284, 36380, 36042, 35507, 35998, 37172, 36296, 35822,
+35342, 35784, 34994, 34784, 35590, 35013, 35957, 36721, 35304, 35587, 36665, 36068,
+36548, 37118, 35084, 35888, 35874, 35599, 35294, 34662, 35657, 35813, 35965, 34779,
+35627, 35882, 35065, 35277, 35993, 35657, 35815, 35870, 36866, 35465, 34887, 35918,
+35908, 35475, 35690, 35906, 35642, 35413, 35934, 35243, 35527, 35483, 34361, 36072,
+36827, 36682, 35229, 36004, 35073, 35599, 34632, 36025, 35822, 35574, 35129, 35002,
+35537, 36179, 34775, 36107, 35700, 35039, 35872, 35090, 36546, 35060, 36059, 34922,
+35063, 37420, 35316, 34948, 35523, 34775, 35543, 35318, 35665, 35630, 35817, 35321,
+35273, 35779, 35418, 35143, 36468, 34535, 35264, 34795, 35237, 35642, 35768, 35691,
+35176, 35829, 35491, 35574, 34790, 35804, 35762, 35882, 35414, 35519, 35495, 35444,
+34522, 33821, 34979, 34980, 35021, 36674, 35213, 35675, 35644, 34992, 35314, 35292,
+36443, 35137, 36236, 35189, 35777, 35966, 35046, 35710, 35492, 34841, 35066, 34787,
+34928, 34625, 35462, 35309, 34950, 35342, 35518, 36113, 35105, 35090, 35262, 34897,
+34364, 35360, 34479, 35074, 35205, 34987, 34169, 35508, 35579, 35044, 34626, 35066,
+36257, 34813, 34284, 35171, 34982, 34310, 35227, 35703, 34651, 35532, 36214, 34728,
+35734, 35718, 35977, 33959, 35556, 35695, 35462, 35283, 35161, 34668, 35362, 34833,
+35015, 35404, 34325, 34115, 35744, 35139, 34648, 34334, 35549, 35421, 35773, 34280,
+35019, 34996, 34581, 34513, 35336, 35463, 36451, 34905, 34844, 35123, 34903, 34766,
+34916, 35219, 34557, 34255, 35544, 35378, 35782, 35037, 34381, 35876, 35234, 34641,
+34315, 35325, 35719, 34128, 34517, 33914, 34090, 36011, 33905, 35111, 34901, 34698,
+34372, 34743, 35687, 34165, 34613, 35115, 34918, 34896, 35453, 35131, 34698, 35137,
+34914, 35266, 34590, 34724, 34700, 35062, 35819, 33963, 34252, 35459, 35169, 34903,
+34190, 35367, 34642, 35682, 34552, 34607, 34542, 34813, 35117, 34932, 34618, 34572,
+33799, 34190, 34419, 35078, 34504, 34865, 35051, 35919, 34321, 34833, 34102, 34845,
+35333, 34322, 34564, 34661, 35693, 34385, 34349, 34250, 34422, 34714, 35042, 35207,
+34632, 34910, 34796, 33782, 33988, 33978, 34667, 35141, 34238, 34558, 35532, 34471,
+35201, 34583, 34365, 33982, 34319, 35132, 34050, 34349, 34685, 33827, 35038, 34482,
+34774, 34466, 34493, 34227, 35077, 33777, 34607, 34177, 35057, 34310, 33764, 35240,
+34137, 34603, 33842, 33987, 35275, 34982, 34565, 34836, 33335, 34462, 34944, 34082,
+34405, 34607, 34595, 33542, 36032, 33425, 33147, 34847, 34723, 34016, 34244, 34449,
+34649, 34303, 33561, 34030, 35300, 34337, 35009, 35060, 34295, 34863, 33931, 34241,
+34265, 35009, 35024, 33707, 34631, 33869, 34850, 34716, 33808, 33686, 34460, 34160,
+33993, 34198, 33764, 33888, 33628, 34520, 34694, 34095, 33260, 34030, 34209, 33506,
+34715, 34532, 35017, 34739, 34352, 34527, 34546, 34286, 34349, 34472, 33503, 34161,
+33781, 34764, 34300, 33261, 33745, 34247, 34706, 34188, 34606, 33450, 33905, 35072,
+33631, 33147, 34741, 34173, 33328, 33719, 34298, 34413, 33755, 34409, 33922, 34058,
+33705, 33998, 33208, 33545, 33204, 34156, 33542, 34467, 32860, 33642, 34288, 33512,
+35028, 34207, 34781, 33603, 34547, 34195, 33479, 34646, 34004, 33831, 34607, 34126,
+34319, 34191, 33590, 34477, 32942, 33312, 33520, 33840, 34171, 33137, 33935, 34187,
+34707, 33032, 33026, 33917, 33896, 34024, 33062, 33827, 33227, 33890, 33683, 33962,
+33518, 34116, 33631, 33192, 32756, 33929, 33632, 34393, 34052, 33684, 33293, 33946,
+33923, 33314, 33182, 33512, 33699, 34190, 33397, 33935, 33179, 33806, 33113, 34235,
+33449, 33144, 33097, 33113, 34368, 33728, 33821, 32416, 33659, 34281, 33425, 31964,
+33982, 33138, 33880, 33144, 33281, 33352, 34176, 32926, 33833, 32936, 33758, 32844,
+33881, 33553, 32967, 32797, 33762, 33020, 33668, 34112, 33685, 33573, 33739, 34019,
+32805, 33575, 33598, 33930, 32500, 33350, 33036, 32530, 33657, 32929, 33668, 33663,
+33092, 32897, 33862, 33593, 33104, 34445, 33785, 33116, 32645, 33084, 33034, 33420,
+32995, 32576, 33348, 33346, 33363, 33092, 32441, 33751, 34191, 33380, 33751, 32805,
+33199, 33497, 33048, 32969, 33479, 33290, 32804, 33197, 33212, 32848, 32909, 33134,
+32211, 33728, 32918, 33275, 33826, 32397, 32890, 33176, 33858, 32432, 32567, 32977,
+33720, 32126, 33623, 32039, 33005, 33388, 33666, 33808, 32882, 32775, 33362, 32375,
+33866, 32788, 34074, 32732, 32954, 32915, 33185, 32819, 32849, 33032, 33515, 33092,
+32599, 32513, 33204, 33070, 32625, 32903, 33263, 33017, 32759, 32528, 32381, 32708,
+32741, 32950, 32381, 32718, 32324, 32854, 32787, 33362, 32858, 33754, 32732, 32423,
+32556, 32864, 32441, 32836, 32225, 31919, 32892, 32119, 32652, 33086, 32101, 32345,
+31671, 32665, 32474, 32991, 32252, 32653, 33777, 32456, 33139, 33044, 32667, 32425,
+31970, 32673, 31970, 33050, 32875, 31622, 32661, 32629, 33101, 33084, 32896, 33033,
+31442, 32269, 33078, 32941, 32472, 31625, 31777, 32717, 32517, 32797, 33375, 32402,
+32846, 32042, 31879, 32132, 32391, 31871, 32267, 33004, 32363, 33240, 31606, 33095,
+32097, 32237, 32797, 32175, 32318, 32611, 32838, 31781, 32837, 31763, 32213, 31772,
+31900, 32181, 32423, 32507, 33143, 32615, 32038, 31638, 31957, 32633, 32117, 31112,
+31767, 32830, 32102, 31763, 31662, 32846, 31988, 32810, 31055, 32602, 31961, 32141,
+32154, 31810, 31643, 31433, 32861, 31781, 31811, 31868, 31989, 32390, 32177, 30862,
+32477, 31581, 31600, 31901, 31586, 31917, 32161, 31470, 32180, 32869, 31947, 31492,
+31904, 32102, 32028, 31889, 30869, 32312, 32342, 32320, 32304, 31450, 30995, 32096,
+31862, 31620, 31927, 32910, 32533, 31647, 31142, 32351, 31493, 31733, 32179, 30960,
+32257, 31727, 31304, 32727, 31202, 31418, 31937, 31003, 31296, 31262, 31933, 31937,
+31503, 31657, 32250, 31657, 31523, 31301, 32034, 32000, 32327, 31774, 32024, 30290,
+32189, 30725, 32154, 31799, 30580, 31430, 30861, 32063, 31331, 32152, 31770, 31255,
+31112, 31352, 32636, 31413, 30844, 31250, 31439, 31265, 30951, 31516, 31293, 31571,
+30187, 30671, 31197, 31960, 30771, 31400, 31034, 30611, 31337, 31753, 30780, 31355,
+31075, 31277, 31412, 31104, 31855, 31217, 30869, 31127, 31845, 30874, 31545, 30092,
+30143, 31307, 31565, 30680, 31204, 31107, 31144, 31656, 30436, 30480, 30814, 30170,
+31290, 31427, 30619, 31071, 30166, 31041, 31447, 31155, 31430, 30424, 30336, 31652,
+30260, 30647, 31859, 30676, 31712, 31383, 30412, 30362, 31665, 30899, 30442, 29661,
+30907, 31401, 30262, 31154, 29760, 31048, 31497, 30914, 29822, 31249, 30597, 30530,
+30686, 30266, 29941, 30860, 30194, 30908, 30333, 30041, 31049, 30815, 30419, 30365,
+31597, 30102, 30706, 30482, 30897, 30073, 31461, 29639, 31037, 30113, 30205, 30519,
+29806, 31161, 30049, 29844, 29945, 30761, 31315, 30857, 30468, 30142, 30041, 30323,
+30941, 30368, 29798, 29436, 30167, 30721, 30467, 30113, 30299, 30536, 30468, 29596,
+29888, 31016, 29835, 29644, 30785, 29505, 30032, 30536, 30473, 30074, 30082, 30324,
+30548, 29846, 29117, 30536, 30173, 30481, 30384, 29644, 29288, 30167, 30194, 30402,
+29515, 30228, 29797, 29733, 30161, 28718, 29416, 29315, 29993, 29606, 29294, 30936,
+29672, 29677, 29462, 30078, 29737, 30221, 29417, 29469, 30629, 29722, 29427, 29465,
+30094, 29714, 29835, 29489, 29153, 30097, 30344, 29634, 29945, 29245, 29079, 29930,
+28901, 28868, 29452, 29594, 29597, 29277, 29524, 29663, 30152, 29591, 28610, 29777,
+29298, 29671, 28764, 29630, 29398, 29214, 28351, 29267, 29528, 29327, 28527, 29099,
+29402, 29177, 29954, 29150, 28669, 28961, 29726, 29214, 28733, 28360, 29184, 29605,
+28499, 29460, 29368, 29228, 28905, 29222, 29144, 28402, 28682, 28562, 28941, 28681,
+29582, 28424, 28692, 28247, 28001, 28796, 29323, 28182, 28997, 29411, 28151, 29600,
+29282, 28744, 28973, 28551, 27955, 28581, 28436, 28534, 28631, 28287, 28685, 29080,
+28775, 28289, 28157, 28257, 28675, 28826, 29184, 29036, 28351, 27810, 28100, 28547,
+27916, 28794, 28585, 28040, 28167, 28592, 28729, 28859, 27608, 28089, 28057, 28080,
+28346, 28333, 28461, 28637, 28226, 27587, 27796, 28637, 26915, 28044, 28714, 27587,
+27731, 28022, 27362, 28233, 28126, 27714, 28085, 28438, 27278, 28154, 28613, 27609,
+27959, 27643, 28568, 27707, 27713, 27789, 27512, 27523, 27834, 27869, 27905, 27592,
+27146, 27621, 27506, 27400, 28250, 27408, 27533, 27112, 27359, 27647, 27492, 27422,
+27068, 26647, 27114, 27475, 27023, 28067, 27078, 27409, 27467, 28094, 27096, 27649,
+27122, 27465, 27128, 27010, 27128, 26748, 27025, 27354, 27371, 27049, 27087, 26314,
+26225, 27014, 26487, 27059, 26197, 26855, 27005, 26931, 26566, 27087, 27251, 26188,
+26687, 26871, 27532, 26622, 26657, 26567, 25934, 27161, 26378, 26935, 26772, 26908,
+26297, 27098, 25307, 27093, 26446, 26121, 26087, 26954, 26429, 25633, 25979, 25679,
+26607, 25373, 25909, 26360, 25593, 25775, 25855, 26529, 26158, 25563, 26581, 25079,
+26210, 26177, 26156, 25962, 25477, 25344, 26401, 25559, 26027, 25421, 25668, 25954,
+25058, 26531, 25299, 26236, 26273, 26522, 24891, 25519, 25640, 24846, 25670, 24952,
+25569, 25220, 25100, 25462, 24932, 25104, 25130, 25298, 25312, 25272, 25835, 24869,
+24806, 24869, 24811, 24975, 23842, 24789, 24422, 25342, 24045, 25339, 24848, 24927,
+24775, 24668, 24086, 25142, 23774, 24719, 24392, 24350, 25191, 24020, 23827, 24785,
+24005, 23768, 24711, 24127, 24021, 24040, 24086, 23787, 25382, 23416, 24786, 23239,
+24065, 23535, 23600, 23701, 23813, 23936, 23604, 23555, 23912, 23488, 23439, 23186,
+23315, 23642, 24587, 22685, 23101, 23082, 23297, 22838, 23804, 23054, 23236, 22344,
+23524, 22937, 23195, 22380, 22678, 22995, 22714, 22830, 22658, 22877, 22189, 22344,
+22843, 21942, 23077, 22188, 22558, 22271, 21512, 21657, 22931, 21259, 21686, 22032,
+21695, 22045, 22224, 21872, 21458, 21344, 21775, 21324, 21841, 21786, 21064, 21374,
+21440, 20520, 21278, 21635, 20662, 20495, 21446, 20910, 20762, 21445, 20654, 20078,
+21038, 19760, 20519, 20303, 20301, 19981, 19709, 20397, 20237, 19745, 19639, 19542,
+19474, 19320, 19852, 19400, 19829, 19451, 18881, 19359, 18649, 19148, 19173, 18655,
+18384, 18410, 18622, 18407, 18539, 17997, 17852, 18340, 17922, 18203, 17096, 16960,
+17582, 17090, 17711, 16760, 16962, 16567, 16745, 17036, 16683, 15937, 16151, 15812,
+15609, 15683, 15445, 15051, 15133, 14924, 15104, 14333, 14007, 14707, 14073, 13291,
+13292, 13157, 13062, 12469, 12314, 12339, 11765, 11369, 10553, 10777, 10229, 9585,
+9259, 8174, 8330, 7005, 6184, 5435, 3974, 2297, 0
+};
+
@@ -1,6 +1,5 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include <string.h>
 #include "primelist_32.h"
 #include "primes_32.h"
 
@@ -38,11 +37,176 @@ static int init_prime_32()
 }
 
 
-int getprime_32(int need, int *prime_array, int offset)
+/*
+ *  One-time initialization of small primes, safe to call concurrently.
+ *  The first caller fills the table, others wait until it is published.
+ *  Once initialized, callers only read the state (no lock or atomic update).
+ */
+static volatile int primes_state = 0;  /*!< 0 = empty, 1 = initializing, 2 = ready */
+static int num_prime = 0;
+
+
+static int init_prime_32_once()
+{
+    if (primes_state != 2) {
+        if (__sync_bool_compare_and_swap(&primes_state, 0, 1)) {
+            num_prime = init_prime_32();
+            __sync_synchronize();
+            primes_state = 2;
+        }
+        while (primes_state != 2)
+            ;
+        __sync_synchronize();
+    }
+
+    return num_prime;
+}
+
+
+/*!
+ *  \brief Entries [index, index + n) of the compressed prime table.
+ *
+ *  Decoding starts at the closest full entry, at most PRIMEMARK - 1
+ *  differences are added before the first entry requested.
+ */
+static void decode_prime_list_32(int index, int n, int *prime_array)
+{
+    int i = index - index % PRIMEMARK;
+    int prime = prime_marks_32[i / PRIMEMARK];
+
+    // Skip to first entry requested
+    for (++i; i <= index && i < PRIMELISTSIZE1; ++i)
+        prime -= 2 * prime_gaps_32[i];
+    for (; i <= index; ++i)
+        prime -= 2 * (prime_diffs_32[i - PRIMELISTSIZE1] + PRIMEDIFF_MIN);
+    prime_array[0] = prime;
+
+    for (int j = 1; j < n; ++j, ++i) {
+        if (i < PRIMELISTSIZE1)
+            prime -= 2 * prime_gaps_32[i];
+        else
+            prime -= 2 * (prime_diffs_32[i - PRIMELISTSIZE1] + PRIMEDIFF_MIN);
+        prime_array[j] = prime;
+    }
+}
+
+
+/*
+ *  Segmented sieve of Eratosthenes over odd candidates below MAXPRIME.
+ *
+ *  Segment k holds SEG_ODDS consecutive odd numbers in descending order,
+ *  bit j is the candidate SIEVE_TOP - 2 * (k * SEG_ODDS + j), so walking
+ *  a segment visits candidates in the same order as the prime search.
+ *  Segments are sieved with the small primes (all factors below sqrt(MAXPRIME))
+ *  on first use and kept for later calls (about 2 KB each).
+ *
+ *  Segments are immutable once published. Concurrent callers may sieve the
+ *  same segment, a single copy is published with a compare-and-swap and
+ *  the others are released. Readers do not lock.
+ */
+static const int SIEVE_TOP = MAXPRIME | 1;
+static const int SIEVE_MIN = MINPRIME - 1;  /*!< smallest candidate searched */
+static const int SEG_ODDS = 16384;
+static const int NSEGS = (SIEVE_TOP - SIEVE_MIN) / (2 * SEG_ODDS) + 1;
+
+static unsigned char * volatile seg_table[NSEGS];
+
+
+/*!
+ *  \brief Composite bits of segment k, sieved on demand.
+ */
+static const unsigned char * get_segment_32(const int k, const int nprime)
+{
+    unsigned char *seg = seg_table[k];
+    if (seg)
+        return seg;
+
+    seg = (unsigned char *)calloc(SEG_ODDS / 8, sizeof(unsigned char));
+    if (!seg) {
+        fprintf(stderr, "ERROR: failed to allocate prime sieve segment\n");
+        return NULL;
+    }
+
+    // Mark odd multiples of each small prime, consecutive odd multiples are p elements apart
+    const int xhi = SIEVE_TOP - 2 * k * SEG_ODDS;
+    for (int i = 0; i < nprime; ++i) {
+        const int p = PRIMES[i];
+        int x = xhi - xhi % p;
+        if ((x & 0x1) == 0)
+            x -= p;
+        for (int j = (xhi - x) / 2; j < SEG_ODDS; j += p)
+            seg[j >> 3] |= (unsigned char)(1U << (j & 0x7));
+    }
+
+    if (!__sync_bool_compare_and_swap(&seg_table[k], (unsigned char *)NULL, seg)) {
+        free(seg);
+        seg = seg_table[k];
+    }
+
+    return seg;
+}
+
+
+/*!
+ *  \brief Search primes below largest, skip first primes found.
+ */
+static int search_sieve_32(int largest, int skip, int need, int *prime_array, int nprime)
+{
+    int obtained = 0;
+    int x = largest - 2;
+    int d = (SIEVE_TOP - x) / 2;
+
+    while (need > obtained && x >= SIEVE_MIN) {
+        const unsigned char * const seg = get_segment_32(d / SEG_ODDS, nprime);
+        if (!seg)
+            break;
+        for (int j = d % SEG_ODDS; j < SEG_ODDS && need > obtained && x >= SIEVE_MIN; ++j, x -= 2, ++d) {
+            if (seg[j >> 3] & (1U << (j & 0x7)))
+                continue;
+            if (skip > 0)
+                skip--;
+            else
+                prime_array[obtained++] = x;
+        }
+    }
+
+    return obtained;
+}
+
+
+/*!
+ *  \brief Search primes below largest by trial division, skip first primes found.
+ */
+static int search_trial_32(int largest, int skip, int need, int *prime_array, int nprime)
+{
+    int i, isprime, obtained = 0;
+
+    while (need > obtained && largest > MINPRIME) {
+        isprime = YES;
+        largest -= 2;
+        for (i = 0; i < nprime; ++i)
+            if (largest%PRIMES[i] == 0) {
+                isprime = NO;
+                break;
+            }
+      
+        if (isprime == YES && skip > 0)
+            skip--;
+        else if (isprime == YES)
+            prime_array[obtained++] = largest;
+    }
+
+    return obtained;
+}
+
+
+typedef int (*SEARCH_PRIMES_32)(int, int, int, int *, int);
+
+
+static int getprime_32_search(int need, int *prime_array, int offset, SEARCH_PRIMES_32 search)
 {
-    static int initiallized = NO, num_prime;
     int largest;
-    int i, isprime, index, obtained = 0;
+    int index, obtained = 0;
     
     if (need <= 0) {
         fprintf(stderr, "WARNING: Number of primes needed = %d < 1; None returned\n", need);
@@ -55,15 +219,11 @@ int getprime_32(int need, int *prime_array, int offset)
     }
     
     if (offset+need-1 < PRIMELISTSIZE1) {
-        memcpy(prime_array, prime_list_32 + offset, need * sizeof(int));
+        decode_prime_list_32(offset, need, prime_array);
         return need;
     }
 
-    if (!initiallized) {
-        num_prime = init_prime_32();
-        largest = MAXPRIME;
-        initiallized = YES;
-    }
+    const int nprime = init_prime_32_once();
     
     if (offset > MAXPRIMEOFFSET) {
         fprintf(stderr, "WARNING: generator has branched maximum number of times, independence of generators no longer guaranteed");
@@ -72,29 +232,18 @@ int getprime_32(int need, int *prime_array, int offset)
     
     /* search table for previous prime */
     if (offset < PRIMELISTSIZE1) {
-        largest = prime_list_32[offset] + 2;
+        decode_prime_list_32(offset, 1, &largest);
+        largest += 2;
         offset = 0;
     }
     else {
         index = (int)((offset-PRIMELISTSIZE1+1)/STEP) + PRIMELISTSIZE1 -  1;
-        largest = prime_list_32[index] + 2;
+        decode_prime_list_32(index, 1, &largest);
+        largest += 2;
         offset -= (index-PRIMELISTSIZE1+1)*STEP + PRIMELISTSIZE1 - 1;
     }
     
-    while (need > obtained && largest > MINPRIME) {
-        isprime = YES;
-        largest -= 2;
-        for (i = 0; i < num_prime; ++i)
-            if (largest%PRIMES[i] == 0) {
-                isprime = NO;
-                break;
-            }
-      
-        if (isprime == YES && offset > 0)
-            offset--;
-        else if (isprime == YES)
-            prime_array[obtained++] = largest;
-    }
+    obtained = search(largest, offset, need, prime_array, nprime);
     
     if (need > obtained)
         fprintf(stderr, "ERROR: Insufficient number of primes: needed %d, obtained %d\n", need, obtained);
@@ -102,3 +251,58 @@ int getprime_32(int need, int *prime_array, int offset)
     return obtained;
 }
 
+
+/*!
+ *  \brief Primes of consecutive offsets (generator numbers) starting at offset.
+ *
+ *  Offsets past the static table are obtained from a cached segmented sieve.
+ *  Safe to call concurrently from multiple threads.
+ */
+int getprime_32(int need, int *prime_array, int offset)
+{ return getprime_32_search(need, prime_array, offset, search_sieve_32); }
+
+
+/*!
+ *  \brief Same as getprime_32() but primes past the static table are obtained
+ *  by trial division. Reference implementation for validation and benchmarks.
+ */
+int getprime_32_trial(int need, int *prime_array, int offset)
+{ return getprime_32_search(need, prime_array, offset, search_trial_32); }
+
+
+/*!
+ *  \brief Prime of each generator number in [offset, offset + need).
+ *
+ *  Same as need calls of getprime_32(1, prime_array + i, offset + i), but
+ *  consecutive primes are obtained in a single search. Generator numbers
+ *  past MAXPRIMEOFFSET wrap around, these are obtained one at a time.
+ */
+int getprimes_32(int need, int *prime_array, int offset)
+{
+    int obtained = 0;
+
+    if (need <= 0) {
+        fprintf(stderr, "WARNING: Number of primes needed = %d < 1; None returned\n", need);
+        return 0;
+    }
+
+    if (offset < 0) {
+        fprintf(stderr, "WARNING: Offset of prime = %d < 1; None returned\n", offset);
+        return 0;
+    }
+
+    if (offset <= MAXPRIMEOFFSET) {
+        const int nrange = (need < MAXPRIMEOFFSET - offset + 1) ? need : (MAXPRIMEOFFSET - offset + 1);
+        obtained = getprime_32(nrange, prime_array, offset);
+        if (obtained < nrange)
+            return obtained;
+    }
+
+    while (obtained < need) {
+        if (getprime_32(1, prime_array + obtained, offset + obtained) < 1)
+            break;
+        obtained++;
+    }
+
+    return obtained;
+}
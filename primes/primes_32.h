@@ -8,6 +8,8 @@ const int MAXPRIMEOFFSET = 779156;
 
 
 int getprime_32(int, int *, int);
+int getprime_32_trial(int, int *, int);
+int getprimes_32(int, int *, int);
 
 
 #endif // __PRIMES_32_H
@@ -0,0 +1,242 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "primelist_64.h"
+#include "primes_64.h"
+
+
+enum { NO = 0, YES };
+static const int NPRIMES = 10000;
+
+#define PRIMES primes64
+static int PRIMES[NPRIMES];
+
+
+static int init_prime_64()
+{
+    int i, j, obtained = 0, isprime;
+
+    for (i = 3; i < MINPRIME_64; i += 2) {
+        isprime = YES;
+
+        for (j = 0; j < obtained; ++j) {
+            if (i % PRIMES[j] == 0) {
+                isprime = NO;
+                break;
+            }
+            else if (PRIMES[j]*PRIMES[j] > i)
+                break;
+        }
+
+        if (isprime == YES) {
+            PRIMES[obtained] = i;
+            obtained++;
+        }
+    }
+
+    return obtained;
+}
+
+
+/*
+ *  One-time initialization of small primes, safe to call concurrently.
+ *  See init_prime_32_once().
+ */
+static volatile int primes_state = 0;  /*!< 0 = empty, 1 = initializing, 2 = ready */
+static int num_prime = 0;
+
+
+static int init_prime_64_once()
+{
+    if (primes_state != 2) {
+        if (__sync_bool_compare_and_swap(&primes_state, 0, 1)) {
+            num_prime = init_prime_64();
+            __sync_synchronize();
+            primes_state = 2;
+        }
+        while (primes_state != 2)
+            ;
+        __sync_synchronize();
+    }
+
+    return num_prime;
+}
+
+
+/*!
+ *  \brief Entries [index, index + n) of the compressed prime table.
+ *
+ *  Decoding starts at the closest full entry, at most PRIMEMARK_64 - 1
+ *  differences are added before the first entry requested.
+ */
+static void decode_prime_list_64(int index, int n, unsigned int *prime_array)
+{
+    int i = index - index % PRIMEMARK_64;
+    unsigned int prime = prime_marks_64[i / PRIMEMARK_64];
+
+    // Skip to first entry requested
+    for (++i; i <= index && i < PRIMELISTSIZE1_64; ++i)
+        prime -= 2U * prime_gaps_64[i];
+    for (; i <= index; ++i)
+        prime -= 2U * (prime_diffs_64[i - PRIMELISTSIZE1_64] + PRIMEDIFF_MIN_64);
+    prime_array[0] = prime;
+
+    for (int j = 1; j < n; ++j, ++i) {
+        if (i < PRIMELISTSIZE1_64)
+            prime -= 2U * prime_gaps_64[i];
+        else
+            prime -= 2U * (prime_diffs_64[i - PRIMELISTSIZE1_64] + PRIMEDIFF_MIN_64);
+        prime_array[j] = prime;
+    }
+}
+
+
+/*
+ *  Segmented sieve of Eratosthenes over odd candidates below largest.
+ *
+ *  Candidates range up to MAXPRIME_64, so segments are sieved per call
+ *  in a local buffer (SEG_ODDS candidates in descending order, bit j is
+ *  the candidate xhi - 2 * j) and not kept. Searches span at most STEP_64
+ *  primes, a few segments.
+ */
+static const unsigned int SIEVE_MIN = MINPRIME_64 - 1;  /*!< smallest candidate searched */
+static const int SEG_ODDS = 16384;
+
+
+/*!
+ *  \brief Search primes below largest, skip first primes found.
+ */
+static int search_sieve_64(unsigned int largest, int skip, int need, unsigned int *prime_array, int nprime)
+{
+    unsigned char seg[SEG_ODDS / 8];
+    int obtained = 0;
+    unsigned int xhi = largest - 2;
+
+    while (need > obtained && xhi >= SIEVE_MIN) {
+        // Mark odd multiples of each small prime, consecutive odd multiples are p elements apart
+        memset(seg, 0, sizeof(seg));
+        for (int i = 0; i < nprime; ++i) {
+            const unsigned int p = PRIMES[i];
+            unsigned int x = xhi - xhi % p;
+            if ((x & 0x1) == 0) {
+                if (x < p)
+                    continue;
+                x -= p;
+            }
+            for (unsigned int j = (xhi - x) / 2; j < (unsigned int)SEG_ODDS; j += p)
+                seg[j >> 3] |= (unsigned char)(1U << (j & 0x7));
+        }
+
+        unsigned int x = xhi;
+        for (int j = 0; j < SEG_ODDS && need > obtained && x >= SIEVE_MIN; ++j, x -= 2) {
+            if (seg[j >> 3] & (1U << (j & 0x7)))
+                continue;
+            if (skip > 0)
+                skip--;
+            else
+                prime_array[obtained++] = x;
+        }
+
+        if (xhi < SIEVE_MIN + 2U * SEG_ODDS)
+            break;
+        xhi -= 2U * SEG_ODDS;
+    }
+
+    return obtained;
+}
+
+
+/*!
+ *  \brief Search primes below largest by trial division, skip first primes found.
+ */
+static int search_trial_64(unsigned int largest, int skip, int need, unsigned int *prime_array, int nprime)
+{
+    int i, isprime, obtained = 0;
+
+    while (need > obtained && largest > (unsigned int)MINPRIME_64) {
+        isprime = YES;
+        largest -= 2;
+        for (i = 0; i < nprime; ++i)
+            if (largest%PRIMES[i] == 0) {
+                isprime = NO;
+                break;
+            }
+
+        if (isprime == YES && skip > 0)
+            skip--;
+        else if (isprime == YES)
+            prime_array[obtained++] = largest;
+    }
+
+    return obtained;
+}
+
+
+typedef int (*SEARCH_PRIMES_64)(unsigned int, int, int, unsigned int *, int);
+
+
+static int getprime_64_search(int need, unsigned int *prime_array, int offset, SEARCH_PRIMES_64 search)
+{
+    unsigned int largest;
+    int index, obtained = 0;
+
+    if (need <= 0) {
+        fprintf(stderr, "WARNING: Number of primes needed = %d < 1; None returned\n", need);
+        return 0;
+    }
+
+    if (offset < 0) {
+        fprintf(stderr, "WARNING: Offset of prime = %d < 1; None returned\n", offset);
+        return 0;
+    }
+
+    if (offset+need-1 < PRIMELISTSIZE1_64) {
+        decode_prime_list_64(offset, need, prime_array);
+        return need;
+    }
+
+    const int nprime = init_prime_64_once();
+
+    if (offset > MAXPRIMEOFFSET_64) {
+        fprintf(stderr, "WARNING: generator has branched maximum number of times, independence of generators no longer guaranteed");
+        offset = offset % MAXPRIMEOFFSET_64;
+    }
+
+    /* search table for previous prime */
+    if (offset < PRIMELISTSIZE1_64) {
+        decode_prime_list_64(offset, 1, &largest);
+        largest += 2;
+        offset = 0;
+    }
+    else {
+        index = (int)((offset-PRIMELISTSIZE1_64+1)/STEP_64) + PRIMELISTSIZE1_64 - 1;
+        decode_prime_list_64(index, 1, &largest);
+        largest += 2;
+        offset -= (index-PRIMELISTSIZE1_64+1)*STEP_64 + PRIMELISTSIZE1_64 - 1;
+    }
+
+    obtained = search(largest, offset, need, prime_array, nprime);
+
+    if (need > obtained)
+        fprintf(stderr, "ERROR: Insufficient number of primes: needed %d, obtained %d\n", need, obtained);
+
+    return obtained;
+}
+
+
+/*!
+ *  \brief Primes of consecutive offsets (generator numbers) starting at offset.
+ *
+ *  Offsets past the static table are obtained with a segmented sieve.
+ *  Safe to call concurrently from multiple threads.
+ */
+int getprime_64(int need, unsigned int *prime_array, int offset)
+{ return getprime_64_search(need, prime_array, offset, search_sieve_64); }
+
+
+/*!
+ *  \brief Same as getprime_64() but primes past the static table are obtained
+ *  by trial division. Reference implementation for validation and benchmarks.
+ */
+int getprime_64_trial(int need, unsigned int *prime_array, int offset)
+{ return getprime_64_search(need, prime_array, offset, search_trial_64); }
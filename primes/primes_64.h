@@ -0,0 +1,15 @@
+#ifndef __PRIMES_64_H
+#define __PRIMES_64_H
+
+
+const unsigned int MAXPRIME_64 = 3037000501U;  /*!< largest odd # < sqrt(2)*2^31 + 2 */
+const int MINPRIME_64 = 55108;  /*!< sqrt(MAXPRIME_64) */
+const int MAXPRIMEOFFSET_64 = 146138719;
+
+
+int getprime_64(int, unsigned int *, int);
+int getprime_64_trial(int, unsigned int *, int);
+
+
+#endif // __PRIMES_64_H
+
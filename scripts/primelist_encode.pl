@@ -0,0 +1,229 @@
+#!/usr/bin/perl
+
+use strict;
+use warnings;
+use Getopt::Long;
+use File::Basename;
+
+
+# Command line arguments
+my $invalid = 0;
+my $help = '';
+my $check = '';
+my $bits = 32;
+my $infile = '';
+my $outfile = '';
+GetOptions("help"     => \$help,
+           "check"    => \$check,
+           "bits=i"   => \$bits,
+           "input=s"  => \$infile,
+           "output=s" => \$outfile
+          ) or $invalid = 1;
+$invalid = 1 if scalar @ARGV;  # catch invalid options without '-' or '--'
+$invalid = 1 if $bits != 32 and $bits != 64;
+if ($invalid) {
+    warn "Unknown option: $_\n" for @ARGV;
+    usage();
+    exit 0;
+}
+elsif ($help) {
+    usage();
+    exit 0;
+}
+
+
+# Print script usage
+sub usage {
+    print "\n",
+    basename($0), " [--help] [--check] [--bits=32|64] [--input=primelist.h] [--output=primelist.h]\n\n",
+    "\tEncode a legacy SPRNG prime table (dev_src/primelist_<bits>.h) into the\n",
+    "\tcompressed table of the library (primes/primelist_<bits>.h).\n",
+    "\tThe encoded table is decoded again and compared with the legacy one,\n",
+    "\tthe script fails if any entry differs.\n",
+    "\tWith --check the output file is not written, it is compared with the\n",
+    "\tgenerated table instead (fails if it differs).\n",
+    "\tDefaults are --bits=32 and input/output files of the given bits.\n",
+    "\n";
+}
+
+
+# Parameters of tables, MAXPRIME has to match primes/primes_<bits>.h
+#   mark:   every mark-th entry is stored in full (random access cost)
+#   suffix: suffix of full entries (unsigned for 64 bit table)
+#   cols:   numbers per line for marks, gaps, and diffs
+my %params = (
+    32 => { maxprime => 11863285, mark => 16, suffix => '', type => 'int',
+            name => '', cols => [8, 16, 12] },
+    64 => { maxprime => 3037000501, mark => 64, suffix => 'U', type => 'unsigned int',
+            name => '_64', cols => [6, 16, 12] },
+);
+my $p = $params{$bits};
+$infile = "dev_src/primelist_$bits.h" unless $infile;
+$outfile = "primes/primelist_$bits.h" unless $outfile;
+
+
+# Read sizes and entries of legacy table
+sub readLegacy {
+    my $file = shift;
+    open my $fh, '<', $file or die "ERROR! failed to open $file: $!\n";
+    my %defs;
+    my @list;
+    my $body = 0;
+    while (<$fh>) {
+        if (/^#define\s+(\w+)\s+(\d+)/) {
+            $defs{$1} = $2;
+        }
+        elsif (/prime_list_\d+\s*\[/) {
+            $body = 1;
+        }
+        elsif ($body) {
+            last if /^\s*\}/;
+            push @list, $1 while /(\d+)/g;
+        }
+    }
+    close $fh;
+
+    foreach (qw(PRIMELISTSIZE1 PRIMELISTSIZE2 STEP)) {
+        die "ERROR! $file: missing $_\n" unless defined $defs{$_};
+    }
+    die "ERROR! $file: ", scalar @list, " entries instead of $defs{PRIMELISTSIZE2}\n"
+        if scalar @list != $defs{PRIMELISTSIZE2};
+
+    return (\%defs, \@list);
+}
+
+
+# Half differences of entries, first is relative to MAXPRIME
+sub halfDiffs {
+    my ($list, $maxprime) = @_;
+    my @half;
+    my $prev = $maxprime;
+    foreach (@$list) {
+        my $d = $prev - $_;
+        die "ERROR! entries are not odd and decreasing at $_\n" if $d <= 0 or $d % 2;
+        push @half, $d / 2;
+        $prev = $_;
+    }
+    return @half;
+}
+
+
+# Comma separated numbers, cols per line
+sub formatList {
+    my ($cols, $suffix, @vals) = @_;
+    my @lines;
+    while (@vals) {
+        my @row = splice @vals, 0, $cols;
+        push @lines, join(', ', map { "$_$suffix" } @row);
+    }
+    return join(",\n", @lines) . "\n";
+}
+
+
+# Decode as decode_prime_list_<bits>() in primes/primes_<bits>.cpp
+sub decode {
+    my ($size1, $mark, $diffmin, $marks, $gaps, $diffs, $index) = @_;
+    my $i = $index - $index % $mark;
+    my $prime = $marks->[$i / $mark];
+    for (++$i; $i <= $index; ++$i) {
+        $prime -= 2 * (($i < $size1) ? $gaps->[$i] : $diffs->[$i - $size1] + $diffmin);
+    }
+    return $prime;
+}
+
+
+########
+# Main #
+########
+my ($defs, $list) = readLegacy $infile;
+my $size1 = $defs->{PRIMELISTSIZE1};
+my $size2 = $defs->{PRIMELISTSIZE2};
+my $mark = $p->{mark};
+my $n = $p->{name};
+
+# First section, one byte per entry
+my @half = halfDiffs $list, $p->{maxprime};
+my @gaps = @half[0 .. $size1 - 1];
+foreach (@gaps) {
+    die "ERROR! gap $_ of first section does not fit in a byte\n" if $_ > 255;
+}
+
+# Second section, two bytes per entry offset by smallest difference
+my @second = @half[$size1 .. $size2 - 1];
+my $diffmin = (sort { $a <=> $b } @second)[0];
+my @diffs = map { $_ - $diffmin } @second;
+foreach (@diffs) {
+    die "ERROR! difference $_ of second section does not fit in two bytes\n" if $_ > 65535;
+}
+
+# Full entries for random access
+my @marks;
+for (my $i = 0; $i < $size2; $i += $mark) {
+    push @marks, $list->[$i];
+}
+
+# Round trip, every entry of legacy table has to be decoded
+for (my $i = 0; $i < $size2; ++$i) {
+    my $prime = decode $size1, $mark, $diffmin, \@marks, \@gaps, \@diffs, $i;
+    die "ERROR! entry $i decodes to $prime instead of $list->[$i]\n" if $prime != $list->[$i];
+}
+
+my $diffmin_type = ($bits == 64) ? 'unsigned int' : 'int';
+my $diffmin_val = "$diffmin$p->{suffix}";
+my $table = $bits == 64 ? '64' : '32';
+my $maxname = "MAXPRIME$n";
+my $text = <<"END";
+/*
+ *  Compressed table of primes below $maxname (see primes_$table.cpp).
+ *
+ *  Entry i < PRIMELISTSIZE1$n is the i-th prime below $maxname, entry
+ *  i >= PRIMELISTSIZE1$n is the prime of offset (i - PRIMELISTSIZE1$n + 1) * STEP$n
+ *  + PRIMELISTSIZE1$n - 1. Entries are stored as half the difference to the
+ *  previous entry (all primes are odd): one byte in the first section, and
+ *  two bytes offset by PRIMEDIFF_MIN$n in the second section. Every
+ *  PRIMEMARK$n-th entry is also stored in full for random access.
+ *
+ *  Generated by scripts/primelist_encode.pl from the table of the original
+ *  SPRNG $table bit primes (dev_src/primelist_$table.h), do not edit. Sizes and
+ *  STEP$n are those of the original table, PRIMEDIFF_MIN$n is the smallest
+ *  half difference of the second section, and PRIMEMARK$n bounds the
+ *  differences decoded per lookup.
+ */
+const int PRIMELISTSIZE1$n = $size1;
+const int PRIMELISTSIZE2$n = $size2;
+const int STEP$n = $defs->{STEP};
+const int PRIMEMARK$n = $mark;
+const $diffmin_type PRIMEDIFF_MIN$n = $diffmin_val;
+
+
+const $p->{type} prime_marks_$table\[@{[scalar @marks]}\] =
+{
+@{[formatList $p->{cols}[0], $p->{suffix}, @marks]}};
+
+
+const unsigned char prime_gaps_$table\[PRIMELISTSIZE1$n\] =
+{
+@{[formatList $p->{cols}[1], '', @gaps]}};
+
+
+const unsigned short prime_diffs_$table\[PRIMELISTSIZE2$n - PRIMELISTSIZE1$n\] =
+{
+@{[formatList $p->{cols}[2], '', @diffs]}};
+
+END
+
+if ($check) {
+    open my $fh, '<', $outfile or die "ERROR! failed to open $outfile: $!\n";
+    local $/;
+    my $old = <$fh>;
+    close $fh;
+    die "ERROR! $outfile differs from table generated from $infile\n" if $old ne $text;
+    print "$outfile matches $infile ($size2 entries)\n";
+}
+else {
+    open my $fh, '>', $outfile or die "ERROR! failed to open $outfile: $!\n";
+    print $fh $text;
+    close $fh;
+}
+
+exit 0;
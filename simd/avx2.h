@@ -27,6 +27,7 @@
 #define SIMD_INT __m256i
 #define SIMD_FLT __m256
 #define SIMD_DBL __m256d
+#define SIMD_MSK SIMD_INT
 #define SIMD_WIDTH_BYTES 32
 #define SIMD_STREAMS_32  8
 #define SIMD_STREAMS_64  4
@@ -49,7 +50,9 @@ enum SHUFFLE_CTRL { XCHG = 0, // Exchange lower/upper halfs of register
                     XCHG32,   // Exchange pairs of 32-bit elements
                     XCHG64,   // Exchange pairs of 64-bit elements
                     DUPLO,     // Duplicate lower half into upper half of register
-                    DUPHI };   // Duplicate upper half into lower half of register
+                    DUPHI,     // Duplicate upper half into lower half of register
+                    BSWAP32,   // Reverse order of bytes in 32-bit elements
+                    BSWAP64 }; // Reverse order of bytes in 64-bit elements
 #endif
 
 
@@ -248,6 +251,18 @@ SIMD_INT simd_shuffle_i32(const SIMD_INT va, const SHUFFLE_CTRL ctrl) __VSPRNG_R
         case XCHG64: vtmp = _mm256_shuffle_epi32(va, 0x4E); break;
         case DUPLO: vtmp = _mm256_shuffle_epi32(va, 0x44); break;
         case DUPHI: vtmp = _mm256_shuffle_epi32(va, 0xEE); break;
+        case BSWAP32:
+        {
+            const SIMD_INT vmsk = _mm256_set_epi64x(0x0C0D0E0F08090A0B, 0x0405060700010203, 0x0C0D0E0F08090A0B, 0x0405060700010203);
+            vtmp = _mm256_shuffle_epi8(va, vmsk);
+        }
+        break;
+        case BSWAP64:
+        {
+            const SIMD_INT vmsk = _mm256_set_epi64x(0x08090A0B0C0D0E0F, 0x0001020304050607, 0x08090A0B0C0D0E0F, 0x0001020304050607);
+            vtmp = _mm256_shuffle_epi8(va, vmsk);
+        }
+        break;
         default: vtmp =  va;
     }
     return vtmp;
@@ -341,6 +356,63 @@ SIMD_INT simd_packmerge_i32(const SIMD_INT va, const SIMD_INT vb) __VSPRNG_REQUI
     return _mm256_inserti128_si256(va_pk, vtmp2, 0x1);
 }
 
+/*!
+ *  Transpose a block of SIMD_STREAMS_32 registers of 32-bit elements in-place,
+ *  element j of register i is swapped with element i of register j.
+ *  4x4 blocks are transposed within 128-bit lanes, then lanes are exchanged.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void simd_transpose(SIMD_FLT * const va)
+{
+    SIMD_FLT vt[8] ARCH_ATTR_ALIGNED(SIMD_WIDTH_BYTES);
+    SIMD_FLT vu[8] ARCH_ATTR_ALIGNED(SIMD_WIDTH_BYTES);
+
+    for (int i = 0; i < 8; i += 4) {
+        vt[i] = _mm256_unpacklo_ps(va[i], va[i+1]);
+        vt[i+1] = _mm256_unpackhi_ps(va[i], va[i+1]);
+        vt[i+2] = _mm256_unpacklo_ps(va[i+2], va[i+3]);
+        vt[i+3] = _mm256_unpackhi_ps(va[i+2], va[i+3]);
+
+        vu[i] = _mm256_shuffle_ps(vt[i], vt[i+2], 0x44);
+        vu[i+1] = _mm256_shuffle_ps(vt[i], vt[i+2], 0xEE);
+        vu[i+2] = _mm256_shuffle_ps(vt[i+1], vt[i+3], 0x44);
+        vu[i+3] = _mm256_shuffle_ps(vt[i+1], vt[i+3], 0xEE);
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        va[i] = _mm256_permute2f128_ps(vu[i], vu[i+4], 0x20);
+        va[i+4] = _mm256_permute2f128_ps(vu[i], vu[i+4], 0x31);
+    }
+}
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void simd_transpose_i32(SIMD_INT * const va)
+{
+    SIMD_FLT vf[8] ARCH_ATTR_ALIGNED(SIMD_WIDTH_BYTES);
+    for (int i = 0; i < 8; ++i)
+        vf[i] = _mm256_castsi256_ps(va[i]);
+    simd_transpose(vf);
+    for (int i = 0; i < 8; ++i)
+        va[i] = _mm256_castps_si256(vf[i]);
+}
+
+/*!
+ *  Transpose a block of SIMD_STREAMS_64 registers of 64-bit elements in-place.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void simd_transpose(SIMD_DBL * const va)
+{
+    const SIMD_DBL vt0 = _mm256_unpacklo_pd(va[0], va[1]);
+    const SIMD_DBL vt1 = _mm256_unpackhi_pd(va[0], va[1]);
+    const SIMD_DBL vt2 = _mm256_unpacklo_pd(va[2], va[3]);
+    const SIMD_DBL vt3 = _mm256_unpackhi_pd(va[2], va[3]);
+
+    va[0] = _mm256_permute2f128_pd(vt0, vt2, 0x20);
+    va[1] = _mm256_permute2f128_pd(vt1, vt3, 0x20);
+    va[2] = _mm256_permute2f128_pd(vt0, vt2, 0x31);
+    va[3] = _mm256_permute2f128_pd(vt1, vt3, 0x31);
+}
+
 
 /*******************
  *  Set intrinsics
@@ -458,11 +530,15 @@ SIMD_FLT simd_cvt_i32_f32(const SIMD_INT va) __VSPRNG_REQUIRED__
  */
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_DBL simd_cvt_i32_f64(const SIMD_INT va) __VSPRNG_REQUIRED__
-{
-    const SIMD_FLT va_flt = _mm256_cvtepi32_ps(va);
-    const __m128 va_flt_lo = _mm256_castps256_ps128(va_flt);
-    return _mm256_cvtps_pd(va_flt_lo);
-}
+{ return _mm256_cvtepi32_pd(_mm256_castsi256_si128(va)); }
+
+/*!
+ *  Convert high half of packed 32-bit integer elements
+ *  to packed double-precision floating-point elements.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL simd_cvt_i32_f64_hi(const SIMD_INT va) __VSPRNG_REQUIRED__
+{ return _mm256_cvtepi32_pd(_mm256_extracti128_si256(va, 0x1)); }
 
 /*!
  *  Convert packed unsigned 64-bit integer elements
@@ -613,5 +689,47 @@ void simd_storeu(double * const sa, const SIMD_DBL va)
 { _mm256_storeu_pd(sa, va); }
 
 
+/*******************************
+ *  Stream mask intrinsics
+ *******************************/
+/*
+ *  Masks select the first n streams (32/64-bit elements) of a register,
+ *  masked out elements are set to zero.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_MSK simd_set_mask_32(const int n) __VSPRNG_REQUIRED__
+{
+    int sa[SIMD_STREAMS_32] ARCH_ATTR_ALIGNED(SIMD_WIDTH_BYTES);
+    for (int i = 0; i < SIMD_STREAMS_32; ++i)
+        sa[i] = (i < n) ? 0xFFFFFFFF : 0x00000000;
+    return simd_load(sa);
+}
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_MSK simd_set_mask_64(const int n) __VSPRNG_REQUIRED__
+{
+    long int sa[SIMD_STREAMS_64] ARCH_ATTR_ALIGNED(SIMD_WIDTH_BYTES);
+    for (int i = 0; i < SIMD_STREAMS_64; ++i)
+        sa[i] = (i < n) ? 0xFFFFFFFFFFFFFFFFL : 0x0000000000000000L;
+    return simd_load(sa);
+}
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT simd_maskz_32(const SIMD_INT va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return simd_and(va, msk); }
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT simd_maskz_64(const SIMD_INT va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return simd_and(va, msk); }
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_FLT simd_maskz(const SIMD_FLT va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return simd_and(va, msk); }
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL simd_maskz(const SIMD_DBL va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return simd_and(va, msk); }
+
+
 #endif  // __AVX2_H
 
@@ -27,6 +27,7 @@
 #define SIMD_INT __m512i
 #define SIMD_FLT __m512
 #define SIMD_DBL __m512d
+#define SIMD_MSK __mmask16
 #define SIMD_WIDTH_BYTES 64
 #define SIMD_STREAMS_32  16
 #define SIMD_STREAMS_64  8
@@ -37,6 +38,24 @@
 #define __SIMD_FUN_PREFIX__ inline static
 
 
+#ifndef _SHUFFLE_CTRL_
+#define _SHUFFLE_CTRL_
+/*!
+ *  Control values for shuffle operations
+ *  \todo Move this enum to a global area, all SIMD modes will use it
+ */
+enum SHUFFLE_CTRL { XCHG = 0, // Exchange lower/upper halfs of register
+                    XCHG8,    // Exchange pairs of 8-bit elements
+                    XCHG16,   // Exchange pairs of 16-bit elements
+                    XCHG32,   // Exchange pairs of 32-bit elements
+                    XCHG64,   // Exchange pairs of 64-bit elements
+                    DUPLO,     // Duplicate lower half into upper half of register
+                    DUPHI,     // Duplicate upper half into lower half of register
+                    BSWAP32,   // Reverse order of bytes in 32-bit elements
+                    BSWAP64 }; // Reverse order of bytes in 64-bit elements
+#endif
+
+
 /*
  *  Interface Legend
  *
@@ -102,7 +121,7 @@ SIMD_DBL simd_fmadd(const SIMD_DBL va, const SIMD_DBL vb, const SIMD_DBL vc)
  */
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_INT simd_mul_u32(const SIMD_INT va, const SIMD_INT vb)
-{ return _mm512_mul_epu32(va, vb); }
+{ return _mm512_maskz_mul_epu32((__mmask8)0xFFU, va, vb); }
 
 /*!
  *  Multiply low signed 32-bit integers from each packed 64-bit elements
@@ -110,7 +129,7 @@ SIMD_INT simd_mul_u32(const SIMD_INT va, const SIMD_INT vb)
  */
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_INT simd_mul_i32(const SIMD_INT va, const SIMD_INT vb)
-{ return _mm512_mul_epi32(va, vb); }
+{ return _mm512_maskz_mul_epi32((__mmask8)0xFFU, va, vb); }
 
 /*!
  *  Perform 64-bit integer multiplication
@@ -155,11 +174,19 @@ SIMD_INT simd_and(const SIMD_INT va, const SIMD_INT vb) __VSPRNG_REQUIRED__
 
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_FLT simd_and(const SIMD_FLT va, const SIMD_INT vb) __VSPRNG_REQUIRED__
-{ return _mm512_and_ps(va, vb); }
+{
+    SIMD_INT va_int = _mm512_castps_si512(va);
+    va_int = _mm512_and_si512(va_int, vb);
+    return _mm512_castsi512_ps(va_int);
+}
 
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_DBL simd_and(const SIMD_DBL va, const SIMD_INT vb) __VSPRNG_REQUIRED__
-{ return _mm512_and_pd(va, vb); }
+{
+    SIMD_INT va_int = _mm512_castpd_si512(va);
+    va_int = _mm512_and_si512(va_int, vb);
+    return _mm512_castsi512_pd(va_int);
+}
 
 
 /*****************************
@@ -167,33 +194,63 @@ SIMD_DBL simd_and(const SIMD_DBL va, const SIMD_INT vb) __VSPRNG_REQUIRED__
  *****************************/
 /*
  *  Shift left (logical) packed 32/64-bit integers
+ *  NOTE: zero-masking forms are used with all elements active, GCC warns about
+ *  uninitialized _mm512_undefined_*() pass-through in the unmasked forms.
  */
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_INT simd_sll_32(const SIMD_INT va, const int shft) __VSPRNG_REQUIRED__
-{ return _mm512_slli_epi32(va, (unsigned int)shft); }
+{ return _mm512_maskz_slli_epi32((__mmask16)0xFFFFU, va, (unsigned int)shft); }
 
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_INT simd_srl_32(const SIMD_INT va, const int shft) __VSPRNG_REQUIRED__
-{ return _mm512_srli_epi32(va, (unsigned int)shft); }
+{ return _mm512_maskz_srli_epi32((__mmask16)0xFFFFU, va, (unsigned int)shft); }
 
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_INT simd_sll_64(const SIMD_INT va, const int shft) __VSPRNG_REQUIRED__
-{ return _mm512_slli_epi64(va, (unsigned int)shft); }
+{ return _mm512_maskz_slli_epi64((__mmask8)0xFFU, va, (unsigned int)shft); }
 
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_INT simd_srl_64(const SIMD_INT va, const int shft) __VSPRNG_REQUIRED__
-{ return _mm512_srli_epi64(va, (unsigned int)shft); }
+{ return _mm512_maskz_srli_epi64((__mmask8)0xFFU, va, (unsigned int)shft); }
 
 /*
  *  Shuffle 32-bit elements using control value
  */
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
-SIMD_INT simd_shuffle_i32(const SIMD_INT va, const int ctrl) __VSPRNG_REQUIRED__
-{ return _mm512_shuffle_epi32(va, ctrl); }
+SIMD_INT simd_shuffle_i32(const SIMD_INT va, const SHUFFLE_CTRL ctrl) __VSPRNG_REQUIRED__
+{
+    SIMD_INT vtmp;
+    switch (ctrl) {
+        case XCHG: vtmp = _mm512_shuffle_epi32(va, (_MM_PERM_ENUM)0x4E); break;
+        case XCHG32: vtmp = _mm512_shuffle_epi32(va, (_MM_PERM_ENUM)0xB1); break;
+        case XCHG64: vtmp = _mm512_shuffle_epi32(va, (_MM_PERM_ENUM)0x4E); break;
+        case DUPLO: vtmp = _mm512_shuffle_epi32(va, (_MM_PERM_ENUM)0x44); break;
+        case DUPHI: vtmp = _mm512_shuffle_epi32(va, (_MM_PERM_ENUM)0xEE); break;
+        case BSWAP32:
+        {
+            const SIMD_INT vmsk = _mm512_set_epi64(0x0C0D0E0F08090A0B, 0x0405060700010203, 0x0C0D0E0F08090A0B, 0x0405060700010203,
+                                                   0x0C0D0E0F08090A0B, 0x0405060700010203, 0x0C0D0E0F08090A0B, 0x0405060700010203);
+            vtmp = _mm512_shuffle_epi8(va, vmsk);
+        }
+        break;
+        case BSWAP64:
+        {
+            const SIMD_INT vmsk = _mm512_set_epi64(0x08090A0B0C0D0E0F, 0x0001020304050607, 0x08090A0B0C0D0E0F, 0x0001020304050607,
+                                                   0x08090A0B0C0D0E0F, 0x0001020304050607, 0x08090A0B0C0D0E0F, 0x0001020304050607);
+            vtmp = _mm512_shuffle_epi8(va, vmsk);
+        }
+        break;
+        default: vtmp = va;
+    }
+    return vtmp;
+}
 
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
-SIMD_FLT simd_shuffle_f32(const SIMD_FLT va, const SIMD_FLT vb, const int ctrl) __VSPRNG_REQUIRED__
-{ return _mm512_shuffle_ps(va, vb, ctrl); }
+SIMD_FLT simd_shuffle_f32(const SIMD_FLT va, const SHUFFLE_CTRL ctrl) __VSPRNG_REQUIRED__
+{
+    const SIMD_INT va_int = _mm512_castps_si512(va);
+    return _mm512_castsi512_ps(simd_shuffle_i32(va_int, ctrl));
+}
 
 /*
  *  Merge either low/high parts from pair of registers
@@ -202,45 +259,45 @@ SIMD_FLT simd_shuffle_f32(const SIMD_FLT va, const SIMD_FLT vb, const int ctrl)
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_INT simd_merge_lo(const SIMD_INT va, const SIMD_INT vb)
 {
-    const __m256i vb_lo = _mm512_castsi512_si256(vb);
-    return _mm512_inserti64x4(va, vb_lo, 0x1);
+    const SIMD_INT vidx = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+    return _mm512_permutex2var_epi64(va, vidx, vb);
 }
 
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_FLT simd_merge_lo(const SIMD_FLT va, const SIMD_FLT vb) __VSPRNG_REQUIRED__
 {
-    const __m256d vb_lo = _mm512_castpd512_pd256(vb);
-    const SIMD_DBL vc = _mm512_insertf64x4(va, vb_lo, 0x1);
+    const SIMD_INT vidx = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+    const SIMD_DBL vc = _mm512_permutex2var_pd(_mm512_castps_pd(va), vidx, _mm512_castps_pd(vb));
     return _mm512_castpd_ps(vc);
 }
 
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_DBL simd_merge_lo(const SIMD_DBL va, const SIMD_DBL vb)
 {
-    const __m256d vb_lo = _mm512_castpd512_pd256(vb);
-    return _mm512_insertf64x4(va, vb_lo, 0x1);
+    const SIMD_INT vidx = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+    return _mm512_permutex2var_pd(va, vidx, vb);
 }
 
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_INT simd_merge_hi(const SIMD_INT va, const SIMD_INT vb)
 {
-    const __m256i va_hi = _mm512_extracti64x4_epi64(va, 0x1);
-    return _mm512_inserti64x4(vb, va_hi, 0x0);
+    const SIMD_INT vidx = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+    return _mm512_permutex2var_epi64(va, vidx, vb);
 }
 
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_FLT simd_merge_hi(const SIMD_FLT va, const SIMD_FLT vb)
 {
-    const __m256d va_hi = _mm512_extractf64x4_pd(va, 0x1);
-    const SIMD_DBL vc = _mm512_insertf64x4(vb, va_hi, 0x0);
+    const SIMD_INT vidx = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+    const SIMD_DBL vc = _mm512_permutex2var_pd(_mm512_castps_pd(va), vidx, _mm512_castps_pd(vb));
     return _mm512_castpd_ps(vc);
 }
 
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_DBL simd_merge_hi(const SIMD_DBL va, const SIMD_DBL vb)
 {
-    const __m256d va_hi = _mm512_extractf64x4_pd(va, 0x1);
-    return _mm512_insertf64x4(vb, va_hi, 0x0);
+    const SIMD_INT vidx = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+    return _mm512_permutex2var_pd(va, vidx, vb);
 }
 
 /*!
@@ -249,15 +306,80 @@ SIMD_DBL simd_merge_hi(const SIMD_DBL va, const SIMD_DBL vb)
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_INT simd_packmerge_i32(const SIMD_INT va, const SIMD_INT vb) __VSPRNG_REQUIRED__
 {
-    // Pack va
-    const int SIMD_INT va_pk = _mm512_maskz_compress_epi32(0x5555U, va);
+    // Pack even 32-bit elements of va (low half) and vb (high half)
+    const SIMD_INT vidx = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    return _mm512_permutex2var_epi32(va, vidx, vb);
+}
 
-    // Pack vb
-    const int SIMD_INT vb_pk = _mm512_maskz_compress_epi32(0x5555U, vb);
+/*!
+ *  Transpose a block of SIMD_STREAMS_32 registers of 32-bit elements in-place,
+ *  element j of register i is swapped with element i of register j.
+ *  4x4 blocks are transposed within 128-bit lanes, then lanes are exchanged.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void simd_transpose(SIMD_FLT * const va)
+{
+    SIMD_FLT vt[16] ARCH_ATTR_ALIGNED(SIMD_WIDTH_BYTES);
+    SIMD_FLT vu[16] ARCH_ATTR_ALIGNED(SIMD_WIDTH_BYTES);
+
+    for (int i = 0; i < 16; i += 4) {
+        vt[i] = _mm512_maskz_unpacklo_ps((__mmask16)0xFFFFU, va[i], va[i+1]);
+        vt[i+1] = _mm512_maskz_unpackhi_ps((__mmask16)0xFFFFU, va[i], va[i+1]);
+        vt[i+2] = _mm512_maskz_unpacklo_ps((__mmask16)0xFFFFU, va[i+2], va[i+3]);
+        vt[i+3] = _mm512_maskz_unpackhi_ps((__mmask16)0xFFFFU, va[i+2], va[i+3]);
+
+        vu[i] = _mm512_maskz_shuffle_ps((__mmask16)0xFFFFU, vt[i], vt[i+2], 0x44);
+        vu[i+1] = _mm512_maskz_shuffle_ps((__mmask16)0xFFFFU, vt[i], vt[i+2], 0xEE);
+        vu[i+2] = _mm512_maskz_shuffle_ps((__mmask16)0xFFFFU, vt[i+1], vt[i+3], 0x44);
+        vu[i+3] = _mm512_maskz_shuffle_ps((__mmask16)0xFFFFU, vt[i+1], vt[i+3], 0xEE);
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        const SIMD_FLT vlo0 = _mm512_maskz_shuffle_f32x4((__mmask16)0xFFFFU, vu[i], vu[i+4], 0x44);
+        const SIMD_FLT vhi0 = _mm512_maskz_shuffle_f32x4((__mmask16)0xFFFFU, vu[i], vu[i+4], 0xEE);
+        const SIMD_FLT vlo1 = _mm512_maskz_shuffle_f32x4((__mmask16)0xFFFFU, vu[i+8], vu[i+12], 0x44);
+        const SIMD_FLT vhi1 = _mm512_maskz_shuffle_f32x4((__mmask16)0xFFFFU, vu[i+8], vu[i+12], 0xEE);
+        va[i] = _mm512_maskz_shuffle_f32x4((__mmask16)0xFFFFU, vlo0, vlo1, 0x88);
+        va[i+4] = _mm512_maskz_shuffle_f32x4((__mmask16)0xFFFFU, vlo0, vlo1, 0xDD);
+        va[i+8] = _mm512_maskz_shuffle_f32x4((__mmask16)0xFFFFU, vhi0, vhi1, 0x88);
+        va[i+12] = _mm512_maskz_shuffle_f32x4((__mmask16)0xFFFFU, vhi0, vhi1, 0xDD);
+    }
+}
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void simd_transpose_i32(SIMD_INT * const va)
+{
+    SIMD_FLT vf[16] ARCH_ATTR_ALIGNED(SIMD_WIDTH_BYTES);
+    for (int i = 0; i < 16; ++i)
+        vf[i] = _mm512_castsi512_ps(va[i]);
+    simd_transpose(vf);
+    for (int i = 0; i < 16; ++i)
+        va[i] = _mm512_castps_si512(vf[i]);
+}
 
-    // Merge
-    const __m256i vb_pk_lo = _mm512_castsi512_si256(vb_pk);
-    return _mm512_inserti64x4(va_pk, vb_pk_lo, 0x1);
+/*!
+ *  Transpose a block of SIMD_STREAMS_64 registers of 64-bit elements in-place.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void simd_transpose(SIMD_DBL * const va)
+{
+    SIMD_DBL vt[8] ARCH_ATTR_ALIGNED(SIMD_WIDTH_BYTES);
+
+    for (int i = 0; i < 8; i += 2) {
+        vt[i] = _mm512_maskz_unpacklo_pd((__mmask8)0xFFU, va[i], va[i+1]);
+        vt[i+1] = _mm512_maskz_unpackhi_pd((__mmask8)0xFFU, va[i], va[i+1]);
+    }
+
+    for (int i = 0; i < 2; ++i) {
+        const SIMD_DBL vlo0 = _mm512_maskz_shuffle_f64x2((__mmask8)0xFFU, vt[i], vt[i+2], 0x44);
+        const SIMD_DBL vhi0 = _mm512_maskz_shuffle_f64x2((__mmask8)0xFFU, vt[i], vt[i+2], 0xEE);
+        const SIMD_DBL vlo1 = _mm512_maskz_shuffle_f64x2((__mmask8)0xFFU, vt[i+4], vt[i+6], 0x44);
+        const SIMD_DBL vhi1 = _mm512_maskz_shuffle_f64x2((__mmask8)0xFFU, vt[i+4], vt[i+6], 0xEE);
+        va[i] = _mm512_maskz_shuffle_f64x2((__mmask8)0xFFU, vlo0, vlo1, 0x88);
+        va[i+2] = _mm512_maskz_shuffle_f64x2((__mmask8)0xFFU, vlo0, vlo1, 0xDD);
+        va[i+4] = _mm512_maskz_shuffle_f64x2((__mmask8)0xFFU, vhi0, vhi1, 0x88);
+        va[i+6] = _mm512_maskz_shuffle_f64x2((__mmask8)0xFFU, vhi0, vhi1, 0xDD);
+    }
 }
 
 
@@ -369,7 +491,7 @@ SIMD_INT simd_set(const unsigned long int * const sa, const int n) __VSPRNG_REQU
  */
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_FLT simd_cvt_i32_f32(const SIMD_INT va) __VSPRNG_REQUIRED__
-{ return _mm512_cvtepi32_ps(va); }
+{ return _mm512_maskz_cvtepi32_ps((__mmask16)0xFFFFU, va); }
 
 /*!
  *  Convert packed 32-bit integer elements
@@ -377,7 +499,21 @@ SIMD_FLT simd_cvt_i32_f32(const SIMD_INT va) __VSPRNG_REQUIRED__
  */
 __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_DBL simd_cvt_i32_f64(const SIMD_INT va) __VSPRNG_REQUIRED__
-{ return _mm512_cvtepi32lo_pd(va); }
+{
+    const __m256i va_lo = _mm512_maskz_extracti64x4_epi64((__mmask8)0xFFU, va, 0x0);
+    return _mm512_maskz_cvtepi32_pd((__mmask8)0xFFU, va_lo);
+}
+
+/*!
+ *  Convert high half of packed 32-bit integer elements
+ *  to packed double-precision floating-point elements.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL simd_cvt_i32_f64_hi(const SIMD_INT va) __VSPRNG_REQUIRED__
+{
+    const __m256i va_hi = _mm512_maskz_extracti64x4_epi64((__mmask8)0xFFU, va, 0x1);
+    return _mm512_maskz_cvtepi32_pd((__mmask8)0xFFU, va_hi);
+}
 
 /*!
  *  Convert packed unsigned 64-bit integer elements
@@ -396,7 +532,8 @@ SIMD_FLT simd_cvt_u64_f32(const SIMD_INT va) __VSPRNG_REQUIRED__
     return _mm512_mask_mov_ps(fa, 0xFF00U, zero);
 */
     const __m256 va_flt = _mm512_cvtepu64_ps(va);
-    return _mm512_mask_xor_ps(va_flt, 0xFF00U, va_flt);
+    const SIMD_DBL vzero = _mm512_setzero_pd();
+    return _mm512_castpd_ps(_mm512_maskz_insertf64x4((__mmask8)0xFFU, vzero, _mm256_castps_pd(va_flt), 0x0));
 }
 
 /*!
@@ -511,5 +648,49 @@ void simd_storeu(double * const sa, const SIMD_DBL va)
 { _mm512_storeu_pd(sa, va); }
 
 
+/*******************************
+ *  Stream mask intrinsics
+ *******************************/
+/*
+ *  Masks select the first n streams (32/64-bit elements) of a register,
+ *  masked out elements are set to zero. Uses opmask (k) registers.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_MSK simd_set_mask_32(const int n) __VSPRNG_REQUIRED__
+{
+    if (n >= SIMD_STREAMS_32)
+        return (SIMD_MSK)0xFFFFU;
+    else if (n <= 0)
+        return (SIMD_MSK)0x0U;
+    return (SIMD_MSK)((0x1U << n) - 1);
+}
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_MSK simd_set_mask_64(const int n) __VSPRNG_REQUIRED__
+{
+    if (n >= SIMD_STREAMS_64)
+        return (SIMD_MSK)0xFFU;
+    else if (n <= 0)
+        return (SIMD_MSK)0x0U;
+    return (SIMD_MSK)((0x1U << n) - 1);
+}
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT simd_maskz_32(const SIMD_INT va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return _mm512_maskz_mov_epi32(msk, va); }
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT simd_maskz_64(const SIMD_INT va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return _mm512_maskz_mov_epi64((__mmask8)msk, va); }
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_FLT simd_maskz(const SIMD_FLT va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return _mm512_maskz_mov_ps(msk, va); }
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL simd_maskz(const SIMD_DBL va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return _mm512_maskz_mov_pd((__mmask8)msk, va); }
+
+
 #endif  // __AVX512_H
 
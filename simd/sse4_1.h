@@ -27,6 +27,7 @@
 #define SIMD_INT __m128i
 #define SIMD_FLT __m128
 #define SIMD_DBL __m128d
+#define SIMD_MSK SIMD_INT
 #define SIMD_WIDTH_BYTES 16
 #define SIMD_STREAMS_32  4
 #define SIMD_STREAMS_64  2
@@ -49,7 +50,9 @@ enum SHUFFLE_CTRL { XCHG = 0, // Exchange lower/upper halfs of register
                     XCHG32,   // Exchange pairs of 32-bit elements
                     XCHG64,   // Exchange pairs of 64-bit elements
                     DUPLO,     // Duplicate lower half into upper half of register
-                    DUPHI };   // Duplicate upper half into lower half of register
+                    DUPHI,     // Duplicate upper half into lower half of register
+                    BSWAP32,   // Reverse order of bytes in 32-bit elements
+                    BSWAP64 }; // Reverse order of bytes in 64-bit elements
 #endif
 
 
@@ -248,6 +251,18 @@ SIMD_INT simd_shuffle_i32(const SIMD_INT va, const SHUFFLE_CTRL ctrl) __VSPRNG_R
         case XCHG64: vtmp = _mm_shuffle_epi32(va, 0x4E); break;
         case DUPLO: vtmp = _mm_shuffle_epi32(va, 0x44); break;
         case DUPHI: vtmp = _mm_shuffle_epi32(va, 0xEE); break;
+        case BSWAP32:
+        {
+            const SIMD_INT vmsk = _mm_set_epi64x(0x0C0D0E0F08090A0B, 0x0405060700010203);
+            vtmp = _mm_shuffle_epi8(va, vmsk);
+        }
+        break;
+        case BSWAP64:
+        {
+            const SIMD_INT vmsk = _mm_set_epi64x(0x08090A0B0C0D0E0F, 0x0001020304050607);
+            vtmp = _mm_shuffle_epi8(va, vmsk);
+        }
+        break;
         default: vtmp =  va;
     }
     return vtmp;
@@ -328,6 +343,51 @@ SIMD_INT simd_packmerge_i32(const SIMD_INT va, const SIMD_INT vb) __VSPRNG_REQUI
 */
 }
 
+/*!
+ *  Transpose a block of SIMD_STREAMS_32 registers of 32-bit elements in-place,
+ *  element j of register i is swapped with element i of register j.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void simd_transpose_i32(SIMD_INT * const va)
+{
+    const SIMD_INT vt0 = _mm_unpacklo_epi32(va[0], va[1]);
+    const SIMD_INT vt1 = _mm_unpacklo_epi32(va[2], va[3]);
+    const SIMD_INT vt2 = _mm_unpackhi_epi32(va[0], va[1]);
+    const SIMD_INT vt3 = _mm_unpackhi_epi32(va[2], va[3]);
+
+    va[0] = _mm_unpacklo_epi64(vt0, vt1);
+    va[1] = _mm_unpackhi_epi64(vt0, vt1);
+    va[2] = _mm_unpacklo_epi64(vt2, vt3);
+    va[3] = _mm_unpackhi_epi64(vt2, vt3);
+}
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void simd_transpose(SIMD_FLT * const va)
+{
+    const SIMD_FLT vt0 = _mm_unpacklo_ps(va[0], va[1]);
+    const SIMD_FLT vt1 = _mm_unpacklo_ps(va[2], va[3]);
+    const SIMD_FLT vt2 = _mm_unpackhi_ps(va[0], va[1]);
+    const SIMD_FLT vt3 = _mm_unpackhi_ps(va[2], va[3]);
+
+    va[0] = _mm_movelh_ps(vt0, vt1);
+    va[1] = _mm_movehl_ps(vt1, vt0);
+    va[2] = _mm_movelh_ps(vt2, vt3);
+    va[3] = _mm_movehl_ps(vt3, vt2);
+}
+
+/*!
+ *  Transpose a block of SIMD_STREAMS_64 registers of 64-bit elements in-place.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+void simd_transpose(SIMD_DBL * const va)
+{
+    const SIMD_DBL vt0 = _mm_unpacklo_pd(va[0], va[1]);
+    const SIMD_DBL vt1 = _mm_unpackhi_pd(va[0], va[1]);
+
+    va[0] = vt0;
+    va[1] = vt1;
+}
+
 
 /*******************
  *  Set intrinsics
@@ -447,6 +507,14 @@ __SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
 SIMD_DBL simd_cvt_i32_f64(const SIMD_INT va) __VSPRNG_REQUIRED__
 { return _mm_cvtepi32_pd(va); }
 
+/*!
+ *  Convert high half of packed 32-bit integer elements
+ *  to packed 64-bit floating-point elements.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL simd_cvt_i32_f64_hi(const SIMD_INT va) __VSPRNG_REQUIRED__
+{ return _mm_cvtepi32_pd(_mm_unpackhi_epi64(va, va)); }
+
 /*!
  *  Convert packed unsigned 64-bit integer elements
  *  to packed 32-bit floating-point elements, the high half of the register is set to 0.0.
@@ -596,5 +664,47 @@ void simd_storeu(double * const sa, const SIMD_DBL va)
 { _mm_storeu_pd(sa, va); }
 
 
+/*******************************
+ *  Stream mask intrinsics
+ *******************************/
+/*
+ *  Masks select the first n streams (32/64-bit elements) of a register,
+ *  masked out elements are set to zero.
+ */
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_MSK simd_set_mask_32(const int n) __VSPRNG_REQUIRED__
+{
+    int sa[SIMD_STREAMS_32] ARCH_ATTR_ALIGNED(SIMD_WIDTH_BYTES);
+    for (int i = 0; i < SIMD_STREAMS_32; ++i)
+        sa[i] = (i < n) ? 0xFFFFFFFF : 0x00000000;
+    return simd_load(sa);
+}
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_MSK simd_set_mask_64(const int n) __VSPRNG_REQUIRED__
+{
+    long int sa[SIMD_STREAMS_64] ARCH_ATTR_ALIGNED(SIMD_WIDTH_BYTES);
+    for (int i = 0; i < SIMD_STREAMS_64; ++i)
+        sa[i] = (i < n) ? 0xFFFFFFFFFFFFFFFFL : 0x0000000000000000L;
+    return simd_load(sa);
+}
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT simd_maskz_32(const SIMD_INT va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return simd_and(va, msk); }
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_INT simd_maskz_64(const SIMD_INT va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return simd_and(va, msk); }
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_FLT simd_maskz(const SIMD_FLT va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return simd_and(va, msk); }
+
+__SIMD_FUN_ATTR__ __SIMD_FUN_PREFIX__
+SIMD_DBL simd_maskz(const SIMD_DBL va, const SIMD_MSK msk) __VSPRNG_REQUIRED__
+{ return simd_and(va, msk); }
+
+
 #endif  // __SSE4_1_H
 
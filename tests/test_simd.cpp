@@ -252,6 +252,31 @@ int test_simd_cvt_i32_fp()
         free(arr_C2);
     }
 
+    // Double, high half
+    {
+        const int num_elems = SIMD_STREAMS_64;
+        const TEST_TYPES test_type = TEST_DBL;
+        int *arr_A = NULL;
+        double *arr_C1 = NULL, *arr_C2 = NULL;
+
+        create_test_array(TEST_I32, (void **)&arr_A, SIMD_STREAMS_32, alignment);
+        create_test_array(test_type, (void **)&arr_C1, num_elems, alignment);
+        create_test_array(test_type, (void **)&arr_C2, num_elems, alignment);
+
+        SIMD_INT va = simd_load(arr_A);
+        SIMD_DBL vc = simd_cvt_i32_f64_hi(va);
+
+        for (int i = 0; i < num_elems; ++i)
+            arr_C2[i] = (double)arr_A[SIMD_STREAMS_64 + i];
+
+        simd_store(arr_C1, vc);
+        test_result += validate_test_arrays(test_type, (void *)arr_C1, (void *)arr_C2, num_elems);
+
+        free(arr_A);
+        free(arr_C1);
+        free(arr_C2);
+    }
+
     return test_result;
 }
 
@@ -512,5 +537,99 @@ int test_simd_merge_hi()
 }
 
 
+// Transpose block of registers
+int test_simd_transpose()
+{
+    int test_result = 0;
+    const int alignment = SIMD_WIDTH_BYTES;
+
+    // Integer
+    {
+        const int num_elems = SIMD_STREAMS_32 * SIMD_STREAMS_32;
+        const TEST_TYPES test_type = TEST_I32;
+        int *arr_A = NULL, *arr_C1 = NULL, *arr_C2 = NULL;
+
+        create_test_array(test_type, (void **)&arr_A, num_elems, alignment);
+        create_test_array(test_type, (void **)&arr_C1, num_elems, alignment);
+        create_test_array(test_type, (void **)&arr_C2, num_elems, alignment);
+
+        SIMD_INT va[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        for (int i = 0; i < SIMD_STREAMS_32; ++i)
+            va[i] = simd_load(arr_A + i * SIMD_STREAMS_32);
+        simd_transpose_i32(va);
+
+        for (int i = 0; i < SIMD_STREAMS_32; ++i)
+            for (int j = 0; j < SIMD_STREAMS_32; ++j)
+                arr_C2[i * SIMD_STREAMS_32 + j] = arr_A[j * SIMD_STREAMS_32 + i];
+
+        for (int i = 0; i < SIMD_STREAMS_32; ++i)
+            simd_store(arr_C1 + i * SIMD_STREAMS_32, va[i]);
+        test_result += validate_test_arrays(test_type, (void *)arr_C1, (void *)arr_C2, num_elems);
+
+        free(arr_A);
+        free(arr_C1);
+        free(arr_C2);
+    }
+
+    // Float
+    {
+        const int num_elems = SIMD_STREAMS_32 * SIMD_STREAMS_32;
+        const TEST_TYPES test_type = TEST_FLT;
+        float *arr_A = NULL, *arr_C1 = NULL, *arr_C2 = NULL;
+
+        create_test_array(test_type, (void **)&arr_A, num_elems, alignment);
+        create_test_array(test_type, (void **)&arr_C1, num_elems, alignment);
+        create_test_array(test_type, (void **)&arr_C2, num_elems, alignment);
+
+        SIMD_FLT va[SIMD_STREAMS_32] __SIMD_ALIGN__;
+        for (int i = 0; i < SIMD_STREAMS_32; ++i)
+            va[i] = simd_load(arr_A + i * SIMD_STREAMS_32);
+        simd_transpose(va);
+
+        for (int i = 0; i < SIMD_STREAMS_32; ++i)
+            for (int j = 0; j < SIMD_STREAMS_32; ++j)
+                arr_C2[i * SIMD_STREAMS_32 + j] = arr_A[j * SIMD_STREAMS_32 + i];
+
+        for (int i = 0; i < SIMD_STREAMS_32; ++i)
+            simd_store(arr_C1 + i * SIMD_STREAMS_32, va[i]);
+        test_result += validate_test_arrays(test_type, (void *)arr_C1, (void *)arr_C2, num_elems);
+
+        free(arr_A);
+        free(arr_C1);
+        free(arr_C2);
+    }
+
+    // Double
+    {
+        const int num_elems = SIMD_STREAMS_64 * SIMD_STREAMS_64;
+        const TEST_TYPES test_type = TEST_DBL;
+        double *arr_A = NULL, *arr_C1 = NULL, *arr_C2 = NULL;
+
+        create_test_array(test_type, (void **)&arr_A, num_elems, alignment);
+        create_test_array(test_type, (void **)&arr_C1, num_elems, alignment);
+        create_test_array(test_type, (void **)&arr_C2, num_elems, alignment);
+
+        SIMD_DBL va[SIMD_STREAMS_64] __SIMD_ALIGN__;
+        for (int i = 0; i < SIMD_STREAMS_64; ++i)
+            va[i] = simd_load(arr_A + i * SIMD_STREAMS_64);
+        simd_transpose(va);
+
+        for (int i = 0; i < SIMD_STREAMS_64; ++i)
+            for (int j = 0; j < SIMD_STREAMS_64; ++j)
+                arr_C2[i * SIMD_STREAMS_64 + j] = arr_A[j * SIMD_STREAMS_64 + i];
+
+        for (int i = 0; i < SIMD_STREAMS_64; ++i)
+            simd_store(arr_C1 + i * SIMD_STREAMS_64, va[i]);
+        test_result += validate_test_arrays(test_type, (void *)arr_C1, (void *)arr_C2, num_elems);
+
+        free(arr_A);
+        free(arr_C1);
+        free(arr_C2);
+    }
+
+    return test_result;
+}
+
+
 #endif // SIMD_MODE
 
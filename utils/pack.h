@@ -0,0 +1,118 @@
+#ifndef __PACK_H
+#define __PACK_H
+
+
+#include <stdio.h>   // printf
+#include <stdint.h>  // fixed width integers
+#include <string.h>  // memset
+
+
+/*
+ *  Common part of checkpoint formats of generators (packed state).
+ *
+ *  Packed state starts with PACK_HEADER, followed by the header fields and
+ *  stream arrays of the generator, padded with zeros to a multiple of
+ *  8 bytes. Buffers have to be 8-byte aligned, packed generators can be
+ *  placed back to back.
+ */
+struct PACK_HEADER
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t rng_type;
+    int32_t nstreams;
+};
+
+
+/*!
+ *  \brief Round size of packed state up to a multiple of 8 bytes.
+ */
+inline static int pack_align(const int size)
+{
+    return (size + 7) & ~7;
+}
+
+
+/*!
+ *  \brief Check buffer for packed state of nbytes bytes, clears padding.
+ *
+ *  Returns nbytes or -1 on error.
+ */
+inline static int pack_check(void * const buffer, const int size, const int nbytes)
+{
+    if (!buffer || ((uintptr_t)buffer & 0x7)) {
+        printf("ERROR: buffer for packed state is invalid or not aligned to 8 bytes\n");
+        return -1;
+    }
+    if (size < nbytes) {
+        printf("ERROR: buffer for packed state is too small, %d < %d\n", size, nbytes);
+        return -1;
+    }
+
+    memset((char *)buffer + nbytes - 8, 0, 8);
+
+    return nbytes;
+}
+
+
+/*!
+ *  \brief Check common header of packed state with at most max_streams streams.
+ *
+ *  Buffer has to hold at least header_size bytes (full header of generator).
+ *  Returns number of streams or -1 on error.
+ */
+inline static int pack_check_header(const void * const buffer, const int size, const uint32_t magic, const uint16_t version, const int rng_type, const int max_streams, const int header_size)
+{
+    if (!buffer || ((uintptr_t)buffer & 0x7) || size < header_size) {
+        printf("ERROR: packed state is invalid or not aligned to 8 bytes\n");
+        return -1;
+    }
+
+    const PACK_HEADER * const header = (const PACK_HEADER *)buffer;
+    if (header->magic != magic || header->version != version) {
+        printf("ERROR: packed state has unknown format or version, %u\n", (unsigned int)header->version);
+        return -1;
+    }
+    if (header->rng_type != rng_type) {
+        printf("ERROR: Unpacked ' %d ' instead of ' %d '\n", (int)header->rng_type, rng_type);
+        return -1;
+    }
+    if (header->nstreams <= 0 || header->nstreams > max_streams) {
+        printf("ERROR: number of packed streams is out of range, %d\n", (int)header->nstreams);
+        return -1;
+    }
+
+    return header->nstreams;
+}
+
+
+/*!
+ *  \brief Check that packed state of size bytes holds nbytes bytes.
+ *
+ *  Returns 0 or -1 if truncated.
+ */
+inline static int pack_check_size(const int size, const int nbytes)
+{
+    if (size < nbytes) {
+        printf("ERROR: packed state is truncated, %d < %d\n", size, nbytes);
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/*!
+ *  \brief Fill common header of packed state.
+ */
+inline static void pack_header(PACK_HEADER * const header, const uint32_t magic, const uint16_t version, const int rng_type, const int n)
+{
+    header->magic = magic;
+    header->version = version;
+    header->rng_type = (uint16_t)rng_type;
+    header->nstreams = n;
+}
+
+
+#endif  // __PACK_H
+
@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <string.h>    // memset, memcpy, strerror
+#include <errno.h>     // errno
+#include <fcntl.h>     // open
+#include <unistd.h>    // write, pread, close
+#include <sys/stat.h>  // fstat
+#include <sys/mman.h>  // mmap, msync, munmap
+#include "pool.h"
+
+
+// Largest single write, Linux transfers at most 0x7FFFF000 bytes per call
+#define POOL_WRITE_CHUNK (1L << 30)
+
+
+/*
+ *  Write all bytes, retries partial writes.
+ */
+static int write_all(const int fd, const char *buf, size_t nbytes)
+{
+    while (nbytes > 0) {
+        const size_t len = (nbytes < (size_t)POOL_WRITE_CHUNK) ? nbytes : (size_t)POOL_WRITE_CHUNK;
+        const ssize_t ret = write(fd, buf, len);
+        if (ret < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        buf += ret;
+        nbytes -= (size_t)ret;
+    }
+    return 0;
+}
+
+
+/*
+ *  Size in bytes of a pool file.
+ */
+static size_t pool_size(const POOL_HEADER * const header)
+{ return POOL_ALIGN + (size_t)header->ngens * (size_t)header->state_size; }
+
+
+int pool_save(const char * const fname, const POOL_HEADER * const header, const void * const states, const long int ngens)
+{
+    if (!fname || !header || header->state_size <= 0 || (!states && ngens > 0) || ngens < 0) {
+        printf("ERROR: invalid arguments for pool file\n");
+        return -1;
+    }
+
+    const int fd = open(fname, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        printf("ERROR: failed to create pool file %s, %s\n", fname, strerror(errno));
+        return -1;
+    }
+
+    // Header page, padding is zeroed
+    char page[POOL_ALIGN];
+    POOL_HEADER hdr = *header;
+    hdr.ngens = ngens;
+    memset(page, 0, sizeof(page));
+    memcpy(page, &hdr, sizeof(hdr));
+
+    if (write_all(fd, page, sizeof(page)) || write_all(fd, (const char *)states, (size_t)ngens * (size_t)hdr.state_size)) {
+        printf("ERROR: failed to write pool file %s, %s\n", fname, strerror(errno));
+        close(fd);
+        return -1;
+    }
+
+    if (close(fd)) {
+        printf("ERROR: failed to close pool file %s, %s\n", fname, strerror(errno));
+        return -1;
+    }
+
+    return 0;
+}
+
+
+void * pool_map(const char * const fname, const POOL_HEADER * const header, long int * const ngens, const int shared)
+{
+    if (!fname || !header) {
+        printf("ERROR: invalid arguments for pool file\n");
+        return NULL;
+    }
+
+    const int fd = open(fname, (shared) ? O_RDWR : O_RDONLY);
+    if (fd < 0) {
+        printf("ERROR: failed to open pool file %s, %s\n", fname, strerror(errno));
+        return NULL;
+    }
+
+    // Validate header before mapping
+    POOL_HEADER hdr;
+    struct stat st;
+    if (fstat(fd, &st) || pread(fd, &hdr, sizeof(hdr), 0) != (ssize_t)sizeof(hdr)) {
+        printf("ERROR: failed to read pool file %s\n", fname);
+        close(fd);
+        return NULL;
+    }
+
+    if (hdr.magic != POOL_MAGIC || hdr.version != POOL_VERSION) {
+        printf("ERROR: pool file has unknown format or version, %u\n", (unsigned int)hdr.version);
+        close(fd);
+        return NULL;
+    }
+    if (hdr.rng_type != header->rng_type || hdr.width_bytes != header->width_bytes || hdr.long_sprng != header->long_sprng
+        || hdr.nstreams != header->nstreams || hdr.state_size != header->state_size) {
+        printf("ERROR: pool file was written by a different build, type %d, width %d, long %d, streams %d, size %d\n",
+               (int)hdr.rng_type, (int)hdr.width_bytes, (int)hdr.long_sprng, (int)hdr.nstreams, (int)hdr.state_size);
+        close(fd);
+        return NULL;
+    }
+    if (hdr.state_size <= 0) {
+        printf("ERROR: pool file has invalid engine size, %d\n", (int)hdr.state_size);
+        close(fd);
+        return NULL;
+    }
+    // Number of engines is checked against file size without computing
+    // ngens * state_size, a corrupt header could overflow the product
+    if (hdr.ngens <= 0 || st.st_size < (off_t)POOL_ALIGN || hdr.ngens > (int64_t)((st.st_size - POOL_ALIGN) / hdr.state_size)) {
+        printf("ERROR: pool file is empty or truncated, %ld engines\n", (long int)hdr.ngens);
+        close(fd);
+        return NULL;
+    }
+
+    void * const base = mmap(NULL, pool_size(&hdr), PROT_READ | PROT_WRITE, (shared) ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        printf("ERROR: failed to map pool file %s, %s\n", fname, strerror(errno));
+        return NULL;
+    }
+
+    if (ngens)
+        *ngens = (long int)hdr.ngens;
+
+    return (char *)base + POOL_ALIGN;
+}
+
+
+int pool_sync(void * const states)
+{
+    if (!states)
+        return -1;
+
+    void * const base = (char *)states - POOL_ALIGN;
+    if (msync(base, pool_size((const POOL_HEADER *)base), MS_SYNC)) {
+        printf("ERROR: failed to write back pool file, %s\n", strerror(errno));
+        return -1;
+    }
+
+    return 0;
+}
+
+
+int pool_unmap(void * const states)
+{
+    if (!states)
+        return -1;
+
+    void * const base = (char *)states - POOL_ALIGN;
+    if (munmap(base, pool_size((const POOL_HEADER *)base))) {
+        printf("ERROR: failed to unmap pool file, %s\n", strerror(errno));
+        return -1;
+    }
+
+    return 0;
+}
+
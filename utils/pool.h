@@ -0,0 +1,90 @@
+#ifndef __POOL_H
+#define __POOL_H
+
+
+#include <stdint.h>  // fixed width integers
+
+
+/*
+ *  Checkpoint file of a pool of generators, version 1.
+ *
+ *  Raw image of an array of generator engines, preceded by a header that
+ *  identifies the build that wrote it:
+ *
+ *    POOL_HEADER        padded to POOL_ALIGN bytes
+ *    engine[ngens]      state_size bytes per engine
+ *
+ *  A file is only mapped by a build with the same generator type, SIMD width,
+ *  LONG_SPRNG flag, lanes, and engine size, engines are then used in place
+ *  without parsing. Engines have to be plain state (no pointers). Files are
+ *  in host byte order, they are not portable across architectures.
+ */
+#define POOL_ALIGN 4096
+
+const uint32_t POOL_MAGIC = 0x4C4F4F50U;  /*!< "POOL" */
+const uint16_t POOL_VERSION = 1;
+
+
+struct POOL_HEADER
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t rng_type;
+    int32_t width_bytes;  /*!< SIMD_WIDTH_BYTES of engines */
+    int32_t long_sprng;   /*!< LONG_SPRNG was defined */
+    int32_t nstreams;     /*!< streams (lanes) per engine */
+    int32_t state_size;   /*!< sizeof engine */
+    int64_t ngens;
+};
+
+
+/*!
+ *  \brief Header for engines of the calling build.
+ *
+ *  Inline so that LONG_SPRNG is the one of the translation unit that owns the engines.
+ */
+inline static POOL_HEADER pool_header(const int rng_type, const int width_bytes, const int nstreams, const int state_size)
+{
+    POOL_HEADER header;
+    header.magic = POOL_MAGIC;
+    header.version = POOL_VERSION;
+    header.rng_type = (uint16_t)rng_type;
+    header.width_bytes = width_bytes;
+#if defined(LONG_SPRNG)
+    header.long_sprng = 1;
+#else
+    header.long_sprng = 0;
+#endif
+    header.nstreams = nstreams;
+    header.state_size = state_size;
+    header.ngens = 0;
+    return header;
+}
+
+
+/*!
+ *  Write engines to a pool file, replaces file if it exists.
+ *  Returns 0 on success, -1 on error.
+ */
+int pool_save(const char * const, const POOL_HEADER * const, const void * const, const long int);
+
+/*!
+ *  Map engines of a pool file, header has to match that of file (except ngens).
+ *  Private mappings are copy-on-write, shared mappings update file in place.
+ *  Returns first engine (aligned to POOL_ALIGN) and number of engines, NULL on error.
+ */
+void * pool_map(const char * const, const POOL_HEADER * const, long int * const, const int = 0);
+
+/*!
+ *  Write back engines of a shared mapping to file.
+ */
+int pool_sync(void * const);
+
+/*!
+ *  Unmap engines returned by pool_map.
+ */
+int pool_unmap(void * const);
+
+
+#endif  // __POOL_H
+
@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h> // posix_memalign
+#include <string.h> // memset
+#include "registry.h"
+
+
+// Size of registries, avoids false sharing between threads
+#define REGISTRY_LINE_SZ 64
+
+
+/*
+ *  Registry of a single thread, owned by at most one thread at a time.
+ */
+struct GEN_REGISTRY::SLOT
+{
+    volatile long int count;
+    volatile int in_use;
+    GEN_REGISTRY *owner;
+    SLOT *next;
+};
+
+
+/*!
+ *  \brief Update number of generators from calling thread.
+ *
+ *  Only the owner thread writes its registry, no atomic operations are needed.
+ *  If a registry is not available, update is applied to the retired count.
+ */
+void GEN_REGISTRY::add(const int n)
+{
+    SLOT * const slot = get_slot();
+    if (slot)
+        slot->count += n;
+    else
+        __sync_fetch_and_add(&retired, (long int)n);
+}
+
+
+/*!
+ *  \brief Aggregate number of generators of all threads.
+ *
+ *  Updates concurrent with the call may or may not be included.
+ */
+int GEN_REGISTRY::count() const
+{
+    long int ngens = retired;
+    for (const SLOT *slot = slots; slot; slot = slot->next)
+        ngens += slot->count;
+
+    return (int)ngens;
+}
+
+
+/*!
+ *  \brief Registry of calling thread, acquired on first use.
+ *
+ *  A free registry (from a thread that exited) is reused before
+ *  allocating a new one. Registries are pushed without locks.
+ */
+GEN_REGISTRY::SLOT * GEN_REGISTRY::get_slot()
+{
+    // Create thread key once, other threads wait for it
+    if (state != 2) {
+        if (__sync_bool_compare_and_swap(&state, 0, 1)) {
+            if (pthread_key_create(&key, retire_slot)) {
+                printf("ERROR: failed to create thread key for generator registry\n");
+                state = 3;
+            }
+            else {
+                __sync_synchronize();
+                state = 2;
+            }
+        }
+        while (state == 1)
+            ;
+        if (state != 2)
+            return NULL;
+    }
+
+    SLOT *slot = (SLOT *)pthread_getspecific(key);
+    if (slot)
+        return slot;
+
+    for (slot = slots; slot; slot = slot->next)
+        if (!slot->in_use && __sync_bool_compare_and_swap(&slot->in_use, 0, 1))
+            break;
+
+    if (!slot) {
+        void *ptr = NULL;
+        if (posix_memalign(&ptr, REGISTRY_LINE_SZ, (sizeof(SLOT) > REGISTRY_LINE_SZ) ? sizeof(SLOT) : REGISTRY_LINE_SZ)) {
+            printf("ERROR: failed to allocate generator registry\n");
+            return NULL;
+        }
+        memset(ptr, 0, REGISTRY_LINE_SZ);
+        slot = (SLOT *)ptr;
+        slot->in_use = 1;
+        slot->owner = this;
+        do {
+            slot->next = slots;
+        } while (!__sync_bool_compare_and_swap(&slots, slot->next, slot));
+    }
+
+    if (pthread_setspecific(key, slot)) {
+        slot->in_use = 0;
+        return NULL;
+    }
+
+    return slot;
+}
+
+
+/*!
+ *  \brief Fold registry of an exiting thread into the retired count.
+ *
+ *  Registry is cleared before the retired count is updated, count() reads
+ *  the retired count first so that generators are never counted twice.
+ */
+void GEN_REGISTRY::retire_slot(void *ptr)
+{
+    SLOT * const slot = (SLOT *)ptr;
+    const long int n = slot->count;
+
+    __sync_fetch_and_sub(&slot->count, n);
+    __sync_fetch_and_add(&slot->owner->retired, n);
+    __sync_synchronize();
+    slot->in_use = 0;
+}
+
@@ -0,0 +1,44 @@
+#ifndef __REGISTRY_H
+#define __REGISTRY_H
+
+
+#include <pthread.h>  // pthread_key_t
+
+
+/*! \class GEN_REGISTRY
+ *  \brief Count of live generators using per-thread registries.
+ *
+ *  Each thread updates a private counter placed in its own cache line,
+ *  so generators created concurrently from many threads do not contend
+ *  on a shared counter. Counters are aggregated lazily by count().
+ *  Generators can be destroyed from a thread other than the one that
+ *  created them, per-thread counters can be negative but the aggregate
+ *  is exact once all updates completed. Registries of threads that exit
+ *  are folded into a retired count and reused by new threads.
+ *
+ *  NOTE: objects have to be of static storage duration. There is no
+ *  constructor, state is zero-initialized before any dynamic initialization
+ *  and set up on first use, so counts are valid from other static objects.
+ *  Registries are never released.
+ */
+class GEN_REGISTRY
+{
+  public:
+    void add(const int = 1);
+    int count() const;
+
+  private:
+    struct SLOT;
+
+    SLOT * volatile slots;
+    volatile long int retired;
+    volatile int state;
+    pthread_key_t key;
+
+    SLOT * get_slot();
+    static void retire_slot(void *);
+};
+
+
+#endif  // __REGISTRY_H
+
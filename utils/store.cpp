@@ -0,0 +1,201 @@
+#include <string.h> // memcpy
+#include "simd.h"
+#include "store.h"
+
+
+// Host byte order, big-endian hosts copy words unchanged
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+#if (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define STORE_BIG_ENDIAN
+#endif
+#endif
+
+
+inline static unsigned int bswap_32(const unsigned int a)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap32(a);
+#else
+    return (a >> 24) | ((a >> 8) & 0xFF00U) | ((a << 8) & 0xFF0000U) | (a << 24);
+#endif
+}
+
+
+inline static unsigned long int bswap_64(const unsigned long int a)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap64(a);
+#else
+    return ((unsigned long int)bswap_32((unsigned int)a) << 32) | bswap_32((unsigned int)(a >> 32));
+#endif
+}
+
+
+/*
+ *  Reverse bytes of n 32-bit words, source and destination can be unaligned.
+ *  Same conversion is used for store and load, of arrays and single words.
+ */
+static void convert_array_32(const unsigned char * const src, const int n, unsigned char * const dst)
+{
+#if defined(STORE_BIG_ENDIAN)
+    memcpy(dst, src, (size_t)n * 4);
+#else
+    int i = 0;
+
+#if defined(SIMD_MODE)
+    for (; i <= n - SIMD_STREAMS_32; i += SIMD_STREAMS_32) {
+        const SIMD_INT va = simd_loadu((const unsigned int *)(src + 4 * i));
+        simd_storeu((unsigned int *)(dst + 4 * i), simd_shuffle_i32(va, BSWAP32));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        unsigned int a;
+        memcpy(&a, src + 4 * i, 4);
+        a = bswap_32(a);
+        memcpy(dst + 4 * i, &a, 4);
+    }
+#endif
+}
+
+
+/*
+ *  Reverse bytes of n 64-bit words, source and destination can be unaligned.
+ */
+static void convert_array_64(const unsigned char * const src, const int n, unsigned char * const dst)
+{
+#if defined(STORE_BIG_ENDIAN)
+    memcpy(dst, src, (size_t)n * 8);
+#else
+    int i = 0;
+
+#if defined(SIMD_MODE)
+    for (; i <= n - SIMD_STREAMS_64; i += SIMD_STREAMS_64) {
+        const SIMD_INT va = simd_loadu((const unsigned long int *)(src + 8 * i));
+        simd_storeu((unsigned long int *)(dst + 8 * i), simd_shuffle_i32(va, BSWAP64));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        unsigned long int a;
+        memcpy(&a, src + 8 * i, 8);
+        a = bswap_64(a);
+        memcpy(dst + 8 * i, &a, 8);
+    }
+#endif
+}
+
+
+int store_int(const unsigned int l, const int nbytes, unsigned char * const c)
+{
+    if (nbytes == 4) {
+        convert_array_32((const unsigned char *)&l, 1, c);
+        return 4;
+    }
+
+    for (int i = 0; i < nbytes; ++i)
+        c[i] = (l >> (8 * (nbytes - i - 1))) & 0xFF;
+
+    return nbytes;
+}
+
+
+int store_intarray(const unsigned int * const l, const int n, const int nbytes, unsigned char * const c)
+{
+    if (nbytes == 4) {
+        convert_array_32((const unsigned char *)l, n, c);
+        return 4 * n;
+    }
+
+    for (int i = 0; i < n; ++i)
+        store_int(l[i], nbytes, c + nbytes * i);
+
+    return nbytes * n;
+}
+
+
+int load_int(const unsigned char * const c, const int nbytes, unsigned int * const l)
+{
+    if (nbytes == 4) {
+        convert_array_32(c, 1, (unsigned char *)l);
+        return 4;
+    }
+
+    *l = 0;
+    for (int i = 0; i < nbytes; ++i)
+        *l = (*l << 8) + (c[i] & 0xFF);
+
+    return nbytes;
+}
+
+
+int load_intarray(const unsigned char * const c, const int n, const int nbytes, unsigned int * const l)
+{
+    if (nbytes == 4) {
+        convert_array_32(c, n, (unsigned char *)l);
+        return 4 * n;
+    }
+
+    for (int i = 0; i < n; ++i)
+        load_int(c + nbytes * i, nbytes, l + i);
+
+    return nbytes * n;
+}
+
+
+int store_long(const unsigned long int l, const int nbytes, unsigned char * const c)
+{
+    if (nbytes == 8) {
+        convert_array_64((const unsigned char *)&l, 1, c);
+        return 8;
+    }
+
+    for (int i = 0; i < nbytes; ++i)
+        c[i] = (l >> (8 * (nbytes - i - 1))) & 0xFF;
+
+    return nbytes;
+}
+
+
+int store_longarray(const unsigned long int * const l, const int n, const int nbytes, unsigned char * const c)
+{
+    if (nbytes == 8) {
+        convert_array_64((const unsigned char *)l, n, c);
+        return 8 * n;
+    }
+
+    for (int i = 0; i < n; ++i)
+        store_long(l[i], nbytes, c + nbytes * i);
+
+    return nbytes * n;
+}
+
+
+int load_long(const unsigned char * const c, const int nbytes, unsigned long int * const l)
+{
+    if (nbytes == 8) {
+        convert_array_64(c, 1, (unsigned char *)l);
+        return 8;
+    }
+
+    *l = 0;
+    for (int i = 0; i < nbytes; ++i)
+        *l = (*l << 8) + (c[i] & 0xFF);
+
+    return nbytes;
+}
+
+
+int load_longarray(const unsigned char * const c, const int n, const int nbytes, unsigned long int * const l)
+{
+    if (nbytes == 8) {
+        convert_array_64(c, n, (unsigned char *)l);
+        return 8 * n;
+    }
+
+    for (int i = 0; i < n; ++i)
+        load_long(c + nbytes * i, nbytes, l + i);
+
+    return nbytes * n;
+}
+
@@ -0,0 +1,26 @@
+#ifndef __STORE_H
+#define __STORE_H
+
+
+/*
+ *  Store/load of state words in SPRNG packed format
+ *  Numbers are stored with most significant byte first (big-endian) using
+ *  nbytes bytes per number, same wire format as SPRNG store routines.
+ *  Buffers do not need to be aligned. Functions return number of bytes
+ *  stored/loaded.
+ *
+ *  Arrays of 4-byte ints or 8-byte longs are converted a register at a time
+ *  with byte shuffles (or bswap in scalar mode), other sizes use a loop per byte.
+ */
+int store_int(const unsigned int, const int, unsigned char * const);
+int store_intarray(const unsigned int * const, const int, const int, unsigned char * const);
+int load_int(const unsigned char * const, const int, unsigned int * const);
+int load_intarray(const unsigned char * const, const int, const int, unsigned int * const);
+int store_long(const unsigned long int, const int, unsigned char * const);
+int store_longarray(const unsigned long int * const, const int, const int, unsigned char * const);
+int load_long(const unsigned char * const, const int, unsigned long int * const);
+int load_longarray(const unsigned char * const, const int, const int, unsigned long int * const);
+
+
+#endif  // __STORE_H
+
@@ -91,12 +91,35 @@ int detectGCCProcSIMD()
         support = 0;
 #endif
 #if defined(__AVX512BW__)
-    if (!CPU_SUPPORTS("avx512BW"))
+    if (!CPU_SUPPORTS("avx512bw"))
         support = 0;
 #endif
 
     return support;
 }
+
+
+/*
+ *  AVX512 mode requires F, BW, DQ, and VL extensions.
+ *  AVX and AVX2 modes also require FMA.
+ */
+int detectProcSIMDLevel()
+{
+    CPU_INIT_SUPPORT();
+
+    if (CPU_SUPPORTS("avx512f") && CPU_SUPPORTS("avx512bw") && CPU_SUPPORTS("avx512dq") && CPU_SUPPORTS("avx512vl") && CPU_SUPPORTS("fma"))
+        return SIMD_LEVEL_AVX512;
+    if (CPU_SUPPORTS("avx2") && CPU_SUPPORTS("fma"))
+        return SIMD_LEVEL_AVX2;
+    if (CPU_SUPPORTS("avx") && CPU_SUPPORTS("fma"))
+        return SIMD_LEVEL_AVX;
+    if (CPU_SUPPORTS("sse4.1"))
+        return SIMD_LEVEL_SSE4_1;
+    if (CPU_SUPPORTS("sse2"))
+        return SIMD_LEVEL_SSE2;
+
+    return SIMD_LEVEL_NONE;
+}
 #undef CPU_SUPPORTS
 #undef CPU_INIT_SUPPORT
 #endif
@@ -178,6 +201,26 @@ int detectPGIProcSIMD()
 #endif
 
 
+#if defined(__INTEL_COMPILER) || defined(__PGI)
+int detectProcSIMDLevel()
+{
+#if defined(__AVX512BW__)
+    return SIMD_LEVEL_AVX512;
+#elif defined(__AVX2__)
+    return SIMD_LEVEL_AVX2;
+#elif defined(__AVX__)
+    return SIMD_LEVEL_AVX;
+#elif defined(__SSE4_1__)
+    return SIMD_LEVEL_SSE4_1;
+#elif defined(__SSE2__)
+    return SIMD_LEVEL_SSE2;
+#else
+    return SIMD_LEVEL_NONE;
+#endif
+}
+#endif
+
+
 void printSysconf()
 {
     printf("Number of processors online = %ld\n", getNumProcOnline());
@@ -22,6 +22,17 @@ int detectGCCProcSIMD();
 #define detectProcSIMD() detectGCCProcSIMD()
 #endif
 
+/*!
+ *  SIMD modes in increasing order of preference
+ */
+enum SIMD_LEVEL { SIMD_LEVEL_NONE = 0, SIMD_LEVEL_SSE2, SIMD_LEVEL_SSE4_1, SIMD_LEVEL_AVX, SIMD_LEVEL_AVX2, SIMD_LEVEL_AVX512 };
+
+/*!
+ *  Detect best SIMD mode supported by CPU at runtime
+ *  Compilers without runtime detection report the SIMD mode enabled at compile time.
+ */
+int detectProcSIMDLevel();
+
 /*!
  *  Print some system configurations
  */
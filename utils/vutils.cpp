@@ -1,7 +1,3 @@
-#include "simd.h"
-#if defined(SIMD_MODE)
-
-
 #include <stdio.h>
 #include <stdlib.h> // posix_memalign
 #include <errno.h> // errno
@@ -62,33 +58,6 @@ int scalar_malloc(double ** const sa, const size_t align, const size_t nelems)
 }
 
 
-int simd_malloc(SIMD_INT ** const va, const size_t align, const size_t nelems)
-{
-    int ierr = posix_memalign((void **)va, align, nelems * sizeof(SIMD_INT));
-    if (ierr)
-        printf("ERROR: failed to allocate aligned memory, %d\n", errno);
-    return ierr;
-}
-
-
-int simd_malloc(SIMD_FLT ** const va, const size_t align, const size_t nelems)
-{
-    int ierr = posix_memalign((void **)va, align, nelems * sizeof(SIMD_FLT));
-    if (ierr)
-        printf("ERROR: failed to allocate aligned memory, %d\n", errno);
-    return ierr;
-}
-
-
-int simd_malloc(SIMD_DBL ** const va, const size_t align, const size_t nelems)
-{
-    int ierr = posix_memalign((void **)va, align, nelems * sizeof(SIMD_DBL));
-    if (ierr)
-        printf("ERROR: failed to allocate aligned memory, %d\n", errno);
-    return ierr;
-}
-
-
 void scalar_free(int ** const va)
 {
     if (va) free(*va);
@@ -131,6 +100,39 @@ void scalar_free(double ** const va)
 }
 
 
+/*
+ *  SIMD register allocation and printing
+ */
+#if defined(SIMD_MODE)
+
+
+int simd_malloc(SIMD_INT ** const va, const size_t align, const size_t nelems)
+{
+    int ierr = posix_memalign((void **)va, align, nelems * sizeof(SIMD_INT));
+    if (ierr)
+        printf("ERROR: failed to allocate aligned memory, %d\n", errno);
+    return ierr;
+}
+
+
+int simd_malloc(SIMD_FLT ** const va, const size_t align, const size_t nelems)
+{
+    int ierr = posix_memalign((void **)va, align, nelems * sizeof(SIMD_FLT));
+    if (ierr)
+        printf("ERROR: failed to allocate aligned memory, %d\n", errno);
+    return ierr;
+}
+
+
+int simd_malloc(SIMD_DBL ** const va, const size_t align, const size_t nelems)
+{
+    int ierr = posix_memalign((void **)va, align, nelems * sizeof(SIMD_DBL));
+    if (ierr)
+        printf("ERROR: failed to allocate aligned memory, %d\n", errno);
+    return ierr;
+}
+
+
 void simd_free(SIMD_INT ** const va)
 {
     if (va) free(*va);
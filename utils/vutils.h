@@ -2,10 +2,13 @@
 #define __VUTILS_H
 
 
+#include <stddef.h>  // size_t
 #include "simd.h"
-#if defined(SIMD_MODE)
 
 
+/*
+ *  Aligned allocation of scalar arrays, available in all modes
+ */
 int scalar_malloc(int ** const, const size_t, const size_t);
 int scalar_malloc(unsigned int ** const, const size_t, const size_t);
 int scalar_malloc(long int ** const, const size_t, const size_t);
@@ -18,6 +21,9 @@ void scalar_free(long int ** const);
 void scalar_free(unsigned long int ** const);
 void scalar_free(float ** const);
 void scalar_free(double ** const);
+
+
+#if defined(SIMD_MODE)
 int simd_malloc(SIMD_INT ** const, const size_t, const size_t);
 int simd_malloc(SIMD_FLT ** const, const size_t, const size_t);
 int simd_malloc(SIMD_DBL ** const, const size_t, const size_t);